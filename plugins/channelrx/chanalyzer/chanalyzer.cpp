@@ -23,6 +23,7 @@
 
 #include "device/deviceapi.h"
 #include "audio/audiooutput.h"
+#include "dsp/dspengine.h"
 #include "dsp/dspcommands.h"
 #include "chanalyzer.h"
 
@@ -41,7 +42,7 @@ ChannelAnalyzer::ChannelAnalyzer(DeviceAPI *deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSink = new ChannelAnalyzerBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSink, m_thread);
 
 	applySettings(m_settings, true);
 
@@ -73,14 +74,13 @@ void ChannelAnalyzer::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSink, m_thread, &m_basebandSink->getTelemetry());
 }
 
 void ChannelAnalyzer::stop()
 {
     qDebug() << "ChannelAnalyzer::stop";
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSink, m_thread);
 }
 
 bool ChannelAnalyzer::handleMessage(const Message& cmd)
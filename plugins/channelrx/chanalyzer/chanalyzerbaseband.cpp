@@ -30,7 +30,9 @@ ChannelAnalyzerBaseband::ChannelAnalyzerBaseband() :
 {
     qDebug("ChannelAnalyzerBaseband::ChannelAnalyzerBaseband");
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
+    m_telemetry.setSampleFifoCounters(&m_sampleFifo.getCounters());
     m_channelizer = new DownChannelizer(&m_sink);
+    m_channelizer->setRecorder(&m_recorder);
 
     QObject::connect(
         &m_sampleFifo,
@@ -62,6 +64,9 @@ void ChannelAnalyzerBaseband::feed(const SampleVector::const_iterator& begin, co
 void ChannelAnalyzerBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
+    unsigned int samplesDone = 0;
+
+    m_telemetry.startBlock(m_sampleFifo.fill(), m_sampleFifo.size());
 
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
@@ -83,7 +88,10 @@ void ChannelAnalyzerBaseband::handleData()
         }
 
 		m_sampleFifo.readCommit((unsigned int) count);
+		samplesDone += count;
     }
+
+    m_telemetry.endBlock(samplesDone);
 }
 
 void ChannelAnalyzerBaseband::handleInputMessages()
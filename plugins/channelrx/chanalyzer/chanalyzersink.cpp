@@ -58,10 +58,11 @@ void ChannelAnalyzerSink::feed(const SampleVector::const_iterator& begin, const
 	fftfilt::cmplx *sideband = 0;
 	Complex ci;
 
-	for (SampleVector::const_iterator it = begin; it < end; ++it)
+	m_nco.nextIQMul(begin, end, m_mixBuffer);
+
+	for (ComplexVector::const_iterator it = m_mixBuffer.begin(); it != m_mixBuffer.end(); ++it)
 	{
-		Complex c(it->real(), it->imag());
-		c *= m_nco.nextIQ();
+		const Complex& c = *it;
 
 		if (m_settings.m_rationalDownSample)
 		{
@@ -84,7 +85,7 @@ void ChannelAnalyzerSink::feed(const SampleVector::const_iterator& begin, const
 	m_sampleBuffer.clear();
 }
 
-void ChannelAnalyzerSink::processOneSample(Complex& c, fftfilt::cmplx *sideband)
+void ChannelAnalyzerSink::processOneSample(const Complex& c, fftfilt::cmplx *sideband)
 {
     int n_out;
 
@@ -63,6 +63,7 @@ private:
 	double m_magsq;
 
 	NCOF m_nco;
+	ComplexVector m_mixBuffer; //!< channel samples mixed down by m_nco
 	PhaseLockComplex m_pll;
 	FreqLockComplex m_fll;
     Interpolator m_interpolator;
@@ -80,7 +81,7 @@ private:
     BasebandSampleSink* m_sampleSink;
 
 	void setFilters(int sampleRate, float bandwidth, float lowCutoff);
-	void processOneSample(Complex& c, fftfilt::cmplx *sideband);
+	void processOneSample(const Complex& c, fftfilt::cmplx *sideband);
 
 	inline void feedOneSample(const fftfilt::cmplx& s, const fftfilt::cmplx& pll)
 	{
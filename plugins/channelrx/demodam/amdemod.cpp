@@ -52,7 +52,7 @@ AMDemod::AMDemod(DeviceAPI *deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSink = new AMDemodBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSink, m_thread);
 
 	applySettings(m_settings, true);
 
@@ -93,14 +93,13 @@ void AMDemod::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSink, m_thread, &m_basebandSink->getTelemetry());
 }
 
 void AMDemod::stop()
 {
     qDebug("AMDemod::stop");
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSink, m_thread);
 }
 
 bool AMDemod::handleMessage(const Message& cmd)
@@ -240,6 +239,21 @@ bool AMDemod::deserialize(const QByteArray& data)
     }
 }
 
+const DSPTelemetry *AMDemod::getTelemetry() const
+{
+    return &m_basebandSink->getTelemetry();
+}
+
+QObject *AMDemod::getBaseband()
+{
+    return m_basebandSink;
+}
+
+ChannelRecorder *AMDemod::getRecorder()
+{
+    return m_basebandSink->getRecorder();
+}
+
 int AMDemod::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
@@ -31,7 +31,11 @@ AMDemodBaseband::AMDemodBaseband() :
     qDebug("AMDemodBaseband::AMDemodBaseband");
 
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
+    m_sampleFifo.setWakeupThreshold(SampleSinkFifo::getWakeupThresholdPolicy(48000));
+    m_telemetry.setSampleFifoCounters(&m_sampleFifo.getCounters());
+    m_sampleFifo.setLockFree(true);
     m_channelizer = new DownChannelizer(&m_sink);
+    m_channelizer->setRecorder(&m_recorder);
 
     QObject::connect(
         &m_sampleFifo,
@@ -40,8 +44,16 @@ AMDemodBaseband::AMDemodBaseband() :
         &AMDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_basebandReader,
+        &SampleSinkRingReader::dataReady,
+        this,
+        &AMDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
+    m_telemetry.setAudioFifoCounters(&m_sink.getAudioFifo()->getCounters());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
 
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
@@ -57,6 +69,7 @@ void AMDemodBaseband::reset()
 {
     QMutexLocker mutexLocker(&m_mutex);
     m_sampleFifo.reset();
+    m_basebandReader.reset();
 }
 
 void AMDemodBaseband::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
@@ -67,6 +80,14 @@ void AMDemodBaseband::feed(const SampleVector::const_iterator& begin, const Samp
 void AMDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
+    m_sampleFifo.consumerWoken(); // the loops below may stop with samples left while messages are pending
+    unsigned int samplesDone = 0;
+
+    m_telemetry.setSampleFifoCounters(m_basebandReader.isAttached() ? &m_basebandReader.getCounters() : &m_sampleFifo.getCounters());
+    m_telemetry.startBlock(
+        m_sampleFifo.fill() + m_basebandReader.fill(),
+        m_basebandReader.isAttached() ? m_basebandReader.size() : m_sampleFifo.size()
+    );
 
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
@@ -88,7 +109,31 @@ void AMDemodBaseband::handleData()
         }
 
 		m_sampleFifo.readCommit((unsigned int) count);
+		samplesDone += count;
+    }
+
+    while ((m_basebandReader.fill() > 0) && (m_inputMessageQueue.size() == 0))
+    {
+		SampleVector::const_iterator part1begin;
+		SampleVector::const_iterator part1end;
+		SampleVector::const_iterator part2begin;
+		SampleVector::const_iterator part2end;
+
+        std::size_t count = m_basebandReader.readBegin(m_basebandReader.fill(), &part1begin, &part1end, &part2begin, &part2end);
+
+        if (part1begin != part1end) {
+            m_channelizer->feed(part1begin, part1end);
+        }
+
+		if (part2begin != part2end) {
+            m_channelizer->feed(part2begin, part2end);
+        }
+
+        m_basebandReader.readCommit((unsigned int) count);
+        samplesDone += count;
     }
+
+    m_telemetry.endBlock(samplesDone);
 }
 
 void AMDemodBaseband::handleInputMessages()
@@ -121,6 +166,7 @@ bool AMDemodBaseband::handleMessage(const Message& cmd)
         DSPSignalNotification& notif = (DSPSignalNotification&) cmd;
         qDebug() << "AMDemodBaseband::handleMessage: DSPSignalNotification: basebandSampleRate: " << notif.getSampleRate();
         m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(notif.getSampleRate()));
+        m_sampleFifo.setWakeupThreshold(SampleSinkFifo::getWakeupThresholdPolicy(notif.getSampleRate()));
         m_channelizer->setBasebandSampleRate(notif.getSampleRate());
         m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
 
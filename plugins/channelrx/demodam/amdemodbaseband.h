@@ -22,6 +22,9 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/dsptelemetry.h"
+#include "dsp/channelrecorder.h"
+#include "dsp/samplesinkring.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -60,7 +63,10 @@ public:
     ~AMDemodBaseband();
     void reset();
     void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    SampleSinkRingReader *getBasebandReader() { return &m_basebandReader; }
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
+    const DSPTelemetry& getTelemetry() const { return m_telemetry; } //!< handleData loop counters
+    ChannelRecorder *getRecorder() { return &m_recorder; } //!< Recording tap after the channelizer
     int getChannelSampleRate() const;
     void getMagSqLevels(double& avg, double& peak, int& nbSamples) { m_sink.getMagSqLevels(avg, peak, nbSamples); }
     bool getSquelchOpen() const { return m_sink.getSquelchOpen(); }
@@ -72,7 +78,10 @@ public:
 
 private:
     SampleSinkFifo m_sampleFifo;
+    DSPTelemetry m_telemetry;
+    SampleSinkRingReader m_basebandReader; //!< in place access to the device set shared baseband
     DownChannelizer *m_channelizer;
+    ChannelRecorder m_recorder;
     AMDemodSink m_sink;
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     AMDemodSettings m_settings;
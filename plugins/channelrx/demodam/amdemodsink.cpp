@@ -40,6 +40,7 @@ AMDemodSink::AMDemodSink() :
 {
 	m_audioBuffer.resize(1<<14);
 	m_audioBufferFill = 0;
+	m_resampleBuffer.resize(Interpolator::BlockSize);
 
 	m_magsq = 0.0;
 
@@ -64,29 +65,36 @@ AMDemodSink::~AMDemodSink()
 
 void AMDemodSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
-	Complex ci;
+	m_nco.nextIQMul(begin, end, m_mixBuffer);
+	const Complex *in = m_mixBuffer.data();
+	int nbIn = m_mixBuffer.size();
 
-	for (SampleVector::const_iterator it = begin; it != end; ++it)
+	while (nbIn > 0)
 	{
-		Complex c(it->real(), it->imag());
-		c *= m_nco.nextIQ();
+		int nbConsumed;
+		int nbOut;
 
 		if (m_interpolatorDistance < 1.0f) // interpolate
 		{
-		    while (!m_interpolator.interpolate(&m_interpolatorDistanceRemain, c, &ci))
-            {
-                processOneSample(ci);
-                m_interpolatorDistanceRemain += m_interpolatorDistance;
-            }
+			nbOut = m_interpolator.interpolate(&m_interpolatorDistanceRemain, m_interpolatorDistance,
+				in, nbIn, m_resampleBuffer.data(), m_resampleBuffer.size(), nbConsumed);
 		}
 		else // decimate
 		{
-	        if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
-	        {
-	            processOneSample(ci);
-	            m_interpolatorDistanceRemain += m_interpolatorDistance;
-	        }
+			nbOut = m_interpolator.decimate(&m_interpolatorDistanceRemain, m_interpolatorDistance,
+				in, nbIn, m_resampleBuffer.data(), m_resampleBuffer.size(), nbConsumed);
+		}
+
+		if ((nbOut == 0) && (nbConsumed == 0)) {
+			break;
 		}
+
+		for (int i = 0; i < nbOut; i++) {
+			processOneSample(m_resampleBuffer[i]);
+		}
+
+		in += nbConsumed;
+		nbIn -= nbConsumed;
 	}
 
 	if (m_audioBufferFill > 0)
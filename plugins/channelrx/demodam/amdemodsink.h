@@ -91,6 +91,8 @@ private:
     uint32_t m_audioSampleRate;
 
 	NCO m_nco;
+	ComplexVector m_mixBuffer; //!< channel samples mixed down by m_nco
+	ComplexVector m_resampleBuffer; //!< m_mixBuffer samples at audio rate
 	Interpolator m_interpolator;
 	Real m_interpolatorDistance;
 	Real m_interpolatorDistanceRemain;
@@ -43,7 +43,7 @@ ATVDemod::ATVDemod(DeviceAPI *deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSink = new ATVDemodBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSink, m_thread);
 
     applySettings(m_settings, true);
 
@@ -69,14 +69,13 @@ void ATVDemod::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSink, m_thread, &m_basebandSink->getTelemetry());
 }
 
 void ATVDemod::stop()
 {
     qDebug("ATVDemod::stop");
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSink, m_thread);
 }
 
 void ATVDemod::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool firstOfBurst)
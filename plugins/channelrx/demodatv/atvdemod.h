@@ -78,6 +78,10 @@ public:
 
     virtual int getNbSinkStreams() const { return 1; }
     virtual int getNbSourceStreams() const { return 0; }
+    virtual const DSPTelemetry *getTelemetry() const { return &m_basebandSink->getTelemetry(); }
+    virtual ChannelRecorder *getRecorder() { return m_basebandSink->getRecorder(); }
+    virtual QThread *getBasebandThread() { return m_thread; }
+    virtual QObject *getBaseband() { return m_basebandSink; }
 
     virtual qint64 getStreamCenterFrequency(int streamIndex, bool sinkElseSource) const
     {
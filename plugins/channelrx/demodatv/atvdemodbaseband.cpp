@@ -31,7 +31,9 @@ ATVDemodBaseband::ATVDemodBaseband() :
 {
     qDebug("ATVDemodBaseband::ATVDemodBaseband");
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
+    m_telemetry.setSampleFifoCounters(&m_sampleFifo.getCounters());
     m_channelizer = new DownChannelizer(&m_sink);
+    m_channelizer->setRecorder(&m_recorder);
 
     QObject::connect(
         &m_sampleFifo,
@@ -63,6 +65,9 @@ void ATVDemodBaseband::feed(const SampleVector::const_iterator& begin, const Sam
 void ATVDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
+    unsigned int samplesDone = 0;
+
+    m_telemetry.startBlock(m_sampleFifo.fill(), m_sampleFifo.size());
 
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
@@ -84,7 +89,10 @@ void ATVDemodBaseband::handleData()
         }
 
 		m_sampleFifo.readCommit((unsigned int) count);
+		samplesDone += count;
     }
+
+    m_telemetry.endBlock(samplesDone);
 }
 
 void ATVDemodBaseband::handleInputMessages()
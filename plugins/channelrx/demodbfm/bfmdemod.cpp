@@ -54,7 +54,7 @@ BFMDemod::BFMDemod(DeviceAPI *deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSink = new BFMDemodBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSink, m_thread);
 
 	applySettings(m_settings, true);
 
@@ -96,14 +96,13 @@ void BFMDemod::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSink, m_thread, &m_basebandSink->getTelemetry());
 }
 
 void BFMDemod::stop()
 {
     qDebug() << "BFMDemod::stop";
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSink, m_thread);
 }
 
 bool BFMDemod::handleMessage(const Message& cmd)
@@ -235,6 +234,21 @@ bool BFMDemod::deserialize(const QByteArray& data)
     }
 }
 
+const DSPTelemetry *BFMDemod::getTelemetry() const
+{
+    return &m_basebandSink->getTelemetry();
+}
+
+QObject *BFMDemod::getBaseband()
+{
+    return m_basebandSink;
+}
+
+ChannelRecorder *BFMDemod::getRecorder()
+{
+    return m_basebandSink->getRecorder();
+}
+
 int BFMDemod::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
@@ -109,6 +109,11 @@ public:
 
     RDSParser& getRDSParser() { return m_basebandSink->getRDSParser(); }
 
+    virtual const DSPTelemetry *getTelemetry() const;
+    virtual ChannelRecorder *getRecorder();
+    virtual QThread *getBasebandThread() { return m_thread; }
+    virtual QObject *getBaseband();
+
     virtual int webapiSettingsGet(
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage);
@@ -31,7 +31,9 @@ BFMDemodBaseband::BFMDemodBaseband() :
     m_messageQueueToGUI(nullptr)
 {
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
+    m_telemetry.setSampleFifoCounters(&m_sampleFifo.getCounters());
     m_channelizer = new DownChannelizer(&m_sink);
+    m_channelizer->setRecorder(&m_recorder);
 
     qDebug("BFMDemodBaseband::BFMDemodBaseband");
     QObject::connect(
@@ -43,6 +45,7 @@ BFMDemodBaseband::BFMDemodBaseband() :
     );
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
+    m_telemetry.setAudioFifoCounters(&m_sink.getAudioFifo()->getCounters());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
 
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
@@ -68,6 +71,9 @@ void BFMDemodBaseband::feed(const SampleVector::const_iterator& begin, const Sam
 void BFMDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
+    unsigned int samplesDone = 0;
+
+    m_telemetry.startBlock(m_sampleFifo.fill(), m_sampleFifo.size());
 
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
@@ -89,7 +95,10 @@ void BFMDemodBaseband::handleData()
         }
 
 		m_sampleFifo.readCommit((unsigned int) count);
+		samplesDone += count;
     }
+
+    m_telemetry.endBlock(samplesDone);
 }
 
 void BFMDemodBaseband::handleInputMessages()
@@ -22,6 +22,8 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/dsptelemetry.h"
+#include "dsp/channelrecorder.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -61,6 +63,8 @@ public:
     void reset();
     void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
+    const DSPTelemetry& getTelemetry() const { return m_telemetry; } //!< handleData loop counters
+    ChannelRecorder *getRecorder() { return &m_recorder; } //!< Recording tap after the channelizer
     int getChannelSampleRate() const;
     void setBasebandSampleRate(int sampleRate);
     void setSpectrumSink(BasebandSampleSink* spectrumSink) { m_sink.setSpectrumSink(spectrumSink); }
@@ -81,7 +85,9 @@ public:
 
 private:
     SampleSinkFifo m_sampleFifo;
+    DSPTelemetry m_telemetry;
     DownChannelizer *m_channelizer;
+    ChannelRecorder m_recorder;
     BFMDemodSink m_sink;
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     BFMDemodSettings m_settings;
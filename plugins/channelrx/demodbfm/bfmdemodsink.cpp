@@ -94,10 +94,11 @@ void BFMDemodSink::feed(const SampleVector::const_iterator& begin, const SampleV
 
 	m_sampleBuffer.clear();
 
-	for (SampleVector::const_iterator it = begin; it != end; ++it)
+	m_nco.nextIQMul(begin, end, m_mixBuffer, 1.0f / SDR_RX_SCALEF);
+
+	for (ComplexVector::const_iterator it = m_mixBuffer.begin(); it != m_mixBuffer.end(); ++it)
 	{
-		Complex c(it->real() / SDR_RX_SCALEF, it->imag() / SDR_RX_SCALEF);
-		c *= m_nco.nextIQ();
+		const Complex& c = *it;
 
 		rf_out = m_rfFilter->runFilt(c, &rf); // filter RF before demod
 
@@ -113,6 +113,7 @@ private:
 	SampleVector m_sampleBuffer;
 
 	NCO m_nco;
+	ComplexVector m_mixBuffer; //!< channel samples mixed down by m_nco
 	Interpolator m_interpolator; //!< Interpolator between fixed demod bandwidth and audio bandwidth (rational)
 	Real m_interpolatorDistance;
 	Real m_interpolatorDistanceRemain;
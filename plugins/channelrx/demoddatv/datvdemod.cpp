@@ -19,6 +19,7 @@
 
 #include <QDebug>
 
+#include "dsp/dspengine.h"
 #include "device/deviceapi.h"
 
 #include "datvdemod.h"
@@ -37,7 +38,7 @@ DATVDemod::DATVDemod(DeviceAPI *deviceAPI) :
     setObjectName("DATVDemod");
     m_thread = new QThread(this);
     m_basebandSink = new DATVDemodBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSink, m_thread);
 
     applySettings(m_settings, true);
 
@@ -70,14 +71,13 @@ void DATVDemod::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSink, m_thread, &m_basebandSink->getTelemetry());
 }
 
 void DATVDemod::stop()
 {
     qDebug("DATVDemod::stop");
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSink, m_thread);
 }
 
 bool DATVDemod::handleMessage(const Message& cmd)
@@ -22,6 +22,8 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/dsptelemetry.h"
+#include "dsp/channelrecorder.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -83,6 +85,8 @@ public:
     void reset();
     void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
+    const DSPTelemetry& getTelemetry() const { return m_telemetry; } //!< handleData loop counters
+    ChannelRecorder *getRecorder() { return &m_recorder; } //!< Recording tap after the channelizer
     int getChannelSampleRate() const;
     double getMagSq() const { return m_sink.getMagSq(); }
     void setTVScreen(TVScreen *tvScreen) { m_sink.setTVScreen(tvScreen); }
@@ -101,7 +105,9 @@ public:
 
 private:
     SampleSinkFifo m_sampleFifo;
+    DSPTelemetry m_telemetry;
     DownChannelizer *m_channelizer;
+    ChannelRecorder m_recorder;
     DATVDemodSink m_sink;
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     DATVDemodSettings m_settings;
@@ -57,7 +57,7 @@ DSDDemod::DSDDemod(DeviceAPI *deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSink = new DSDDemodBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSink, m_thread);
 
     applySettings(m_settings, true);
 
@@ -98,14 +98,13 @@ void DSDDemod::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSink, m_thread, &m_basebandSink->getTelemetry());
 }
 
 void DSDDemod::stop()
 {
     qDebug() << "DSDDemod::stop";
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSink, m_thread);
 }
 
 bool DSDDemod::handleMessage(const Message& cmd)
@@ -275,6 +274,21 @@ bool DSDDemod::deserialize(const QByteArray& data)
     }
 }
 
+const DSPTelemetry *DSDDemod::getTelemetry() const
+{
+    return &m_basebandSink->getTelemetry();
+}
+
+QObject *DSDDemod::getBaseband()
+{
+    return m_basebandSink;
+}
+
+ChannelRecorder *DSDDemod::getRecorder()
+{
+    return m_basebandSink->getRecorder();
+}
+
 int DSDDemod::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
@@ -88,6 +88,11 @@ public:
         return m_settings.m_inputFrequencyOffset;
     }
 
+    virtual const DSPTelemetry *getTelemetry() const;
+    virtual ChannelRecorder *getRecorder();
+    virtual QThread *getBasebandThread() { return m_thread; }
+    virtual QObject *getBaseband();
+
     virtual int webapiSettingsGet(
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage);
@@ -30,7 +30,9 @@ DSDDemodBaseband::DSDDemodBaseband() :
 {
     qDebug("DSDDemodBaseband::DSDDemodBaseband");
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
+    m_telemetry.setSampleFifoCounters(&m_sampleFifo.getCounters());
     m_channelizer = new DownChannelizer(&m_sink);
+    m_channelizer->setRecorder(&m_recorder);
 
     QObject::connect(
         &m_sampleFifo,
@@ -41,6 +43,7 @@ DSDDemodBaseband::DSDDemodBaseband() :
     );
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo1(), getInputMessageQueue());
+    m_telemetry.setAudioFifoCounters(&m_sink.getAudioFifo1()->getCounters());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo2(), getInputMessageQueue());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
@@ -69,6 +72,9 @@ void DSDDemodBaseband::feed(const SampleVector::const_iterator& begin, const Sam
 void DSDDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
+    unsigned int samplesDone = 0;
+
+    m_telemetry.startBlock(m_sampleFifo.fill(), m_sampleFifo.size());
 
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
@@ -90,7 +96,10 @@ void DSDDemodBaseband::handleData()
         }
 
 		m_sampleFifo.readCommit((unsigned int) count);
+		samplesDone += count;
     }
+
+    m_telemetry.endBlock(samplesDone);
 }
 
 void DSDDemodBaseband::handleInputMessages()
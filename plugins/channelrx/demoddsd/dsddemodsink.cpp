@@ -85,10 +85,11 @@ void DSDDemodSink::feed(const SampleVector::const_iterator& begin, const SampleV
 
 	m_dsdDecoder.enableMbelib(!DSPEngine::instance()->hasDVSerialSupport()); // disable mbelib if DV serial support is present and activated else enable it
 
-	for (SampleVector::const_iterator it = begin; it != end; ++it)
+	m_nco.nextIQMul(begin, end, m_mixBuffer);
+
+	for (ComplexVector::const_iterator it = m_mixBuffer.begin(); it != m_mixBuffer.end(); ++it)
 	{
-		Complex c(it->real(), it->imag());
-		c *= m_nco.nextIQ();
+		const Complex& c = *it;
 
         if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
         {
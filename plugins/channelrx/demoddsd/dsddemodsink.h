@@ -109,6 +109,7 @@ private:
     quint32 m_audioSampleRate;
 
 	NCO m_nco;
+	ComplexVector m_mixBuffer; //!< channel samples mixed down by m_nco
 	Interpolator m_interpolator;
 	Real m_interpolatorDistance;
 	Real m_interpolatorDistanceRemain;
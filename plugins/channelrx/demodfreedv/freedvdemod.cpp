@@ -48,7 +48,7 @@ FreeDVDemod::FreeDVDemod(DeviceAPI *deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSink = new FreeDVDemodBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSink, m_thread);
 
     applySettings(m_settings, true);
 
@@ -89,14 +89,13 @@ void FreeDVDemod::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSink, m_thread, &m_basebandSink->getTelemetry());
 }
 
 void FreeDVDemod::stop()
 {
     qDebug() << "FreeDVDemod::stop";
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSink, m_thread);
 }
 
 bool FreeDVDemod::handleMessage(const Message& cmd)
@@ -229,6 +228,21 @@ bool FreeDVDemod::deserialize(const QByteArray& data)
     }
 }
 
+const DSPTelemetry *FreeDVDemod::getTelemetry() const
+{
+    return &m_basebandSink->getTelemetry();
+}
+
+QObject *FreeDVDemod::getBaseband()
+{
+    return m_basebandSink;
+}
+
+ChannelRecorder *FreeDVDemod::getRecorder()
+{
+    return m_basebandSink->getRecorder();
+}
+
 int FreeDVDemod::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
@@ -111,6 +111,11 @@ public:
 	bool isSync() const { return m_basebandSink->isSync(); }
     void propagateMessageQueueToGUI() { m_basebandSink->setMessageQueueToGUI(getMessageQueueToGUI()); }
 
+    virtual const DSPTelemetry *getTelemetry() const;
+    virtual ChannelRecorder *getRecorder();
+    virtual QThread *getBasebandThread() { return m_thread; }
+    virtual QObject *getBaseband();
+
     virtual int webapiSettingsGet(
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage);
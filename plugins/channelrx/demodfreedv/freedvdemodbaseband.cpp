@@ -32,7 +32,9 @@ FreeDVDemodBaseband::FreeDVDemodBaseband() :
 {
     qDebug("FreeDVDemodBaseband::FreeDVDemodBaseband");
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
+    m_telemetry.setSampleFifoCounters(&m_sampleFifo.getCounters());
     m_channelizer = new DownChannelizer(&m_sink);
+    m_channelizer->setRecorder(&m_recorder);
 
     QObject::connect(
         &m_sampleFifo,
@@ -43,6 +45,7 @@ FreeDVDemodBaseband::FreeDVDemodBaseband() :
     );
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
+    m_telemetry.setAudioFifoCounters(&m_sink.getAudioFifo()->getCounters());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
 
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
@@ -68,6 +71,9 @@ void FreeDVDemodBaseband::feed(const SampleVector::const_iterator& begin, const
 void FreeDVDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
+    unsigned int samplesDone = 0;
+
+    m_telemetry.startBlock(m_sampleFifo.fill(), m_sampleFifo.size());
 
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
@@ -89,8 +95,11 @@ void FreeDVDemodBaseband::handleData()
         }
 
 		m_sampleFifo.readCommit((unsigned int) count);
+		samplesDone += count;
     }
 
+    m_telemetry.endBlock(samplesDone);
+
     qreal rmsLevel, peakLevel;
     int numSamples;
     m_sink.getLevels(rmsLevel, peakLevel, numSamples);
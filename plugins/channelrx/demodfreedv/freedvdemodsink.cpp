@@ -190,10 +190,11 @@ void FreeDVDemodSink::feed(const SampleVector::const_iterator& begin, const Samp
 	int decim = 1<<(m_spanLog2 - 1);
 	unsigned char decim_mask = decim - 1; // counter LSB bit mask for decimation by 2^(m_scaleLog2 - 1)
 
-	for(SampleVector::const_iterator it = begin; it < end; ++it)
+	m_nco.nextIQMul(begin, end, m_mixBuffer);
+
+	for (ComplexVector::const_iterator it = m_mixBuffer.begin(); it != m_mixBuffer.end(); ++it)
 	{
-		Complex c(it->real(), it->imag());
-		c *= m_nco.nextIQ();
+		const Complex& c = *it;
 
         if (m_interpolatorDistance < 1.0f) // interpolate
         {
@@ -169,6 +169,7 @@ private:
     bool m_audioActive;         //!< True if an audio signal is produced (no AGC or AGC and above threshold)
 
 	NCOF m_nco;
+	ComplexVector m_mixBuffer; //!< channel samples mixed down by m_nco
     Interpolator m_interpolator;
     Real m_interpolatorDistance;
     Real m_interpolatorDistanceRemain;
@@ -23,6 +23,7 @@
 #include <QDebug>
 #include <QThread>
 
+#include "dsp/dspengine.h"
 #include "dsp/dspcommands.h"
 #include "device/deviceapi.h"
 
@@ -41,7 +42,7 @@ LoRaDemod::LoRaDemod(DeviceAPI* deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSink = new LoRaDemodBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSink, m_thread);
 
 	applySettings(m_settings, true);
 
@@ -73,14 +74,13 @@ void LoRaDemod::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSink, m_thread, &m_basebandSink->getTelemetry());
 }
 
 void LoRaDemod::stop()
 {
     qDebug() << "LoRaDemod::stop";
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSink, m_thread);
 }
 
 bool LoRaDemod::handleMessage(const Message& cmd)
@@ -29,7 +29,9 @@ LoRaDemodBaseband::LoRaDemodBaseband() :
     m_mutex(QMutex::Recursive)
 {
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
+    m_telemetry.setSampleFifoCounters(&m_sampleFifo.getCounters());
     m_channelizer = new DownChannelizer(&m_sink);
+    m_channelizer->setRecorder(&m_recorder);
 
     qDebug("LoRaDemodBaseband::LoRaDemodBaseband");
     QObject::connect(
@@ -62,6 +64,9 @@ void LoRaDemodBaseband::feed(const SampleVector::const_iterator& begin, const Sa
 void LoRaDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
+    unsigned int samplesDone = 0;
+
+    m_telemetry.startBlock(m_sampleFifo.fill(), m_sampleFifo.size());
 
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
@@ -83,7 +88,10 @@ void LoRaDemodBaseband::handleData()
         }
 
 		m_sampleFifo.readCommit((unsigned int) count);
+		samplesDone += count;
     }
+
+    m_telemetry.endBlock(samplesDone);
 }
 
 void LoRaDemodBaseband::handleInputMessages()
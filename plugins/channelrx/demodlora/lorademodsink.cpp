@@ -224,10 +224,11 @@ void LoRaDemodSink::feed(const SampleVector::const_iterator& begin, const Sample
 
 	m_sampleBuffer.clear();
 
-	for (SampleVector::const_iterator it = begin; it < end; ++it)
+	m_nco.nextIQMul(begin, end, m_mixBuffer, 1.0f / SDR_RX_SCALEF);
+
+	for (ComplexVector::const_iterator it = m_mixBuffer.begin(); it != m_mixBuffer.end(); ++it)
 	{
-		Complex c(it->real() / SDR_RX_SCALEF, it->imag() / SDR_RX_SCALEF);
-		c *= m_nco.nextIQ();
+		const Complex& c = *it;
 
 		if (m_interpolator.decimate(&m_sampleDistanceRemain, c, &ci))
 		{
@@ -62,6 +62,7 @@ private:
 	short* finetune;
 
 	NCO m_nco;
+	ComplexVector m_mixBuffer; //!< channel samples mixed down by m_nco
 	Interpolator m_interpolator;
 	Real m_sampleDistanceRemain;
 
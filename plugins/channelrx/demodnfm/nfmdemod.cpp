@@ -34,6 +34,7 @@
 #include "dsp/dspengine.h"
 #include "dsp/dspcommands.h"
 #include "dsp/devicesamplemimo.h"
+#include "dsp/dspdevicesourceengine.h"
 #include "device/deviceapi.h"
 #include "util/db.h"
 
@@ -56,7 +57,12 @@ NFMDemod::NFMDemod(DeviceAPI *devieAPI) :
 
     m_thread = new QThread(this);
     m_basebandSink = new NFMDemodBaseband();
-    m_basebandSink->moveToThread(m_thread);
+
+    if (m_deviceAPI->getDeviceSourceEngine()) {
+        m_basebandSink->setDeviceEngineQueue(m_deviceAPI->getDeviceSourceEngine()->getInputMessageQueue());
+    }
+
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSink, m_thread);
 
 	applySettings(m_settings, true);
 
@@ -97,14 +103,13 @@ void NFMDemod::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSink, m_thread, &m_basebandSink->getTelemetry());
 }
 
 void NFMDemod::stop()
 {
     qDebug() << "NFMDemod::stop";
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSink, m_thread);
 }
 
 bool NFMDemod::handleMessage(const Message& cmd)
@@ -152,6 +157,7 @@ void NFMDemod::applySettings(const NFMDemodSettings& settings, bool force)
             << " m_audioMute: " << settings.m_audioMute
             << " m_audioDeviceName: " << settings.m_audioDeviceName
             << " m_streamIndex: " << settings.m_streamIndex
+            << " m_sharedChannelizer: " << settings.m_sharedChannelizer
             << " m_useReverseAPI: " << settings.m_useReverseAPI
             << " m_reverseAPIAddress: " << settings.m_reverseAPIAddress
             << " m_reverseAPIPort: " << settings.m_reverseAPIPort
@@ -206,6 +212,9 @@ void NFMDemod::applySettings(const NFMDemodSettings& settings, bool force)
     if ((settings.m_audioDeviceName != m_settings.m_audioDeviceName) || force) {
         reverseAPIKeys.append("audioDeviceName");
     }
+    if ((settings.m_sharedChannelizer != m_settings.m_sharedChannelizer) || force) {
+        reverseAPIKeys.append("sharedChannelizer");
+    }
 
     if (m_settings.m_streamIndex != settings.m_streamIndex)
     {
@@ -257,6 +266,21 @@ bool NFMDemod::deserialize(const QByteArray& data)
     return success;
 }
 
+const DSPTelemetry *NFMDemod::getTelemetry() const
+{
+    return &m_basebandSink->getTelemetry();
+}
+
+QObject *NFMDemod::getBaseband()
+{
+    return m_basebandSink;
+}
+
+ChannelRecorder *NFMDemod::getRecorder()
+{
+    return m_basebandSink->getRecorder();
+}
+
 int NFMDemod::webapiSettingsGet(
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage)
@@ -345,6 +369,9 @@ void NFMDemod::webapiUpdateChannelSettings(
     if (channelSettingsKeys.contains("streamIndex")) {
         settings.m_streamIndex = response.getNfmDemodSettings()->getStreamIndex();
     }
+    if (channelSettingsKeys.contains("sharedChannelizer")) {
+        settings.m_sharedChannelizer = response.getNfmDemodSettings()->getSharedChannelizer() != 0;
+    }
     if (channelSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getNfmDemodSettings()->getUseReverseApi() != 0;
     }
@@ -402,6 +429,7 @@ void NFMDemod::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& resp
     }
 
     response.getNfmDemodSettings()->setStreamIndex(settings.m_streamIndex);
+    response.getNfmDemodSettings()->setSharedChannelizer(settings.m_sharedChannelizer ? 1 : 0);
     response.getNfmDemodSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
     if (response.getNfmDemodSettings()->getReverseApiAddress()) {
@@ -498,6 +526,9 @@ void NFMDemod::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, co
     if (channelSettingsKeys.contains("streamIndex") || force) {
         swgNFMDemodSettings->setStreamIndex(settings.m_streamIndex);
     }
+    if (channelSettingsKeys.contains("sharedChannelizer") || force) {
+        swgNFMDemodSettings->setSharedChannelizer(settings.m_sharedChannelizer ? 1 : 0);
+    }
 
     QString channelSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/channel/%4/settings")
             .arg(settings.m_reverseAPIAddress)
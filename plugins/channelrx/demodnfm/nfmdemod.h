@@ -69,6 +69,7 @@ public:
 	virtual void start();
 	virtual void stop();
 	virtual bool handleMessage(const Message& cmd);
+	virtual SampleSinkRingReader *getSharedBasebandReader() { return m_basebandSink->getBasebandReader(); }
 
     virtual void getIdentifier(QString& id) { id = objectName(); }
     virtual void getTitle(QString& title) { title = m_settings.m_title; }
@@ -87,6 +88,11 @@ public:
         return m_settings.m_inputFrequencyOffset;
     }
 
+    virtual const DSPTelemetry *getTelemetry() const;
+    virtual ChannelRecorder *getRecorder();
+    virtual QThread *getBasebandThread() { return m_thread; }
+    virtual QObject *getBaseband();
+
     virtual int webapiSettingsGet(
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage);
@@ -26,10 +26,17 @@
 MESSAGE_CLASS_DEFINITION(NFMDemodBaseband::MsgConfigureNFMDemodBaseband, Message)
 
 NFMDemodBaseband::NFMDemodBaseband() :
+    m_engineQueue(nullptr),
+    m_bandSubscribed(false),
+    m_bandSampleRate(0),
     m_mutex(QMutex::Recursive)
 {
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
+    m_sampleFifo.setWakeupThreshold(SampleSinkFifo::getWakeupThresholdPolicy(48000));
+    m_telemetry.setSampleFifoCounters(&m_sampleFifo.getCounters());
+    m_sampleFifo.setLockFree(true);
     m_channelizer = new DownChannelizer(&m_sink);
+    m_channelizer->setRecorder(&m_recorder);
 
     qDebug("NFMDemodBaseband::NFMDemodBaseband");
     QObject::connect(
@@ -39,8 +46,23 @@ NFMDemodBaseband::NFMDemodBaseband() :
         &NFMDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_basebandReader,
+        &SampleSinkRingReader::dataReady,
+        this,
+        &NFMDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
+    QObject::connect(
+        &m_bandReader,
+        &SampleSinkRingReader::dataReady,
+        this,
+        &NFMDemodBaseband::handleData,
+        Qt::QueuedConnection
+    );
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
+    m_telemetry.setAudioFifoCounters(&m_sink.getAudioFifo()->getCounters());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
 
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
@@ -56,6 +78,8 @@ void NFMDemodBaseband::reset()
 {
     QMutexLocker mutexLocker(&m_mutex);
     m_sampleFifo.reset();
+    m_basebandReader.reset();
+    m_bandReader.reset();
 }
 
 void NFMDemodBaseband::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
@@ -66,6 +90,15 @@ void NFMDemodBaseband::feed(const SampleVector::const_iterator& begin, const Sam
 void NFMDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
+    m_sampleFifo.consumerWoken(); // the loops below may stop with samples left while messages are pending
+    unsigned int samplesDone = 0;
+
+    SampleSinkRingReader *reader = m_bandSubscribed ? &m_bandReader : &m_basebandReader;
+    m_telemetry.setSampleFifoCounters(reader->isAttached() ? &reader->getCounters() : &m_sampleFifo.getCounters());
+    m_telemetry.startBlock(
+        m_sampleFifo.fill() + m_basebandReader.fill() + m_bandReader.fill(),
+        reader->isAttached() ? reader->size() : m_sampleFifo.size()
+    );
 
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
@@ -87,7 +120,60 @@ void NFMDemodBaseband::handleData()
         }
 
 		m_sampleFifo.readCommit((unsigned int) count);
+		samplesDone += count;
+    }
+
+    while ((m_basebandReader.fill() > 0) && (m_inputMessageQueue.size() == 0))
+    {
+		SampleVector::const_iterator part1begin;
+		SampleVector::const_iterator part1end;
+		SampleVector::const_iterator part2begin;
+		SampleVector::const_iterator part2end;
+
+        std::size_t count = m_basebandReader.readBegin(m_basebandReader.fill(), &part1begin, &part1end, &part2begin, &part2end);
+
+        if (part1begin != part1end) {
+            m_channelizer->feed(part1begin, part1end);
+        }
+
+        if (part2begin != part2end) {
+            m_channelizer->feed(part2begin, part2end);
+        }
+
+        m_basebandReader.readCommit((unsigned int) count);
+        samplesDone += count;
     }
+
+    while ((m_bandReader.fill() > 0) && (m_inputMessageQueue.size() == 0))
+    {
+		SampleVector::const_iterator part1begin;
+		SampleVector::const_iterator part1end;
+		SampleVector::const_iterator part2begin;
+		SampleVector::const_iterator part2end;
+
+        std::size_t count = m_bandReader.readBegin(m_bandReader.fill(), &part1begin, &part1end, &part2begin, &part2end);
+
+        if (m_bandSubscribed) // else the subscription reply is not processed yet: just release the sub-band
+        {
+            // the sub-band replaces the channelizer output also for the recording tap
+            if (part1begin != part1end)
+            {
+                m_recorder.feed(part1begin, part1end);
+                m_sink.feed(part1begin, part1end);
+            }
+
+            if (part2begin != part2end)
+            {
+                m_recorder.feed(part2begin, part2end);
+                m_sink.feed(part2begin, part2end);
+            }
+        }
+
+        m_bandReader.readCommit((unsigned int) count);
+        samplesDone += count;
+    }
+
+    m_telemetry.endBlock(samplesDone);
 }
 
 void NFMDemodBaseband::handleInputMessages()
@@ -120,11 +206,39 @@ bool NFMDemodBaseband::handleMessage(const Message& cmd)
         DSPSignalNotification& notif = (DSPSignalNotification&) cmd;
         qDebug() << "NFMDemodBaseband::handleMessage: DSPSignalNotification: basebandSampleRate: " << notif.getSampleRate();
         m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(notif.getSampleRate()));
+        m_sampleFifo.setWakeupThreshold(SampleSinkFifo::getWakeupThresholdPolicy(notif.getSampleRate()));
         m_channelizer->setBasebandSampleRate(notif.getSampleRate());
-        m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
+        applyChannelization(m_settings.m_inputFrequencyOffset);
 
 		return true;
     }
+    else if (DSPSharedChannelizerSubscription::match(cmd))
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        DSPSharedChannelizerSubscription& subscription = (DSPSharedChannelizerSubscription&) cmd;
+        m_bandSubscribed = subscription.getSubscribed();
+
+        if (m_bandSubscribed)
+        {
+            m_bandSampleRate = subscription.getBandSampleRate();
+            m_sink.applyChannelSettings(m_bandSampleRate, subscription.getBandFrequencyOffset());
+            m_channelizer->setRecorder(nullptr); // its changes must not split the recording of the sub-band
+            m_recorder.setChannelization( // the band offset is the shift of the channel from the sub-band center
+                m_bandSampleRate,
+                m_settings.m_inputFrequencyOffset - subscription.getBandFrequencyOffset(),
+                m_settings.m_inputFrequencyOffset
+            );
+        }
+        else
+        {
+            m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
+            m_channelizer->setRecorder(&m_recorder);
+        }
+
+        qDebug("NFMDemodBaseband::handleMessage: DSPSharedChannelizerSubscription: shared: %s", m_bandSubscribed ? "true" : "false");
+
+        return true;
+    }
     else
     {
         return false;
@@ -133,10 +247,12 @@ bool NFMDemodBaseband::handleMessage(const Message& cmd)
 
 void NFMDemodBaseband::applySettings(const NFMDemodSettings& settings, bool force)
 {
+    bool channelizationChanged = false;
+
     if ((settings.m_inputFrequencyOffset != m_settings.m_inputFrequencyOffset) || force)
     {
         m_channelizer->setChannelization(m_sink.getAudioSampleRate(), settings.m_inputFrequencyOffset);
-        m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
+        channelizationChanged = true;
     }
 
     if ((settings.m_audioDeviceName != m_settings.m_audioDeviceName) || force)
@@ -151,23 +267,56 @@ void NFMDemodBaseband::applySettings(const NFMDemodSettings& settings, bool forc
         {
             m_sink.applyAudioSampleRate(audioSampleRate);
             m_channelizer->setChannelization(audioSampleRate, settings.m_inputFrequencyOffset);
-            m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
+            channelizationChanged = true;
         }
     }
 
+    if ((settings.m_sharedChannelizer != m_settings.m_sharedChannelizer)
+     || (settings.m_rfBandwidth != m_settings.m_rfBandwidth) || force) {
+        channelizationChanged = true;
+    }
+
     m_sink.applySettings(settings, force);
 
     m_settings = settings;
+
+    if (channelizationChanged) {
+        applyChannelization(settings.m_inputFrequencyOffset);
+    }
+}
+
+void NFMDemodBaseband::applyChannelization(int inputFrequencyOffset)
+{
+    if (m_engineQueue)
+    {
+        // the device engine (un)subscribes from its own thread and replies with DSPSharedChannelizerSubscription
+        // the sub-band must contain the RF bandwidth the sink filters not just the audio rate
+        m_engineQueue->push(new DSPSharedChannelizerSubscribe(
+            &m_basebandReader,
+            &m_bandReader,
+            m_settings.m_sharedChannelizer,
+            inputFrequencyOffset,
+            (int) m_settings.m_rfBandwidth,
+            getInputMessageQueue()
+        ));
+    }
+
+    if (!m_settings.m_sharedChannelizer || !m_engineQueue)
+    {
+        m_bandSubscribed = false;
+        m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
+        m_channelizer->setRecorder(&m_recorder);
+    }
 }
 
 int NFMDemodBaseband::getChannelSampleRate() const
 {
-    return m_channelizer->getChannelSampleRate();
+    return m_bandSubscribed ? m_bandSampleRate : m_channelizer->getChannelSampleRate();
 }
 
 
 void NFMDemodBaseband::setBasebandSampleRate(int sampleRate)
 {
     m_channelizer->setBasebandSampleRate(sampleRate);
-    m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
+    applyChannelization(m_settings.m_inputFrequencyOffset);
 }
\ No newline at end of file
@@ -22,6 +22,9 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/dsptelemetry.h"
+#include "dsp/channelrecorder.h"
+#include "dsp/samplesinkring.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -60,7 +63,10 @@ public:
     ~NFMDemodBaseband();
     void reset();
     void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    SampleSinkRingReader *getBasebandReader() { return &m_basebandReader; }
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
+    const DSPTelemetry& getTelemetry() const { return m_telemetry; } //!< handleData loop counters
+    ChannelRecorder *getRecorder() { return &m_recorder; } //!< Recording tap after the channelizer or on the shared channelizer sub-band when subscribed
     int getChannelSampleRate() const;
     void getMagSqLevels(double& avg, double& peak, int& nbSamples) { m_sink.getMagSqLevels(avg, peak, nbSamples); }
     void setSelectedCtcssIndex(int selectedCtcssIndex) { m_sink.setSelectedCtcssIndex(selectedCtcssIndex); }
@@ -69,10 +75,18 @@ public:
     void setMessageQueueToGUI(MessageQueue *messageQueue) { m_sink.setMessageQueueToGUI(messageQueue); }
     unsigned int getAudioSampleRate() const { return m_sink.getAudioSampleRate(); }
     void setBasebandSampleRate(int sampleRate);
+    void setDeviceEngineQueue(MessageQueue *engineQueue) { m_engineQueue = engineQueue; } //!< Shared channelizer subscriptions are handled by the device engine
 
 private:
     SampleSinkFifo m_sampleFifo;
+    DSPTelemetry m_telemetry;
+    SampleSinkRingReader m_basebandReader; //!< in place access to the device set shared baseband
     DownChannelizer *m_channelizer;
+    ChannelRecorder m_recorder;
+    MessageQueue *m_engineQueue;            //!< device engine owning the shared channelizer (null if not available e.g. MIMO)
+    SampleSinkRingReader m_bandReader;      //!< sub-band samples from the shared channelizer
+    bool m_bandSubscribed;                  //!< sub-band of the shared channelizer is used instead of the channelizer
+    int m_bandSampleRate;                   //!< channel sample rate when subscribed
     NFMDemodSink m_sink;
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     NFMDemodSettings m_settings;
@@ -80,6 +94,7 @@ private:
 
     bool handleMessage(const Message& cmd);
     void applySettings(const NFMDemodSettings& settings, bool force = false);
+    void applyChannelization(int inputFrequencyOffset); //!< (un)subscribes to the shared channelizer sub-band containing the RF bandwidth
 
 private slots:
     void handleInputMessages();
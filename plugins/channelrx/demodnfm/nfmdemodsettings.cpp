@@ -55,6 +55,7 @@ void NFMDemodSettings::resetToDefaults()
     m_audioDeviceName = AudioDeviceManager::m_defaultDeviceName;
     m_highPass = true;
     m_streamIndex = 0;
+    m_sharedChannelizer = false;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -90,6 +91,7 @@ QByteArray NFMDemodSettings::serialize() const
     s.writeU32(19, m_reverseAPIDeviceIndex);
     s.writeU32(20, m_reverseAPIChannelIndex);
     s.writeS32(21, m_streamIndex);
+    s.writeBool(22, m_sharedChannelizer);
 
     return s.final();
 }
@@ -151,6 +153,7 @@ bool NFMDemodSettings::deserialize(const QByteArray& data)
         d.readU32(20, &utmp, 0);
         m_reverseAPIChannelIndex = utmp > 99 ? 99 : utmp;
         d.readS32(21, &m_streamIndex, 0);
+        d.readBool(22, &m_sharedChannelizer, false);
 
         return true;
     }
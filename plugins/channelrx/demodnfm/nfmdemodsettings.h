@@ -44,6 +44,7 @@ struct NFMDemodSettings
     QString m_audioDeviceName;
     bool m_highPass;
     int m_streamIndex; //!< MIMO channel. Not relevant when connected to SI (single Rx).
+    bool m_sharedChannelizer; //!< Use the device set polyphase channelizer when the channel fits in one of its sub-bands
     bool m_useReverseAPI;
     QString m_reverseAPIAddress;
     uint16_t m_reverseAPIPort;
@@ -71,10 +71,11 @@ void NFMDemodSink::feed(const SampleVector::const_iterator& begin, const SampleV
 {
 	Complex ci;
 
-	for (SampleVector::const_iterator it = begin; it != end; ++it)
+	m_nco.nextIQMul(begin, end, m_mixBuffer);
+
+	for (ComplexVector::const_iterator it = m_mixBuffer.begin(); it != m_mixBuffer.end(); ++it)
 	{
-		Complex c(it->real(), it->imag());
-		c *= m_nco.nextIQ();
+		const Complex& c = *it;
 
         if (m_interpolatorDistance < 1.0f) // interpolate
         {
@@ -107,6 +107,7 @@ private:
 	float m_discriCompensation; //!< compensation factor that depends on audio rate (1 for 48 kS/s)
 
 	NCO m_nco;
+	ComplexVector m_mixBuffer; //!< channel samples mixed down by m_nco
 	Interpolator m_interpolator;
 	Real m_interpolatorDistance;
 	Real m_interpolatorDistanceRemain;
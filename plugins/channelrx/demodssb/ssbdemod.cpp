@@ -54,7 +54,7 @@ SSBDemod::SSBDemod(DeviceAPI *deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSink = new SSBDemodBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSink, m_thread);
 
 	applySettings(m_settings, true);
 
@@ -95,14 +95,13 @@ void SSBDemod::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSink, m_thread, &m_basebandSink->getTelemetry());
 }
 
 void SSBDemod::stop()
 {
     qDebug() << "SSBDemod::stop";
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSink, m_thread);
 }
 
 bool SSBDemod::handleMessage(const Message& cmd)
@@ -258,6 +257,21 @@ bool SSBDemod::deserialize(const QByteArray& data)
     }
 }
 
+const DSPTelemetry *SSBDemod::getTelemetry() const
+{
+    return &m_basebandSink->getTelemetry();
+}
+
+QObject *SSBDemod::getBaseband()
+{
+    return m_basebandSink;
+}
+
+ChannelRecorder *SSBDemod::getRecorder()
+{
+    return m_basebandSink->getRecorder();
+}
+
 int SSBDemod::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
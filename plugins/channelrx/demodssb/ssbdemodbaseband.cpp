@@ -30,7 +30,9 @@ SSBDemodBaseband::SSBDemodBaseband() :
     m_mutex(QMutex::Recursive)
 {
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
+    m_telemetry.setSampleFifoCounters(&m_sampleFifo.getCounters());
     m_channelizer = new DownChannelizer(&m_sink);
+    m_channelizer->setRecorder(&m_recorder);
 
     qDebug("SSBDemodBaseband::SSBDemodBaseband");
     QObject::connect(
@@ -42,6 +44,7 @@ SSBDemodBaseband::SSBDemodBaseband() :
     );
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
+    m_telemetry.setAudioFifoCounters(&m_sink.getAudioFifo()->getCounters());
     m_audioSampleRate = DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate();
     m_sink.applyAudioSampleRate(m_audioSampleRate);
 
@@ -69,6 +72,9 @@ void SSBDemodBaseband::feed(const SampleVector::const_iterator& begin, const Sam
 void SSBDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
+    unsigned int samplesDone = 0;
+
+    m_telemetry.startBlock(m_sampleFifo.fill(), m_sampleFifo.size());
 
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
@@ -90,7 +96,10 @@ void SSBDemodBaseband::handleData()
         }
 
 		m_sampleFifo.readCommit((unsigned int) count);
+		samplesDone += count;
     }
+
+    m_telemetry.endBlock(samplesDone);
 }
 
 void SSBDemodBaseband::handleInputMessages()
@@ -57,7 +57,7 @@ WFMDemod::WFMDemod(DeviceAPI* deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSink = new WFMDemodBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSink, m_thread);
 
 	applySettings(m_settings, true);
 
@@ -99,14 +99,13 @@ void WFMDemod::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSink, m_thread, &m_basebandSink->getTelemetry());
 }
 
 void WFMDemod::stop()
 {
     qDebug() << "WFMDemod::stop";
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSink, m_thread);
 }
 
 bool WFMDemod::handleMessage(const Message& cmd)
@@ -236,6 +235,21 @@ bool WFMDemod::deserialize(const QByteArray& data)
     }
 }
 
+const DSPTelemetry *WFMDemod::getTelemetry() const
+{
+    return &m_basebandSink->getTelemetry();
+}
+
+QObject *WFMDemod::getBaseband()
+{
+    return m_basebandSink;
+}
+
+ChannelRecorder *WFMDemod::getRecorder()
+{
+    return m_basebandSink->getRecorder();
+}
+
 int WFMDemod::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
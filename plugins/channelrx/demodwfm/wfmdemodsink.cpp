@@ -65,10 +65,11 @@ void WFMDemodSink::feed(const SampleVector::const_iterator& begin, const SampleV
 	double msq;
 	float fmDev;
 
-	for (SampleVector::const_iterator it = begin; it != end; ++it)
+	m_nco.nextIQMul(begin, end, m_mixBuffer);
+
+	for (ComplexVector::const_iterator it = m_mixBuffer.begin(); it != m_mixBuffer.end(); ++it)
 	{
-		Complex c(it->real(), it->imag());
-		c *= m_nco.nextIQ();
+		const Complex& c = *it;
 
 		rf_out = m_rfFilter->runFilt(c, &rf); // filter RF before demod
 
@@ -60,7 +60,7 @@ FreqTracker::FreqTracker(DeviceAPI *deviceAPI) :
     m_thread = new QThread(this);
     m_basebandSink = new FreqTrackerBaseband();
     propagateMessageQueue(getInputMessageQueue());
-    m_basebandSink->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSink, m_thread);
 
 	applySettings(m_settings, true);
 
@@ -102,14 +102,13 @@ void FreqTracker::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSink, m_thread, &m_basebandSink->getTelemetry());
 }
 
 void FreqTracker::stop()
 {
     qDebug("FreqTracker::stop");
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSink, m_thread);
 }
 
 bool FreqTracker::handleMessage(const Message& cmd)
@@ -282,6 +281,21 @@ bool FreqTracker::deserialize(const QByteArray& data)
     }
 }
 
+const DSPTelemetry *FreqTracker::getTelemetry() const
+{
+    return &m_basebandSink->getTelemetry();
+}
+
+QObject *FreqTracker::getBaseband()
+{
+    return m_basebandSink;
+}
+
+ChannelRecorder *FreqTracker::getRecorder()
+{
+    return m_basebandSink->getRecorder();
+}
+
 int FreqTracker::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
@@ -30,7 +30,9 @@ FreqTrackerBaseband::FreqTrackerBaseband() :
     m_mutex(QMutex::Recursive)
 {
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
+    m_telemetry.setSampleFifoCounters(&m_sampleFifo.getCounters());
     m_channelizer = new DownChannelizer(&m_sink);
+    m_channelizer->setRecorder(&m_recorder);
 
     qDebug("FreqTrackerBaseband::FreqTrackerBaseband");
     QObject::connect(
@@ -63,6 +65,9 @@ void FreqTrackerBaseband::feed(const SampleVector::const_iterator& begin, const
 void FreqTrackerBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
+    unsigned int samplesDone = 0;
+
+    m_telemetry.startBlock(m_sampleFifo.fill(), m_sampleFifo.size());
 
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
@@ -84,7 +89,10 @@ void FreqTrackerBaseband::handleData()
         }
 
 		m_sampleFifo.readCommit((unsigned int) count);
+		samplesDone += count;
     }
+
+    m_telemetry.endBlock(samplesDone);
 }
 
 void FreqTrackerBaseband::handleInputMessages()
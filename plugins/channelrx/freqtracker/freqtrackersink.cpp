@@ -72,10 +72,11 @@ void FreqTrackerSink::feed(const SampleVector::const_iterator& begin, const Samp
 {
 	Complex ci;
 
-	for (SampleVector::const_iterator it = begin; it != end; ++it)
+	m_nco.nextIQMul(begin, end, m_mixBuffer);
+
+	for (ComplexVector::const_iterator it = m_mixBuffer.begin(); it != m_mixBuffer.end(); ++it)
 	{
-		Complex c(it->real(), it->imag());
-		c *= m_nco.nextIQ();
+		const Complex& c = *it;
 
 		if (m_interpolatorDistance < 1.0f) // interpolate
 		{
@@ -100,6 +100,7 @@ private:
     uint32_t m_sinkSampleRate;
 
 	NCOF m_nco;
+	ComplexVector m_mixBuffer; //!< channel samples mixed down by m_nco
     PhaseLockComplex m_pll;
     FreqLockComplex m_fll;
 	Interpolator m_interpolator;
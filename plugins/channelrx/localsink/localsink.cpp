@@ -54,7 +54,7 @@ LocalSink::LocalSink(DeviceAPI *deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSink = new LocalSinkBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSink, m_thread);
 
     applySettings(m_settings, true);
 
@@ -90,14 +90,13 @@ void LocalSink::start()
 {
 	qDebug("LocalSink::start");
     m_basebandSink->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSink, m_thread, &m_basebandSink->getTelemetry());
 }
 
 void LocalSink::stop()
 {
     qDebug("LocalSink::stop");
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSink, m_thread);
 }
 
 bool LocalSink::handleMessage(const Message& cmd)
@@ -322,6 +321,21 @@ void LocalSink::calculateFrequencyOffset(uint32_t log2Decim, uint32_t filterChai
     m_frequencyOffset = m_basebandSampleRate * shiftFactor;
 }
 
+const DSPTelemetry *LocalSink::getTelemetry() const
+{
+    return &m_basebandSink->getTelemetry();
+}
+
+QObject *LocalSink::getBaseband()
+{
+    return m_basebandSink;
+}
+
+ChannelRecorder *LocalSink::getRecorder()
+{
+    return m_basebandSink->getRecorder();
+}
+
 int LocalSink::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
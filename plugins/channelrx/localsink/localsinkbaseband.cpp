@@ -33,7 +33,9 @@ LocalSinkBaseband::LocalSinkBaseband() :
     m_mutex(QMutex::Recursive)
 {
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
+    m_telemetry.setSampleFifoCounters(&m_sampleFifo.getCounters());
     m_channelizer = new DownChannelizer(&m_sink);
+    m_channelizer->setRecorder(&m_recorder);
 
     qDebug("LocalSinkBaseband::LocalSinkBaseband");
     QObject::connect(
@@ -66,6 +68,9 @@ void LocalSinkBaseband::feed(const SampleVector::const_iterator& begin, const Sa
 void LocalSinkBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
+    unsigned int samplesDone = 0;
+
+    m_telemetry.startBlock(m_sampleFifo.fill(), m_sampleFifo.size());
 
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
@@ -87,7 +92,10 @@ void LocalSinkBaseband::handleData()
         }
 
 		m_sampleFifo.readCommit((unsigned int) count);
+		samplesDone += count;
     }
+
+    m_telemetry.endBlock(samplesDone);
 }
 
 void LocalSinkBaseband::handleInputMessages()
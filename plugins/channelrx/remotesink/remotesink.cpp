@@ -31,6 +31,7 @@
 #include "SWGChannelSettings.h"
 
 #include "util/simpleserializer.h"
+#include "dsp/dspengine.h"
 #include "dsp/dspcommands.h"
 #include "dsp/hbfilterchainconverter.h"
 #include "dsp/devicesamplemimo.h"
@@ -54,7 +55,7 @@ RemoteSink::RemoteSink(DeviceAPI *deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSink = new RemoteSinkBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSink, m_thread);
 
     applySettings(m_settings, true);
 
@@ -95,7 +96,7 @@ void RemoteSink::start()
         m_basebandSink->setBasebandSampleRate(m_basebandSampleRate);
     }
 
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSink, m_thread, &m_basebandSink->getTelemetry());
     m_basebandSink->startSender();
 }
 
@@ -103,8 +104,7 @@ void RemoteSink::stop()
 {
     qDebug("RemoteSink::stop");
     m_basebandSink->stopSender();
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSink, m_thread);
 }
 
 bool RemoteSink::handleMessage(const Message& cmd)
@@ -260,6 +260,21 @@ void RemoteSink::calculateFrequencyOffset()
     m_frequencyOffset = m_basebandSampleRate * shiftFactor;
 }
 
+const DSPTelemetry *RemoteSink::getTelemetry() const
+{
+    return &m_basebandSink->getTelemetry();
+}
+
+QObject *RemoteSink::getBaseband()
+{
+    return m_basebandSink;
+}
+
+ChannelRecorder *RemoteSink::getRecorder()
+{
+    return m_basebandSink->getRecorder();
+}
+
 int RemoteSink::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
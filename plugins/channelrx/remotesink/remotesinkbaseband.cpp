@@ -29,7 +29,9 @@ RemoteSinkBaseband::RemoteSinkBaseband() :
     m_mutex(QMutex::Recursive)
 {
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
+    m_telemetry.setSampleFifoCounters(&m_sampleFifo.getCounters());
     m_channelizer = new DownChannelizer(&m_sink);
+    m_channelizer->setRecorder(&m_recorder);
 
     qDebug("RemoteSinkBaseband::RemoteSinkBaseband");
     QObject::connect(
@@ -62,6 +64,9 @@ void RemoteSinkBaseband::feed(const SampleVector::const_iterator& begin, const S
 void RemoteSinkBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
+    unsigned int samplesDone = 0;
+
+    m_telemetry.startBlock(m_sampleFifo.fill(), m_sampleFifo.size());
 
     while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
     {
@@ -83,7 +88,10 @@ void RemoteSinkBaseband::handleData()
         }
 
 		m_sampleFifo.readCommit((unsigned int) count);
+		samplesDone += count;
     }
+
+    m_telemetry.endBlock(samplesDone);
 }
 
 void RemoteSinkBaseband::handleInputMessages()
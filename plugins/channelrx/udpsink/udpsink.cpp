@@ -51,7 +51,7 @@ UDPSink::UDPSink(DeviceAPI *deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSink = new UDPSinkBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSink, m_thread);
 
 	applySettings(m_settings, true);
 
@@ -92,14 +92,13 @@ void UDPSink::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSink, m_thread, &m_basebandSink->getTelemetry());
 }
 
 void UDPSink::stop()
 {
     qDebug() << "UDPSink::stop";
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSink, m_thread);
 }
 
 bool UDPSink::handleMessage(const Message& cmd)
@@ -259,6 +258,21 @@ bool UDPSink::deserialize(const QByteArray& data)
     }
 }
 
+const DSPTelemetry *UDPSink::getTelemetry() const
+{
+    return &m_basebandSink->getTelemetry();
+}
+
+QObject *UDPSink::getBaseband()
+{
+    return m_basebandSink;
+}
+
+ChannelRecorder *UDPSink::getRecorder()
+{
+    return m_basebandSink->getRecorder();
+}
+
 int UDPSink::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
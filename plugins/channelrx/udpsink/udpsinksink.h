@@ -93,6 +93,7 @@ private:
 	Complex m_last, m_this;
 
 	NCO m_nco;
+	ComplexVector m_mixBuffer; //!< channel samples mixed down by m_nco
 	Interpolator m_interpolator;
 	Real m_sampleDistanceRemain;
 	fftfilt* UDPFilter;
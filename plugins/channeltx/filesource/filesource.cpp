@@ -29,6 +29,7 @@
 #include "SWGFileSourceReport.h"
 
 #include "device/deviceapi.h"
+#include "dsp/dspengine.h"
 #include "dsp/dspcommands.h"
 #include "dsp/devicesamplesink.h"
 #include "dsp/hbfilterchainconverter.h"
@@ -59,7 +60,7 @@ FileSource::FileSource(DeviceAPI *deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSource = new FileSourceBaseband();
-    m_basebandSource->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSource, m_thread);
 
     applySettings(m_settings, true);
 
@@ -84,14 +85,13 @@ void FileSource::start()
 {
 	qDebug("FileSource::start");
     m_basebandSource->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSource, m_thread, &m_basebandSource->getTelemetry());
 }
 
 void FileSource::stop()
 {
     qDebug("FileSource::stop");
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSource, m_thread);
 }
 
 void FileSource::pull(SampleVector::iterator& begin, unsigned int nbSamples)
@@ -281,6 +281,16 @@ void FileSource::calculateFrequencyOffset()
     m_frequencyOffset = m_basebandSampleRate * shiftFactor;
 }
 
+const DSPTelemetry *FileSource::getTelemetry() const
+{
+    return &m_basebandSource->getTelemetry();
+}
+
+QObject *FileSource::getBaseband()
+{
+    return m_basebandSource;
+}
+
 int FileSource::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
@@ -35,6 +35,7 @@ FileSourceBaseband::FileSourceBaseband() :
     m_mutex(QMutex::Recursive)
 {
     m_sampleFifo.resize(SampleSourceFifo::getSizePolicy(48000));
+    m_telemetry.setSampleFifoCounters(&m_sampleFifo.getCounters());
     m_channelizer = new UpChannelizer(&m_source);
 
     qDebug("FileSourceBaseband::FileSourceBaseband");
@@ -97,10 +98,14 @@ void FileSourceBaseband::handleData()
     unsigned int ipart2end;
 
     unsigned int remainder = m_sampleFifo.remainder();
+    unsigned int samplesDone = 0;
+
+    m_telemetry.startBlock(remainder, m_sampleFifo.size());
 
     while ((remainder > 0) && (m_inputMessageQueue.size() == 0))
     {
         m_sampleFifo.write(remainder, ipart1begin, ipart1end, ipart2begin, ipart2end);
+        samplesDone += (ipart1end - ipart1begin) + (ipart2end - ipart2begin);
 
         if (ipart1begin != ipart1end) { // first part of FIFO data
             processFifo(data, ipart1begin, ipart1end);
@@ -113,6 +118,8 @@ void FileSourceBaseband::handleData()
         remainder = m_sampleFifo.remainder();
     }
 
+    m_telemetry.endBlock(samplesDone);
+
     m_source.getMagSqLevels(m_avg, m_peak, m_nbSamples);
 }
 
@@ -184,7 +184,12 @@ void FileSourceSource::openFileStream(const QString& fileName)
 		m_sampleSize = header.sampleSize;
 		QString crcHex = QString("%1").arg(header.crc32 , 0, 16);
 
-	    if (crcOK)
+	    if (crcOK && (header.format != RecordFormat::FormatNative))
+	    {
+	        qCritical("FileSourceSource::openFileStream: only native sample format recordings are supported");
+	        m_recordLength = 0;
+	    }
+	    else if (crcOK)
 	    {
 	        qDebug("FileSourceSource::openFileStream: CRC32 OK for header: %s", qPrintable(crcHex));
 	        m_recordLength = (fileSize - sizeof(FileRecord::Header)) / ((m_sampleSize == 24 ? 8 : 4) * m_fileSampleRate);
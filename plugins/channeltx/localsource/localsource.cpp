@@ -51,7 +51,7 @@ LocalSource::LocalSource(DeviceAPI *deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSource = new LocalSourceBaseband();
-    m_basebandSource->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSource, m_thread);
 
     applySettings(m_settings, true);
 
@@ -76,14 +76,13 @@ void LocalSource::start()
 {
 	qDebug("LocalSource::start");
     m_basebandSource->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSource, m_thread, &m_basebandSource->getTelemetry());
 }
 
 void LocalSource::stop()
 {
     qDebug("LocalSource::stop");
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSource, m_thread);
 }
 
 void LocalSource::pull(SampleVector::iterator& begin, unsigned int nbSamples)
@@ -325,6 +324,16 @@ void LocalSource::calculateFrequencyOffset(uint32_t log2Interp, uint32_t filterC
     m_frequencyOffset = m_basebandSampleRate * shiftFactor;
 }
 
+const DSPTelemetry *LocalSource::getTelemetry() const
+{
+    return &m_basebandSource->getTelemetry();
+}
+
+QObject *LocalSource::getBaseband()
+{
+    return m_basebandSource;
+}
+
 int LocalSource::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
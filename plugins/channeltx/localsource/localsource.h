@@ -106,6 +106,10 @@ public:
         return m_frequencyOffset;
     }
 
+    virtual const DSPTelemetry *getTelemetry() const;
+    virtual QThread *getBasebandThread() { return m_thread; }
+    virtual QObject *getBaseband();
+
     virtual int webapiSettingsGet(
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage);
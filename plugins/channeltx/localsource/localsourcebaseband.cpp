@@ -33,6 +33,7 @@ LocalSourceBaseband::LocalSourceBaseband() :
     m_mutex(QMutex::Recursive)
 {
     m_sampleFifo.resize(SampleSourceFifo::getSizePolicy(48000));
+    m_telemetry.setSampleFifoCounters(&m_sampleFifo.getCounters());
     m_channelizer = new UpChannelizer(&m_source);
 
     qDebug("LocalSourceBaseband::LocalSourceBaseband");
@@ -95,10 +96,14 @@ void LocalSourceBaseband::handleData()
     unsigned int ipart2end;
 
     unsigned int remainder = m_sampleFifo.remainder();
+    unsigned int samplesDone = 0;
+
+    m_telemetry.startBlock(remainder, m_sampleFifo.size());
 
     while ((remainder > 0) && (m_inputMessageQueue.size() == 0))
     {
         m_sampleFifo.write(remainder, ipart1begin, ipart1end, ipart2begin, ipart2end);
+        samplesDone += (ipart1end - ipart1begin) + (ipart2end - ipart2begin);
 
         if (ipart1begin != ipart1end) { // first part of FIFO data
             processFifo(data, ipart1begin, ipart1end);
@@ -110,6 +115,8 @@ void LocalSourceBaseband::handleData()
 
         remainder = m_sampleFifo.remainder();
     }
+
+    m_telemetry.endBlock(samplesDone);
 }
 
 void LocalSourceBaseband::processFifo(SampleVector& data, unsigned int iBegin, unsigned int iEnd)
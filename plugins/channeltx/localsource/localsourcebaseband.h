@@ -22,6 +22,7 @@
 #include <QMutex>
 
 #include "dsp/samplesourcefifo.h"
+#include "dsp/dsptelemetry.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -122,12 +123,14 @@ public:
     void reset();
 	void pull(const SampleVector::iterator& begin, unsigned int nbSamples);
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
+    const DSPTelemetry& getTelemetry() const { return m_telemetry; } //!< handleData loop counters
     int getChannelSampleRate() const;
     void startSource() { m_source.start(m_localSampleSink); }
     void stopSource() { m_source.stop(); }
 
 private:
     SampleSourceFifo m_sampleFifo;
+    DSPTelemetry m_telemetry;
     UpChannelizer *m_channelizer;
     LocalSourceSource m_source;
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
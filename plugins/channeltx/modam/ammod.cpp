@@ -63,7 +63,7 @@ AMMod::AMMod(DeviceAPI *deviceAPI) :
     m_thread = new QThread(this);
     m_basebandSource = new AMModBaseband();
     m_basebandSource->setInputFileStream(&m_ifstream);
-    m_basebandSource->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSource, m_thread);
 
     applySettings(m_settings, true);
 
@@ -93,14 +93,13 @@ void AMMod::start()
 {
 	qDebug("AMMod::start");
     m_basebandSource->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSource, m_thread, &m_basebandSource->getTelemetry());
 }
 
 void AMMod::stop()
 {
     qDebug("AMMod::stop");
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSource, m_thread);
 }
 
 void AMMod::pull(SampleVector::iterator& begin, unsigned int nbSamples)
@@ -325,6 +324,16 @@ bool AMMod::deserialize(const QByteArray& data)
     }
 }
 
+const DSPTelemetry *AMMod::getTelemetry() const
+{
+    return &m_basebandSource->getTelemetry();
+}
+
+QObject *AMMod::getBaseband()
+{
+    return m_basebandSource;
+}
+
 int AMMod::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
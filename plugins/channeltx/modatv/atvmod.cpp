@@ -60,7 +60,7 @@ ATVMod::ATVMod(DeviceAPI *deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSource = new ATVModBaseband();
-    m_basebandSource->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSource, m_thread);
 
     applySettings(m_settings, true);
 
@@ -90,14 +90,13 @@ void ATVMod::start()
 {
 	qDebug("ATVMod::start");
     m_basebandSource->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSource, m_thread, &m_basebandSource->getTelemetry());
 }
 
 void ATVMod::stop()
 {
     qDebug("ATVMod::stop");
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSource, m_thread);
 }
 
 void ATVMod::pull(SampleVector::iterator& begin, unsigned int nbSamples)
@@ -345,6 +344,16 @@ bool ATVMod::deserialize(const QByteArray& data)
     }
 }
 
+const DSPTelemetry *ATVMod::getTelemetry() const
+{
+    return &m_basebandSource->getTelemetry();
+}
+
+QObject *ATVMod::getBaseband()
+{
+    return m_basebandSource;
+}
+
 int ATVMod::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
@@ -22,6 +22,7 @@
 #include <QMutex>
 
 #include "dsp/samplesourcefifo.h"
+#include "dsp/dsptelemetry.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -215,6 +216,7 @@ public:
     void reset();
 	void pull(const SampleVector::iterator& begin, unsigned int nbSamples);
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
+    const DSPTelemetry& getTelemetry() const { return m_telemetry; } //!< handleData loop counters
     void setMessageQueueToGUI(MessageQueue *messageQueue) { m_source.setMessageQueueToGUI(messageQueue); }
     double getMagSq() const { return m_source.getMagSq(); }
     int getChannelSampleRate() const;
@@ -233,6 +235,7 @@ signals:
 
 private:
     SampleSourceFifo m_sampleFifo;
+    DSPTelemetry m_telemetry;
     UpChannelizer *m_channelizer;
     ATVModSource m_source;
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
@@ -62,7 +62,7 @@ FreeDVMod::FreeDVMod(DeviceAPI *deviceAPI) :
     m_thread = new QThread(this);
     m_basebandSource = new FreeDVModBaseband();
     m_basebandSource->setInputFileStream(&m_ifstream);
-    m_basebandSource->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSource, m_thread);
 
     applySettings(m_settings, true);
 
@@ -87,14 +87,13 @@ void FreeDVMod::start()
 {
 	qDebug("FreeDVMod::start");
     m_basebandSource->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSource, m_thread, &m_basebandSource->getTelemetry());
 }
 
 void FreeDVMod::stop()
 {
     qDebug("FreeDVMod::stop");
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSource, m_thread);
 }
 
 void FreeDVMod::pull(SampleVector::iterator& begin, unsigned int nbSamples)
@@ -311,6 +310,16 @@ bool FreeDVMod::deserialize(const QByteArray& data)
     }
 }
 
+const DSPTelemetry *FreeDVMod::getTelemetry() const
+{
+    return &m_basebandSource->getTelemetry();
+}
+
+QObject *FreeDVMod::getBaseband()
+{
+    return m_basebandSource;
+}
+
 int FreeDVMod::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
@@ -64,7 +64,7 @@ NFMMod::NFMMod(DeviceAPI *deviceAPI) :
     m_thread = new QThread(this);
     m_basebandSource = new NFMModBaseband();
     m_basebandSource->setInputFileStream(&m_ifstream);
-    m_basebandSource->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSource, m_thread);
 
     applySettings(m_settings, true);
 
@@ -89,14 +89,13 @@ void NFMMod::start()
 {
 	qDebug("NFMMod::start");
     m_basebandSource->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSource, m_thread, &m_basebandSource->getTelemetry());
 }
 
 void NFMMod::stop()
 {
     qDebug("NFMMod::stop");
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSource, m_thread);
 }
 
 void NFMMod::pull(SampleVector::iterator& begin, unsigned int nbSamples)
@@ -370,6 +369,16 @@ bool NFMMod::deserialize(const QByteArray& data)
     return success;
 }
 
+const DSPTelemetry *NFMMod::getTelemetry() const
+{
+    return &m_basebandSource->getTelemetry();
+}
+
+QObject *NFMMod::getBaseband()
+{
+    return m_basebandSource;
+}
+
 int NFMMod::webapiSettingsGet(
                 SWGSDRangel::SWGChannelSettings& response,
                 QString& errorMessage)
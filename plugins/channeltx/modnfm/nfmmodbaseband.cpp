@@ -29,6 +29,7 @@ NFMModBaseband::NFMModBaseband() :
     m_mutex(QMutex::Recursive)
 {
     m_sampleFifo.resize(SampleSourceFifo::getSizePolicy(48000));
+    m_telemetry.setSampleFifoCounters(&m_sampleFifo.getCounters());
     m_channelizer = new UpChannelizer(&m_source);
 
     qDebug("NFMModBaseband::NFMModBaseband");
@@ -41,6 +42,7 @@ NFMModBaseband::NFMModBaseband() :
     );
 
 	DSPEngine::instance()->getAudioDeviceManager()->addAudioSource(m_source.getAudioFifo(), getInputMessageQueue());
+    m_telemetry.setAudioFifoCounters(&m_source.getAudioFifo()->getCounters());
     m_source.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getInputSampleRate());
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_source.getFeedbackAudioFifo(), getInputMessageQueue());
@@ -101,10 +103,14 @@ void NFMModBaseband::handleData()
     int numSamples;
 
     unsigned int remainder = m_sampleFifo.remainder();
+    unsigned int samplesDone = 0;
+
+    m_telemetry.startBlock(remainder, m_sampleFifo.size());
 
     while ((remainder > 0) && (m_inputMessageQueue.size() == 0))
     {
         m_sampleFifo.write(remainder, ipart1begin, ipart1end, ipart2begin, ipart2end);
+        samplesDone += (ipart1end - ipart1begin) + (ipart2end - ipart2begin);
 
         if (ipart1begin != ipart1end) { // first part of FIFO data
             processFifo(data, ipart1begin, ipart1end);
@@ -117,6 +123,8 @@ void NFMModBaseband::handleData()
         remainder = m_sampleFifo.remainder();
     }
 
+    m_telemetry.endBlock(samplesDone);
+
     m_source.getLevels(rmsLevel, peakLevel, numSamples);
     emit levelChanged(rmsLevel, peakLevel, numSamples);
 }
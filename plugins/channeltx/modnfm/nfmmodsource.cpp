@@ -15,6 +15,8 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 #include <QDebug>
 
 #include "nfmmodsource.h"
@@ -53,13 +55,25 @@ NFMModSource::~NFMModSource()
 
 void NFMModSource::pull(SampleVector::iterator begin, unsigned int nbSamples)
 {
-    std::for_each(
-        begin,
-        begin + nbSamples,
-        [this](Sample& s) {
-            pullOne(s);
-        }
-    );
+    if (m_settings.m_channelMute)
+    {
+        std::fill(begin, begin + nbSamples, Sample{0, 0});
+        return;
+    }
+
+    m_modBuffer.resize(nbSamples);
+
+    for (unsigned int i = 0; i < nbSamples; i++) {
+        modulateOne(m_modBuffer[i]);
+    }
+
+    m_carrierNco.nextIQMul(m_modBuffer.data(), nbSamples); // shift to carrier frequency
+
+    for (unsigned int i = 0; i < nbSamples; i++) {
+        outputOne(m_modBuffer[i], begin[i]);
+    }
+
+    m_magsq = m_movingAverage.asDouble();
 }
 
 void NFMModSource::pullOne(Sample& sample)
@@ -72,7 +86,14 @@ void NFMModSource::pullOne(Sample& sample)
 	}
 
 	Complex ci;
+    modulateOne(ci);
+    ci *= m_carrierNco.nextIQ(); // shift to carrier frequency
+    outputOne(ci, sample);
+	m_magsq = m_movingAverage.asDouble();
+}
 
+void NFMModSource::modulateOne(Complex& ci)
+{
     if (m_interpolatorDistance > 1.0f) // decimate
     {
     	modulateSample();
@@ -91,13 +112,13 @@ void NFMModSource::pullOne(Sample& sample)
     }
 
     m_interpolatorDistanceRemain += m_interpolatorDistance;
+}
 
-    ci *= m_carrierNco.nextIQ(); // shift to carrier frequency
-
+void NFMModSource::outputOne(const Complex& ci, Sample& sample)
+{
     double magsq = ci.real() * ci.real() + ci.imag() * ci.imag();
 	magsq /= (SDR_TX_SCALED*SDR_TX_SCALED);
 	m_movingAverage(magsq);
-	m_magsq = m_movingAverage.asDouble();
 
 	sample.m_real = (FixReal) ci.real();
 	sample.m_imag = (FixReal) ci.imag();
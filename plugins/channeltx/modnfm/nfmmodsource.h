@@ -70,6 +70,7 @@ private:
     NFMModSettings m_settings;
 
     NCO m_carrierNco;
+    ComplexVector m_modBuffer; //!< block of channel samples before the carrier shift
     NCOF m_toneNco;
     NCOF m_ctcssNco;
     float m_modPhasor; //!< baseband modulator phasor
@@ -115,6 +116,8 @@ private:
     static const float m_preemphasis;
 
     void processOneSample(Complex& ci);
+    void modulateOne(Complex& ci); //!< channel sample before the carrier shift shared by pull (block) and pullOne
+    void outputOne(const Complex& ci, Sample& sample); //!< level and output of one channel sample after the carrier shift
     void pullAF(Real& sample);
     void pullAudio(unsigned int nbSamples);
     void pushFeedback(Real sample);
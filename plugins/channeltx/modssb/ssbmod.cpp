@@ -63,7 +63,7 @@ SSBMod::SSBMod(DeviceAPI *deviceAPI) :
     m_thread = new QThread(this);
     m_basebandSource = new SSBModBaseband();
     m_basebandSource->setInputFileStream(&m_ifstream);
-    m_basebandSource->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSource, m_thread);
 
     applySettings(m_settings, true);
 
@@ -88,14 +88,13 @@ void SSBMod::start()
 {
 	qDebug("SSBMod::start");
     m_basebandSource->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSource, m_thread, &m_basebandSource->getTelemetry());
 }
 
 void SSBMod::stop()
 {
     qDebug("SSBMod::stop");
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSource, m_thread);
 }
 
 void SSBMod::pull(SampleVector::iterator& begin, unsigned int nbSamples)
@@ -331,6 +330,16 @@ bool SSBMod::deserialize(const QByteArray& data)
     }
 }
 
+const DSPTelemetry *SSBMod::getTelemetry() const
+{
+    return &m_basebandSource->getTelemetry();
+}
+
+QObject *SSBMod::getBaseband()
+{
+    return m_basebandSource;
+}
+
 int SSBMod::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
@@ -22,6 +22,7 @@
 #include <QMutex>
 
 #include "dsp/samplesourcefifo.h"
+#include "dsp/dsptelemetry.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -62,6 +63,7 @@ public:
     void reset();
 	void pull(const SampleVector::iterator& begin, unsigned int nbSamples);
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
+    const DSPTelemetry& getTelemetry() const { return m_telemetry; } //!< handleData loop counters
     CWKeyer& getCWKeyer() { return m_source.getCWKeyer(); }
     double getMagSq() const { return m_source.getMagSq(); }
     unsigned int getAudioSampleRate() const { return m_source.getAudioSampleRate(); }
@@ -83,6 +85,7 @@ signals:
 
 private:
     SampleSourceFifo m_sampleFifo;
+    DSPTelemetry m_telemetry;
     UpChannelizer *m_channelizer;
     SSBModSource m_source;
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
@@ -62,7 +62,7 @@ WFMMod::WFMMod(DeviceAPI *deviceAPI) :
     m_thread = new QThread(this);
     m_basebandSource = new WFMModBaseband();
     m_basebandSource->setInputFileStream(&m_ifstream);
-    m_basebandSource->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSource, m_thread);
 
     applySettings(m_settings, true);
 
@@ -87,14 +87,13 @@ void WFMMod::start()
 {
 	qDebug("WFMMod::start");
     m_basebandSource->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSource, m_thread, &m_basebandSource->getTelemetry());
 }
 
 void WFMMod::stop()
 {
     qDebug("WFMMod::stop");
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSource, m_thread);
 }
 
 void WFMMod::pull(SampleVector::iterator& begin, unsigned int nbSamples)
@@ -311,6 +310,16 @@ bool WFMMod::deserialize(const QByteArray& data)
     }
 }
 
+const DSPTelemetry *WFMMod::getTelemetry() const
+{
+    return &m_basebandSource->getTelemetry();
+}
+
+QObject *WFMMod::getBaseband()
+{
+    return m_basebandSource;
+}
+
 int WFMMod::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
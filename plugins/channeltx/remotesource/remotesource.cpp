@@ -27,6 +27,7 @@
 #include "SWGChannelReport.h"
 #include "SWGRemoteSourceReport.h"
 
+#include "dsp/dspengine.h"
 #include "dsp/devicesamplesink.h"
 #include "device/deviceapi.h"
 #include "util/timeutil.h"
@@ -48,7 +49,7 @@ RemoteSource::RemoteSource(DeviceAPI *deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSource = new RemoteSourceBaseband();
-    m_basebandSource->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSource, m_thread);
 
     applySettings(m_settings, true);
 
@@ -73,7 +74,7 @@ void RemoteSource::start()
 {
     qDebug("RemoteSource::start");
     m_basebandSource->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSource, m_thread, &m_basebandSource->getTelemetry());
     RemoteSourceBaseband::MsgConfigureRemoteSourceWork *msg = RemoteSourceBaseband::MsgConfigureRemoteSourceWork::create(true);
     m_basebandSource->getInputMessageQueue()->push(msg);
 }
@@ -81,8 +82,7 @@ void RemoteSource::start()
 void RemoteSource::stop()
 {
     qDebug("RemoteSource::stop");
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSource, m_thread);
 }
 
 void RemoteSource::pull(SampleVector::iterator& begin, unsigned int nbSamples)
@@ -205,6 +205,16 @@ void RemoteSource::applySettings(const RemoteSourceSettings& settings, bool forc
     m_settings = settings;
 }
 
+const DSPTelemetry *RemoteSource::getTelemetry() const
+{
+    return &m_basebandSource->getTelemetry();
+}
+
+QObject *RemoteSource::getBaseband()
+{
+    return m_basebandSource;
+}
+
 int RemoteSource::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
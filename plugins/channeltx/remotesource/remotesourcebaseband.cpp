@@ -30,6 +30,7 @@ RemoteSourceBaseband::RemoteSourceBaseband() :
     m_mutex(QMutex::Recursive)
 {
     m_sampleFifo.resize(SampleSourceFifo::getSizePolicy(48000));
+    m_telemetry.setSampleFifoCounters(&m_sampleFifo.getCounters());
     m_channelizer = new UpChannelizer(&m_source);
 
     qDebug("RemoteSourceBaseband::RemoteSourceBaseband");
@@ -94,10 +95,14 @@ void RemoteSourceBaseband::handleData()
     unsigned int ipart2end;
 
     unsigned int remainder = m_sampleFifo.remainder();
+    unsigned int samplesDone = 0;
+
+    m_telemetry.startBlock(remainder, m_sampleFifo.size());
 
     while ((remainder > 0) && (m_inputMessageQueue.size() == 0))
     {
         m_sampleFifo.write(remainder, ipart1begin, ipart1end, ipart2begin, ipart2end);
+        samplesDone += (ipart1end - ipart1begin) + (ipart2end - ipart2begin);
 
         if (ipart1begin != ipart1end) { // first part of FIFO data
             processFifo(data, ipart1begin, ipart1end);
@@ -109,6 +114,8 @@ void RemoteSourceBaseband::handleData()
 
         remainder = m_sampleFifo.remainder();
     }
+
+    m_telemetry.endBlock(samplesDone);
 }
 
 void RemoteSourceBaseband::processFifo(SampleVector& data, unsigned int iBegin, unsigned int iEnd)
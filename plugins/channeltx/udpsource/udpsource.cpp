@@ -26,6 +26,7 @@
 #include "SWGUDPSourceReport.h"
 
 #include "device/deviceapi.h"
+#include "dsp/dspengine.h"
 #include "dsp/dspcommands.h"
 #include "util/db.h"
 
@@ -47,7 +48,7 @@ UDPSource::UDPSource(DeviceAPI *deviceAPI) :
 
     m_thread = new QThread(this);
     m_basebandSource = new UDPSourceBaseband();
-    m_basebandSource->moveToThread(m_thread);
+    DSPEngine::instance()->getChannelThreadPool()->setupBaseband(m_basebandSource, m_thread);
 
     applySettings(m_settings, true);
 
@@ -72,14 +73,13 @@ void UDPSource::start()
 {
 	qDebug("UDPSource::start");
     m_basebandSource->reset();
-    m_thread->start();
+    DSPEngine::instance()->getChannelThreadPool()->startBaseband(m_basebandSource, m_thread, &m_basebandSource->getTelemetry());
 }
 
 void UDPSource::stop()
 {
     qDebug("UDPSource::stop");
-	m_thread->exit();
-	m_thread->wait();
+	DSPEngine::instance()->getChannelThreadPool()->stopBaseband(m_basebandSource, m_thread);
 }
 
 void UDPSource::pull(SampleVector::iterator& begin, unsigned int nbSamples)
@@ -271,6 +271,16 @@ bool UDPSource::deserialize(const QByteArray& data)
     }
 }
 
+const DSPTelemetry *UDPSource::getTelemetry() const
+{
+    return &m_basebandSource->getTelemetry();
+}
+
+QObject *UDPSource::getBaseband()
+{
+    return m_basebandSource;
+}
+
 int UDPSource::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
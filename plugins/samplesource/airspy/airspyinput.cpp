@@ -105,6 +105,8 @@ bool AirspyInput::openDevice()
         return false;
     }
 
+    m_sampleFifo.setLockFree(true); // written by the device thread only
+
     int device = m_deviceAPI->getSamplingDeviceSequence();
 
     if ((m_dev = open_airspy_from_sequence(device)) == 0)
@@ -577,6 +579,7 @@ bool AirspyInput::applySettings(const AirspySettings& settings, bool force)
 	if (forwardChange)
 	{
 		int sampleRate = m_sampleRates[m_settings.m_devSampleRateIndex]/(1<<m_settings.m_log2Decim);
+        m_sampleFifo.setWakeupThreshold(SampleSinkFifo::getWakeupThresholdPolicy(sampleRate)); // batched engine wakeups
 		DSPSignalNotification *notif = new DSPSignalNotification(sampleRate, m_settings.m_centerFrequency);
         m_fileSink->handleMessage(*notif); // forward to file sink
         m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
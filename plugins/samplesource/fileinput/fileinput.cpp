@@ -26,6 +26,8 @@
 #include "SWGFileInputSettings.h"
 #include "SWGDeviceState.h"
 #include "SWGDeviceReport.h"
+#include "SWGDeviceActions.h"
+#include "SWGFileInputActions.h"
 
 #include "util/simpleserializer.h"
 #include "dsp/dspcommands.h"
@@ -41,6 +43,7 @@ MESSAGE_CLASS_DEFINITION(FileInput::MsgConfigureFileInput, Message)
 MESSAGE_CLASS_DEFINITION(FileInput::MsgConfigureFileSourceName, Message)
 MESSAGE_CLASS_DEFINITION(FileInput::MsgConfigureFileInputWork, Message)
 MESSAGE_CLASS_DEFINITION(FileInput::MsgConfigureFileSourceSeek, Message)
+MESSAGE_CLASS_DEFINITION(FileInput::MsgConfigureFileSourceSeekTime, Message)
 MESSAGE_CLASS_DEFINITION(FileInput::MsgConfigureFileInputStreamTiming, Message)
 MESSAGE_CLASS_DEFINITION(FileInput::MsgStartStop, Message)
 MESSAGE_CLASS_DEFINITION(FileInput::MsgPlayPause, Message)
@@ -57,9 +60,11 @@ FileInput::FileInput(DeviceAPI *deviceAPI) :
 	m_fileName("..."),
 	m_sampleRate(0),
 	m_sampleSize(0),
+	m_format(RecordFormat::FormatNative),
 	m_centerFrequency(0),
 	m_recordLength(0),
-    m_startingTimeStamp(0)
+    m_startingTimeStamp(0),
+    m_endOfFile(false)
 {
     m_deviceAPI->setNbSourceStreams(1);
     qDebug("FileInput::FileInput: device source engine: %p", m_deviceAPI->getDeviceSourceEngine());
@@ -93,51 +98,33 @@ void FileInput::openFileStream()
 		m_ifstream.close();
 	}
 
-#ifdef Q_OS_WIN
-	m_ifstream.open(m_fileName.toStdWString().c_str(), std::ios::binary | std::ios::ate);
-#else
-	m_ifstream.open(m_fileName.toStdString().c_str(), std::ios::binary | std::ios::ate);
-#endif
-	quint64 fileSize = m_ifstream.tellg();
-
-	if (fileSize > sizeof(FileRecord::Header))
-	{
-	    FileRecord::Header header;
-	    m_ifstream.seekg(0,std::ios_base::beg);
-		bool crcOK = FileRecord::readHeader(m_ifstream, header);
-		m_sampleRate = header.sampleRate;
-		m_centerFrequency = header.centerFrequency;
-		m_startingTimeStamp = header.startTimeStamp;
-		m_sampleSize = header.sampleSize;
-		QString crcHex = QString("%1").arg(header.crc32 , 0, 16);
-
-	    if (crcOK)
-	    {
-	        qDebug("FileInput::openFileStream: CRC32 OK for header: %s", qPrintable(crcHex));
-	        m_recordLength = (fileSize - sizeof(FileRecord::Header)) / ((m_sampleSize == 24 ? 8 : 4) * m_sampleRate);
-	    }
-	    else
-	    {
-	        qCritical("FileInput::openFileStream: bad CRC32 for header: %s", qPrintable(crcHex));
-	        m_recordLength = 0;
-	    }
-
-		if (getMessageQueueToGUI()) {
-			MsgReportHeaderCRC *report = MsgReportHeaderCRC::create(crcOK);
-			getMessageQueueToGUI()->push(report);
-		}
+	m_endOfFile = false;
+	bool indexOK = m_index.build(m_fileName);
+	const FileRecord::Header& header = m_index.getHeader();
+	m_sampleRate = header.sampleRate;
+	m_centerFrequency = header.centerFrequency;
+	m_startingTimeStamp = header.startTimeStamp;
+	m_sampleSize = header.sampleSize;
+	m_format = m_index.getFormat();
+
+	if (indexOK && m_index.openSegment(m_ifstream, 0, 0)) {
+	    m_recordLength = m_index.getNbSamples() / m_sampleRate;
+	} else {
+	    m_recordLength = 0;
 	}
-	else
-	{
-		m_recordLength = 0;
+
+	if (getMessageQueueToGUI()) {
+		MsgReportHeaderCRC *report = MsgReportHeaderCRC::create(indexOK && m_index.isCrcOK());
+		getMessageQueueToGUI()->push(report);
 	}
 
 	qDebug() << "FileInput::openFileStream: " << m_fileName.toStdString().c_str()
-			<< " fileSize: " << fileSize << " bytes"
+			<< " segments: " << m_index.getNbSegments()
 			<< " length: " << m_recordLength << " seconds"
 			<< " sample rate: " << m_sampleRate << " S/s"
 			<< " center frequency: " << m_centerFrequency << " Hz"
-			<< " sample size: " << m_sampleSize << " bits";
+			<< " sample size: " << m_sampleSize << " bits"
+			<< " format: " << RecordFormat::getName(m_format);
 
 	if (getMessageQueueToGUI()) {
 	    MsgReportFileInputStreamData *report = MsgReportFileInputStreamData::create(m_sampleRate,
@@ -156,14 +143,35 @@ void FileInput::openFileStream()
 void FileInput::seekFileStream(int seekMillis)
 {
 	QMutexLocker mutexLocker(&m_mutex);
+	seekSample((m_index.getNbSamples() * seekMillis) / 1000);
+}
+
+void FileInput::seekFileStreamTime(qint64 timeMs)
+{
+	QMutexLocker mutexLocker(&m_mutex);
+	seekSample(m_index.getSampleAtTime(timeMs));
+}
 
-	if ((m_ifstream.is_open()) && m_fileInputThread && !m_fileInputThread->isRunning())
+void FileInput::seekSample(quint64 sample)
+{
+	// the index gives the segment and offset directly. Playing is resumed after the jump
+	if (m_ifstream.is_open() && m_fileInputThread)
 	{
-        quint64 seekPoint = ((m_recordLength * seekMillis) / 1000) * m_sampleRate;
-		m_fileInputThread->setSamplesCount(seekPoint);
-        seekPoint *= (m_sampleSize == 24 ? 8 : 4); // + sizeof(FileSink::Header)
-		m_ifstream.clear();
-		m_ifstream.seekg(seekPoint + sizeof(FileRecord::Header), std::ios::beg);
+		bool working = m_fileInputThread->isRunning();
+
+		if (working) {
+			m_fileInputThread->stopWork();
+		}
+
+		int segmentIndex = m_index.findSegment(sample);
+		quint64 unit = (sample - m_index.getSegment(segmentIndex).m_firstSample) / m_index.getUnitSamples(); // whole units
+		m_index.openSegment(m_ifstream, segmentIndex, unit);
+		m_fileInputThread->setPosition(segmentIndex, unit);
+		m_endOfFile = false;
+
+		if (working) {
+			m_fileInputThread->startWork();
+		}
 	}
 }
 
@@ -184,18 +192,18 @@ bool FileInput::start()
 	QMutexLocker mutexLocker(&m_mutex);
 	qDebug() << "FileInput::start";
 
-	if (m_ifstream.tellg() != (std::streampos)0) {
-		m_ifstream.clear();
-		m_ifstream.seekg(sizeof(FileRecord::Header), std::ios::beg);
-	}
+	m_index.openSegment(m_ifstream, 0, 0);
 
 	if(!m_sampleFifo.setSize(m_settings.m_accelerationFactor * m_sampleRate * sizeof(Sample))) {
 		qCritical("Could not allocate SampleFifo");
 		return false;
 	}
 
-	m_fileInputThread = new FileInputThread(&m_ifstream, &m_sampleFifo, m_masterTimer, &m_inputMessageQueue);
-	m_fileInputThread->setSampleRateAndSize(m_settings.m_accelerationFactor * m_sampleRate, m_sampleSize); // Fast Forward: 1 corresponds to live. 1/2 is half speed, 2 is double speed
+	m_fileInputThread = new FileInputThread(&m_ifstream, &m_index, &m_sampleFifo, m_deviceAPI->getDeviceSourceEngine(), m_masterTimer, &m_inputMessageQueue);
+	m_fileInputThread->setSampleRateAndSize(m_settings.m_accelerationFactor * m_sampleRate, m_sampleSize, m_format); // Fast Forward: 1 corresponds to live. 1/2 is half speed, 2 is double speed
+	m_fileInputThread->setPosition(0, 0);
+	m_fileInputThread->setUnthrottled(m_settings.m_unthrottled);
+	m_endOfFile = false;
 	m_fileInputThread->startWork();
 	m_deviceDescription = "FileInput";
 
@@ -316,6 +324,7 @@ bool FileInput::handleMessage(const Message& message)
 		if (m_fileInputThread != 0)
 		{
 			if (working) {
+				m_endOfFile = false;
 				m_fileInputThread->startWork();
 			} else {
 				m_fileInputThread->stopWork();
@@ -332,6 +341,13 @@ bool FileInput::handleMessage(const Message& message)
 
 		return true;
 	}
+	else if (MsgConfigureFileSourceSeekTime::match(message))
+	{
+		MsgConfigureFileSourceSeekTime& conf = (MsgConfigureFileSourceSeekTime&) message;
+		seekFileStreamTime(conf.getTimeMs());
+
+		return true;
+	}
 	else if (MsgConfigureFileInputStreamTiming::match(message))
 	{
 		MsgReportFileInputStreamTiming *report;
@@ -340,7 +356,8 @@ bool FileInput::handleMessage(const Message& message)
 		{
 			if (getMessageQueueToGUI())
 			{
-                report = MsgReportFileInputStreamTiming::create(m_fileInputThread->getSamplesCount());
+                quint64 samplesCount = m_fileInputThread->getSamplesCount();
+                report = MsgReportFileInputStreamTiming::create(samplesCount, m_index.getTimeOfSample(samplesCount));
                 getMessageQueueToGUI()->push(report);
 			}
 		}
@@ -377,7 +394,8 @@ bool FileInput::handleMessage(const Message& message)
 
         if (getMessageQueueToGUI())
         {
-            MsgReportFileInputStreamTiming *report = MsgReportFileInputStreamTiming::create(m_fileInputThread->getSamplesCount());
+            quint64 samplesCount = m_fileInputThread->getSamplesCount();
+            MsgReportFileInputStreamTiming *report = MsgReportFileInputStreamTiming::create(samplesCount, m_index.getTimeOfSample(samplesCount));
             getMessageQueueToGUI()->push(report);
         }
 
@@ -388,6 +406,8 @@ bool FileInput::handleMessage(const Message& message)
         }
         else
         {
+            m_endOfFile = true;
+
             if (getMessageQueueToGUI())
             {
                 MsgPlayPause *report = MsgPlayPause::create(false);
@@ -422,7 +442,28 @@ bool FileInput::applySettings(const FileInputSettings& settings, bool force)
                 qCritical("FileInput::applySettings: could not reallocate sample FIFO size to %lu",
                         m_settings.m_accelerationFactor * m_sampleRate * sizeof(Sample));
             }
-            m_fileInputThread->setSampleRateAndSize(settings.m_accelerationFactor * m_sampleRate, m_sampleSize); // Fast Forward: 1 corresponds to live. 1/2 is half speed, 2 is double speed
+            m_fileInputThread->setSampleRateAndSize(settings.m_accelerationFactor * m_sampleRate, m_sampleSize, m_format); // Fast Forward: 1 corresponds to live. 1/2 is half speed, 2 is double speed
+        }
+    }
+
+    if ((m_settings.m_unthrottled != settings.m_unthrottled) || force)
+    {
+        reverseAPIKeys.append("unthrottled");
+
+        if (m_fileInputThread)
+        {
+            QMutexLocker mutexLocker(&m_mutex);
+            bool working = m_fileInputThread->isRunning();
+
+            if (working) {
+                m_fileInputThread->stopWork();
+            }
+
+            m_fileInputThread->setUnthrottled(settings.m_unthrottled);
+
+            if (working) {
+                m_fileInputThread->startWork();
+            }
         }
     }
 
@@ -494,6 +535,9 @@ void FileInput::webapiUpdateDeviceSettings(
     if (deviceSettingsKeys.contains("loop")) {
         settings.m_loop = response.getFileInputSettings()->getLoop() != 0;
     }
+    if (deviceSettingsKeys.contains("unthrottled")) {
+        settings.m_unthrottled = response.getFileInputSettings()->getUnthrottled() != 0;
+    }
     if (deviceSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getFileInputSettings()->getUseReverseApi() != 0;
     }
@@ -547,11 +591,54 @@ int FileInput::webapiReportGet(
     return 200;
 }
 
+int FileInput::webapiActionsPost(
+        const QStringList& deviceActionsKeys,
+        SWGSDRangel::SWGDeviceActions& query,
+        QString& errorMessage)
+{
+    SWGSDRangel::SWGFileInputActions *swgFileInputActions = query.getFileInputActions();
+
+    if (swgFileInputActions)
+    {
+        if (deviceActionsKeys.contains("seekMillis"))
+        {
+            MsgConfigureFileSourceSeek *msg = MsgConfigureFileSourceSeek::create(swgFileInputActions->getSeekMillis());
+            getInputMessageQueue()->push(msg);
+        }
+
+        if (deviceActionsKeys.contains("seekTime"))
+        {
+            QDateTime dt = QDateTime::fromString(*swgFileInputActions->getSeekTime(), Qt::ISODate);
+
+            if (!dt.isValid())
+            {
+                errorMessage = QString("Invalid seekTime: %1").arg(*swgFileInputActions->getSeekTime());
+                return 400;
+            }
+
+            if (dt.timeSpec() == Qt::LocalTime) { // no time zone given: UTC
+                dt.setTimeSpec(Qt::UTC);
+            }
+
+            MsgConfigureFileSourceSeekTime *msg = MsgConfigureFileSourceSeekTime::create(dt.toMSecsSinceEpoch());
+            getInputMessageQueue()->push(msg);
+        }
+
+        return 202;
+    }
+    else
+    {
+        errorMessage = "Missing FileInputActions in query";
+        return 400;
+    }
+}
+
 void FileInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& response, const FileInputSettings& settings)
 {
     response.getFileInputSettings()->setFileName(new QString(settings.m_fileName));
     response.getFileInputSettings()->setAccelerationFactor(settings.m_accelerationFactor);
     response.getFileInputSettings()->setLoop(settings.m_loop ? 1 : 0);
+    response.getFileInputSettings()->setUnthrottled(settings.m_unthrottled ? 1 : 0);
 
     response.getFileInputSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
@@ -586,10 +673,7 @@ void FileInput::webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response)
     t = t.addMSecs(t_msec);
     response.getFileInputReport()->setElapsedTime(new QString(t.toString("HH:mm:ss.zzz")));
 
-    qint64 startingTimeStampMsec = m_startingTimeStamp * 1000LL;
-    QDateTime dt = QDateTime::fromMSecsSinceEpoch(startingTimeStampMsec);
-    dt = dt.addSecs(t_sec);
-    dt = dt.addMSecs(t_msec);
+    QDateTime dt = QDateTime::fromMSecsSinceEpoch(m_index.getTimeOfSample(samplesCount));
     response.getFileInputReport()->setAbsoluteTime(new QString(dt.toString("yyyy-MM-dd HH:mm:ss.zzz")));
 
     QTime recordLength(0, 0, 0, 0);
@@ -599,6 +683,7 @@ void FileInput::webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response)
     response.getFileInputReport()->setFileName(new QString(m_fileName));
     response.getFileInputReport()->setSampleRate(m_sampleRate);
     response.getFileInputReport()->setSampleSize(m_sampleSize);
+    response.getFileInputReport()->setEndOfFile(m_endOfFile ? 1 : 0);
 }
 
 void FileInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const FileInputSettings& settings, bool force)
@@ -618,6 +703,9 @@ void FileInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, co
     if (deviceSettingsKeys.contains("loop") || force) {
         swgFileInputSettings->setLoop(settings.m_loop);
     }
+    if (deviceSettingsKeys.contains("unthrottled") || force) {
+        swgFileInputSettings->setUnthrottled(settings.m_unthrottled ? 1 : 0);
+    }
     if (deviceSettingsKeys.contains("fileName") || force) {
         swgFileInputSettings->setFileName(new QString(settings.m_fileName));
     }
@@ -28,7 +28,9 @@
 #include <QNetworkRequest>
 
 #include "dsp/devicesamplesource.h"
+#include "dsp/recordformat.h"
 #include "fileinputsettings.h"
+#include "fileinputindex.h"
 
 class QNetworkAccessManager;
 class QNetworkReply;
@@ -138,6 +140,26 @@ public:
 		{ }
 	};
 
+	class MsgConfigureFileSourceSeekTime : public Message {
+		MESSAGE_CLASS_DECLARATION
+
+	public:
+		qint64 getTimeMs() const { return m_timeMs; }
+
+		static MsgConfigureFileSourceSeekTime* create(qint64 timeMs)
+		{
+			return new MsgConfigureFileSourceSeekTime(timeMs);
+		}
+
+	protected:
+		qint64 m_timeMs; //!< absolute (UTC) time of seek position in milliseconds since epoch
+
+		MsgConfigureFileSourceSeekTime(qint64 timeMs) :
+			Message(),
+			m_timeMs(timeMs)
+		{ }
+	};
+
 	class MsgReportFileSourceAcquisition : public Message {
 		MESSAGE_CLASS_DECLARATION
 
@@ -241,18 +263,21 @@ public:
 
 	public:
         quint64 getSamplesCount() const { return m_samplesCount; }
+        qint64 getAbsoluteTimeMs() const { return m_absoluteTimeMs; }
 
-        static MsgReportFileInputStreamTiming* create(quint64 samplesCount)
+        static MsgReportFileInputStreamTiming* create(quint64 samplesCount, qint64 absoluteTimeMs)
 		{
-			return new MsgReportFileInputStreamTiming(samplesCount);
+			return new MsgReportFileInputStreamTiming(samplesCount, absoluteTimeMs);
 		}
 
 	protected:
         quint64 m_samplesCount;
+        qint64 m_absoluteTimeMs; //!< UTC time of the current sample from the segment it belongs to
 
-        MsgReportFileInputStreamTiming(quint64 samplesCount) :
+        MsgReportFileInputStreamTiming(quint64 samplesCount, qint64 absoluteTimeMs) :
 			Message(),
-			m_samplesCount(samplesCount)
+			m_samplesCount(samplesCount),
+			m_absoluteTimeMs(absoluteTimeMs)
 		{ }
 	};
 
@@ -319,6 +344,11 @@ public:
             SWGSDRangel::SWGDeviceReport& response,
             QString& errorMessage);
 
+    virtual int webapiActionsPost(
+            const QStringList& deviceActionsKeys,
+            SWGSDRangel::SWGDeviceActions& actions,
+            QString& errorMessage);
+
     static void webapiFormatDeviceSettings(
             SWGSDRangel::SWGDeviceSettings& response,
             const FileInputSettings& settings);
@@ -333,20 +363,25 @@ public:
 	QMutex m_mutex;
 	FileInputSettings m_settings;
 	std::ifstream m_ifstream;
+	FileInputIndex m_index; //!< Time index of the file or playlist segments
 	FileInputThread* m_fileInputThread;
 	QString m_deviceDescription;
 	QString m_fileName;
 	int m_sampleRate;
 	quint32 m_sampleSize;
+	RecordFormat::Format m_format;
 	quint64 m_centerFrequency;
-    quint64 m_recordLength; //!< record length in seconds computed from file size
+    quint64 m_recordLength; //!< record length in seconds computed from file (or all segments) size
     quint64 m_startingTimeStamp;
+    bool m_endOfFile; //!< End of file reached and all samples delivered (no loop)
 	QTimer m_masterTimer;
     QNetworkAccessManager *m_networkManager;
     QNetworkRequest m_networkRequest;
 
 	void openFileStream();
 	void seekFileStream(int seekMillis);
+	void seekFileStreamTime(qint64 timeMs);
+	void seekSample(quint64 sample);
 	bool applySettings(const FileInputSettings& settings, bool force = false);
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const FileInputSettings& settings, bool force);
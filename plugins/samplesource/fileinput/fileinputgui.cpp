@@ -51,6 +51,7 @@ FileInputGUI::FileInputGUI(DeviceUISet *deviceUISet, QWidget* parent) :
 	m_centerFrequency(0),
 	m_recordLength(0),
 	m_startingTimeStamp(0),
+	m_absoluteTimeMs(0),
 	m_samplesCount(0),
 	m_tickCount(0),
 	m_enableNavTime(false),
@@ -184,6 +185,7 @@ bool FileInputGUI::handleMessage(const Message& message)
 		m_sampleSize = ((FileInput::MsgReportFileInputStreamData&)message).getSampleSize();
 		m_centerFrequency = ((FileInput::MsgReportFileInputStreamData&)message).getCenterFrequency();
 		m_startingTimeStamp = ((FileInput::MsgReportFileInputStreamData&)message).getStartingTimeStamp();
+		m_absoluteTimeMs = m_startingTimeStamp * 1000LL;
 		m_recordLength = ((FileInput::MsgReportFileInputStreamData&)message).getRecordLength();
 		updateWithStreamData();
 		return true;
@@ -191,6 +193,7 @@ bool FileInputGUI::handleMessage(const Message& message)
 	else if (FileInput::MsgReportFileInputStreamTiming::match(message))
 	{
 		m_samplesCount = ((FileInput::MsgReportFileInputStreamTiming&)message).getSamplesCount();
+		m_absoluteTimeMs = ((FileInput::MsgReportFileInputStreamTiming&)message).getAbsoluteTimeMs();
 		updateWithStreamTime();
 		return true;
 	}
@@ -242,7 +245,13 @@ void FileInputGUI::displaySettings()
 {
     blockApplySettings(true);
     ui->playLoop->setChecked(m_settings.m_loop);
-    ui->acceleration->setCurrentIndex(FileInputSettings::getAccelerationIndex(m_settings.m_accelerationFactor));
+
+    if (m_settings.m_unthrottled) {
+        ui->acceleration->setCurrentIndex(ui->acceleration->count() - 1);
+    } else {
+        ui->acceleration->setCurrentIndex(FileInputSettings::getAccelerationIndex(m_settings.m_accelerationFactor));
+    }
+
     blockApplySettings(false);
 }
 
@@ -320,7 +329,7 @@ void FileInputGUI::on_showFileDialog_clicked(bool checked)
 {
     (void) checked;
 	QString fileName = QFileDialog::getOpenFileName(this,
-	    tr("Open I/Q record file"), ".", tr("SDR I/Q Files (*.sdriq)"), 0, QFileDialog::DontUseNativeDialog);
+	    tr("Open I/Q record file"), ".", tr("SDR I/Q Files (*.sdriq *.m3u)"), 0, QFileDialog::DontUseNativeDialog);
 
 	if (fileName != "")
 	{
@@ -335,7 +344,12 @@ void FileInputGUI::on_acceleration_currentIndexChanged(int index)
 {
     if (m_doApplySettings)
     {
-        m_settings.m_accelerationFactor = FileInputSettings::getAccelerationValue(index);
+        m_settings.m_unthrottled = index == ui->acceleration->count() - 1; // last item is as fast as possible
+
+        if (!m_settings.m_unthrottled) {
+            m_settings.m_accelerationFactor = FileInputSettings::getAccelerationValue(index);
+        }
+
         FileInput::MsgConfigureFileInput *message = FileInput::MsgConfigureFileInput::create(m_settings, false);
         m_sampleSource->getInputMessageQueue()->push(message);
     }
@@ -384,10 +398,7 @@ void FileInputGUI::updateWithStreamTime()
 	QString s_timems = t.toString("HH:mm:ss.zzz");
 	ui->relTimeText->setText(s_timems);
 
-    qint64 startingTimeStampMsec = m_startingTimeStamp * 1000LL;
-	QDateTime dt = QDateTime::fromMSecsSinceEpoch(startingTimeStampMsec);
-    dt = dt.addSecs(t_sec);
-    dt = dt.addMSecs(t_msec);
+	QDateTime dt = QDateTime::fromMSecsSinceEpoch(m_absoluteTimeMs); // from the segment being played
 	QString s_date = dt.toString("yyyy-MM-dd HH:mm:ss.zzz");
 	ui->absTimeText->setText(s_date);
 
@@ -427,6 +438,7 @@ void FileInputGUI::setAccelerationCombo()
         ui->acceleration->addItem(s);
     }
 
+    ui->acceleration->addItem(QString("Max"));
     ui->acceleration->blockSignals(false);
 }
 
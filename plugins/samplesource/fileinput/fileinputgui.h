@@ -68,6 +68,7 @@ private:
 	quint64 m_centerFrequency;
     quint64 m_recordLength;
     quint64 m_startingTimeStamp;
+    qint64 m_absoluteTimeMs;
     quint64 m_samplesCount;
 	std::size_t m_tickCount;
 	bool m_enableNavTime;
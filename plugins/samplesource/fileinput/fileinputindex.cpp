@@ -0,0 +1,286 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <algorithm>
+
+#include <QDebug>
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QTextStream>
+#include <QStringList>
+
+#ifdef Q_OS_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "fileinputindex.h"
+
+const int FileInputIndex::m_prefetchSeconds = 2;
+
+FileInputIndex::FileInputIndex() :
+    m_format(RecordFormat::FormatNative),
+    m_unitBytes(0),
+    m_unitSamples(1),
+    m_nbSamples(0),
+    m_crcOK(true)
+{
+    memset(&m_header, 0, sizeof(FileRecord::Header));
+}
+
+void FileInputIndex::clear()
+{
+    m_segments.clear();
+    memset(&m_header, 0, sizeof(FileRecord::Header));
+    m_format = RecordFormat::FormatNative;
+    m_unitBytes = 0;
+    m_unitSamples = 1;
+    m_nbSamples = 0;
+    m_crcOK = true;
+}
+
+bool FileInputIndex::isPlaylist(const QString& fileName)
+{
+    return fileName.endsWith(".m3u", Qt::CaseInsensitive);
+}
+
+bool FileInputIndex::build(const QString& fileName)
+{
+    clear();
+    QStringList fileNames;
+
+    if (isPlaylist(fileName))
+    {
+        QFile playlist(fileName);
+
+        if (!playlist.open(QIODevice::ReadOnly | QIODevice::Text))
+        {
+            qWarning("FileInputIndex::build: cannot open playlist %s", qPrintable(fileName));
+            return false;
+        }
+
+        QDir playlistDir = QFileInfo(fileName).absoluteDir();
+        QTextStream in(&playlist);
+
+        while (!in.atEnd())
+        {
+            QString line = in.readLine().trimmed();
+
+            if (line.isEmpty() || line.startsWith('#')) {
+                continue;
+            }
+
+            fileNames.append(QFileInfo(line).isAbsolute() ? line : playlistDir.filePath(line));
+        }
+    }
+    else
+    {
+        fileNames.append(fileName);
+    }
+
+    for (const QString& segmentFileName : fileNames) {
+        addSegment(segmentFileName);
+    }
+
+    if (m_segments.size() == 0) {
+        return false;
+    }
+
+    // stable so that segments starting in the same second keep the playlist order
+    std::stable_sort(m_segments.begin(), m_segments.end(), [](const Segment& a, const Segment& b) {
+        return a.m_startTimeMs < b.m_startTimeMs;
+    });
+
+    m_header.startTimeStamp = m_segments[0].m_startTimeMs / 1000;
+    m_nbSamples = 0;
+
+    for (Segment& segment : m_segments)
+    {
+        segment.m_firstSample = m_nbSamples;
+        m_nbSamples += segment.m_nbUnits * m_unitSamples;
+    }
+
+    qDebug("FileInputIndex::build: %s: %d segments %llu samples",
+        qPrintable(fileName), getNbSegments(), m_nbSamples);
+
+    return true;
+}
+
+bool FileInputIndex::addSegment(const QString& fileName)
+{
+    std::ifstream stream;
+#ifdef Q_OS_WIN
+    stream.open(fileName.toStdWString().c_str(), std::ios::binary | std::ios::ate);
+#else
+    stream.open(fileName.toStdString().c_str(), std::ios::binary | std::ios::ate);
+#endif
+
+    if (!stream.is_open())
+    {
+        qWarning("FileInputIndex::addSegment: cannot open %s", qPrintable(fileName));
+        return false;
+    }
+
+    quint64 fileSize = stream.tellg();
+
+    if (fileSize <= sizeof(FileRecord::Header))
+    {
+        qWarning("FileInputIndex::addSegment: %s: no samples", qPrintable(fileName));
+        return false;
+    }
+
+    FileRecord::Header header;
+    stream.seekg(0, std::ios_base::beg);
+
+    if (!FileRecord::readHeader(stream, header))
+    {
+        qCritical("FileInputIndex::addSegment: %s: bad CRC32 for header: %x", qPrintable(fileName), header.crc32);
+        m_crcOK = false;
+        return false;
+    }
+
+    if ((header.format >= RecordFormat::FormatEnd) || (header.sampleRate == 0))
+    {
+        qCritical("FileInputIndex::addSegment: %s: unsupported format %u or sample rate %u",
+            qPrintable(fileName), header.format, header.sampleRate);
+        return false;
+    }
+
+    if (m_segments.size() == 0)
+    {
+        m_header = header;
+        m_format = (RecordFormat::Format) header.format;
+        m_unitBytes = RecordFormat::getUnitBytes(m_format, header.sampleSize);
+        m_unitSamples = RecordFormat::getUnitSamples(m_format);
+    }
+    else if ((header.sampleRate != m_header.sampleRate)
+        || (header.sampleSize != m_header.sampleSize)
+        || (header.format != m_header.format)
+        || (header.centerFrequency != m_header.centerFrequency))
+    {
+        qWarning("FileInputIndex::addSegment: %s: stream does not match the first segment. Skipped", qPrintable(fileName));
+        return false;
+    }
+
+    Segment segment;
+    segment.m_fileName = fileName;
+    segment.m_startTimeMs = header.startTimeStamp * 1000LL;
+    segment.m_firstSample = 0;
+    segment.m_nbUnits = (fileSize - sizeof(FileRecord::Header)) / m_unitBytes;
+    m_segments.push_back(segment);
+
+    return true;
+}
+
+int FileInputIndex::findSegment(quint64 sample) const
+{
+    std::vector<Segment>::const_iterator it = std::upper_bound(m_segments.begin(), m_segments.end(), sample,
+        [](quint64 s, const Segment& segment) {
+            return s < segment.m_firstSample;
+        });
+
+    return it == m_segments.begin() ? 0 : (it - m_segments.begin()) - 1;
+}
+
+quint64 FileInputIndex::getSampleAtTime(qint64 timeMs) const
+{
+    if (m_segments.size() == 0) {
+        return 0;
+    }
+
+    std::vector<Segment>::const_iterator it = std::upper_bound(m_segments.begin(), m_segments.end(), timeMs,
+        [](qint64 t, const Segment& segment) {
+            return t < segment.m_startTimeMs;
+        });
+
+    if (it == m_segments.begin()) { // before the recording
+        return 0;
+    }
+
+    const Segment& segment = *(it - 1);
+    quint64 offset = ((timeMs - segment.m_startTimeMs) * m_header.sampleRate) / 1000;
+    quint64 nbSamples = segment.m_nbUnits * m_unitSamples;
+
+    // times in a gap between segments go to the start of the next segment
+    return segment.m_firstSample + (offset < nbSamples ? offset : nbSamples);
+}
+
+qint64 FileInputIndex::getTimeOfSample(quint64 sample) const
+{
+    if (m_segments.size() == 0) {
+        return 0;
+    }
+
+    const Segment& segment = m_segments[findSegment(sample)];
+    return segment.m_startTimeMs + (qint64) (((sample - segment.m_firstSample) * 1000) / m_header.sampleRate);
+}
+
+bool FileInputIndex::openSegment(std::ifstream& stream, int segmentIndex, quint64 unit) const
+{
+    const Segment& segment = m_segments[segmentIndex];
+
+    if (stream.is_open()) {
+        stream.close();
+    }
+
+    stream.clear();
+#ifdef Q_OS_WIN
+    stream.open(segment.m_fileName.toStdWString().c_str(), std::ios::binary);
+#else
+    stream.open(segment.m_fileName.toStdString().c_str(), std::ios::binary);
+#endif
+
+    if (!stream.is_open())
+    {
+        qWarning("FileInputIndex::openSegment: cannot open %s", qPrintable(segment.m_fileName));
+        return false;
+    }
+
+    quint64 offset = sizeof(FileRecord::Header) + unit * m_unitBytes;
+    stream.seekg(offset, std::ios::beg);
+
+    quint64 prefetchBytes = (((quint64) m_prefetchSeconds * m_header.sampleRate) / m_unitSamples) * m_unitBytes;
+    quint64 remainderBytes = unit < segment.m_nbUnits ? (segment.m_nbUnits - unit) * m_unitBytes : 0;
+    prefetch(segment.m_fileName, offset, prefetchBytes);
+
+    // segment ends within the prefetch: start of next segment too
+    if ((remainderBytes < prefetchBytes) && (segmentIndex + 1 < getNbSegments())) {
+        prefetch(m_segments[segmentIndex + 1].m_fileName, sizeof(FileRecord::Header), prefetchBytes - remainderBytes);
+    }
+
+    return true;
+}
+
+void FileInputIndex::prefetch(const QString& fileName, quint64 offset, quint64 nbBytes) const
+{
+#ifdef Q_OS_LINUX
+    // asynchronous read into the page cache so that reads after a jump do not wait on the disk
+    int fd = ::open(QFile::encodeName(fileName).constData(), O_RDONLY);
+
+    if (fd >= 0)
+    {
+        posix_fadvise(fd, offset, nbBytes, POSIX_FADV_WILLNEED);
+        ::close(fd);
+    }
+#else
+    (void) fileName;
+    (void) offset;
+    (void) nbBytes;
+#endif
+}
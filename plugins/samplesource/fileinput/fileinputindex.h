@@ -0,0 +1,87 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_FILEINPUTINDEX_H
+#define INCLUDE_FILEINPUTINDEX_H
+
+#include <fstream>
+#include <vector>
+
+#include <QString>
+
+#include "dsp/filerecord.h"
+#include "dsp/recordformat.h"
+
+/**
+ * Time index of a recording made of one record file or of a playlist of record files (segments).
+ *
+ * It is built from the segment headers only: samples of a record file are at a constant rate from
+ * the header start time so the file and byte offset of a sample or of an absolute (UTC) time is
+ * computed directly without reading the samples. Segments are concatenated in time order and the
+ * sample index of the recording runs continuously through them.
+ *
+ * A playlist is a text file with .m3u extension listing one record file per line. Relative paths
+ * are relative to the playlist directory and lines starting with # are ignored. All segments must
+ * have the same sample rate, sample size, format and center frequency as the first valid one.
+ */
+class FileInputIndex
+{
+public:
+    struct Segment
+    {
+        QString m_fileName;
+        qint64 m_startTimeMs;  //!< UTC start time from the segment header
+        quint64 m_firstSample; //!< Index of the first sample of the segment in the recording
+        quint64 m_nbUnits;     //!< Number of whole read units in the segment
+    };
+
+    FileInputIndex();
+
+    bool build(const QString& fileName); //!< Returns true if at least one valid segment was found
+    void clear();
+    static bool isPlaylist(const QString& fileName);
+
+    bool isCrcOK() const { return m_crcOK; } //!< All headers read had a good CRC
+    const FileRecord::Header& getHeader() const { return m_header; } //!< Header of the first segment
+    RecordFormat::Format getFormat() const { return m_format; }
+    int getNbSegments() const { return m_segments.size(); }
+    const Segment& getSegment(int segmentIndex) const { return m_segments[segmentIndex]; }
+    quint64 getNbSamples() const { return m_nbSamples; }
+    int getUnitBytes() const { return m_unitBytes; }
+    int getUnitSamples() const { return m_unitSamples; }
+
+    int findSegment(quint64 sample) const;     //!< Segment holding the sample (the last one past the end)
+    quint64 getSampleAtTime(qint64 timeMs) const; //!< First sample at or after an absolute time
+    qint64 getTimeOfSample(quint64 sample) const; //!< Absolute time of a sample
+    bool openSegment(std::ifstream& stream, int segmentIndex, quint64 unit) const; //!< Open stream at unit of segment and prefetch
+
+private:
+    std::vector<Segment> m_segments;
+    FileRecord::Header m_header;
+    RecordFormat::Format m_format;
+    int m_unitBytes;
+    int m_unitSamples;
+    quint64 m_nbSamples;
+    bool m_crcOK;
+
+    static const int m_prefetchSeconds; //!< Amount of samples read ahead after opening a segment
+
+    bool addSegment(const QString& fileName);
+    void prefetch(const QString& fileName, quint64 offset, quint64 nbBytes) const;
+};
+
+#endif // INCLUDE_FILEINPUTINDEX_H
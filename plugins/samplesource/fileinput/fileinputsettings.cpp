@@ -33,6 +33,7 @@ void FileInputSettings::resetToDefaults()
     m_fileName = "./test.sdriq";
     m_accelerationFactor = 1;
     m_loop = true;
+    m_unthrottled = false;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -49,6 +50,7 @@ QByteArray FileInputSettings::serialize() const
     s.writeString(5, m_reverseAPIAddress);
     s.writeU32(6, m_reverseAPIPort);
     s.writeU32(7, m_reverseAPIDeviceIndex);
+    s.writeBool(8, m_unthrottled);
 
     return s.final();
 }
@@ -81,6 +83,7 @@ bool FileInputSettings::deserialize(const QByteArray& data)
 
         d.readU32(7, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readBool(8, &m_unthrottled, false);
 
         return true;
     }
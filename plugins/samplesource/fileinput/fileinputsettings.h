@@ -27,6 +27,7 @@ struct FileInputSettings {
     QString m_fileName;
     quint32 m_accelerationFactor;
     bool m_loop;
+    bool m_unthrottled; //!< Read as fast as the processing allows (offline processing)
     bool     m_useReverseAPI;
     QString  m_reverseAPIAddress;
     uint16_t m_reverseAPIPort;
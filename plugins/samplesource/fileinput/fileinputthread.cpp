@@ -18,38 +18,55 @@
 #include <stdio.h>
 #include <errno.h>
 #include <assert.h>
+#include <algorithm>
 #include <QDebug>
 
 #include "dsp/filerecord.h"
 #include "fileinputthread.h"
+#include "fileinputindex.h"
 #include "dsp/samplesinkfifo.h"
+#include "dsp/dspdevicesourceengine.h"
 #include "util/messagequeue.h"
 
 MESSAGE_CLASS_DEFINITION(FileInputThread::MsgReportEOF, Message)
 
 FileInputThread::FileInputThread(std::ifstream *samplesStream,
+        const FileInputIndex *index,
         SampleSinkFifo* sampleFifo,
+        const DSPDeviceSourceEngine *deviceSourceEngine,
         const QTimer& timer,
         MessageQueue *fileInputMessageQueue,
         QObject* parent) :
 	QThread(parent),
 	m_running(false),
 	m_ifstream(samplesStream),
+	m_index(index),
+	m_segment(0),
+	m_segmentUnit(0),
 	m_fileBuf(0),
 	m_convertBuf(0),
 	m_bufsize(0),
 	m_chunksize(0),
 	m_sampleFifo(sampleFifo),
+	m_deviceSourceEngine(deviceSourceEngine),
 	m_samplesCount(0),
 	m_timer(timer),
 	m_fileInputMessageQueue(fileInputMessageQueue),
     m_samplerate(0),
 	m_samplesize(0),
-	m_samplebytes(0),
+	m_format(RecordFormat::FormatNative),
+	m_unitBytes(0),
+	m_unitSamples(1),
+	m_chunkSamples(0),
+	m_sampleCredit(0),
     m_throttlems(FILESOURCE_THROTTLE_MS),
-    m_throttleToggle(false)
+    m_throttleToggle(false),
+    m_unthrottled(false),
+    m_eof(false),
+    m_eofReported(false)
 {
     assert(m_ifstream != 0);
+    assert(m_index != 0);
 }
 
 FileInputThread::~FileInputThread()
@@ -76,11 +93,16 @@ void FileInputThread::startWork()
         qDebug() << "FileInputThread::startWork: file stream open, starting...";
         m_startWaitMutex.lock();
         m_elapsedTimer.start();
+        m_eof = false;
+        m_eofReported = false;
         start();
         while(!m_running)
             m_startWaiter.wait(&m_startWaitMutex, 100);
         m_startWaitMutex.unlock();
-        connect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+
+        if (!m_unthrottled) {
+            connect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+        }
     }
     else
     {
@@ -96,15 +118,16 @@ void FileInputThread::stopWork()
 	wait();
 }
 
-void FileInputThread::setSampleRateAndSize(int samplerate, quint32 samplesize)
+void FileInputThread::setSampleRateAndSize(int samplerate, quint32 samplesize, RecordFormat::Format format)
 {
 	qDebug() << "FileInputThread::setSampleRateAndSize:"
 			<< " new rate:" << samplerate
 			<< " new size:" << samplesize
+			<< " new format:" << RecordFormat::getName(format)
 			<< " old rate:" << m_samplerate
 			<< " old size:" << m_samplesize;
 
-	if ((samplerate != m_samplerate) || (samplesize != m_samplesize))
+	if ((samplerate != m_samplerate) || (samplesize != m_samplesize) || (format != m_format))
 	{
 		if (m_running) {
 			stopWork();
@@ -112,8 +135,12 @@ void FileInputThread::setSampleRateAndSize(int samplerate, quint32 samplesize)
 
 		m_samplerate = samplerate;
 		m_samplesize = samplesize;
-		m_samplebytes = m_samplesize > 16 ? sizeof(int32_t) : sizeof(int16_t);
-        m_chunksize = (m_samplerate * 2 * m_samplebytes * m_throttlems) / 1000;
+		m_format = format;
+		m_unitBytes = RecordFormat::getUnitBytes(m_format, m_samplesize);
+		m_unitSamples = RecordFormat::getUnitSamples(m_format);
+		m_chunkSamples = (m_samplerate * m_throttlems) / 1000;
+		m_sampleCredit = 0;
+        m_chunksize = m_unitBytes * (m_chunkSamples / m_unitSamples);
 
         setBuffers(m_chunksize);
 	}
@@ -121,12 +148,19 @@ void FileInputThread::setSampleRateAndSize(int samplerate, quint32 samplesize)
 	//m_samplerate = samplerate;
 }
 
+void FileInputThread::setPosition(int segment, quint64 unit)
+{
+    m_segment = segment;
+    m_segmentUnit = unit;
+    m_samplesCount = m_index->getSegment(segment).m_firstSample + unit * m_unitSamples;
+}
+
 void FileInputThread::setBuffers(std::size_t chunksize)
 {
     if (chunksize > m_bufsize)
     {
         m_bufsize = chunksize;
-        int nbSamples = m_bufsize/(2 * m_samplebytes);
+        int nbSamples = (m_bufsize / m_unitBytes) * m_unitSamples;
 
         if (m_fileBuf == 0)
         {
@@ -164,14 +198,66 @@ void FileInputThread::run()
 	m_running = true;
 	m_startWaiter.wakeAll();
 
-	while(m_running) // actual work is in the tick() function
+	while(m_running)
 	{
-		sleep(1);
+		if (m_unthrottled) {
+			readUnthrottled();
+		} else {
+			sleep(1); // actual work is in the tick() function
+		}
 	}
 
 	m_running = false;
 }
 
+void FileInputThread::readUnthrottled()
+{
+    if (m_eof)
+    {
+        // end of file is reported once all samples have been taken from the FIFO
+        if (!m_eofReported && (m_sampleFifo->fill() == 0))
+        {
+            m_eofReported = true;
+            MsgReportEOF *message = MsgReportEOF::create();
+            m_fileInputMessageQueue->push(message);
+        }
+
+        usleep(1000);
+        return;
+    }
+
+    // large reads of a quarter of the FIFO when there is room for it
+    unsigned int chunkSamples = std::min(m_sampleFifo->size() / 4, (unsigned int) FILESOURCE_UNTHROTTLED_CHUNK);
+    unsigned int sharedBasebandSize = m_deviceSourceEngine ? m_deviceSourceEngine->getSharedBasebandSize() : 0;
+
+    if (sharedBasebandSize > 0) {
+        chunkSamples = std::min(chunkSamples, sharedBasebandSize / 4);
+    }
+
+    qint64 nbUnits = std::max(chunkSamples / m_unitSamples, 1U);
+    unsigned int fifoFill = m_sampleFifo->fill();
+
+    // The device engine copies the FIFO to the shared baseband which never waits for its readers.
+    // The slowest of them must have room for what is still in the FIFO plus this read.
+    // Sinks fed with a copy of the baseband and shared channelizer sub-band rings are not accounted for.
+    if ((m_sampleFifo->size() - fifoFill < nbUnits * m_unitSamples)
+     || ((sharedBasebandSize > 0) && (m_deviceSourceEngine->getSharedBasebandFree() < fifoFill + nbUnits * m_unitSamples)))
+    {
+        usleep(1000); // backpressure
+        return;
+    }
+
+    m_chunksize = nbUnits * m_unitBytes;
+    setBuffers(m_chunksize);
+    qint64 nbRead = readUnits(m_fileBuf, nbUnits);
+    writeToSampleFifo(m_fileBuf, (qint32) (nbRead * m_unitBytes));
+    m_samplesCount += nbRead * m_unitSamples;
+
+    if (nbRead < nbUnits) {
+        m_eof = true;
+    }
+}
+
 void FileInputThread::tick()
 {
 	if (m_running)
@@ -181,70 +267,78 @@ void FileInputThread::tick()
         if (throttlems != m_throttlems)
         {
             m_throttlems = throttlems;
-            m_chunksize = 2 * m_samplebytes * ((m_samplerate * (m_throttlems+(m_throttleToggle ? 1 : 0))) / 1000);
+            m_chunkSamples = (m_samplerate * (m_throttlems+(m_throttleToggle ? 1 : 0))) / 1000;
             m_throttleToggle = !m_throttleToggle;
-            setBuffers(m_chunksize);
         }
 
+        // whole units only. The remainder is due at next tick
+        m_sampleCredit += m_chunkSamples;
+        qint64 nbUnits = m_sampleCredit / m_unitSamples;
+        m_sampleCredit -= nbUnits * m_unitSamples;
+        m_chunksize = nbUnits * m_unitBytes;
+        setBuffers(m_chunksize);
+
 		// read samples directly feeding the SampleFifo (no callback)
-		m_ifstream->read(reinterpret_cast<char*>(m_fileBuf), m_chunksize);
+		qint64 nbRead = readUnits(m_fileBuf, nbUnits);
+		writeToSampleFifo(m_fileBuf, (qint32) (nbRead * m_unitBytes));
+		m_samplesCount += nbRead * m_unitSamples;
 
-        if (m_ifstream->eof())
+        if (nbRead < nbUnits)
         {
-        	writeToSampleFifo(m_fileBuf, (qint32) m_ifstream->gcount());
         	MsgReportEOF *message = MsgReportEOF::create();
         	m_fileInputMessageQueue->push(message);
         }
-        else
+	}
+}
+
+qint64 FileInputThread::readUnits(quint8 *buf, qint64 nbUnits)
+{
+    qint64 nbRead = 0;
+
+    while (nbRead < nbUnits)
+    {
+        const FileInputIndex::Segment& segment = m_index->getSegment(m_segment);
+        qint64 segmentUnits = segment.m_nbUnits > m_segmentUnit ? segment.m_nbUnits - m_segmentUnit : 0;
+        qint64 toRead = std::min(nbUnits - nbRead, segmentUnits);
+
+        if (toRead > 0)
         {
-        	writeToSampleFifo(m_fileBuf, (qint32) m_chunksize);
-    		m_samplesCount += m_chunksize / (2 * m_samplebytes);
+            m_ifstream->read(reinterpret_cast<char*>(buf + nbRead * m_unitBytes), toRead * m_unitBytes);
+            qint64 unitsRead = m_ifstream->gcount() / m_unitBytes;
+            nbRead += unitsRead;
+            m_segmentUnit += unitsRead;
+
+            if (unitsRead < toRead) { // file shorter than indexed: end of segment
+                m_segmentUnit = segment.m_nbUnits;
+            }
         }
-	}
+
+        if (m_segmentUnit < segment.m_nbUnits) {
+            continue;
+        }
+
+        // next segment continues the stream
+        if ((m_segment + 1 >= m_index->getNbSegments()) || !m_index->openSegment(*m_ifstream, m_segment + 1, 0)) {
+            break;
+        }
+
+        m_segment++;
+        m_segmentUnit = 0;
+    }
+
+    return nbRead;
 }
 
 void FileInputThread::writeToSampleFifo(const quint8* buf, qint32 nbBytes)
 {
-	if (m_samplesize == 16)
+	if ((m_format == RecordFormat::FormatNative) && (m_samplesize == SDR_RX_SAMP_SZ))
 	{
-		if (SDR_RX_SAMP_SZ == 16)
-		{
-			m_sampleFifo->write(buf, nbBytes);
-		}
-		else if (SDR_RX_SAMP_SZ == 24)
-		{
-			FixReal *convertBuf = (FixReal *) m_convertBuf;
-			const int16_t *fileBuf = (int16_t *) buf;
-			int nbSamples = nbBytes / (2 * m_samplebytes);
-
-			for (int is = 0; is < nbSamples; is++)
-			{
-				convertBuf[2*is]   = fileBuf[2*is] << 8;
-				convertBuf[2*is+1] = fileBuf[2*is+1] << 8;
-			}
-
-			m_sampleFifo->write((quint8*) convertBuf, nbSamples*sizeof(Sample));
-		}
+		m_sampleFifo->write(buf, nbBytes);
 	}
-	else if (m_samplesize == 24)
+	else
 	{
-		if (SDR_RX_SAMP_SZ == 24)
-		{
-			m_sampleFifo->write(buf, nbBytes);
-		}
-		else if (SDR_RX_SAMP_SZ == 16)
-		{
-			FixReal *convertBuf = (FixReal *) m_convertBuf;
-			const int32_t *fileBuf = (int32_t *) buf;
-			int nbSamples = nbBytes / (2 * m_samplebytes);
-
-			for (int is = 0; is < nbSamples; is++)
-			{
-				convertBuf[2*is]   = fileBuf[2*is] >> 8;
-				convertBuf[2*is+1] = fileBuf[2*is+1] >> 8;
-			}
-
-			m_sampleFifo->write((quint8*) convertBuf, nbSamples*sizeof(Sample));
-		}
+		int nbUnits = nbBytes / m_unitBytes;
+		RecordFormat::unpack(m_format, m_samplesize, (Sample*) m_convertBuf, (const char*) buf, nbUnits);
+		m_sampleFifo->write(m_convertBuf, nbUnits * m_unitSamples * sizeof(Sample));
 	}
 }
@@ -28,12 +28,16 @@
 #include <cstdlib>
 
 #include "dsp/inthalfbandfilter.h"
+#include "dsp/recordformat.h"
 #include "util/message.h"
 
 #define FILESOURCE_THROTTLE_MS 50
+#define FILESOURCE_UNTHROTTLED_CHUNK (1<<20) //!< Maximum number of I/Q samples of a read in unthrottled mode
 
 class SampleSinkFifo;
+class DSPDeviceSourceEngine;
 class MessageQueue;
+class FileInputIndex;
 
 class FileInputThread : public QThread {
 	Q_OBJECT
@@ -54,7 +58,9 @@ public:
     };
 
 	FileInputThread(std::ifstream *samplesStream,
+	        const FileInputIndex *index,
 	        SampleSinkFifo* sampleFifo,
+	        const DSPDeviceSourceEngine *deviceSourceEngine,
 	        const QTimer& timer,
 	        MessageQueue *fileInputMessageQueue,
 	        QObject* parent = NULL);
@@ -62,11 +68,12 @@ public:
 
 	void startWork();
 	void stopWork();
-	void setSampleRateAndSize(int samplerate, quint32 samplesize);
+	void setSampleRateAndSize(int samplerate, quint32 samplesize, RecordFormat::Format format);
     void setBuffers(std::size_t chunksize);
 	bool isRunning() const { return m_running; }
     quint64 getSamplesCount() const { return m_samplesCount; }
-    void setSamplesCount(quint64 samplesCount) { m_samplesCount = samplesCount; }
+    void setPosition(int segment, quint64 unit); //!< Stream must be at this unit of this segment. To be called when not working
+    void setUnthrottled(bool unthrottled) { m_unthrottled = unthrottled; } //!< To be called when not working
 
 private:
 	QMutex m_startWaitMutex;
@@ -74,25 +81,38 @@ private:
 	volatile bool m_running;
 
 	std::ifstream* m_ifstream;
+	const FileInputIndex *m_index;
+	int m_segment;          //!< Index of the segment being read
+	quint64 m_segmentUnit;  //!< Next unit to read in the segment
 	quint8  *m_fileBuf;
 	quint8  *m_convertBuf;
 	std::size_t m_bufsize;
     qint64 m_chunksize;
 	SampleSinkFifo* m_sampleFifo;
+    const DSPDeviceSourceEngine *m_deviceSourceEngine; //!< Unthrottled mode: its shared baseband readers must keep up too
     quint64 m_samplesCount;
     const QTimer& m_timer;
     MessageQueue *m_fileInputMessageQueue;
 
 	int m_samplerate;      //!< File I/Q stream original sample rate
     quint64 m_samplesize;  //!< File effective sample size in bits (I or Q). Ex: 16, 24.
-    quint64 m_samplebytes; //!< Number of bytes used to store a I or Q sample. Ex: 2. 4.
+    RecordFormat::Format m_format; //!< File on-disk sample format
+    int m_unitBytes;       //!< Number of bytes of a read unit (one sample or one block of samples depending on format)
+    int m_unitSamples;     //!< Number of I/Q samples in a read unit
+    qint64 m_chunkSamples; //!< Number of I/Q samples due at each tick
+    qint64 m_sampleCredit; //!< Samples due but not read yet because they do not make a whole unit
     qint64 m_throttlems;
     QElapsedTimer m_elapsedTimer;
     bool m_throttleToggle;
+    bool m_unthrottled;    //!< Read in the thread as fast as the FIFO is emptied instead of at timer ticks
+    bool m_eof;            //!< Unthrottled mode: end of file was read
+    bool m_eofReported;    //!< Unthrottled mode: end of file was reported after the FIFO was drained
 
 	void run();
 	//void decimate1(SampleVector::iterator* it, const qint16* buf, qint32 len);
 	void writeToSampleFifo(const quint8* buf, qint32 nbBytes);
+	void readUnthrottled();
+	qint64 readUnits(quint8 *buf, qint64 nbUnits); //!< Read across segments. Returns less than nbUnits at end of recording
 
 private slots:
 	void tick();
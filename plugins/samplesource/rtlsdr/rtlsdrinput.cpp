@@ -107,6 +107,8 @@ bool RTLSDRInput::openDevice()
         return false;
     }
 
+    m_sampleFifo.setLockFree(true); // written by the device thread only
+
     int device;
 
     if ((device = rtlsdr_get_index_by_serial(qPrintable(m_deviceAPI->getSamplingDeviceSerial()))) < 0)
@@ -207,6 +209,7 @@ bool RTLSDRInput::start()
 	m_rtlSDRThread->setSamplerate(m_settings.m_devSampleRate);
 	m_rtlSDRThread->setLog2Decimation(m_settings.m_log2Decim);
 	m_rtlSDRThread->setFcPos((int) m_settings.m_fcPos);
+	m_deviceAPI->registerWorkerThread(m_rtlSDRThread); // device set thread policy applies
 
 	m_rtlSDRThread->startWork();
 
@@ -236,6 +239,7 @@ void RTLSDRInput::stop()
 	if (m_rtlSDRThread != 0)
 	{
 		m_rtlSDRThread->stopWork();
+		m_deviceAPI->unregisterWorkerThread(m_rtlSDRThread);
 		delete m_rtlSDRThread;
 		m_rtlSDRThread = 0;
 	}
@@ -567,6 +571,7 @@ bool RTLSDRInput::applySettings(const RTLSDRSettings& settings, bool force)
     if (forwardChange)
     {
         int sampleRate = m_settings.m_devSampleRate/(1<<m_settings.m_log2Decim);
+        m_sampleFifo.setWakeupThreshold(SampleSinkFifo::getWakeupThresholdPolicy(sampleRate)); // batched engine wakeups
         DSPSignalNotification *notif = new DSPSignalNotification(sampleRate, m_settings.m_centerFrequency);
         m_fileSink->handleMessage(*notif); // forward to file sink
         m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
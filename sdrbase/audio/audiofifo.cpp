@@ -78,6 +78,10 @@ uint AudioFifo::write(const quint8* data, uint32_t numSamples)
 	total = MIN(numSamples, m_size - m_fill);
 	remaining = total;
 
+	if (total < numSamples) {
+		m_counters.overflow(numSamples - total);
+	}
+
 	while (remaining != 0)
 	{
 		if (isFull())
@@ -115,6 +119,10 @@ uint AudioFifo::read(quint8* data, uint32_t numSamples)
 	total = MIN(numSamples, m_fill);
 	remaining = total;
 
+	if (total < numSamples) {
+		m_counters.underrun(numSamples - total);
+	}
+
 	while (remaining != 0)
 	{
 		if (isEmpty())
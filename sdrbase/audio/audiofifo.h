@@ -24,6 +24,7 @@
 #include <QWaitCondition>
 
 #include "dsp/dsptypes.h"
+#include "dsp/fifocounters.h"
 #include "export.h"
 
 class SDRBASE_API AudioFifo : public QObject {
@@ -46,6 +47,7 @@ public:
 	inline bool isEmpty() const { return m_fill == 0; }
 	inline bool isFull() const { return m_fill == m_size; }
 	inline uint32_t size() const { return m_size; }
+	const FifoCounters& getCounters() const { return m_counters; } //!< short writes as overflows and short reads as underruns
 
 private:
 	QMutex m_mutex;
@@ -59,6 +61,8 @@ private:
 	uint32_t m_head;
 	uint32_t m_tail;
 
+	FifoCounters m_counters;
+
 	bool create(uint32_t numSamples);
 };
 
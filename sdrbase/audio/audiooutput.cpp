@@ -230,6 +230,11 @@ qint64 AudioOutput::readData(char* data, qint64 maxLen)
 
 	unsigned int samplesPerBuffer = maxLen / 4;
 
+	return mix((qint16*) data, samplesPerBuffer) * 4;
+}
+
+unsigned int AudioOutput::mix(qint16 *data, unsigned int samplesPerBuffer)
+{
 	if (samplesPerBuffer == 0)
 	{
 		return 0;
@@ -253,7 +258,7 @@ qint64 AudioOutput::readData(char* data, qint64 maxLen)
 	{
 		// use outputBuffer as temp - yes, one memcpy could be saved
 		unsigned int samples = (*it)->read((quint8*) data, samplesPerBuffer);
-		const qint16* src = (const qint16*) data;
+		const qint16* src = data;
 		std::vector<qint32>::iterator dst = m_mixBuffer.begin();
 
 //		if (samples != framesPerBuffer)
@@ -274,7 +279,7 @@ qint64 AudioOutput::readData(char* data, qint64 maxLen)
 	// convert to int16
 
 	//std::vector<qint32>::const_iterator src = m_mixBuffer.begin(); // Valgrind optim
-	qint16* dst = (qint16*) data;
+	qint16* dst = data;
 	qint32 sl, sr;
 
 	for (unsigned int i = 0; i < samplesPerBuffer; i++)
@@ -332,7 +337,7 @@ qint64 AudioOutput::readData(char* data, qint64 maxLen)
 		}
 	}
 
-	return samplesPerBuffer * 4;
+	return samplesPerBuffer;
 }
 
 qint64 AudioOutput::writeData(const char* data, qint64 len)
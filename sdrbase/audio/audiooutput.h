@@ -72,6 +72,10 @@ public:
 	void setUdpChannelFormat(UDPChannelCodec udpChannelCodec, bool stereo, int sampleRate);
 	void setUdpDecimation(uint32_t decimation);
 
+	/** Sum nbSamples stereo samples of all FIFOs into data with clipping. Core of the audio callback.
+	 *  data is also used as temporary storage for the FIFO reads. Returns the number of samples written. */
+	unsigned int mix(qint16 *data, unsigned int nbSamples);
+
 private:
 	QMutex m_mutex;
 	QAudioOutput* m_audioOutput;
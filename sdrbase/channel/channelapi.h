@@ -24,9 +24,13 @@
 #include <QByteArray>
 #include <stdint.h>
 
+#include "util/threadpolicy.h"
 #include "export.h"
 
+class QThread;
 class DeviceAPI;
+class DSPTelemetry;
+class ChannelRecorder;
 
 namespace SWGSDRangel
 {
@@ -107,6 +111,29 @@ public:
         errorMessage = "Not implemented"; return 501;
     }
 
+    /**
+     * Hot path counters of the channel baseband if any
+     */
+    virtual const DSPTelemetry *getTelemetry() const { return nullptr; }
+
+    /**
+     * Thread running the channel baseband if any. The channel thread policy is applied to it.
+     */
+    virtual QThread *getBasebandThread() { return nullptr; }
+
+    /**
+     * Baseband object running in the baseband thread if any. Used to post calls to that thread.
+     */
+    virtual QObject *getBaseband() { return nullptr; }
+
+    /**
+     * Recording tap of the channel samples after its channelizer if any
+     */
+    virtual ChannelRecorder *getRecorder() { return nullptr; }
+
+    const ThreadPolicy& getThreadPolicy() const { return m_threadPolicy; }
+    void setThreadPolicy(const ThreadPolicy& threadPolicy) { m_threadPolicy = threadPolicy; } //!< Applied by DeviceAPI::applyThreadPolicy
+
     int getIndexInDeviceSet() const { return m_indexInDeviceSet; }
     void setIndexInDeviceSet(int indexInDeviceSet) { m_indexInDeviceSet = indexInDeviceSet; }
     int getDeviceSetIndex() const { return m_deviceSetIndex; }
@@ -133,6 +160,7 @@ private:
     int m_deviceSetIndex;
     DeviceAPI *m_deviceAPI;
     uint64_t m_uid;
+    ThreadPolicy m_threadPolicy; //!< Default to follow the device set policy CPUs
 };
 
 
@@ -15,6 +15,8 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <QThread>
+
 #include "plugin/plugininstancegui.h"
 #include "plugin/plugininterface.h"
 #include "dsp/dspdevicesourceengine.h"
@@ -141,6 +143,7 @@ void DeviceAPI::addChannelSinkAPI(ChannelAPI* channelAPI)
 {
     m_channelSinkAPIs.append(channelAPI);
     renumerateChannels();
+    applyThreadPolicy(channelAPI);
 }
 
 void DeviceAPI::removeChannelSinkAPI(ChannelAPI* channelAPI)
@@ -156,6 +159,7 @@ void DeviceAPI::addChannelSourceAPI(ChannelAPI* channelAPI)
 {
     m_channelSourceAPIs.append(channelAPI);
     renumerateChannels();
+    applyThreadPolicy(channelAPI);
 }
 
 void DeviceAPI::removeChannelSourceAPI(ChannelAPI* channelAPI)
@@ -171,6 +175,7 @@ void DeviceAPI::addMIMOChannelAPI(ChannelAPI* channelAPI)
 {
     m_mimoChannelAPIs.append(channelAPI);
     renumerateChannels();
+    applyThreadPolicy(channelAPI);
 }
 
 void DeviceAPI::removeMIMOChannelAPI(ChannelAPI *channelAPI)
@@ -491,6 +496,7 @@ void DeviceAPI::loadSamplingDeviceSettings(const Preset* preset)
     if (m_deviceSourceEngine && (preset->isSourcePreset()))
     {
         qDebug("DeviceAPI::loadSamplingDeviceSettings: Loading Rx preset [%s | %s]", qPrintable(preset->getGroup()), qPrintable(preset->getDescription()));
+        setThreadPolicy(preset->getThreadPolicy());
 
         const QByteArray* sourceConfig = preset->findBestDeviceConfig(m_samplingDeviceId, m_samplingDeviceSerial, m_samplingDeviceSequence);
         qint64 centerFrequency = preset->getCenterFrequency();
@@ -537,6 +543,7 @@ void DeviceAPI::loadSamplingDeviceSettings(const Preset* preset)
     else if (m_deviceSinkEngine && preset->isSinkPreset())
     {
         qDebug("DeviceAPI::loadSamplingDeviceSettings: Loading Tx preset [%s | %s]", qPrintable(preset->getGroup()), qPrintable(preset->getDescription()));
+        setThreadPolicy(preset->getThreadPolicy());
 
         const QByteArray* sinkConfig = preset->findBestDeviceConfig(m_samplingDeviceId, m_samplingDeviceSerial, m_samplingDeviceSequence);
         qint64 centerFrequency = preset->getCenterFrequency();
@@ -571,6 +578,7 @@ void DeviceAPI::loadSamplingDeviceSettings(const Preset* preset)
     else if (m_deviceMIMOEngine && preset->isMIMOPreset())
     {
         qDebug("DeviceAPI::loadSamplingDeviceSettings: Loading MIMO preset [%s | %s]", qPrintable(preset->getGroup()), qPrintable(preset->getDescription()));
+        setThreadPolicy(preset->getThreadPolicy());
 
         const QByteArray* mimoConfig = preset->findBestDeviceConfig(m_samplingDeviceId, m_samplingDeviceSerial, m_samplingDeviceSequence);
         qint64 centerFrequency = preset->getCenterFrequency();
@@ -614,6 +622,7 @@ void DeviceAPI::saveSamplingDeviceSettings(Preset* preset)
     {
         qDebug("DeviceAPI::saveSamplingDeviceSettings: serializing source %s[%d]: %s",
             qPrintable(m_samplingDeviceId), m_samplingDeviceSequence, qPrintable(m_samplingDeviceSerial));
+        preset->setThreadPolicy(m_threadPolicy);
 
         if (m_samplingDevicePluginInstanceUI) // GUI flavor
         {
@@ -634,6 +643,7 @@ void DeviceAPI::saveSamplingDeviceSettings(Preset* preset)
     {
         qDebug("DeviceAPI::saveSamplingDeviceSettings: serializing sink %s[%d]: %s",
             qPrintable(m_samplingDeviceId), m_samplingDeviceSequence, qPrintable(m_samplingDeviceSerial));
+        preset->setThreadPolicy(m_threadPolicy);
 
         if (m_samplingDevicePluginInstanceUI) // GUI flavor
         {
@@ -654,6 +664,7 @@ void DeviceAPI::saveSamplingDeviceSettings(Preset* preset)
     {
         qDebug("DeviceAPI::saveSamplingDeviceSettings: serializing MIMO %s[%d]: %s",
             qPrintable(m_samplingDeviceId), m_samplingDeviceSequence, qPrintable(m_samplingDeviceSerial));
+        preset->setThreadPolicy(m_threadPolicy);
 
         if (m_samplingDevicePluginInstanceUI) // GUI flavor
         {
@@ -832,6 +843,65 @@ void DeviceAPI::clearBuddiesLists()
     m_sinkBuddies.clear();
 }
 
+void DeviceAPI::setThreadPolicy(const ThreadPolicy& threadPolicy)
+{
+    m_threadPolicy = threadPolicy;
+
+    if (m_deviceSourceEngine) {
+        m_threadPolicy.apply(m_deviceSourceEngine, m_deviceSourceEngine); // engines live in their own thread and run its event loop
+    }
+    if (m_deviceSinkEngine) {
+        m_threadPolicy.apply(m_deviceSinkEngine, m_deviceSinkEngine);
+    }
+    if (m_deviceMIMOEngine) {
+        m_threadPolicy.apply(m_deviceMIMOEngine, m_deviceMIMOEngine);
+    }
+
+    for (QThread *thread : m_workerThreads) {
+        m_threadPolicy.apply(thread);
+    }
+
+    // channels without their own policy follow the device set CPUs
+    for (ChannelAPI *channelAPI : m_channelSinkAPIs) {
+        applyThreadPolicy(channelAPI);
+    }
+    for (ChannelAPI *channelAPI : m_channelSourceAPIs) {
+        applyThreadPolicy(channelAPI);
+    }
+    for (ChannelAPI *channelAPI : m_mimoChannelAPIs) {
+        applyThreadPolicy(channelAPI);
+    }
+}
+
+void DeviceAPI::registerWorkerThread(QThread *thread)
+{
+    if (thread && !m_workerThreads.contains(thread))
+    {
+        m_workerThreads.append(thread);
+        m_threadPolicy.apply(thread);
+    }
+}
+
+void DeviceAPI::unregisterWorkerThread(QThread *thread)
+{
+    m_workerThreads.removeOne(thread);
+}
+
+void DeviceAPI::applyThreadPolicy(ChannelAPI *channelAPI)
+{
+    QThread *thread = channelAPI->getBasebandThread();
+
+    if (thread)
+    {
+        // the baseband runs the thread event loop unless it is in the channel thread pool
+        QObject *baseband = channelAPI->getBaseband();
+        channelAPI->getThreadPolicy().inherit(m_threadPolicy).apply(
+            thread,
+            baseband && (baseband->thread() == thread) ? baseband : nullptr
+        );
+    }
+}
+
 void DeviceAPI::renumerateChannels()
 {
     if (m_streamType == StreamSingleRx)
@@ -22,8 +22,10 @@
 #include <QString>
 #include <QTimer>
 
+#include "util/threadpolicy.h"
 #include "export.h"
 
+class QThread;
 class BasebandSampleSink;
 class BasebandSampleSource;
 class MIMOChannel;
@@ -172,6 +174,12 @@ public:
 
     const QTimer& getMasterTimer() const { return m_masterTimer; } //!< This is the DSPEngine master timer
 
+    void setThreadPolicy(const ThreadPolicy& threadPolicy); //!< Set and apply the policy of the engine and worker threads and default of channels
+    const ThreadPolicy& getThreadPolicy() const { return m_threadPolicy; }
+    void registerWorkerThread(QThread *thread);   //!< Device worker thread to which the device set policy applies
+    void unregisterWorkerThread(QThread *thread);
+    void applyThreadPolicy(ChannelAPI *channelAPI); //!< Apply the policy of the channel or else the device set default to its baseband thread
+
 protected:
     // common
 
@@ -213,6 +221,11 @@ protected:
     DSPDeviceMIMOEngine *m_deviceMIMOEngine;
     QList<ChannelAPI*> m_mimoChannelAPIs;
 
+    // Threading
+
+    ThreadPolicy m_threadPolicy;
+    QList<QThread*> m_workerThreads;
+
 private:
     void renumerateChannels();
 };
@@ -0,0 +1,311 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <algorithm>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#endif
+
+#include <QMutexLocker>
+#include <QDebug>
+
+#include "asyncfilewriter.h"
+
+const std::size_t AsyncFileWriter::m_alignment = 4096; // O_DIRECT buffer, size and offset alignment
+const int AsyncFileWriter::m_idleWaitMs = 100;
+
+AsyncFileWriter::Stream::Stream(AsyncFileWriter *writer, const QString& fileName, bool directIO, std::size_t blockSize, unsigned int nbBlocks) :
+    m_writer(writer),
+    m_fileName(fileName),
+    m_directIO(directIO),
+    m_blockSize(((blockSize + m_alignment - 1) / m_alignment) * m_alignment),
+    m_nbBlocks(nbBlocks < 2 ? 2 : nbBlocks),
+    m_produced(0),
+    m_consumed(0),
+    m_currentFill(0),
+    m_bytesWritten(0),
+    m_droppedBlocks(0),
+    m_writeErrors(0),
+    m_closing(0)
+{
+    // allocated (and touched) once for all before recording starts
+    m_buffer.resize(m_nbBlocks * m_blockSize + m_alignment);
+    quintptr base = (reinterpret_cast<quintptr>(m_buffer.data()) + m_alignment - 1) & ~((quintptr) m_alignment - 1);
+
+    for (unsigned int i = 0; i < m_nbBlocks; i++) {
+        m_blocks.push_back(reinterpret_cast<char*>(base) + i * m_blockSize);
+    }
+
+    m_blockFill.resize(m_nbBlocks, 0);
+    m_current = m_blocks[0];
+}
+
+AsyncFileWriter::Stream::~Stream()
+{
+    if (m_file.isOpen()) {
+        m_file.close();
+    }
+}
+
+bool AsyncFileWriter::Stream::open()
+{
+    m_file.setFileName(m_fileName);
+
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Unbuffered))
+    {
+        qWarning() << "AsyncFileWriter::Stream::open: cannot open" << m_fileName << ":" << m_file.errorString();
+        return false;
+    }
+
+#if defined(__linux__) && defined(O_DIRECT)
+    if (m_directIO)
+    {
+        int flags = fcntl(m_file.handle(), F_GETFL);
+
+        if ((flags < 0) || (fcntl(m_file.handle(), F_SETFL, flags | O_DIRECT) < 0))
+        {
+            qWarning() << "AsyncFileWriter::Stream::open: O_DIRECT not supported for" << m_fileName;
+            m_directIO = false;
+        }
+    }
+#else
+    m_directIO = false;
+#endif
+
+    return true;
+}
+
+void AsyncFileWriter::Stream::write(const char *data, std::size_t size)
+{
+    while (size > 0)
+    {
+        std::size_t chunk = std::min(size, m_blockSize - m_currentFill);
+
+        if (m_current) { // else dropping
+            std::memcpy(m_current + m_currentFill, data, chunk);
+        }
+
+        m_currentFill += chunk;
+        data += chunk;
+        size -= chunk;
+
+        if (m_currentFill == m_blockSize) {
+            handOff();
+        }
+    }
+}
+
+void AsyncFileWriter::Stream::handOff()
+{
+    quint32 produced = m_produced.load();
+
+    if (m_current)
+    {
+        m_blockFill[produced % m_nbBlocks] = m_currentFill;
+        m_produced.storeRelease(++produced);
+        m_writer->wakeUp();
+    }
+    else if (m_currentFill > 0)
+    {
+        m_droppedBlocks.fetchAndAddRelaxed(1);
+    }
+
+    m_currentFill = 0;
+
+    // the next block is free once the writer has written its previous content
+    if (produced - m_consumed.loadAcquire() < m_nbBlocks) {
+        m_current = m_blocks[produced % m_nbBlocks];
+    } else {
+        m_current = nullptr;
+    }
+}
+
+bool AsyncFileWriter::Stream::writeBlocks()
+{
+    quint32 produced = m_produced.loadAcquire();
+    quint32 consumed = m_consumed.load();
+
+    if (consumed == produced) {
+        return false;
+    }
+
+    // 32 bit counters wrap after 2^32 blocks (4 PiB in 1 MiB blocks)
+    while (consumed != produced)
+    {
+        unsigned int index = consumed % m_nbBlocks;
+        std::size_t size = m_blockFill[index];
+
+#if defined(__linux__) && defined(O_DIRECT)
+        if (m_directIO && (size % m_alignment != 0)) // last block of the file
+        {
+            int flags = fcntl(m_file.handle(), F_GETFL);
+            fcntl(m_file.handle(), F_SETFL, flags & ~O_DIRECT);
+            m_directIO = false;
+        }
+#endif
+
+        if (m_file.write(m_blocks[index], size) == (qint64) size) {
+            m_bytesWritten.fetchAndAddRelaxed(size);
+        } else {
+            m_writeErrors.fetchAndAddRelaxed(1);
+        }
+
+        m_consumed.storeRelease(++consumed);
+    }
+
+    return true;
+}
+
+bool AsyncFileWriter::Stream::isFlushed() const
+{
+    return m_consumed.loadAcquire() == m_produced.loadAcquire();
+}
+
+AsyncFileWriter::AsyncFileWriter() :
+    m_running(0)
+{
+    setObjectName("AsyncFileWriter");
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+    m_running.storeRelease(0);
+    wakeUp();
+    wait();
+
+    // streams not closed by their owner or still flushing
+    for (Stream *stream : m_streams)
+    {
+        if (!stream->m_closing.loadAcquire()) {
+            stream->handOff();
+        }
+
+        stream->writeBlocks();
+        qDebug() << "AsyncFileWriter::~AsyncFileWriter: flushed" << stream->getFileName()
+            << "bytes written:" << stream->getBytesWritten();
+        delete stream;
+    }
+}
+
+AsyncFileWriter::Stream *AsyncFileWriter::openStream(const QString& fileName, bool directIO, std::size_t blockSize, unsigned int nbBlocks)
+{
+    {
+        // a file being reused must be closed by its previous stream before it is truncated
+        QMutexLocker mutexLocker(&m_mutex);
+        bool pending = true;
+
+        while (pending)
+        {
+            pending = false;
+
+            for (Stream *stream : m_streams) {
+                pending = pending || (stream->m_closing.loadAcquire() && (stream->m_fileName == fileName));
+            }
+
+            if (pending) {
+                m_streamClosed.wait(&m_mutex);
+            }
+        }
+    }
+
+    Stream *stream = new Stream(this, fileName, directIO, blockSize, nbBlocks);
+
+    if (!stream->open())
+    {
+        delete stream;
+        return nullptr;
+    }
+
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        m_streams.push_back(stream);
+    }
+
+    if (!isRunning())
+    {
+        m_running.storeRelease(1);
+        start();
+    }
+
+    qDebug() << "AsyncFileWriter::openStream:" << fileName << "direct I/O:" << stream->m_directIO
+        << "blocks:" << stream->m_nbBlocks << "x" << stream->m_blockSize;
+    return stream;
+}
+
+quint64 AsyncFileWriter::closeStream(Stream *stream)
+{
+    if (!stream) {
+        return 0;
+    }
+
+    stream->handOff(); // last partial block
+    quint64 droppedBlocks = stream->getDroppedBlocks(); // the producer is done: final count
+    stream->m_closing.storeRelease(1); // the stream may be deleted by the writer thread from now on
+    wakeUp();
+
+    return droppedBlocks;
+}
+
+void AsyncFileWriter::run()
+{
+    while (m_running.loadAcquire())
+    {
+        m_wakeUp.tryAcquire(1, m_idleWaitMs);
+        m_wakeUp.tryAcquire(m_wakeUp.available()); // all pending blocks are served below
+
+        std::vector<Stream*> streams;
+
+        {
+            QMutexLocker mutexLocker(&m_mutex);
+            streams = m_streams;
+        }
+
+        // the disk is accessed without holding the mutex
+        bool written = true;
+
+        while (written)
+        {
+            written = false;
+
+            for (Stream *stream : streams) {
+                written = stream->writeBlocks() || written;
+            }
+        }
+
+        for (Stream *stream : streams)
+        {
+            if (stream->m_closing.loadAcquire() && stream->isFlushed())
+            {
+                stream->m_file.close();
+
+                {
+                    QMutexLocker mutexLocker(&m_mutex);
+                    m_streams.erase(std::find(m_streams.begin(), m_streams.end(), stream));
+                    m_streamClosed.wakeAll();
+                }
+
+                qDebug() << "AsyncFileWriter::run: closed" << stream->getFileName()
+                    << "bytes written:" << stream->getBytesWritten()
+                    << "dropped blocks:" << stream->getDroppedBlocks()
+                    << "write errors:" << stream->getWriteErrors();
+                delete stream;
+            }
+        }
+    }
+}
@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_ASYNCFILEWRITER_H_
+#define SDRBASE_DSP_ASYNCFILEWRITER_H_
+
+#include <vector>
+
+#include <QThread>
+#include <QMutex>
+#include <QSemaphore>
+#include <QWaitCondition>
+#include <QAtomicInt>
+#include <QAtomicInteger>
+#include <QFile>
+
+#include "export.h"
+
+/**
+ * Thread writing files on behalf of DSP threads so that a stalled disk never blocks them.
+ *
+ * Each file is a Stream with a ring of large aligned blocks. The producer (DSP thread) copies
+ * its data in the current block and hands it off to the writer thread when full through
+ * atomic counters only. When the writer is late and no block is free the data of whole blocks
+ * is dropped and counted instead of waiting. Full blocks are written with O_DIRECT on Linux
+ * when asked for. One writer may serve several streams. Closing a stream does not wait either:
+ * the writer thread flushes, closes and deletes it. Only the destructor waits for pending data.
+ */
+class SDRBASE_API AsyncFileWriter : public QThread
+{
+    Q_OBJECT
+public:
+    class SDRBASE_API Stream
+    {
+    public:
+        void write(const char *data, std::size_t size); //!< From the producer thread only. Never blocks
+        quint64 getBytesWritten() const { return m_bytesWritten.loadAcquire(); } //!< Bytes actually on disk
+        quint64 getDroppedBlocks() const { return m_droppedBlocks.loadAcquire(); } //!< Blocks of data lost while no block was free
+        quint64 getWriteErrors() const { return m_writeErrors.loadAcquire(); }
+        const QString& getFileName() const { return m_fileName; }
+
+    private:
+        friend class AsyncFileWriter;
+
+        Stream(AsyncFileWriter *writer, const QString& fileName, bool directIO, std::size_t blockSize, unsigned int nbBlocks);
+        ~Stream();
+        bool open();
+        void handOff();
+        bool writeBlocks();     //!< From the writer thread. Returns true if it has written something
+        bool isFlushed() const; //!< All handed off blocks are written
+
+        AsyncFileWriter *m_writer;
+        QString m_fileName;
+        QFile m_file;
+        bool m_directIO;
+        std::size_t m_blockSize;
+        unsigned int m_nbBlocks;
+        std::vector<char> m_buffer;           //!< Storage of the blocks with room for alignment
+        std::vector<char*> m_blocks;          //!< Aligned blocks
+        std::vector<std::size_t> m_blockFill; //!< Bytes to write in each handed off block
+        QAtomicInteger<quint32> m_produced;   //!< Blocks handed off by the producer
+        QAtomicInteger<quint32> m_consumed;   //!< Blocks written by the writer thread
+        char *m_current;                      //!< Block being filled or nullptr when dropping
+        std::size_t m_currentFill;
+        QAtomicInteger<quint64> m_bytesWritten;
+        QAtomicInteger<quint64> m_droppedBlocks;
+        QAtomicInteger<quint64> m_writeErrors;
+        QAtomicInt m_closing;                 //!< The producer has stopped and handed off its last block
+    };
+
+    AsyncFileWriter();
+    ~AsyncFileWriter();
+
+    /** Opens the file and starts the writer thread if needed. Returns nullptr if the file cannot be opened */
+    Stream *openStream(const QString& fileName, bool directIO = false, std::size_t blockSize = 1<<20, unsigned int nbBlocks = 64);
+    /**
+     * Once the producer has stopped writing. Hands off the last block and returns at once with the
+     * final number of dropped blocks. The writer thread closes and deletes the stream once its pending
+     * blocks are written so the stream must not be used any more.
+     */
+    quint64 closeStream(Stream *stream);
+    static std::size_t getAlignment() { return m_alignment; } //!< Block sizes are rounded up to this
+
+protected:
+    virtual void run();
+
+private:
+    QMutex m_mutex;                   //!< Protects the list of streams
+    std::vector<Stream*> m_streams;
+    QWaitCondition m_streamClosed;    //!< A closing stream has been removed from the list
+    QSemaphore m_wakeUp;              //!< Released for each handed off block
+    QAtomicInt m_running;
+
+    static const std::size_t m_alignment;
+    static const int m_idleWaitMs;
+
+    void wakeUp() { m_wakeUp.release(); }
+};
+
+#endif // SDRBASE_DSP_ASYNCFILEWRITER_H_
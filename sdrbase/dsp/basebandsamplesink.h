@@ -26,6 +26,7 @@
 #include "util/message.h"
 
 class Message;
+class SampleSinkRingReader;
 
 class SDRBASE_API BasebandSampleSink : public QObject {
 	Q_OBJECT
@@ -58,6 +59,7 @@ public:
 	virtual void stop() = 0;
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly) = 0;
 	virtual bool handleMessage(const Message& cmd) = 0; //!< Processing of a message. Returns true if message has actually been processed
+	virtual SampleSinkRingReader *getSharedBasebandReader() { return nullptr; } //!< Non null if the sink reads the device baseband in place instead of being fed
 
 	MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
     void setMessageQueueToGUI(MessageQueue *queue) { m_guiMessageQueue = queue; }
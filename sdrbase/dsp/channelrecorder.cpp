@@ -0,0 +1,204 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <QFileInfo>
+#include <QDebug>
+
+#include "dsp/dspengine.h"
+#include "dsp/dspcommands.h"
+#include "channelrecorder.h"
+
+// Channel rates are small compared to the device rate: the default blocks of the writer would hold
+// seconds of samples that are lost at once if the recording is interrupted and would sit in memory
+// for each channel being recorded.
+const int ChannelRecorder::m_blockMs = 100;
+const unsigned int ChannelRecorder::m_nbBlocks = 8;
+
+ChannelRecorder::ChannelRecorder() :
+    m_recording(false),
+    m_sampleRate(0),
+    m_frequencyOffset(0),
+    m_channelFrequencyOffset(0),
+    m_deviceCenterFrequency(0),
+    m_format(RecordFormat::FormatNative),
+    m_part(0),
+    m_partsSamplesCount(0),
+    m_partsDroppedBlocks(0)
+{
+    m_fileRecord.setWriter(DSPEngine::instance()->getChannelRecordWriter());
+}
+
+ChannelRecorder::~ChannelRecorder()
+{
+    stopRecording();
+}
+
+void ChannelRecorder::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    m_fileRecord.feed(begin, end, false); // returns at once when not recording
+}
+
+void ChannelRecorder::setChannelization(int sampleRate, int frequencyOffset, int channelFrequencyOffset)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    // the channel may move within the recorded band without a new part
+    m_channelFrequencyOffset = channelFrequencyOffset;
+    m_fileRecord.setChannelFrequency(m_deviceCenterFrequency + m_channelFrequencyOffset);
+
+    if ((sampleRate == m_sampleRate) && (frequencyOffset == m_frequencyOffset)) {
+        return;
+    }
+
+    m_sampleRate = sampleRate;
+    m_frequencyOffset = frequencyOffset;
+
+    if (!m_recording) {
+        return;
+    }
+
+    if (m_fileRecord.getByteCount() == 0) // header not written yet
+    {
+        m_fileRecord.handleMessage(DSPSignalNotification(m_sampleRate, m_deviceCenterFrequency + m_frequencyOffset));
+        return;
+    }
+
+    qDebug("ChannelRecorder::setChannelization: new part %u at %d S/s offset %d Hz", m_part + 1, m_sampleRate, m_frequencyOffset);
+    stopPart();
+    m_part++;
+    m_recording = startPart();
+}
+
+bool ChannelRecorder::startRecording(const QString& fileName, RecordFormat::Format format, qint64 deviceCenterFrequency)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_recording) {
+        stopPart();
+    }
+
+    m_fileName = fileName;
+    m_format = format;
+    m_deviceCenterFrequency = deviceCenterFrequency;
+    m_part = 0;
+    m_partsSamplesCount = 0;
+    m_partsDroppedBlocks = 0;
+    m_recording = startPart();
+
+    return m_recording;
+}
+
+void ChannelRecorder::stopRecording()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_recording)
+    {
+        stopPart();
+        m_recording = false;
+    }
+}
+
+bool ChannelRecorder::startPart()
+{
+    m_fileRecord.handleMessage(DSPSignalNotification(m_sampleRate, m_deviceCenterFrequency + m_frequencyOffset));
+    m_fileRecord.setChannelFrequency(m_deviceCenterFrequency + m_channelFrequencyOffset);
+    m_fileRecord.setFormat(m_format);
+    // about m_blockMs of samples per block rounded up to the writer alignment
+    qint64 blockBytes = ((qint64) m_sampleRate * m_blockMs * RecordFormat::getUnitBytes(m_format, SDR_RX_SAMP_SZ))
+        / (1000 * RecordFormat::getUnitSamples(m_format));
+    std::size_t alignment = AsyncFileWriter::getAlignment();
+    std::size_t blockSize = ((std::max(blockBytes, (qint64) 1) + alignment - 1) / alignment) * alignment;
+    m_fileRecord.setStreamBlocks(blockSize, m_nbBlocks);
+    m_fileRecord.setFileName(getPartFileName());
+    m_fileRecord.startRecording();
+
+    if (!m_fileRecord.isRecording())
+    {
+        qWarning("ChannelRecorder::startPart: cannot open %s", qPrintable(getPartFileName()));
+        return false;
+    }
+
+    return true;
+}
+
+void ChannelRecorder::stopPart()
+{
+    m_fileRecord.stopRecording(); // does not wait: the shared writer thread flushes and closes the file
+    m_partsSamplesCount += m_fileRecord.getByteCount();
+    m_partsDroppedBlocks += m_fileRecord.getDroppedBlocks();
+}
+
+QString ChannelRecorder::getPartFileName() const
+{
+    if (m_part == 0) {
+        return m_fileName;
+    }
+
+    QFileInfo fileInfo(m_fileName);
+    QString partFileName = QString("%1_%2").arg(fileInfo.completeBaseName()).arg(m_part);
+
+    if (!fileInfo.suffix().isEmpty()) {
+        partFileName += "." + fileInfo.suffix();
+    }
+
+    return m_fileName.left(m_fileName.size() - fileInfo.fileName().size()) + partFileName; // same directory as given
+}
+
+bool ChannelRecorder::isRecording() const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_recording;
+}
+
+QString ChannelRecorder::getFileName() const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return getPartFileName();
+}
+
+RecordFormat::Format ChannelRecorder::getFormat() const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_format;
+}
+
+int ChannelRecorder::getSampleRate() const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_sampleRate;
+}
+
+qint64 ChannelRecorder::getCenterFrequency() const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_deviceCenterFrequency + m_frequencyOffset;
+}
+
+quint64 ChannelRecorder::getSamplesCount() const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_partsSamplesCount + (m_recording ? m_fileRecord.getByteCount() : 0);
+}
+
+quint64 ChannelRecorder::getDroppedBlocks() const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_partsDroppedBlocks + (m_recording ? m_fileRecord.getDroppedBlocks() : 0);
+}
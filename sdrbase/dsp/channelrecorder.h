@@ -0,0 +1,89 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_CHANNELRECORDER_H_
+#define SDRBASE_DSP_CHANNELRECORDER_H_
+
+#include <QString>
+#include <QMutex>
+
+#include "dsp/dsptypes.h"
+#include "dsp/filerecord.h"
+#include "dsp/recordformat.h"
+#include "export.h"
+
+/**
+ * Recording tap of a channel placed after its channelizer so that only the decimated channel
+ * samples are written. All channel recordings share the writer thread of the DSP engine.
+ *
+ * The tap is at the output of the half band filter chain (or of the shared channelizer sub-band)
+ * and not after the interpolator and NCO of the channel sink. The recorded rate is the channelizer
+ * output rate which may be up to twice the channel rate and the recorded band is centered on the
+ * filter chain output and not on the channel. The header and SigMF center frequency is the real
+ * center of the recorded band: the device center frequency given at start plus the band offset.
+ * The SigMF metadata also gives the channel frequency (sdrangel:channel_frequency).
+ *
+ * When the channelizer output changes during a recording the file is closed and the recording
+ * continues in a new part <name>_<n>.<ext> so that each part is consistent. The previous part is
+ * flushed and closed by the writer thread so that the channel thread does not wait for the disk.
+ * The parts can be played in sequence by the file input with a playlist.
+ */
+class SDRBASE_API ChannelRecorder
+{
+public:
+    ChannelRecorder();
+    ~ChannelRecorder();
+
+    void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end); //!< From the channelizer with its output
+    /** From the channelizer when its output changes. Offsets of the recorded band center and of the channel from the device center frequency */
+    void setChannelization(int sampleRate, int frequencyOffset, int channelFrequencyOffset);
+
+    /** Returns false if the file cannot be opened */
+    bool startRecording(const QString& fileName, RecordFormat::Format format, qint64 deviceCenterFrequency);
+    void stopRecording();
+
+    bool isRecording() const;
+    QString getFileName() const;     //!< Of the current or last part
+    RecordFormat::Format getFormat() const;
+    int getSampleRate() const;       //!< Channelizer output sample rate
+    qint64 getCenterFrequency() const; //!< Of the recorded band
+    quint64 getSamplesCount() const; //!< Of all parts of the current or last recording
+    quint64 getDroppedBlocks() const;
+
+private:
+    mutable QMutex m_mutex;          //!< API thread calls against the channel thread ones
+    FileRecord m_fileRecord;
+    bool m_recording;
+    int m_sampleRate;
+    int m_frequencyOffset;           //!< Of the recorded band center
+    int m_channelFrequencyOffset;    //!< Of the channel which is not at the center of the recorded band in general
+    qint64 m_deviceCenterFrequency;
+    QString m_fileName;              //!< As requested which is also the name of the first part
+    RecordFormat::Format m_format;
+    unsigned int m_part;
+    quint64 m_partsSamplesCount;     //!< Of the closed parts
+    quint64 m_partsDroppedBlocks;
+
+    static const int m_blockMs;      //!< Duration of the samples in a write block
+    static const unsigned int m_nbBlocks;
+
+    bool startPart();
+    void stopPart();
+    QString getPartFileName() const;
+};
+
+#endif // SDRBASE_DSP_CHANNELRECORDER_H_
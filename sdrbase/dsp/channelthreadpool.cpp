@@ -0,0 +1,289 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QThread>
+#include <QSemaphore>
+#include <QDebug>
+
+#include "dsp/dsptelemetry.h"
+#include "channelthreadpool.h"
+
+const int ChannelThreadPool::m_balancePeriodMs = 1000;
+
+ChannelThreadPool::ChannelThreadPool()
+{
+    connect(&m_balanceTimer, SIGNAL(timeout()), this, SLOT(balance()));
+}
+
+ChannelThreadPool::~ChannelThreadPool()
+{
+    m_balanceTimer.stop();
+
+    for (unsigned int i = 0; i < m_workers.size(); i++)
+    {
+        m_workers[i]->quit();
+        m_workers[i]->wait();
+        delete m_workerContexts[i];
+        delete m_workers[i];
+    }
+}
+
+void ChannelThreadPool::setNbThreads(int nbThreads)
+{
+    if (isEnabled())
+    {
+        qWarning("ChannelThreadPool::setNbThreads: pool already started with %d threads", getNbThreads());
+        return;
+    }
+
+    int nbWorkers = nbThreads > 0 ? nbThreads : QThread::idealThreadCount();
+    nbWorkers = nbWorkers < 1 ? 1 : nbWorkers;
+    qDebug("ChannelThreadPool::setNbThreads: %d threads", nbWorkers);
+
+    for (int i = 0; i < nbWorkers; i++)
+    {
+        QThread *worker = new QThread();
+        worker->setObjectName(QString("ChannelPool-%1").arg(i));
+        QObject *context = new QObject();
+        context->moveToThread(worker);
+        m_workers.push_back(worker);
+        m_workerContexts.push_back(context);
+        worker->start();
+    }
+
+    m_balanceTimer.start(m_balancePeriodMs);
+}
+
+void ChannelThreadPool::setupBaseband(QObject *baseband, QThread *thread)
+{
+    if (!isEnabled()) {
+        baseband->moveToThread(thread);
+    }
+
+    // else the baseband stays in the creating thread until started
+}
+
+void ChannelThreadPool::startBaseband(QObject *baseband, QThread *thread, const DSPTelemetry *telemetry)
+{
+    if (!isEnabled())
+    {
+        thread->start();
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (findTask(baseband)) {
+        return;
+    }
+
+    // least loaded thread then least number of channels
+    std::vector<quint64> loads(m_workers.size(), 0);
+    std::vector<unsigned int> counts(m_workers.size(), 0);
+
+    for (const Task& task : m_tasks)
+    {
+        loads[task.m_worker] += task.m_load;
+        counts[task.m_worker]++;
+    }
+
+    unsigned int worker = 0;
+
+    for (unsigned int i = 1; i < m_workers.size(); i++)
+    {
+        if ((loads[i] < loads[worker]) || ((loads[i] == loads[worker]) && (counts[i] < counts[worker]))) {
+            worker = i;
+        }
+    }
+
+    Task task;
+    task.m_baseband = baseband;
+    task.m_telemetry = telemetry;
+    task.m_worker = worker;
+    task.m_busyNsecs = telemetry ? telemetry->getSnapshot().m_busyNsecs : 0;
+    task.m_load = 0;
+    m_tasks.push_back(task);
+
+    postSettle(baseband);
+}
+
+void ChannelThreadPool::stopBaseband(QObject *baseband, QThread *thread)
+{
+    if (!isEnabled())
+    {
+        thread->exit();
+        thread->wait();
+        return;
+    }
+
+    QSemaphore moved;
+
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+
+        for (std::vector<Task>::iterator it = m_tasks.begin(); it != m_tasks.end(); ++it)
+        {
+            if (it->m_baseband == baseband)
+            {
+                m_tasks.erase(it); // pending moves of the baseband are cancelled
+                break;
+            }
+        }
+
+        QThread *basebandThread = baseband->thread();
+        int worker = findWorker(basebandThread);
+
+        if (worker < 0) { // not moved to the pool yet
+            return;
+        }
+
+        if (basebandThread == QThread::currentThread())
+        {
+            baseband->moveToThread(this->thread());
+            return;
+        }
+
+        // move back to the pool owner thread between two runs of the baseband
+        QTimer::singleShot(0, m_workerContexts[worker], [this, baseband, &moved]() {
+            m_mutex.lock();
+            baseband->moveToThread(this->thread());
+            m_mutex.unlock();
+            moved.release();
+        });
+    }
+
+    moved.acquire();
+}
+
+ChannelThreadPool::Task *ChannelThreadPool::findTask(QObject *baseband)
+{
+    for (Task& task : m_tasks)
+    {
+        if (task.m_baseband == baseband) {
+            return &task;
+        }
+    }
+
+    return nullptr;
+}
+
+int ChannelThreadPool::findWorker(QThread *thread) const
+{
+    for (unsigned int i = 0; i < m_workers.size(); i++)
+    {
+        if (m_workers[i] == thread) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+void ChannelThreadPool::postSettle(QObject *baseband)
+{
+    // called with m_mutex locked. The move is done by the thread the baseband lives in.
+    int worker = findWorker(baseband->thread());
+    QObject *context = worker < 0 ? (baseband->thread() == thread() ? this : baseband) : m_workerContexts[worker];
+
+    QTimer::singleShot(0, context, [this, baseband]() {
+        settle(baseband);
+    });
+}
+
+void ChannelThreadPool::settle(QObject *baseband)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    Task *task = findTask(baseband);
+
+    if (!task) { // stopped meanwhile
+        return;
+    }
+
+    if (baseband->thread() != QThread::currentThread()) { // moved meanwhile
+        return;
+    }
+
+    if (baseband->thread() != m_workers[task->m_worker]) {
+        baseband->moveToThread(m_workers[task->m_worker]);
+    }
+}
+
+void ChannelThreadPool::balance()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_tasks.size() < 2) {
+        return;
+    }
+
+    std::vector<quint64> loads(m_workers.size(), 0);
+    std::vector<unsigned int> counts(m_workers.size(), 0);
+
+    for (Task& task : m_tasks)
+    {
+        quint64 busyNsecs = task.m_telemetry ? task.m_telemetry->getSnapshot().m_busyNsecs : 0;
+        task.m_load = busyNsecs > task.m_busyNsecs ? busyNsecs - task.m_busyNsecs : 0;
+        task.m_busyNsecs = busyNsecs;
+        loads[task.m_worker] += task.m_load;
+        counts[task.m_worker]++;
+    }
+
+    unsigned int busiest = 0;
+    unsigned int idlest = 0;
+
+    for (unsigned int i = 1; i < m_workers.size(); i++)
+    {
+        if (loads[i] > loads[busiest]) {
+            busiest = i;
+        }
+        if (loads[i] < loads[idlest]) {
+            idlest = i;
+        }
+    }
+
+    // not worth moving for less than 10% of a thread
+    if ((counts[busiest] < 2) || (loads[busiest] - loads[idlest] < m_balancePeriodMs * 100000ULL)) {
+        return;
+    }
+
+    // the idlest thread takes over the channel that best evens both loads
+    Task *stolen = nullptr;
+    quint64 bestMax = loads[busiest];
+
+    for (Task& task : m_tasks)
+    {
+        if ((task.m_worker != busiest) || (task.m_baseband->thread() != m_workers[busiest])) { // skip moves in progress
+            continue;
+        }
+
+        quint64 busiestLoad = loads[busiest] - task.m_load;
+        quint64 idlestLoad = loads[idlest] + task.m_load;
+        quint64 newMax = busiestLoad > idlestLoad ? busiestLoad : idlestLoad;
+
+        if (newMax < bestMax)
+        {
+            bestMax = newMax;
+            stolen = &task;
+        }
+    }
+
+    if (stolen)
+    {
+        stolen->m_worker = idlest;
+        postSettle(stolen->m_baseband);
+    }
+}
@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_CHANNELTHREADPOOL_H_
+#define SDRBASE_DSP_CHANNELTHREADPOOL_H_
+
+#include <vector>
+
+#include <QObject>
+#include <QMutex>
+#include <QTimer>
+
+#include "export.h"
+
+class QThread;
+class DSPTelemetry;
+
+/**
+ * Optional shared pool of threads running the channel basebands in place of one thread per channel.
+ *
+ * A baseband is a QObject woken by queued signals (new samples, input messages) so it is run
+ * by the event loop of one pool thread at a time which preserves the order of its processing.
+ * New basebands go to the least loaded thread. Periodically the least loaded thread takes over
+ * a channel from the most loaded one (load is the baseband busy time from its telemetry). The
+ * move takes place in the baseband thread between two runs and pending events follow it.
+ *
+ * Channels call setupBaseband, startBaseband and stopBaseband with their own (dedicated) thread
+ * which is used when the pool is disabled (default).
+ */
+class SDRBASE_API ChannelThreadPool : public QObject
+{
+    Q_OBJECT
+public:
+    ChannelThreadPool();
+    ~ChannelThreadPool();
+
+    void setNbThreads(int nbThreads); //!< Enable the pool. 0 for one thread per core. To be called before any channel is created
+    bool isEnabled() const { return m_workers.size() > 0; }
+    int getNbThreads() const { return m_workers.size(); }
+
+    void setupBaseband(QObject *baseband, QThread *thread); //!< From the channel constructor in place of moveToThread
+    void startBaseband(QObject *baseband, QThread *thread, const DSPTelemetry *telemetry); //!< From channel start
+    void stopBaseband(QObject *baseband, QThread *thread); //!< From channel stop. Baseband does not run in the pool on return
+
+private:
+    struct Task
+    {
+        QObject *m_baseband;
+        const DSPTelemetry *m_telemetry;
+        unsigned int m_worker;   //!< Target pool thread
+        quint64 m_busyNsecs;     //!< Baseband busy time at the last balance
+        quint64 m_load;          //!< Busy time during the last balance period
+    };
+
+    QMutex m_mutex;              //!< Protects the tasks and all moves of pooled basebands
+    std::vector<QThread*> m_workers;
+    std::vector<QObject*> m_workerContexts; //!< One object living in each pool thread to post calls there
+    std::vector<Task> m_tasks;
+    QTimer m_balanceTimer;
+
+    static const int m_balancePeriodMs;
+
+    Task *findTask(QObject *baseband);
+    int findWorker(QThread *thread) const;
+    void settle(QObject *baseband);
+    void postSettle(QObject *baseband);
+
+private slots:
+    void balance();
+};
+
+#endif // SDRBASE_DSP_CHANNELTHREADPOOL_H_
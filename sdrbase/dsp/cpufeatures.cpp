@@ -0,0 +1,228 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+#include <QStringList>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define CPUFEATURES_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#include "cpufeatures.h"
+
+#ifdef CPUFEATURES_X86
+static void cpuid(unsigned int leaf, unsigned int subleaf, unsigned int regs[4])
+{
+#if defined(_MSC_VER)
+    int r[4];
+    __cpuidex(r, (int) leaf, (int) subleaf);
+    for (int i = 0; i < 4; i++) {
+        regs[i] = (unsigned int) r[i];
+    }
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static unsigned int cpuidMaxLeaf()
+{
+#if defined(_MSC_VER)
+    int r[4];
+    __cpuid(r, 0);
+    return (unsigned int) r[0];
+#else
+    return __get_cpuid_max(0, nullptr);
+#endif
+}
+
+/** Register state enabled by the OS (XCR0). Only valid when OSXSAVE is set */
+static unsigned long long xgetbv0()
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned int eax, edx;
+    __asm__ volatile ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+    return ((unsigned long long) edx << 32) | eax;
+#endif
+}
+#endif // CPUFEATURES_X86
+
+const CPUFeatures& CPUFeatures::instance()
+{
+    static CPUFeatures features;
+    return features;
+}
+
+CPUFeatures::CPUFeatures() :
+    m_sse2(false),
+    m_ssse3(false),
+    m_sse41(false),
+    m_sse42(false),
+    m_avx(false),
+    m_avx2(false),
+    m_fma(false),
+    m_avx512(false),
+    m_bestPath(SIMDGeneric),
+    m_path(SIMDGeneric)
+{
+    detect();
+
+    if (m_avx512) {
+        m_bestPath = SIMDAVX512;
+    } else if (m_avx2) {
+        m_bestPath = SIMDAVX2;
+    } else if (m_sse41) {
+        m_bestPath = SIMDSSE41;
+    } else if (m_sse2) {
+        m_bestPath = SIMDSSE2;
+    }
+
+    m_path = m_bestPath;
+    QByteArray env = qgetenv("SDRANGEL_SIMD");
+    SIMDPath requested;
+
+    if (!env.isEmpty())
+    {
+        if (!getSIMDPathFromName(QString(env), requested)) {
+            qWarning("CPUFeatures::CPUFeatures: unknown SDRANGEL_SIMD value: %s", env.constData());
+        } else if (requested > m_bestPath) {
+            qWarning("CPUFeatures::CPUFeatures: SDRANGEL_SIMD=%s not supported by this CPU", env.constData());
+        } else {
+            m_path = requested;
+        }
+    }
+
+    qDebug("CPUFeatures::CPUFeatures: features: %s SIMD path: %s",
+        qPrintable(getFeaturesString()), qPrintable(getSIMDPathName(m_path)));
+}
+
+void CPUFeatures::detect()
+{
+#ifdef CPUFEATURES_X86
+    unsigned int regs[4]; // eax, ebx, ecx, edx
+    unsigned int maxLeaf = cpuidMaxLeaf();
+
+    if (maxLeaf < 1) {
+        return;
+    }
+
+    cpuid(1, 0, regs);
+    m_sse2 = (regs[3] & (1U << 26)) != 0;
+    m_ssse3 = (regs[2] & (1U << 9)) != 0;
+    m_sse41 = (regs[2] & (1U << 19)) != 0;
+    m_sse42 = (regs[2] & (1U << 20)) != 0;
+    bool osxsave = (regs[2] & (1U << 27)) != 0;
+    bool avx = (regs[2] & (1U << 28)) != 0;
+    bool fma = (regs[2] & (1U << 12)) != 0;
+
+    // AVX registers are usable only if the OS saves them on context switch
+    unsigned long long xcr0 = osxsave ? xgetbv0() : 0;
+    bool osAVX = (xcr0 & 0x06) == 0x06;           // XMM and YMM state
+    bool osAVX512 = (xcr0 & 0xE6) == 0xE6;        // plus opmask, ZMM0-15 upper halves and ZMM16-31
+
+    m_avx = avx && osAVX;
+    m_fma = fma && m_avx;
+
+    if (maxLeaf >= 7)
+    {
+        cpuid(7, 0, regs);
+        m_avx2 = m_avx && ((regs[1] & (1U << 5)) != 0);
+        bool avx512f = (regs[1] & (1U << 16)) != 0;
+        bool avx512dq = (regs[1] & (1U << 17)) != 0;
+        bool avx512bw = (regs[1] & (1U << 30)) != 0;
+        bool avx512vl = (regs[1] & (1U << 31)) != 0;
+        m_avx512 = m_avx2 && osAVX512 && avx512f && avx512dq && avx512bw && avx512vl;
+    }
+#endif
+}
+
+QString CPUFeatures::getFeaturesString() const
+{
+    QStringList features;
+
+    if (m_sse2) {
+        features << "sse2";
+    }
+    if (m_ssse3) {
+        features << "ssse3";
+    }
+    if (m_sse41) {
+        features << "sse4.1";
+    }
+    if (m_sse42) {
+        features << "sse4.2";
+    }
+    if (m_avx) {
+        features << "avx";
+    }
+    if (m_fma) {
+        features << "fma";
+    }
+    if (m_avx2) {
+        features << "avx2";
+    }
+    if (m_avx512) {
+        features << "avx512";
+    }
+
+    return features.join(" ");
+}
+
+QString CPUFeatures::getSIMDPathName(SIMDPath path)
+{
+    switch (path)
+    {
+    case SIMDSSE2:
+        return "sse2";
+    case SIMDSSE41:
+        return "sse4.1";
+    case SIMDAVX2:
+        return "avx2";
+    case SIMDAVX512:
+        return "avx512";
+    case SIMDGeneric:
+    default:
+        return "generic";
+    }
+}
+
+bool CPUFeatures::getSIMDPathFromName(const QString& name, SIMDPath& path)
+{
+    QString lname = name.trimmed().toLower();
+
+    if (lname == "generic") {
+        path = SIMDGeneric;
+    } else if (lname == "sse2") {
+        path = SIMDSSE2;
+    } else if ((lname == "sse4.1") || (lname == "sse41")) {
+        path = SIMDSSE41;
+    } else if (lname == "avx2") {
+        path = SIMDAVX2;
+    } else if (lname == "avx512") {
+        path = SIMDAVX512;
+    } else {
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,79 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_CPUFEATURES_H
+#define SDRBASE_DSP_CPUFEATURES_H
+
+#include <QString>
+
+#include "export.h"
+
+/**
+ * SIMD capabilities of the CPU the instance is running on as opposed to the USE_SSE... compile time flags.
+ * Detection is done once on first use. The SIMD path selected for the runtime dispatched DSP kernels
+ * is the best one supported by both the CPU and the OS. It can be lowered (never raised) with the
+ * SDRANGEL_SIMD environment variable set to one of generic, sse2, sse4.1, avx2, avx512.
+ */
+class SDRBASE_API CPUFeatures
+{
+public:
+    enum SIMDPath
+    {
+        SIMDGeneric,
+        SIMDSSE2,
+        SIMDSSE41,
+        SIMDAVX2,
+        SIMDAVX512
+    };
+
+    static const CPUFeatures& instance();
+
+    bool hasSSE2() const { return m_sse2; }
+    bool hasSSSE3() const { return m_ssse3; }
+    bool hasSSE41() const { return m_sse41; }
+    bool hasSSE42() const { return m_sse42; }
+    bool hasAVX() const { return m_avx; }
+    bool hasAVX2() const { return m_avx2; }
+    bool hasFMA() const { return m_fma; }
+    bool hasAVX512() const { return m_avx512; } //!< F, BW, DQ and VL subsets
+
+    SIMDPath getBestSIMDPath() const { return m_bestPath; }   //!< best path supported by the CPU
+    SIMDPath getSIMDPath() const { return m_path; }           //!< path actually used by the DSP kernels
+    QString getSIMDPathName() const { return getSIMDPathName(m_path); }
+    QString getFeaturesString() const; //!< space separated list of the detected features
+
+    static QString getSIMDPathName(SIMDPath path);
+    static bool getSIMDPathFromName(const QString& name, SIMDPath& path);
+
+private:
+    CPUFeatures();
+
+    void detect();
+
+    bool m_sse2;
+    bool m_ssse3;
+    bool m_sse41;
+    bool m_sse42;
+    bool m_avx;
+    bool m_avx2;
+    bool m_fma;
+    bool m_avx512;
+    SIMDPath m_bestPath;
+    SIMDPath m_path;
+};
+
+#endif // SDRBASE_DSP_CPUFEATURES_H
@@ -22,11 +22,13 @@
 #include "dsp/inthalfbandfilter.h"
 #include "dsp/dspcommands.h"
 #include "dsp/hbfilterchainconverter.h"
+#include "dsp/channelrecorder.h"
 #include "downchannelizer.h"
 
 DownChannelizer::DownChannelizer(ChannelSampleSink* sampleSink) :
     m_filterChainSetMode(false),
 	m_sampleSink(sampleSink),
+    m_recorder(nullptr),
 	m_basebandSampleRate(0),
 	m_requestedOutputSampleRate(0),
 	m_requestedCenterFrequency(0),
@@ -52,41 +54,72 @@ void DownChannelizer::feed(const SampleVector::const_iterator& begin, const Samp
 
 	if (m_filterStages.size() == 0) // optimization when no downsampling is done anyway
 	{
+        if (m_recorder) {
+            m_recorder->feed(begin, end);
+        }
+
 		m_sampleSink->feed(begin, end);
 	}
 	else
 	{
-		for (SampleVector::const_iterator sample = begin; sample != end; ++sample)
+		int nbSamples = end - begin;
+
+		if (nbSamples == 0) {
+			return;
+		}
+
+		if ((int) m_sampleBuffer.size() < nbSamples/2 + 1) {
+			m_sampleBuffer.resize(nbSamples/2 + 1);
+		}
+
+		const Sample *in = &(*begin);
+		Sample *out = m_sampleBuffer.data();
+
+		for (FilterStages::iterator stage = m_filterStages.begin(); stage != m_filterStages.end(); ++stage)
 		{
-			Sample s(*sample);
-			FilterStages::iterator stage = m_filterStages.begin();
-
-			for (; stage != m_filterStages.end(); ++stage)
-			{
-#ifndef SDR_RX_SAMPLE_24BIT
-                s.m_real /= 2; // avoid saturation on 16 bit samples
-                s.m_imag /= 2;
+#ifdef SDR_RX_SAMPLE_24BIT
+			nbSamples = stage->work(in, nbSamples, out, false);
+#else
+			nbSamples = stage->work(in, nbSamples, out, true); // avoid saturation on 16 bit samples
 #endif
-				if (!(*stage)->work(&s)) {
-					break;
-				}
-			}
+			in = out;
+		}
 
-			if(stage == m_filterStages.end())
-			{
 #ifdef SDR_RX_SAMPLE_24BIT
-			    s.m_real /= (1<<(m_filterStages.size())); // on 32 bit samples there is enough headroom to just divide the final result
-			    s.m_imag /= (1<<(m_filterStages.size()));
-#endif
-				m_sampleBuffer.push_back(s);
-			}
+		for (int i = 0; i < nbSamples; i++)
+		{
+			out[i].m_real /= (1<<(m_filterStages.size())); // on 32 bit samples there is enough headroom to just divide the final result
+			out[i].m_imag /= (1<<(m_filterStages.size()));
 		}
+#endif
 
-		m_sampleSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end());
-		m_sampleBuffer.clear();
+        if (m_recorder) {
+            m_recorder->feed(m_sampleBuffer.begin(), m_sampleBuffer.begin() + nbSamples);
+        }
+
+		m_sampleSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.begin() + nbSamples);
 	}
 }
 
+void DownChannelizer::setRecorder(ChannelRecorder *recorder)
+{
+    m_recorder = recorder;
+
+    if (m_recorder) {
+        applyRecorderChannelization();
+    }
+}
+
+void DownChannelizer::applyRecorderChannelization()
+{
+    // in decimation mode the channel is the filter chain output band else it is shifted from its center
+    if (m_filterChainSetMode) {
+        m_recorder->setChannelization(m_channelSampleRate, m_channelFrequencyOffset, m_channelFrequencyOffset);
+    } else {
+        m_recorder->setChannelization(m_channelSampleRate, m_requestedCenterFrequency - m_channelFrequencyOffset, m_requestedCenterFrequency);
+    }
+}
+
 void DownChannelizer::setChannelization(int requestedSampleRate, qint64 requestedCenterFrequency)
 {
     m_requestedOutputSampleRate = requestedSampleRate;
@@ -127,6 +160,10 @@ void DownChannelizer::applyChannelization()
 
 	m_channelSampleRate = m_basebandSampleRate / (1 << m_filterStages.size());
 
+    if (m_recorder) {
+        applyRecorderChannelization();
+    }
+
 	qDebug() << "DownChannelizer::applyChannelization done:"
         << " in (baseband):" << m_basebandSampleRate
 		<< " req:" << m_requestedOutputSampleRate
@@ -154,6 +191,10 @@ void DownChannelizer::applyDecimation()
     m_channelSampleRate = m_basebandSampleRate / (1 << m_filterStages.size());
     m_requestedOutputSampleRate = m_channelSampleRate;
 
+    if (m_recorder) {
+        applyRecorderChannelization();
+    }
+
 	qDebug() << "UpChannelizer::applyInterpolation:"
             << " m_log2Interp:" << m_log2Decim
             << " m_filterChainHash:" << m_filterChainHash
@@ -162,53 +203,10 @@ void DownChannelizer::applyDecimation()
 			<< " fc:" << m_channelFrequencyOffset;
 }
 
-#ifdef SDR_RX_SAMPLE_24BIT
 DownChannelizer::FilterStage::FilterStage(Mode mode) :
-    m_filter(new IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER>),
-    m_workFunction(0),
     m_mode(mode),
     m_sse(true)
 {
-    switch(mode) {
-        case ModeCenter:
-            m_workFunction = &IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateCenter;
-            break;
-
-        case ModeLowerHalf:
-            m_workFunction = &IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateLowerHalf;
-            break;
-
-        case ModeUpperHalf:
-            m_workFunction = &IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateUpperHalf;
-            break;
-    }
-}
-#else
-DownChannelizer::FilterStage::FilterStage(Mode mode) :
-    m_filter(new IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>),
-    m_workFunction(0),
-    m_mode(mode),
-    m_sse(true)
-{
-    switch(mode) {
-        case ModeCenter:
-            m_workFunction = &IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateCenter;
-            break;
-
-        case ModeLowerHalf:
-            m_workFunction = &IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateLowerHalf;
-            break;
-
-        case ModeUpperHalf:
-            m_workFunction = &IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateUpperHalf;
-            break;
-    }
-}
-#endif
-
-DownChannelizer::FilterStage::~FilterStage()
-{
-	delete m_filter;
 }
 
 bool DownChannelizer::signalContainsChannel(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd) const
@@ -232,7 +230,7 @@ Real DownChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanSta
 	if(signalContainsChannel(sigStart, sigStart + sigBw / 2.0, chanStart, chanEnd))
     {
 		//qDebug("DownChannelizer::createFilterChain: -> take left half (rotate by +1/4 and decimate by 2)");
-		m_filterStages.push_back(new FilterStage(FilterStage::ModeLowerHalf));
+		m_filterStages.push_back(FilterStage(FilterStage::ModeLowerHalf));
 		return createFilterChain(sigStart, sigStart + sigBw / 2.0, chanStart, chanEnd);
 	}
 
@@ -240,7 +238,7 @@ Real DownChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanSta
 	if(signalContainsChannel(sigEnd - sigBw / 2.0f, sigEnd, chanStart, chanEnd))
     {
 		//qDebug("DownChannelizer::createFilterChain: -> take right half (rotate by -1/4 and decimate by 2)");
-		m_filterStages.push_back(new FilterStage(FilterStage::ModeUpperHalf));
+		m_filterStages.push_back(FilterStage(FilterStage::ModeUpperHalf));
 		return createFilterChain(sigEnd - sigBw / 2.0f, sigEnd, chanStart, chanEnd);
 	}
 
@@ -248,7 +246,7 @@ Real DownChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanSta
 	if(signalContainsChannel(sigStart + rot, sigEnd - rot, chanStart, chanEnd))
     {
 		//qDebug("DownChannelizer::createFilterChain: -> take center half (decimate by 2)");
-		m_filterStages.push_back(new FilterStage(FilterStage::ModeCenter));
+		m_filterStages.push_back(FilterStage(FilterStage::ModeCenter));
 		return createFilterChain(sigStart + rot, sigEnd - rot, chanStart, chanEnd);
 	}
 
@@ -270,21 +268,23 @@ double DownChannelizer::setFilterChain(const std::vector<unsigned int>& stageInd
     {
         if (*rit == 0)
         {
-            m_filterStages.push_back(new FilterStage(FilterStage::ModeLowerHalf));
+            m_filterStages.push_back(FilterStage(FilterStage::ModeLowerHalf));
             ofs -= ofs_stage;
             qDebug("DownChannelizer::setFilterChain: lower half: ofs: %f", ofs);
         }
         else if (*rit == 1)
         {
-            m_filterStages.push_back(new FilterStage(FilterStage::ModeCenter));
+            m_filterStages.push_back(FilterStage(FilterStage::ModeCenter));
             qDebug("DownChannelizer::setFilterChain: center: ofs: %f", ofs);
         }
         else if (*rit == 2)
         {
-            m_filterStages.push_back(new FilterStage(FilterStage::ModeUpperHalf));
+            m_filterStages.push_back(FilterStage(FilterStage::ModeUpperHalf));
             ofs += ofs_stage;
             qDebug("DownChannelizer::setFilterChain: upper half: ofs: %f", ofs);
         }
+
+        ofs_stage /= 2;
     }
 
     return ofs;
@@ -292,8 +292,6 @@ double DownChannelizer::setFilterChain(const std::vector<unsigned int>& stageInd
 
 void DownChannelizer::freeFilterChain()
 {
-	for(FilterStages::iterator it = m_filterStages.begin(); it != m_filterStages.end(); ++it)
-		delete *it;
 	m_filterStages.clear();
 }
 
@@ -303,19 +301,19 @@ void DownChannelizer::debugFilterChain()
 
     for(FilterStages::iterator it = m_filterStages.begin(); it != m_filterStages.end(); ++it)
     {
-        switch ((*it)->m_mode)
+        switch (it->m_mode)
         {
         case FilterStage::ModeCenter:
-            qDebug("DownChannelizer::debugFilterChain: center %s", (*it)->m_sse ? "sse" : "no_sse");
+            qDebug("DownChannelizer::debugFilterChain: center %s", it->m_sse ? "sse" : "no_sse");
             break;
         case FilterStage::ModeLowerHalf:
-            qDebug("DownChannelizer::debugFilterChain: lower %s", (*it)->m_sse ? "sse" : "no_sse");
+            qDebug("DownChannelizer::debugFilterChain: lower %s", it->m_sse ? "sse" : "no_sse");
             break;
         case FilterStage::ModeUpperHalf:
-            qDebug("DownChannelizer::debugFilterChain: upper %s", (*it)->m_sse ? "sse" : "no_sse");
+            qDebug("DownChannelizer::debugFilterChain: upper %s", it->m_sse ? "sse" : "no_sse");
             break;
         default:
-            qDebug("DownChannelizer::debugFilterChain: none %s", (*it)->m_sse ? "sse" : "no_sse");
+            qDebug("DownChannelizer::debugFilterChain: none %s", it->m_sse ? "sse" : "no_sse");
             break;
         }
     }
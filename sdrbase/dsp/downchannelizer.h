@@ -19,17 +19,18 @@
 #ifndef SDRBASE_DSP_DOWNCHANNELIZER_H
 #define SDRBASE_DSP_DOWNCHANNELIZER_H
 
-#include <list>
 #include <vector>
 
 #include "export.h"
 #include "util/message.h"
-#include "dsp/inthalfbandfiltereo.h"
+#include "dsp/inthalfbandfilterblock.h"
 
 #include "channelsamplesink.h"
 
 #define DOWNCHANNELIZER_HB_FILTER_ORDER 48
 
+class ChannelRecorder;
+
 class SDRBASE_API DownChannelizer : public ChannelSampleSink {
 public:
 	DownChannelizer(ChannelSampleSink* sampleSink);
@@ -43,6 +44,7 @@ public:
 	int getBasebandSampleRate() const { return m_basebandSampleRate; }
     int getChannelSampleRate() const { return m_channelSampleRate; }
 	int getChannelFrequencyOffset() const { return m_channelFrequencyOffset; }
+    void setRecorder(ChannelRecorder *recorder); //!< Optional recording tap of the channelizer output (not owned)
 
 protected:
 	struct FilterStage {
@@ -53,29 +55,36 @@ protected:
 		};
 
 #ifdef SDR_RX_SAMPLE_24BIT
-        typedef bool (IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER>::*WorkFunction)(Sample* s);
-        IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER>* m_filter;
+        IntHalfbandFilterBlock<qint32, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER> m_filter; // 24 bit samples fit in 32 bit storage
 #else
-        typedef bool (IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>::*WorkFunction)(Sample* s);
-        IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>* m_filter;
+        IntHalfbandFilterBlock<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER> m_filter;
 #endif
 
-		WorkFunction m_workFunction;
 		Mode m_mode;
 		bool m_sse;
 
 		FilterStage(Mode mode);
-		~FilterStage();
 
-		bool work(Sample* sample)
+		/** Decimate a block by 2. Returns the number of output samples. out may be the same as in. */
+		int work(const Sample* in, int nbIn, Sample* out, bool halfInput)
 		{
-			return (m_filter->*m_workFunction)(sample);
+			switch (m_mode)
+			{
+			case ModeLowerHalf:
+				return m_filter.workDecimateLowerHalf(in, nbIn, out, halfInput);
+			case ModeUpperHalf:
+				return m_filter.workDecimateUpperHalf(in, nbIn, out, halfInput);
+			case ModeCenter:
+			default:
+				return m_filter.workDecimateCenter(in, nbIn, out, halfInput);
+			}
 		}
 	};
-	typedef std::list<FilterStage*> FilterStages;
+	typedef std::vector<FilterStage> FilterStages; //!< stages stored contiguously in processing order
 	FilterStages m_filterStages;
     bool m_filterChainSetMode;
 	ChannelSampleSink* m_sampleSink; //!< Demodulator
+    ChannelRecorder *m_recorder;     //!< Optional recording tap
     int m_basebandSampleRate;
 	int m_requestedOutputSampleRate;
 	int m_requestedCenterFrequency;
@@ -83,10 +92,11 @@ protected:
     int m_channelFrequencyOffset;
     unsigned int m_log2Decim;
     unsigned int m_filterChainHash;
-	SampleVector m_sampleBuffer;
+	SampleVector m_sampleBuffer; //!< output of the first stage, then decimated in place by the next ones
 
 	void applyChannelization();
     void applyDecimation();
+    void applyRecorderChannelization(); //!< Recorded band and channel offsets to the recorder
 	bool signalContainsChannel(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd) const;
 	Real createFilterChain(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd);
     double setFilterChain(const std::vector<unsigned int>& stageIndexes);
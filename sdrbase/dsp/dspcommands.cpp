@@ -33,6 +33,8 @@ MESSAGE_CLASS_DEFINITION(DSPAddBasebandSampleSink, Message)
 MESSAGE_CLASS_DEFINITION(DSPAddSpectrumSink, Message)
 MESSAGE_CLASS_DEFINITION(DSPAddBasebandSampleSource, Message)
 MESSAGE_CLASS_DEFINITION(DSPRemoveBasebandSampleSink, Message)
+MESSAGE_CLASS_DEFINITION(DSPSharedChannelizerSubscribe, Message)
+MESSAGE_CLASS_DEFINITION(DSPSharedChannelizerSubscription, Message)
 MESSAGE_CLASS_DEFINITION(DSPRemoveSpectrumSink, Message)
 MESSAGE_CLASS_DEFINITION(DSPRemoveBasebandSampleSource, Message)
 MESSAGE_CLASS_DEFINITION(DSPAddAudioSink, Message)
@@ -29,6 +29,8 @@ class BasebandSampleSink;
 class DeviceSampleSink;
 class BasebandSampleSource;
 class AudioFifo;
+class MessageQueue;
+class SampleSinkRingReader;
 
 class SDRBASE_API DSPAcquisitionInit : public Message {
 	MESSAGE_CLASS_DECLARATION
@@ -159,6 +161,69 @@ private:
 	BasebandSampleSink* m_sampleSink;
 };
 
+/**
+ * Channel request to read a sub-band of the device set shared channelizer instead of the full baseband.
+ * Handled by the device engine thread which owns the rings. While subscribed the baseband reader
+ * is detached from the shared baseband. The outcome is posted back as DSPSharedChannelizerSubscription.
+ */
+class SDRBASE_API DSPSharedChannelizerSubscribe : public Message {
+	MESSAGE_CLASS_DECLARATION
+
+public:
+	DSPSharedChannelizerSubscribe(
+		SampleSinkRingReader *basebandReader,
+		SampleSinkRingReader *bandReader,
+		bool subscribe,
+		qint64 centerFrequency,
+		int bandwidth,
+		MessageQueue *replyQueue
+	) :
+		Message(),
+		m_basebandReader(basebandReader),
+		m_bandReader(bandReader),
+		m_subscribe(subscribe),
+		m_centerFrequency(centerFrequency),
+		m_bandwidth(bandwidth),
+		m_replyQueue(replyQueue)
+	{ }
+
+	SampleSinkRingReader *getBasebandReader() const { return m_basebandReader; }
+	SampleSinkRingReader *getBandReader() const { return m_bandReader; }
+	bool getSubscribe() const { return m_subscribe; } //!< false to unsubscribe and read the full baseband again
+	qint64 getCenterFrequency() const { return m_centerFrequency; }
+	int getBandwidth() const { return m_bandwidth; }
+	MessageQueue *getReplyQueue() const { return m_replyQueue; }
+
+private:
+	SampleSinkRingReader *m_basebandReader;
+	SampleSinkRingReader *m_bandReader;
+	bool m_subscribe;
+	qint64 m_centerFrequency;
+	int m_bandwidth;
+	MessageQueue *m_replyQueue;
+};
+
+class SDRBASE_API DSPSharedChannelizerSubscription : public Message {
+	MESSAGE_CLASS_DECLARATION
+
+public:
+	DSPSharedChannelizerSubscription(bool subscribed, int bandSampleRate, int bandFrequencyOffset) :
+		Message(),
+		m_subscribed(subscribed),
+		m_bandSampleRate(bandSampleRate),
+		m_bandFrequencyOffset(bandFrequencyOffset)
+	{ }
+
+	bool getSubscribed() const { return m_subscribed; }
+	int getBandSampleRate() const { return m_bandSampleRate; }
+	int getBandFrequencyOffset() const { return m_bandFrequencyOffset; }
+
+private:
+	bool m_subscribed;
+	int m_bandSampleRate;
+	int m_bandFrequencyOffset;
+};
+
 class SDRBASE_API DSPRemoveSpectrumSink : public Message {
 	MESSAGE_CLASS_DECLARATION
 
@@ -166,10 +166,14 @@ void DSPDeviceSinkEngine::workSampleFifo()
     SampleVector& data = sourceFifo->getData();
     unsigned int iPart1Begin, iPart1End, iPart2Begin, iPart2End;
     unsigned int remainder = sourceFifo->remainder();
+    unsigned int samplesDone = 0;
+
+    m_telemetry.startBlock(remainder, sourceFifo->size());
 
     while ((remainder > 0) && (m_inputMessageQueue.size() == 0))
     {
         sourceFifo->write(remainder, iPart1Begin, iPart1End, iPart2Begin, iPart2End);
+        samplesDone += (iPart1End - iPart1Begin) + (iPart2End - iPart2Begin);
 
         if (iPart1Begin != iPart1End) {
             workSamples(data, iPart1Begin, iPart1End);
@@ -181,6 +185,8 @@ void DSPDeviceSinkEngine::workSampleFifo()
 
         remainder = sourceFifo->remainder();
     }
+
+    m_telemetry.endBlock(samplesDone);
 }
 
 void DSPDeviceSinkEngine::workSamples(SampleVector& data, unsigned int iBegin, unsigned int iEnd)
@@ -398,10 +404,14 @@ void DSPDeviceSinkEngine::handleSetSink(DeviceSampleSink* sink)
 {
 	m_deviceSampleSink = sink;
 
-    if (!m_deviceSampleSink) { // Early leave
+    if (!m_deviceSampleSink) // Early leave
+    {
+        m_telemetry.setSampleFifoCounters(nullptr);
         return;
     }
 
+    m_telemetry.setSampleFifoCounters(&m_deviceSampleSink->getSampleFifo()->getCounters());
+
     qDebug("DSPDeviceSinkEngine::handleSetSink: set %s", qPrintable(sink->getDeviceDescription()));
 
     QObject::connect(
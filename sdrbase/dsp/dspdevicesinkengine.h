@@ -30,6 +30,7 @@
 
 #include "dsp/dsptypes.h"
 #include "dsp/fftwindow.h"
+#include "dsp/dsptelemetry.h"
 #include "util/messagequeue.h"
 #include "util/syncmessenger.h"
 #include "util/incrementalvector.h"
@@ -76,6 +77,7 @@ public:
 	void removeSpectrumSink(BasebandSampleSink* spectrumSink); //!< Add a spectrum vis baseband sample sink
 
 	State state() const { return m_state; } //!< Return DSP engine current state
+	const DSPTelemetry& getTelemetry() const { return m_telemetry; } //!< sample FIFO work loop counters
 
 	QString errorMessage(); //!< Return the current error message
 	QString sinkDeviceDescription(); //!< Return the sink device description
@@ -104,6 +106,7 @@ private:
 	uint32_t m_sampleRate;
 	quint64 m_centerFrequency;
     unsigned int m_sumIndex; //!< channel index when summing channels
+	DSPTelemetry m_telemetry; //!< sample FIFO work loop counters
 
 	void run();
 	void workSampleFifo(); //!< transfer samples from baseband sources to sink if in running state
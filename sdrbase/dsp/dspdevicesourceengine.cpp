@@ -134,6 +134,13 @@ void DSPDeviceSourceEngine::removeSink(BasebandSampleSink* sink)
 	m_syncMessenger.sendWait(cmd);
 }
 
+unsigned int DSPDeviceSourceEngine::getSharedBasebandFree() const
+{
+	unsigned int size = m_sharedBaseband.size();
+	unsigned int maxFill = m_sharedBaseband.getMaxFill();
+	return maxFill < size ? size - maxFill : 0;
+}
+
 void DSPDeviceSourceEngine::configureCorrections(bool dcOffsetCorrection, bool iqImbalanceCorrection)
 {
 	qDebug() << "DSPDeviceSourceEngine::configureCorrections";
@@ -313,6 +320,8 @@ void DSPDeviceSourceEngine::work()
 	std::size_t samplesDone = 0;
 	bool positiveOnly = false;
 
+	m_telemetry.startBlock(sampleFifo->fill(), sampleFifo->size());
+
 	while ((sampleFifo->fill() > 0) && (m_inputMessageQueue.size() == 0) && (samplesDone < m_sampleRate))
 	{
 		SampleVector::iterator part1begin;
@@ -332,11 +341,17 @@ void DSPDeviceSourceEngine::work()
             }
 
 			// feed data to direct sinks
-			for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
+			for (BasebandSampleSinks::const_iterator it = m_fedBasebandSampleSinks.begin(); it != m_fedBasebandSampleSinks.end(); ++it)
 			{
 				(*it)->feed(part1begin, part1end, positiveOnly);
 			}
 
+			// single copy for all sinks reading the shared baseband
+			m_sharedBaseband.write(part1begin, part1end);
+
+			if (m_sharedChannelizer.isActive()) {
+				m_sharedChannelizer.feed(part1begin, part1end);
+			}
 		}
 
 		// second part of FIFO data (used when block wraps around)
@@ -349,17 +364,30 @@ void DSPDeviceSourceEngine::work()
             }
 
 			// feed data to direct sinks
-			for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); it++)
+			for (BasebandSampleSinks::const_iterator it = m_fedBasebandSampleSinks.begin(); it != m_fedBasebandSampleSinks.end(); it++)
 			{
 				(*it)->feed(part2begin, part2end, positiveOnly);
 			}
 
+			m_sharedBaseband.write(part2begin, part2end);
+
+			if (m_sharedChannelizer.isActive()) {
+				m_sharedChannelizer.feed(part2begin, part2end);
+			}
 		}
 
 		// adjust FIFO pointers
 		sampleFifo->readCommit((unsigned int) count);
 		samplesDone += count;
 	}
+
+	if (samplesDone > 0)
+	{
+		m_sharedBaseband.notify();
+		m_sharedChannelizer.notify();
+	}
+
+	m_telemetry.endBlock(samplesDone);
 }
 
 // notStarted -> idle -> init -> running -+
@@ -440,6 +468,8 @@ DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoInit()
 			<< " sampleRate: " << m_sampleRate
 			<< " centerFrequency: " << m_centerFrequency;
 
+	m_sharedBaseband.setSize(SampleSinkFifo::getSizePolicy(m_sampleRate));
+	m_sharedChannelizer.setBasebandSampleRate(m_sampleRate);
 	DSPSignalNotification notif(m_sampleRate, m_centerFrequency);
 
 	for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
@@ -527,15 +557,60 @@ void DSPDeviceSourceEngine::handleSetSource(DeviceSampleSource* source)
 	{
 		qDebug("DSPDeviceSourceEngine::handleSetSource: set %s", qPrintable(source->getDeviceDescription()));
 		connect(m_deviceSampleSource->getSampleFifo(), SIGNAL(dataReady()), this, SLOT(handleData()), Qt::QueuedConnection);
+		m_telemetry.setSampleFifoCounters(&m_deviceSampleSource->getSampleFifo()->getCounters());
 	}
 	else
 	{
 		qDebug("DSPDeviceSourceEngine::handleSetSource: set none");
+		m_telemetry.setSampleFifoCounters(nullptr);
 	}
 }
 
+void DSPDeviceSourceEngine::handleSharedChannelizerSubscribe(const DSPSharedChannelizerSubscribe& cmd)
+{
+	SampleSinkRingReader *basebandReader = cmd.getBasebandReader();
+	SampleSinkRingReader *bandReader = cmd.getBandReader();
+	BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin();
+
+	for (; it != m_basebandSampleSinks.end(); ++it)
+	{
+		if ((*it)->getSharedBasebandReader() == basebandReader) {
+			break;
+		}
+	}
+
+	if (it == m_basebandSampleSinks.end()) // the channel was removed since it posted the request
+	{
+		qDebug("DSPDeviceSourceEngine::handleSharedChannelizerSubscribe: channel not found");
+		return;
+	}
+
+	int bandSampleRate = 0;
+	int bandFrequencyOffset = 0;
+	bool subscribed = cmd.getSubscribe() && m_sharedChannelizer.subscribe(
+		bandReader, cmd.getCenterFrequency(), cmd.getBandwidth(), bandSampleRate, bandFrequencyOffset);
+
+	if (subscribed)
+	{
+		m_sharedChannelizerReaders[basebandReader] = bandReader;
+		m_sharedBaseband.detach(basebandReader); // full rate baseband is not read while subscribed
+	}
+	else
+	{
+		m_sharedChannelizer.unsubscribe(bandReader);
+		m_sharedChannelizerReaders.erase(basebandReader);
+		m_sharedBaseband.attach(basebandReader);
+	}
+
+	cmd.getReplyQueue()->push(new DSPSharedChannelizerSubscription(subscribed, bandSampleRate, bandFrequencyOffset));
+}
+
 void DSPDeviceSourceEngine::handleData()
 {
+	if (m_deviceSampleSource) {
+		m_deviceSampleSource->getSampleFifo()->consumerWoken(); // before any gate so that next write wakes up again
+	}
+
 	if(m_state == StRunning)
 	{
 		work();
@@ -580,6 +655,14 @@ void DSPDeviceSourceEngine::handleSynchronousMessages()
 	{
 		BasebandSampleSink* sink = ((DSPAddBasebandSampleSink*) message)->getSampleSink();
 		m_basebandSampleSinks.push_back(sink);
+		SampleSinkRingReader *reader = sink->getSharedBasebandReader();
+
+		if (reader) {
+			m_sharedBaseband.attach(reader);
+		} else {
+			m_fedBasebandSampleSinks.push_back(sink);
+		}
+
         // initialize sample rate and center frequency in the sink:
         DSPSignalNotification msg(m_sampleRate, m_centerFrequency);
         sink->handleMessage(msg);
@@ -597,6 +680,20 @@ void DSPDeviceSourceEngine::handleSynchronousMessages()
 		}
 
 		m_basebandSampleSinks.remove(sink);
+		m_fedBasebandSampleSinks.remove(sink);
+		SampleSinkRingReader *reader = sink->getSharedBasebandReader();
+
+		if (reader)
+		{
+			m_sharedBaseband.detach(reader);
+			std::map<SampleSinkRingReader*, SampleSinkRingReader*>::iterator sit = m_sharedChannelizerReaders.find(reader);
+
+			if (sit != m_sharedChannelizerReaders.end())
+			{
+				m_sharedChannelizer.unsubscribe(sit->second);
+				m_sharedChannelizerReaders.erase(sit);
+			}
+		}
 	}
 
 	m_syncMessenger.done(m_state);
@@ -649,6 +746,8 @@ void DSPDeviceSourceEngine::handleInputMessages()
 
 			m_sampleRate = notif->getSampleRate();
 			m_centerFrequency = notif->getCenterFrequency();
+			m_sharedBaseband.setSize(SampleSinkFifo::getSizePolicy(m_sampleRate));
+			m_sharedChannelizer.setBasebandSampleRate(m_sampleRate);
 
 			qDebug() << "DSPDeviceSourceEngine::handleInputMessages: DSPSignalNotification:"
 				<< " m_sampleRate: " << m_sampleRate
@@ -676,5 +775,10 @@ void DSPDeviceSourceEngine::handleInputMessages()
 
 			delete message;
 		}
+		else if (DSPSharedChannelizerSubscribe::match(*message))
+		{
+			handleSharedChannelizerSubscribe(*((DSPSharedChannelizerSubscribe*) message));
+			delete message;
+		}
 	}
 }
@@ -19,12 +19,17 @@
 #ifndef INCLUDE_DSPDEVICEENGINE_H
 #define INCLUDE_DSPDEVICEENGINE_H
 
+#include <map>
+
 #include <QThread>
 #include <QTimer>
 #include <QMutex>
 #include <QWaitCondition>
 #include "dsp/dsptypes.h"
 #include "dsp/fftwindow.h"
+#include "dsp/samplesinkring.h"
+#include "dsp/sharedchannelizer.h"
+#include "dsp/dsptelemetry.h"
 #include "util/messagequeue.h"
 #include "util/syncmessenger.h"
 #include "export.h"
@@ -32,6 +37,7 @@
 
 class DeviceSampleSource;
 class BasebandSampleSink;
+class DSPSharedChannelizerSubscribe;
 
 class SDRBASE_API DSPDeviceSourceEngine : public QThread {
 	Q_OBJECT
@@ -67,6 +73,10 @@ public:
 	void removeSink(BasebandSampleSink* sink); //!< Remove a sample sink
 
 	void configureCorrections(bool dcOffsetCorrection, bool iqImbalanceCorrection); //!< Configure DSP corrections
+	quint64 getSharedBasebandDropped() const { return m_sharedBaseband.getDropped(); } //!< samples skipped by lagging shared baseband readers
+	unsigned int getSharedBasebandSize() const { return m_sharedBaseband.size(); } //!< shared baseband ring size in samples
+	unsigned int getSharedBasebandFree() const; //!< samples that can be written to the shared baseband before its slowest reader overflows. From any thread
+	const DSPTelemetry& getTelemetry() const { return m_telemetry; } //!< work loop counters
 
 	State state() const { return m_state; } //!< Return DSP engine current state
 
@@ -89,6 +99,11 @@ private:
 
 	typedef std::list<BasebandSampleSink*> BasebandSampleSinks;
 	BasebandSampleSinks m_basebandSampleSinks; //!< sample sinks within main thread (usually spectrum, file output)
+	BasebandSampleSinks m_fedBasebandSampleSinks; //!< sample sinks that are fed with a copy of the baseband
+	SampleSinkRing m_sharedBaseband; //!< baseband written once and read in place by the other sample sinks
+	SharedChannelizer m_sharedChannelizer; //!< filter bank computed once for all subscribed channels
+	std::map<SampleSinkRingReader*, SampleSinkRingReader*> m_sharedChannelizerReaders; //!< baseband reader to sub-band reader of subscribed channels
+	DSPTelemetry m_telemetry; //!< work loop counters
 
 	uint m_sampleRate;
 	quint64 m_centerFrequency;
@@ -136,6 +151,7 @@ private:
 	State gotoError(const QString& errorMsg); //!< Go to an error state
 
 	void handleSetSource(DeviceSampleSource* source); //!< Manage source setting
+	void handleSharedChannelizerSubscribe(const DSPSharedChannelizerSubscribe& cmd); //!< (Un)subscribe a channel to the shared channelizer from the writer thread
 
 private slots:
 	void handleData(); //!< Handle data when samples from source FIFO are ready to be processed
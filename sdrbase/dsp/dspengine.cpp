@@ -18,12 +18,15 @@
 
 #include <QGlobalStatic>
 #include <QThread>
+#include <QDebug>
 
 #include "dsp/dspengine.h"
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
 #include "dsp/dspdevicemimoengine.h"
 #include "dsp/fftfactory.h"
+#include "dsp/cpufeatures.h"
+#include "dsp/simdkernels.h"
 
 DSPEngine::DSPEngine() :
     m_deviceSourceEnginesUIDSequence(0),
@@ -36,6 +39,8 @@ DSPEngine::DSPEngine() :
 	m_dvSerialSupport = false;
     m_mimoSupport = false;
     m_masterTimer.start(50);
+    // select the runtime dispatched DSP kernels before any channel is created
+    qDebug("DSPEngine::DSPEngine: SIMD path: %s", qPrintable(CPUFeatures::getSIMDPathName(SIMDKernels::instance().path)));
 }
 
 DSPEngine::~DSPEngine()
@@ -195,6 +200,7 @@ void DSPEngine::pushMbeFrame(
 void DSPEngine::createFFTFactory(const QString& fftWisdomFileName)
 {
     m_fftFactory = new FFTFactory(fftWisdomFileName);
+    m_fftFactory->generateWisdom(4, 16); // on first start only: FFT sizes from 16 to 65536
 }
 
 void DSPEngine::preAllocateFFTs()
@@ -28,6 +28,8 @@
 #include "audio/audioinput.h"
 #include "export.h"
 #include "ambe/ambeengine.h"
+#include "dsp/channelthreadpool.h"
+#include "dsp/asyncfilewriter.h"
 
 class DSPDeviceSourceEngine;
 class DSPDeviceSinkEngine;
@@ -88,6 +90,8 @@ public:
     void createFFTFactory(const QString& fftWisdomFileName);
     void preAllocateFFTs();
     FFTFactory *getFFTFactory() { return m_fftFactory; }
+    ChannelThreadPool *getChannelThreadPool() { return &m_channelThreadPool; }
+    AsyncFileWriter *getChannelRecordWriter() { return &m_channelRecordWriter; } //!< Writer thread shared by all channel recordings
 
 private:
 	std::vector<DSPDeviceSourceEngine*> m_deviceSourceEngines;
@@ -104,6 +108,8 @@ private:
     bool m_mimoSupport;
 	AMBEEngine m_ambeEngine;
     FFTFactory *m_fftFactory;
+    ChannelThreadPool m_channelThreadPool;
+    AsyncFileWriter m_channelRecordWriter;
 };
 
 #endif // INCLUDE_DSPENGINE_H
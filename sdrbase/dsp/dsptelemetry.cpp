@@ -0,0 +1,204 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "SWGDSPTelemetry.h"
+#include "SWGFifoCounters.h"
+
+#include "dsptelemetry.h"
+
+DSPTelemetry::DSPTelemetry() :
+    m_sampleFifoCounters(nullptr),
+    m_audioFifoCounters(nullptr)
+{
+    reset();
+}
+
+void DSPTelemetry::startBlock(unsigned int fifoFill, unsigned int fifoSize)
+{
+    m_fifoSize.storeRelease(fifoSize);
+
+    if (fifoFill > m_fifoHighWater.loadAcquire()) {
+        m_fifoHighWater.storeRelease(fifoFill);
+    }
+
+    m_timer.start();
+}
+
+void DSPTelemetry::endBlock(unsigned int nbSamples)
+{
+    quint64 nsecs = m_timer.nsecsElapsed();
+
+    if (nbSamples == 0) { // spurious wakeup: nothing to account
+        return;
+    }
+
+    m_samples.storeRelease(m_samples.loadAcquire() + nbSamples);
+    m_blocks.storeRelease(m_blocks.loadAcquire() + 1);
+    m_busyNsecs.storeRelease(m_busyNsecs.loadAcquire() + nsecs);
+    m_lastBlockNsecs.storeRelease(nsecs);
+
+    if (nsecs > m_maxBlockNsecs.loadAcquire()) {
+        m_maxBlockNsecs.storeRelease(nsecs);
+    }
+}
+
+void DSPTelemetry::reset()
+{
+    m_samples.storeRelease(0);
+    m_blocks.storeRelease(0);
+    m_busyNsecs.storeRelease(0);
+    m_maxBlockNsecs.storeRelease(0);
+    m_lastBlockNsecs.storeRelease(0);
+    m_fifoSize.storeRelease(0);
+    m_fifoHighWater.storeRelease(0);
+}
+
+DSPTelemetry::Snapshot DSPTelemetry::getSnapshot() const
+{
+    Snapshot snapshot;
+    snapshot.m_samples = m_samples.loadAcquire();
+    snapshot.m_blocks = m_blocks.loadAcquire();
+    snapshot.m_busyNsecs = m_busyNsecs.loadAcquire();
+    snapshot.m_maxBlockNsecs = m_maxBlockNsecs.loadAcquire();
+    snapshot.m_lastBlockNsecs = m_lastBlockNsecs.loadAcquire();
+    snapshot.m_fifoSize = m_fifoSize.loadAcquire();
+    snapshot.m_fifoHighWater = m_fifoHighWater.loadAcquire();
+    const FifoCounters *sampleFifoCounters = m_sampleFifoCounters.loadAcquire();
+    const FifoCounters *audioFifoCounters = m_audioFifoCounters.loadAcquire();
+    snapshot.m_hasSampleFifo = sampleFifoCounters != nullptr;
+    snapshot.m_sampleFifo = sampleFifoCounters ? sampleFifoCounters->getSnapshot() : FifoCounters::Snapshot();
+    snapshot.m_hasAudioFifo = audioFifoCounters != nullptr;
+    snapshot.m_audioFifo = audioFifoCounters ? audioFifoCounters->getSnapshot() : FifoCounters::Snapshot();
+    return snapshot;
+}
+
+void DSPTelemetry::webapiFormat(SWGSDRangel::SWGDSPTelemetry& response) const
+{
+    Snapshot snapshot = getSnapshot();
+    response.setSamples(snapshot.m_samples);
+    response.setBlocks(snapshot.m_blocks);
+    response.setBusyTime(snapshot.m_busyNsecs);
+    response.setMaxBlockTime(snapshot.m_maxBlockNsecs);
+    response.setLastBlockTime(snapshot.m_lastBlockNsecs);
+    response.setFifoSize(snapshot.m_fifoSize);
+    response.setFifoHighWater(snapshot.m_fifoHighWater);
+
+    if (snapshot.m_hasSampleFifo)
+    {
+        response.setSampleFifo(new SWGSDRangel::SWGFifoCounters());
+        FifoCounters::webapiFormat(*response.getSampleFifo(), snapshot.m_sampleFifo);
+    }
+
+    if (snapshot.m_hasAudioFifo)
+    {
+        response.setAudioFifo(new SWGSDRangel::SWGFifoCounters());
+        FifoCounters::webapiFormat(*response.getAudioFifo(), snapshot.m_audioFifo);
+    }
+}
+
+void DSPTelemetry::formatPrometheus(
+    QString& text,
+    const QString& prefix,
+    const std::vector<std::pair<QString, Snapshot>>& snapshots)
+{
+    struct Family
+    {
+        const char *m_name;
+        const char *m_type;
+        const char *m_help;
+        quint64 Snapshot::*m_field;
+        double m_scale;
+    };
+
+    static const Family families[] = {
+        {"samples_total", "counter", "Samples processed", &Snapshot::m_samples, 1.0},
+        {"blocks_total", "counter", "Processing runs", &Snapshot::m_blocks, 1.0},
+        {"busy_seconds_total", "counter", "Time spent processing", &Snapshot::m_busyNsecs, 1e-9},
+        {"block_seconds_max", "gauge", "Longest processing run", &Snapshot::m_maxBlockNsecs, 1e-9},
+        {"block_seconds_last", "gauge", "Last processing run", &Snapshot::m_lastBlockNsecs, 1e-9},
+        {"fifo_size_samples", "gauge", "FIFO size", &Snapshot::m_fifoSize, 1.0},
+        {"fifo_high_water_samples", "gauge", "Highest samples pending in the FIFO", &Snapshot::m_fifoHighWater, 1.0}
+    };
+
+    struct FifoFamily
+    {
+        const char *m_name;
+        const char *m_type;
+        const char *m_help;
+        quint64 FifoCounters::Snapshot::*m_field;
+        double m_scale;
+    };
+
+    static const FifoFamily fifoFamilies[] = {
+        {"fifo_overflows_total", "counter", "Writes that could not be stored completely in the FIFO", &FifoCounters::Snapshot::m_overflowEvents, 1.0},
+        {"fifo_overflow_samples_total", "counter", "Samples lost on FIFO write", &FifoCounters::Snapshot::m_overflowSamples, 1.0},
+        {"fifo_last_overflow_timestamp_seconds", "gauge", "Time of the last FIFO overflow", &FifoCounters::Snapshot::m_lastOverflowMs, 1e-3},
+        {"fifo_underruns_total", "counter", "Reads that could not be served completely by the FIFO", &FifoCounters::Snapshot::m_underrunEvents, 1.0},
+        {"fifo_underrun_samples_total", "counter", "Samples missing on FIFO read", &FifoCounters::Snapshot::m_underrunSamples, 1.0},
+        {"fifo_last_underrun_timestamp_seconds", "gauge", "Time of the last FIFO underrun", &FifoCounters::Snapshot::m_lastUnderrunMs, 1e-3}
+    };
+
+    if (snapshots.size() == 0) {
+        return;
+    }
+
+    for (const Family& family : families)
+    {
+        QString name = QString("%1_%2").arg(prefix).arg(family.m_name);
+        text += QString("# HELP %1 %2\n").arg(name).arg(family.m_help);
+        text += QString("# TYPE %1 %2\n").arg(name).arg(family.m_type);
+
+        for (const auto& labelledSnapshot : snapshots)
+        {
+            quint64 value = labelledSnapshot.second.*family.m_field;
+            text += QString("%1{%2} %3\n")
+                .arg(name)
+                .arg(labelledSnapshot.first)
+                .arg(family.m_scale == 1.0 ? QString::number(value) : QString::number(value * family.m_scale, 'g', 9));
+        }
+    }
+
+    for (const FifoFamily& family : fifoFamilies)
+    {
+        QString name = QString("%1_%2").arg(prefix).arg(family.m_name);
+        text += QString("# HELP %1 %2\n").arg(name).arg(family.m_help);
+        text += QString("# TYPE %1 %2\n").arg(name).arg(family.m_type);
+
+        for (const auto& labelledSnapshot : snapshots)
+        {
+            const Snapshot& snapshot = labelledSnapshot.second;
+
+            if (snapshot.m_hasSampleFifo)
+            {
+                quint64 value = snapshot.m_sampleFifo.*family.m_field;
+                text += QString("%1{%2,fifo=\"sample\"} %3\n")
+                    .arg(name)
+                    .arg(labelledSnapshot.first)
+                    .arg(family.m_scale == 1.0 ? QString::number(value) : QString::number(value * family.m_scale, 'f', 3));
+            }
+
+            if (snapshot.m_hasAudioFifo)
+            {
+                quint64 value = snapshot.m_audioFifo.*family.m_field;
+                text += QString("%1{%2,fifo=\"audio\"} %3\n")
+                    .arg(name)
+                    .arg(labelledSnapshot.first)
+                    .arg(family.m_scale == 1.0 ? QString::number(value) : QString::number(value * family.m_scale, 'f', 3));
+            }
+        }
+    }
+}
@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_DSPTELEMETRY_H_
+#define SDRBASE_DSP_DSPTELEMETRY_H_
+
+#include <vector>
+
+#include <QString>
+#include <QElapsedTimer>
+#include <QAtomicInteger>
+#include <QAtomicPointer>
+
+#include "dsp/fifocounters.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+    class SWGDSPTelemetry;
+}
+
+/**
+ * Counters of a DSP hot path (device engine work loop or channel baseband handleData loop).
+ * A processing run is bracketed by startBlock and endBlock from the processing thread which is
+ * the only writer. Counters are atomics so that the Web API thread can take a snapshot at any
+ * time without locking the hot path. Snapshot fields may be from slightly different runs.
+ * Overflow and underrun counters are read from the FIFOs registered with setSampleFifoCounters
+ * and setAudioFifoCounters at snapshot time.
+ */
+class SDRBASE_API DSPTelemetry
+{
+public:
+    struct Snapshot
+    {
+        quint64 m_samples;        //!< samples processed
+        quint64 m_blocks;         //!< processing runs
+        quint64 m_busyNsecs;      //!< total time spent processing
+        quint64 m_maxBlockNsecs;  //!< longest processing run
+        quint64 m_lastBlockNsecs; //!< last processing run
+        quint64 m_fifoSize;       //!< FIFO size in samples
+        quint64 m_fifoHighWater;  //!< highest samples pending in the FIFO at the start of a run (to read for Rx, to write for Tx)
+        bool m_hasSampleFifo;
+        FifoCounters::Snapshot m_sampleFifo; //!< FIFO feeding the loop (Rx) or fed by the loop (Tx)
+        bool m_hasAudioFifo;
+        FifoCounters::Snapshot m_audioFifo;  //!< audio FIFO of the channel
+    };
+
+    DSPTelemetry();
+
+    void startBlock(unsigned int fifoFill, unsigned int fifoSize);
+    void endBlock(unsigned int nbSamples);
+    void setSampleFifoCounters(const FifoCounters *counters) { m_sampleFifoCounters.storeRelease(counters); }
+    void setAudioFifoCounters(const FifoCounters *counters) { m_audioFifoCounters.storeRelease(counters); }
+    void reset();
+    Snapshot getSnapshot() const;
+    void webapiFormat(SWGSDRangel::SWGDSPTelemetry& response) const;
+
+    /**
+     * Append one Prometheus metric family per counter to text for a set of labelled snapshots.
+     * Metric names are prefix followed by the counter name. Labels are given already formatted
+     * as in: deviceset="0",channel="1". FIFO counters get an additional fifo="sample" or
+     * fifo="audio" label.
+     */
+    static void formatPrometheus(
+        QString& text,
+        const QString& prefix,
+        const std::vector<std::pair<QString, Snapshot>>& snapshots
+    );
+
+private:
+    QElapsedTimer m_timer;
+    QAtomicInteger<quint64> m_samples;
+    QAtomicInteger<quint64> m_blocks;
+    QAtomicInteger<quint64> m_busyNsecs;
+    QAtomicInteger<quint64> m_maxBlockNsecs;
+    QAtomicInteger<quint64> m_lastBlockNsecs;
+    QAtomicInteger<quint64> m_fifoSize;
+    QAtomicInteger<quint64> m_fifoHighWater;
+    QAtomicPointer<const FifoCounters> m_sampleFifoCounters;
+    QAtomicPointer<const FifoCounters> m_audioFifoCounters;
+};
+
+#endif // SDRBASE_DSP_DSPTELEMETRY_H_
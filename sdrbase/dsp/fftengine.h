@@ -10,7 +10,7 @@ class SDRBASE_API FFTEngine {
 public:
 	virtual ~FFTEngine();
 
-	virtual void configure(int n, bool inverse) = 0;
+	virtual void configure(int n, bool inverse, int batch = 1) = 0; //!< batch transforms of n samples laid out contiguously in in() and out()
 	virtual void transform() = 0;
 
 	virtual Complex* in() = 0;
@@ -15,22 +15,89 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QThread>
+
+#ifdef USE_FFTW
+#include "fftwengine.h"
+#endif
 #include "fftfactory.h"
 
+#ifdef USE_FFTW
+namespace {
+
+class WisdomThread : public QThread
+{
+public:
+    WisdomThread(const QString& fftwWisdomFileName, unsigned int minLog2Size, unsigned int maxLog2Size) :
+        m_fftwWisdomFileName(fftwWisdomFileName),
+        m_minLog2Size(minLog2Size),
+        m_maxLog2Size(maxLog2Size)
+    {}
+
+protected:
+    virtual void run()
+    {
+        // smallest sizes first as they are the most used and the quickest to plan
+        for (unsigned int log2Size = m_minLog2Size; log2Size <= m_maxLog2Size; log2Size++)
+        {
+            for (int inverse = 0; inverse < 2; inverse++)
+            {
+                if (isInterruptionRequested())
+                {
+                    qDebug("FFTFactory: wisdom generation interrupted at size %u", 1U<<log2Size);
+                    return;
+                }
+
+                FFTWEngine::createWisdom(1<<log2Size, inverse != 0);
+                QThread::yieldCurrentThread(); // let engines waiting for the planner take it
+            }
+        }
+
+        QDir().mkpath(QFileInfo(m_fftwWisdomFileName).absolutePath());
+        FFTWEngine::exportWisdom(m_fftwWisdomFileName);
+    }
+
+private:
+    QString m_fftwWisdomFileName;
+    unsigned int m_minLog2Size;
+    unsigned int m_maxLog2Size;
+};
+
+} // namespace
+#endif
+
 FFTFactory::FFTFactory(const QString& fftwWisdomFileName) :
-    m_fftwWisdomFileName(fftwWisdomFileName)
+    m_fftwWisdomFileName(fftwWisdomFileName),
+    m_wisdomThread(nullptr)
 {}
 
 FFTFactory::~FFTFactory()
 {
     qDebug("FFTFactory::~FFTFactory: deleting FFTs");
 
+    if (m_wisdomThread)
+    {
+        m_wisdomThread->requestInterruption();
+        m_wisdomThread->wait();
+        delete m_wisdomThread;
+    }
+
     for (auto mIt = m_fftEngineBySize.begin(); mIt != m_fftEngineBySize.end(); ++mIt)
     {
         for (auto eIt = mIt->second.begin(); eIt != mIt->second.end(); ++eIt) {
             delete eIt->m_engine;
         }
     }
+
+    for (auto mIt = m_invFFTEngineBySize.begin(); mIt != m_invFFTEngineBySize.end(); ++mIt)
+    {
+        for (auto eIt = mIt->second.begin(); eIt != mIt->second.end(); ++eIt) {
+            delete eIt->m_engine;
+        }
+    }
 }
 
 void FFTFactory::preallocate(
@@ -44,95 +111,106 @@ void FFTFactory::preallocate(
         for (unsigned int log2Size = minLog2Size; log2Size <= maxLog2Size; log2Size++)
         {
             unsigned int fftSize = 1<<log2Size;
-            m_fftEngineBySize.insert(std::pair<unsigned int, std::vector<AllocatedEngine>>(fftSize, std::vector<AllocatedEngine>()));
-            m_invFFTEngineBySize.insert(std::pair<unsigned int, std::vector<AllocatedEngine>>(fftSize, std::vector<AllocatedEngine>()));
-            std::vector<AllocatedEngine>& fftEngines = m_fftEngineBySize[fftSize];
-            std::vector<AllocatedEngine>& invFFTEngines = m_invFFTEngineBySize[fftSize];
 
             for (unsigned int i = 0; i < numberFFT; i++)
             {
-                fftEngines.push_back(AllocatedEngine());
-                fftEngines.back().m_engine = FFTEngine::create(m_fftwWisdomFileName);
-                fftEngines.back().m_engine->setReuse(false);
-                fftEngines.back().m_engine->configure(fftSize, false);
+                FFTEngine *engine = createEngine(fftSize, false, 1); // planning is done without the factory lock
+                QMutexLocker mutexLocker(&m_mutex);
+                m_fftEngineBySize[EngineKey(fftSize, 1)].push_back(AllocatedEngine());
+                m_fftEngineBySize[EngineKey(fftSize, 1)].back().m_engine = engine;
             }
 
             for (unsigned int i = 0; i < numberInvFFT; i++)
             {
-                invFFTEngines.push_back(AllocatedEngine());
-                invFFTEngines.back().m_engine = FFTEngine::create(m_fftwWisdomFileName);
-                fftEngines.back().m_engine->setReuse(false);
-                invFFTEngines.back().m_engine->configure(fftSize, true);
+                FFTEngine *engine = createEngine(fftSize, true, 1);
+                QMutexLocker mutexLocker(&m_mutex);
+                m_invFFTEngineBySize[EngineKey(fftSize, 1)].push_back(AllocatedEngine());
+                m_invFFTEngineBySize[EngineKey(fftSize, 1)].back().m_engine = engine;
             }
         }
     }
 }
 
-unsigned int FFTFactory::getEngine(unsigned int fftSize, bool inverse, FFTEngine **engine)
+unsigned int FFTFactory::getEngine(unsigned int fftSize, bool inverse, FFTEngine **engine, unsigned int batch)
 {
-    std::map<unsigned int, std::vector<AllocatedEngine>>& enginesBySize = inverse ?
-        m_invFFTEngineBySize : m_fftEngineBySize;
+    EngineKey key(fftSize, batch);
+    unsigned int i = 0;
 
-    if (enginesBySize.find(fftSize) == enginesBySize.end())
-    {
-        qDebug("FFTFactory::getEngine: new FFT %s size: %u", (inverse ? "inv" : "fwd"), fftSize);
-        enginesBySize.insert(std::pair<unsigned int, std::vector<AllocatedEngine>>(fftSize, std::vector<AllocatedEngine>()));
-        std::vector<AllocatedEngine>& engines = enginesBySize[fftSize];
-        engines.push_back(AllocatedEngine());
-        engines.back().m_inUse = true;
-        engines.back().m_engine = FFTEngine::create(m_fftwWisdomFileName);
-        engines.back().m_engine->setReuse(false);
-        engines.back().m_engine->configure(fftSize, inverse);
-        *engine = engines.back().m_engine;
-        return 0;
-    }
-    else
     {
-        unsigned int i = 0;
+        QMutexLocker mutexLocker(&m_mutex);
+        std::vector<AllocatedEngine>& engines = (inverse ? m_invFFTEngineBySize : m_fftEngineBySize)[key];
 
-        for (; i < enginesBySize[fftSize].size(); i++)
+        for (; i < engines.size(); i++)
         {
-            if (!enginesBySize[fftSize][i].m_inUse) {
+            if (!engines[i].m_inUse) {
                 break;
             }
         }
 
-        if (i < enginesBySize[fftSize].size())
+        if (i < engines.size())
         {
-            qDebug("FFTFactory::getEngine: reuse engine: %u FFT %s size: %u", i, (inverse ? "inv" : "fwd"), fftSize);
-            enginesBySize[fftSize][i].m_inUse = true;
-            *engine = enginesBySize[fftSize][i].m_engine;
+            qDebug("FFTFactory::getEngine: reuse engine: %u FFT %s size: %u batch: %u", i, (inverse ? "inv" : "fwd"), fftSize, batch);
+            engines[i].m_inUse = true;
+            *engine = engines[i].m_engine;
             return i;
         }
-        else
-        {
-            std::vector<AllocatedEngine>& engines = enginesBySize[fftSize];
-            qDebug("FFTFactory::getEngine: create engine: %lu FFT %s size: %u", engines.size(), (inverse ? "inv" : "fwd"), fftSize);
-            engines.push_back(AllocatedEngine());
-            engines.back().m_inUse = true;
-            engines.back().m_engine = FFTEngine::create(m_fftwWisdomFileName);
-            engines.back().m_engine->setReuse(false);
-            engines.back().m_engine->configure(fftSize, inverse);
-            *engine = engines.back().m_engine;
-            return engines.size() - 1;
-        }
+
+        qDebug("FFTFactory::getEngine: create engine: %u FFT %s size: %u batch: %u", i, (inverse ? "inv" : "fwd"), fftSize, batch);
+        engines.push_back(AllocatedEngine()); // reserve the slot: in use with no engine yet
+        engines.back().m_inUse = true;
     }
+
+    // planning may take long (FFTW_PATIENT, wisdom generation): do not block the other users of the factory
+    FFTEngine *newEngine = createEngine(fftSize, inverse, batch);
+    QMutexLocker mutexLocker(&m_mutex);
+    (inverse ? m_invFFTEngineBySize : m_fftEngineBySize)[key][i].m_engine = newEngine;
+    *engine = newEngine;
+    return i;
 }
 
-void FFTFactory::releaseEngine(unsigned int fftSize, bool inverse, unsigned int engineSequence)
+void FFTFactory::releaseEngine(unsigned int fftSize, bool inverse, unsigned int engineSequence, unsigned int batch)
 {
-    std::map<unsigned int, std::vector<AllocatedEngine>>& enginesBySize = inverse ?
-        m_invFFTEngineBySize : m_fftEngineBySize;
+    QMutexLocker mutexLocker(&m_mutex);
+    EnginesBySize& enginesBySize = inverse ? m_invFFTEngineBySize : m_fftEngineBySize;
+    EnginesBySize::iterator it = enginesBySize.find(EngineKey(fftSize, batch));
 
-    if (enginesBySize.find(fftSize) != enginesBySize.end())
+    if (it != enginesBySize.end())
     {
-        std::vector<AllocatedEngine>& engines = enginesBySize[fftSize];
+        std::vector<AllocatedEngine>& engines = it->second;
 
         if (engineSequence < engines.size())
         {
-            qDebug("FFTFactory::releaseEngine: engineSequence: %u FFT %s size: %u",
-                engineSequence, (inverse ? "inv" : "fwd"), fftSize);
+            qDebug("FFTFactory::releaseEngine: engineSequence: %u FFT %s size: %u batch: %u",
+                engineSequence, (inverse ? "inv" : "fwd"), fftSize, batch);
             engines[engineSequence].m_inUse = false;
         }
     }
-}
\ No newline at end of file
+}
+
+void FFTFactory::generateWisdom(unsigned int minLog2Size, unsigned int maxLog2Size)
+{
+#ifdef USE_FFTW
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_wisdomThread || m_fftwWisdomFileName.isEmpty() || QFile::exists(m_fftwWisdomFileName)) {
+        return;
+    }
+
+    qInfo("FFTFactory::generateWisdom: generating FFTW wisdom for sizes %u to %u in file: '%s'",
+        1U<<minLog2Size, 1U<<maxLog2Size, qPrintable(m_fftwWisdomFileName));
+    m_wisdomThread = new WisdomThread(m_fftwWisdomFileName, minLog2Size, maxLog2Size);
+    m_wisdomThread->setObjectName("FFTWisdom");
+    m_wisdomThread->start(QThread::LowestPriority);
+#else
+    (void) minLog2Size;
+    (void) maxLog2Size;
+#endif
+}
+
+FFTEngine *FFTFactory::createEngine(unsigned int fftSize, bool inverse, unsigned int batch)
+{
+    FFTEngine *engine = FFTEngine::create(m_fftwWisdomFileName);
+    engine->setReuse(false);
+    engine->configure(fftSize, inverse, batch);
+    return engine;
+}
@@ -22,19 +22,34 @@
 #include <vector>
 
 #include <QString>
+#include <QMutex>
 
 #include "export.h"
 #include "dsp/dsptypes.h"
 #include "fftengine.h"
 
+class QThread;
+
+/**
+ * Pool of FFT engines by size, direction and batch (number of transforms run at once).
+ * Engines may be taken and released from any thread.
+ */
 class SDRBASE_API FFTFactory {
 public:
 	FFTFactory(const QString& fftwWisdomFileName);
 	~FFTFactory();
 
     void preallocate(unsigned int minLog2Size, unsigned int maxLog2Size, unsigned int numberFFT, unsigned int numberInvFFT);
-    unsigned int getEngine(unsigned int fftSize, bool inverse, FFTEngine **engine); //!< returns an engine sequence
-    void releaseEngine(unsigned int fftSize, bool inverse, unsigned int engineSequence);
+    unsigned int getEngine(unsigned int fftSize, bool inverse, FFTEngine **engine, unsigned int batch = 1); //!< returns an engine sequence
+    void releaseEngine(unsigned int fftSize, bool inverse, unsigned int engineSequence, unsigned int batch = 1);
+
+    /**
+     * When the FFTW wisdom file does not exist yet plan all power of two sizes in [minLog2Size, maxLog2Size]
+     * in the background then save the wisdom to the file. Plans created meanwhile already benefit from it.
+     * No-op if not built with FFTW.
+     */
+    void generateWisdom(unsigned int minLog2Size, unsigned int maxLog2Size);
+    const QString& getWisdomFileName() const { return m_fftwWisdomFileName; }
 
 private:
     struct AllocatedEngine
@@ -48,9 +63,16 @@ private:
         {}
     };
 
+    typedef std::pair<unsigned int, unsigned int> EngineKey; //!< FFT size, batch
+    typedef std::map<EngineKey, std::vector<AllocatedEngine>> EnginesBySize;
+
     QString m_fftwWisdomFileName;
-    std::map<unsigned int, std::vector<AllocatedEngine>> m_fftEngineBySize;
-    std::map<unsigned int, std::vector<AllocatedEngine>> m_invFFTEngineBySize;
+    EnginesBySize m_fftEngineBySize;
+    EnginesBySize m_invFFTEngineBySize;
+    QMutex m_mutex;
+    QThread *m_wisdomThread;
+
+    FFTEngine *createEngine(unsigned int fftSize, bool inverse, unsigned int batch);
 };
 
 #endif // _SDRBASE_FFTWFACTORY_H
@@ -34,13 +34,49 @@
 #include <cstdlib>
 #include <cmath>
 #include <typeinfo>
+#include <map>
 
 #include <stdio.h>
 #include <sys/types.h>
 #include <memory.h>
 
+#include <QMutex>
+
 #include <dsp/misc.h>
 #include <dsp/fftfilt.h>
+#include <dsp/dspengine.h>
+#include <dsp/fftfactory.h>
+#include <dsp/fftengine.h>
+#include <dsp/simdkernels.h>
+
+//------------------------------------------------------------------------------
+// filter spectra shared by all filters of identical shape and length
+//------------------------------------------------------------------------------
+
+namespace {
+
+enum {SHAPE_BAND, SHAPE_DSB, SHAPE_RRC};
+
+struct SpectrumKey
+{
+	int shape;
+	int len;
+	float p1;
+	float p2;
+
+	bool operator<(const SpectrumKey& other) const
+	{
+		if (shape != other.shape) return shape < other.shape;
+		if (len != other.len) return len < other.len;
+		if (p1 != other.p1) return p1 < other.p1;
+		return p2 < other.p2;
+	}
+};
+
+QMutex spectraMutex;
+std::map<SpectrumKey, std::weak_ptr<std::vector<fftfilt::cmplx>>> spectra;
+
+} // namespace
 
 //------------------------------------------------------------------------------
 // initialize the filter
@@ -53,19 +89,26 @@ void fftfilt::init_filter()
 	flen2	= flen >> 1;
 	fft	= new g_fft<float>(flen);
 
-	filter		= new cmplx[flen];
-    filterOpp   = new cmplx[flen];
+	filterSpectrum = std::make_shared<std::vector<cmplx>>(flen, cmplx(0, 0));
+	filterOppSpectrum = std::make_shared<std::vector<cmplx>>(flen, cmplx(0, 0));
+	filter		= filterSpectrum->data();
+    filterOpp   = filterOppSpectrum->data();
 	data		= new cmplx[flen];
 	output		= new cmplx[flen2];
 	ovlbuf		= new cmplx[flen2];
 
-	memset(filter, 0, flen * sizeof(cmplx));
-    memset(filterOpp, 0, flen * sizeof(cmplx));
 	memset(data, 0, flen * sizeof(cmplx));
 	memset(output, 0, flen2 * sizeof(cmplx));
 	memset(ovlbuf, 0, flen2 * sizeof(cmplx));
 
 	inptr = 0;
+
+    fftBlock = nullptr;
+    fftInvBlock = nullptr;
+    fftBlockSequence = 0;
+    fftInvBlockSequence = 0;
+    kernels = &SIMDKernels::instance();
+    blockPtr = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -97,151 +140,142 @@ fftfilt::~fftfilt()
 {
 	if (fft) delete fft;
 
-	if (filter) delete [] filter;
-    if (filterOpp) delete [] filterOpp;
 	if (data) delete [] data;
 	if (output) delete [] output;
 	if (ovlbuf) delete [] ovlbuf;
+
+    if (fftBlock)
+    {
+        FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+        fftFactory->releaseEngine(flen, false, fftBlockSequence);
+        fftFactory->releaseEngine(flen, true, fftInvBlockSequence);
+    }
 }
 
-void fftfilt::create_filter(float f1, float f2)
+// Look up the spectrum of the given shape and length among the ones in use or compute it
+void fftfilt::set_filter(Spectrum& spectrum, cmplx **coefs, int shape, float p1, float p2)
 {
-	// initialize the filter to zero
-	memset(filter, 0, flen * sizeof(cmplx));
+    QMutexLocker mutexLocker(&spectraMutex);
+    SpectrumKey key = {shape, flen, p1, p2};
+    std::map<SpectrumKey, std::weak_ptr<std::vector<cmplx>>>::iterator it = spectra.find(key);
+    Spectrum shared;
 
-	// create the filter shape coefficients by fft
-	bool b_lowpass, b_highpass;
-	b_lowpass = (f2 != 0);
-	b_highpass = (f1 != 0);
+    if (it != spectra.end()) {
+        shared = it->second.lock();
+    }
 
-	for (int i = 0; i < flen2; i++) {
-		filter[i] = 0;
-	// lowpass @ f2
-		if (b_lowpass)
-			filter[i] += fsinc(f2, i, flen2);
-	// highighpass @ f1
-		if (b_highpass)
-			filter[i] -= fsinc(f1, i, flen2);
-	}
-	// highpass is delta[flen2/2] - h(t)
-	if (b_highpass && f2 < f1)
-		filter[flen2 / 2] += 1;
+    if (!shared)
+    {
+        shared = std::make_shared<std::vector<cmplx>>(flen, cmplx(0, 0));
+        compute_filter(*shared, shape, p1, p2);
 
-	for (int i = 0; i < flen2; i++)
-		filter[i] *= _blackman(i, flen2);
+        for (it = spectra.begin(); it != spectra.end();) // forget the spectra no more in use
+        {
+            if (it->second.expired()) {
+                it = spectra.erase(it);
+            } else {
+                ++it;
+            }
+        }
 
-	fft->ComplexFFT(filter); // filter was expressed in the time domain (impulse response)
+        spectra[key] = shared;
+    }
 
-	// normalize the output filter for unity gain
-	float scale = 0, mag;
-	for (int i = 0; i < flen2; i++) {
-		mag = abs(filter[i]);
-		if (mag > scale) scale = mag;
-	}
-	if (scale != 0) {
-		for (int i = 0; i < flen; i++)
-			filter[i] /= scale;
-	}
+    spectrum = shared;
+    *coefs = spectrum->data();
 }
 
-// Double the size of FFT used for equivalent SSB filter or assume FFT is half the size of the one used for SSB
-void fftfilt::create_dsb_filter(float f2)
+void fftfilt::compute_filter(std::vector<cmplx>& spectrum, int shape, float p1, float p2)
 {
-	// initialize the filter to zero
-	memset(filter, 0, flen * sizeof(cmplx));
+    cmplx *coefs = spectrum.data();
+	float scale = 0, mag;
 
-	for (int i = 0; i < flen2; i++) {
-		filter[i] = fsinc(f2, i, flen2);
-		filter[i] *= _blackman(i, flen2);
-	}
+    if (shape == SHAPE_RRC) // constructed directly from frequency domain response
+    {
+        for (int i = 0; i < flen; i++) {
+            coefs[i] = frrc(p1, p2, i, flen);
+        }
 
-	fft->ComplexFFT(filter); // filter was expressed in the time domain (impulse response)
+        // normalize the output filter for unity gain
+        for (int i = 0; i < flen; i++)
+        {
+            mag = abs(coefs[i]);
+            if (mag > scale) {
+                scale = mag;
+            }
+        }
+    }
+    else
+    {
+        if (shape == SHAPE_DSB)
+        {
+            for (int i = 0; i < flen2; i++) {
+                coefs[i] = fsinc(p2, i, flen2);
+                coefs[i] *= _blackman(i, flen2);
+            }
+        }
+        else
+        {
+            // create the filter shape coefficients by fft
+            bool b_lowpass, b_highpass;
+            b_lowpass = (p2 != 0);
+            b_highpass = (p1 != 0);
+
+            for (int i = 0; i < flen2; i++) {
+                coefs[i] = 0;
+            // lowpass @ f2
+                if (b_lowpass)
+                    coefs[i] += fsinc(p2, i, flen2);
+            // highighpass @ f1
+                if (b_highpass)
+                    coefs[i] -= fsinc(p1, i, flen2);
+            }
+            // highpass is delta[flen2/2] - h(t)
+            if (b_highpass && p2 < p1)
+                coefs[flen2 / 2] += 1;
+
+            for (int i = 0; i < flen2; i++)
+                coefs[i] *= _blackman(i, flen2);
+        }
+
+        fft->ComplexFFT(coefs); // filter was expressed in the time domain (impulse response)
+
+        // normalize the output filter for unity gain
+        for (int i = 0; i < flen2; i++) {
+            mag = abs(coefs[i]);
+            if (mag > scale) scale = mag;
+        }
+    }
 
-	// normalize the output filter for unity gain
-	float scale = 0, mag;
-	for (int i = 0; i < flen2; i++) {
-		mag = abs(filter[i]);
-		if (mag > scale) scale = mag;
-	}
 	if (scale != 0) {
 		for (int i = 0; i < flen; i++)
-			filter[i] /= scale;
+			coefs[i] /= scale;
 	}
 }
 
+void fftfilt::create_filter(float f1, float f2)
+{
+    set_filter(filterSpectrum, &filter, SHAPE_BAND, f1, f2);
+}
+
+// Double the size of FFT used for equivalent SSB filter or assume FFT is half the size of the one used for SSB
+void fftfilt::create_dsb_filter(float f2)
+{
+    set_filter(filterSpectrum, &filter, SHAPE_DSB, 0, f2);
+}
+
 // Double the size of FFT used for equivalent SSB filter or assume FFT is half the size of the one used for SSB
 // used with runAsym for in band / opposite band asymmetrical filtering. Can be used for vestigial sideband modulation.
 void fftfilt::create_asym_filter(float fopp, float fin)
 {
-    // in band
-    // initialize the filter to zero
-    memset(filter, 0, flen * sizeof(cmplx));
-
-    for (int i = 0; i < flen2; i++) {
-        filter[i] = fsinc(fin, i, flen2);
-        filter[i] *= _blackman(i, flen2);
-    }
-
-    fft->ComplexFFT(filter); // filter was expressed in the time domain (impulse response)
-
-    // normalize the output filter for unity gain
-    float scale = 0, mag;
-    for (int i = 0; i < flen2; i++) {
-        mag = abs(filter[i]);
-        if (mag > scale) scale = mag;
-    }
-    if (scale != 0) {
-        for (int i = 0; i < flen; i++)
-            filter[i] /= scale;
-    }
-
-    // opposite band
-    // initialize the filter to zero
-    memset(filterOpp, 0, flen * sizeof(cmplx));
-
-    for (int i = 0; i < flen2; i++) {
-        filterOpp[i] = fsinc(fopp, i, flen2);
-        filterOpp[i] *= _blackman(i, flen2);
-    }
-
-    fft->ComplexFFT(filterOpp); // filter was expressed in the time domain (impulse response)
-
-    // normalize the output filter for unity gain
-    scale = 0;
-    for (int i = 0; i < flen2; i++) {
-        mag = abs(filterOpp[i]);
-        if (mag > scale) scale = mag;
-    }
-    if (scale != 0) {
-        for (int i = 0; i < flen; i++)
-            filterOpp[i] /= scale;
-    }
+    set_filter(filterSpectrum, &filter, SHAPE_DSB, 0, fin);        // in band
+    set_filter(filterOppSpectrum, &filterOpp, SHAPE_DSB, 0, fopp); // opposite band
 }
 
 // This filter is constructed directly from frequency domain response. Run with runFilt.
 void fftfilt::create_rrc_filter(float fb, float a)
 {
-    std::fill(filter, filter+flen, 0);
-
-    for (int i = 0; i < flen; i++) {
-        filter[i] = frrc(fb, a, i, flen);
-    }
-
-    // normalize the output filter for unity gain
-    float scale = 0, mag;
-    for (int i = 0; i < flen; i++)
-    {
-        mag = abs(filter[i]);
-        if (mag > scale) {
-            scale = mag;
-        }
-    }
-    if (scale != 0)
-    {
-        for (int i = 0; i < flen; i++) {
-            filter[i] /= scale;
-        }
-    }
+    set_filter(filterSpectrum, &filter, SHAPE_RRC, fb, a);
 }
 
 // test bypass
@@ -400,6 +434,121 @@ int fftfilt::runAsym(const cmplx & in, cmplx **out, bool usb)
     return flen2;
 }
 
+//------------------------------------------------------------------------------
+// Block versions with overlap-save fast convolution.
+// The FFT input is the previous half block followed by the current half block.
+// The first half of the circular convolution is aliased and dropped. Filtered
+// samples of a half block are output while the next half block is collected.
+//------------------------------------------------------------------------------
+
+void fftfilt::runFilt(const cmplx *in, cmplx *out, int len)
+{
+    runBlock(in, out, len, BlockFilt, true, true);
+}
+
+void fftfilt::runSSB(const cmplx *in, cmplx *out, int len, bool usb, bool getDC)
+{
+    runBlock(in, out, len, BlockSSB, usb, getDC);
+}
+
+void fftfilt::runDSB(const cmplx *in, cmplx *out, int len, bool getDC)
+{
+    runBlock(in, out, len, BlockDSB, true, getDC);
+}
+
+void fftfilt::runAsym(const cmplx *in, cmplx *out, int len, bool usb)
+{
+    runBlock(in, out, len, BlockAsym, usb, true);
+}
+
+void fftfilt::runBlock(const cmplx *in, cmplx *out, int len, BlockMode mode, bool usb, bool getDC)
+{
+    if (!fftBlock) // engines are allocated only when the block versions are used
+    {
+        FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+        fftBlockSequence = fftFactory->getEngine(flen, false, &fftBlock);
+        fftInvBlockSequence = fftFactory->getEngine(flen, true, &fftInvBlock);
+        blockInput.assign(flen, cmplx(0, 0));
+        blockOutput.assign(flen2, cmplx(0, 0));
+        blockPtr = 0;
+    }
+
+    int done = 0;
+
+    while (done < len)
+    {
+        int count = std::min(len - done, flen2 - blockPtr);
+        std::copy(in + done, in + done + count, blockInput.begin() + flen2 + blockPtr);
+        std::copy(blockOutput.begin() + blockPtr, blockOutput.begin() + blockPtr + count, out + done);
+        blockPtr += count;
+        done += count;
+
+        if (blockPtr == flen2)
+        {
+            filterBlock(mode, usb, getDC);
+            blockPtr = 0;
+        }
+    }
+}
+
+void fftfilt::filterBlock(BlockMode mode, bool usb, bool getDC)
+{
+    std::copy(blockInput.begin(), blockInput.end(), fftBlock->in());
+    fftBlock->transform();
+
+    const cmplx *spectrum = fftBlock->out();
+    cmplx *shaped = fftInvBlock->in();
+    const float *a = reinterpret_cast<const float*>(spectrum);
+    float *res = reinterpret_cast<float*>(shaped);
+
+    switch (mode)
+    {
+    case BlockSSB:
+        // Discard frequencies for ssb
+        if (usb)
+        {
+            kernels->mulIQ(res, a, reinterpret_cast<const float*>(filter), flen2);
+            std::fill(shaped + flen2, shaped + flen, 0);
+        }
+        else
+        {
+            std::fill(shaped, shaped + flen2, 0);
+            kernels->mulIQ(res + 2*flen2, a + 2*flen2, reinterpret_cast<const float*>(filter + flen2), flen2);
+            shaped[flen2] = 0;
+        }
+        // get or reject DC component
+        shaped[0] = getDC ? spectrum[0] * filter[0] : 0;
+        break;
+    case BlockDSB:
+        kernels->mulIQ(res, a, reinterpret_cast<const float*>(filter), flen);
+        // get or reject DC component
+        shaped[0] = getDC ? shaped[0] : 0;
+        break;
+    case BlockAsym:
+        // opposite band gets the opposite filter
+        kernels->mulIQ(res, a, reinterpret_cast<const float*>(usb ? filter : filterOpp), flen2);
+        kernels->mulIQ(res + 2*flen2, a + 2*flen2, reinterpret_cast<const float*>((usb ? filterOpp : filter) + flen2), flen2);
+        shaped[0] = spectrum[0] * filter[0]; // always keep DC
+        break;
+    case BlockFilt:
+    default:
+        kernels->mulIQ(res, a, reinterpret_cast<const float*>(filter), flen);
+        break;
+    }
+
+    fftInvBlock->transform();
+
+    // keep the last half of the circular convolution. Inverse FFT is not normalized.
+    const cmplx *filtered = fftInvBlock->out() + flen2;
+    const float scale = 1.0f / flen;
+
+    for (int i = 0; i < flen2; i++) {
+        blockOutput[i] = filtered[i] * scale;
+    }
+
+    std::copy(blockInput.begin() + flen2, blockInput.end(), blockInput.begin());
+}
+
 /* Sliding FFT from Fldigi */
 
 struct sfft::vrot_bins_pair {
@@ -6,9 +6,15 @@
 #define	_FFTFILT_H
 
 #include <complex>
+#include <memory>
+#include <vector>
+
 #include "gfft.h"
 #include "export.h"
 
+class FFTEngine;
+struct SIMDKernels;
+
 #undef M_PI
 #define M_PI 3.14159265358979323846
 
@@ -36,18 +42,40 @@ public:
 	int runDSB(const cmplx& in, cmplx **out, bool getDC = true);
 	int runAsym(const cmplx & in, cmplx **out, bool usb); //!< Asymmetrical fitering can be used for vestigial sideband
 
+    // Block versions: overlap-save fast convolution of whole buffers with FFTs from the FFTFactory.
+    // Each call filters len samples of in into len samples of out with a fixed delay
+    // of half the FFT length. out may be in. Block and per sample versions must not be mixed on the same object.
+    void runFilt(const cmplx *in, cmplx *out, int len);
+    void runSSB(const cmplx *in, cmplx *out, int len, bool usb, bool getDC = true);
+    void runDSB(const cmplx *in, cmplx *out, int len, bool getDC = true);
+    void runAsym(const cmplx *in, cmplx *out, int len, bool usb);
+
 protected:
+    enum BlockMode {BlockFilt, BlockSSB, BlockDSB, BlockAsym};
+    typedef std::shared_ptr<std::vector<cmplx>> Spectrum;
+
 	int flen;
 	int flen2;
 	g_fft<float> *fft;
-	cmplx *filter;
-    cmplx *filterOpp;
+	cmplx *filter;    //!< points to filterSpectrum data
+    cmplx *filterOpp; //!< points to filterOppSpectrum data
+    Spectrum filterSpectrum;    //!< may be shared with other filters of identical shape and length
+    Spectrum filterOppSpectrum; //!< may be shared with other filters of identical shape and length
 	cmplx *data;
 	cmplx *ovlbuf;
 	cmplx *output;
 	int inptr;
 	int pass;
 	int window;
+    // block (overlap-save) processing
+    FFTEngine *fftBlock;
+    FFTEngine *fftInvBlock;
+    unsigned int fftBlockSequence;
+    unsigned int fftInvBlockSequence;
+    const SIMDKernels *kernels;
+    std::vector<cmplx> blockInput;  //!< previous and current half blocks
+    std::vector<cmplx> blockOutput; //!< filtered previous half block
+    int blockPtr;
 
 	inline float fsinc(float fc, int i, int len)
 	{
@@ -88,6 +116,10 @@ protected:
 
 	void init_filter();
 	void init_dsb_filter();
+    void set_filter(Spectrum& spectrum, cmplx **coefs, int shape, float p1, float p2);
+    void compute_filter(std::vector<cmplx>& spectrum, int shape, float p1, float p2);
+    void runBlock(const cmplx *in, cmplx *out, int len, BlockMode mode, bool usb, bool getDC);
+    void filterBlock(BlockMode mode, bool usb, bool getDC);
 };
 
 
@@ -14,13 +14,13 @@ FFTWEngine::~FFTWEngine()
 	freeAll();
 }
 
-void FFTWEngine::configure(int n, bool inverse)
+void FFTWEngine::configure(int n, bool inverse, int batch)
 {
     if (m_reuse)
     {
         for (Plans::const_iterator it = m_plans.begin(); it != m_plans.end(); ++it)
         {
-            if (((*it)->n == n) && ((*it)->inverse == inverse))
+            if (((*it)->n == n) && ((*it)->inverse == inverse) && ((*it)->batch == batch))
             {
                 m_currentPlan = *it;
                 return;
@@ -28,14 +28,16 @@ void FFTWEngine::configure(int n, bool inverse)
         }
     }
 
-	m_currentPlan = new Plan;
-	m_currentPlan->n = n;
-	m_currentPlan->inverse = inverse;
-	m_currentPlan->in = (fftwf_complex*)fftwf_malloc(sizeof(fftwf_complex) * n);
-	m_currentPlan->out = (fftwf_complex*)fftwf_malloc(sizeof(fftwf_complex) * n);
+    // plan privately and publish the plan only when it is complete
+    Plan *plan = new Plan;
+    plan->n = n;
+    plan->inverse = inverse;
+    plan->batch = batch;
+    plan->in = (fftwf_complex*)fftwf_malloc(sizeof(fftwf_complex) * n * batch);
+    plan->out = (fftwf_complex*)fftwf_malloc(sizeof(fftwf_complex) * n * batch);
 	QTime t;
 	t.start();
-    m_globalPlanMutex.lock();
+    m_globalPlanMutex.lock(); // only the FFTW planner, it may wait for the wisdom generation of one size
 
     if (m_fftWisdomFileName.size() > 0)
     {
@@ -52,11 +54,20 @@ void FFTWEngine::configure(int n, bool inverse)
         qDebug("FFTWEngine::configure: no FFTW wisdom file");
     }
 
-	m_currentPlan->plan = fftwf_plan_dft_1d(n, m_currentPlan->in, m_currentPlan->out, inverse ? FFTW_BACKWARD : FFTW_FORWARD, FFTW_PATIENT);
+    if (batch > 1) { // transforms of contiguous blocks of n samples
+        plan->plan = fftwf_plan_many_dft(1, &n, batch,
+            plan->in, nullptr, 1, n,
+            plan->out, nullptr, 1, n,
+            inverse ? FFTW_BACKWARD : FFTW_FORWARD, FFTW_PATIENT);
+    } else {
+        plan->plan = fftwf_plan_dft_1d(n, plan->in, plan->out, inverse ? FFTW_BACKWARD : FFTW_FORWARD, FFTW_PATIENT);
+    }
+
     m_globalPlanMutex.unlock();
 
-    qDebug("FFT: creating FFTW plan (n=%d,%s) took %dms", n, inverse ? "inverse" : "forward", t.elapsed());
-	m_plans.push_back(m_currentPlan);
+    qDebug("FFT: creating FFTW plan (n=%d,%s,batch=%d) took %dms", n, inverse ? "inverse" : "forward", batch, t.elapsed());
+    m_plans.push_back(plan);
+    m_currentPlan = plan;
 }
 
 void FFTWEngine::transform()
@@ -81,8 +92,39 @@ Complex* FFTWEngine::out()
 
 QMutex FFTWEngine::m_globalPlanMutex;
 
+void FFTWEngine::createWisdom(int n, bool inverse)
+{
+	fftwf_complex *in = (fftwf_complex*)fftwf_malloc(sizeof(fftwf_complex) * n);
+	fftwf_complex *out = (fftwf_complex*)fftwf_malloc(sizeof(fftwf_complex) * n);
+	QTime t;
+	t.start();
+    m_globalPlanMutex.lock(); // one size only so that engines can plan between sizes
+	fftwf_plan plan = fftwf_plan_dft_1d(n, in, out, inverse ? FFTW_BACKWARD : FFTW_FORWARD, FFTW_PATIENT);
+	fftwf_destroy_plan(plan);
+    m_globalPlanMutex.unlock();
+	fftwf_free(in);
+	fftwf_free(out);
+    qDebug("FFTWEngine::createWisdom: (n=%d,%s) took %dms", n, inverse ? "inverse" : "forward", t.elapsed());
+}
+
+bool FFTWEngine::exportWisdom(const QString& fftWisdomFileName)
+{
+    QMutexLocker mutexLocker(&m_globalPlanMutex);
+    int rc = fftwf_export_wisdom_to_filename(fftWisdomFileName.toStdString().c_str());
+
+    if (rc == 0) { // that's an error
+        qWarning("FFTWEngine::exportWisdom: exporting to FFTW wisdom file: '%s' failed", qPrintable(fftWisdomFileName));
+    } else {
+        qInfo("FFTWEngine::exportWisdom: exported to FFTW wisdom file: '%s'", qPrintable(fftWisdomFileName));
+    }
+
+    return rc != 0;
+}
+
 void FFTWEngine::freeAll()
 {
+    QMutexLocker mutexLocker(&m_globalPlanMutex); // only fftwf_execute is thread safe
+
 	for(Plans::iterator it = m_plans.begin(); it != m_plans.end(); ++it) {
 		fftwf_destroy_plan((*it)->plan);
 		fftwf_free((*it)->in);
@@ -14,7 +14,7 @@ public:
 	FFTWEngine(const QString& fftWisdomFileName);
 	virtual ~FFTWEngine();
 
-	virtual void configure(int n, bool inverse);
+	virtual void configure(int n, bool inverse, int batch = 1);
 	virtual void transform();
 
 	virtual Complex* in();
@@ -22,6 +22,9 @@ public:
 
     virtual void setReuse(bool reuse) { m_reuse = reuse; }
 
+    static void createWisdom(int n, bool inverse); //!< Plan with the engine flags and discard the plan. Wisdom stays in memory
+    static bool exportWisdom(const QString& fftWisdomFileName);
+
 protected:
 	static QMutex m_globalPlanMutex;
     QString m_fftWisdomFileName;
@@ -29,6 +32,7 @@ protected:
 	struct Plan {
 		int n;
 		bool inverse;
+		int batch;
 		fftwf_plan plan;
 		fftwf_complex* in;
 		fftwf_complex* out;
@@ -0,0 +1,81 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDateTime>
+
+#include "SWGFifoCounters.h"
+
+#include "fifocounters.h"
+
+FifoCounters::FifoCounters()
+{
+    reset();
+}
+
+void FifoCounters::overflow(unsigned int nbSamples)
+{
+    if (nbSamples == 0) {
+        return;
+    }
+
+    m_overflowEvents.fetchAndAddOrdered(1);
+    m_overflowSamples.fetchAndAddOrdered(nbSamples);
+    m_lastOverflowMs.storeRelease(QDateTime::currentMSecsSinceEpoch());
+}
+
+void FifoCounters::underrun(unsigned int nbSamples)
+{
+    if (nbSamples == 0) {
+        return;
+    }
+
+    m_underrunEvents.fetchAndAddOrdered(1);
+    m_underrunSamples.fetchAndAddOrdered(nbSamples);
+    m_lastUnderrunMs.storeRelease(QDateTime::currentMSecsSinceEpoch());
+}
+
+void FifoCounters::reset()
+{
+    m_overflowEvents.storeRelease(0);
+    m_overflowSamples.storeRelease(0);
+    m_lastOverflowMs.storeRelease(0);
+    m_underrunEvents.storeRelease(0);
+    m_underrunSamples.storeRelease(0);
+    m_lastUnderrunMs.storeRelease(0);
+}
+
+FifoCounters::Snapshot FifoCounters::getSnapshot() const
+{
+    Snapshot snapshot;
+    snapshot.m_overflowEvents = m_overflowEvents.loadAcquire();
+    snapshot.m_overflowSamples = m_overflowSamples.loadAcquire();
+    snapshot.m_lastOverflowMs = m_lastOverflowMs.loadAcquire();
+    snapshot.m_underrunEvents = m_underrunEvents.loadAcquire();
+    snapshot.m_underrunSamples = m_underrunSamples.loadAcquire();
+    snapshot.m_lastUnderrunMs = m_lastUnderrunMs.loadAcquire();
+    return snapshot;
+}
+
+void FifoCounters::webapiFormat(SWGSDRangel::SWGFifoCounters& response, const Snapshot& snapshot)
+{
+    response.setOverflowEvents(snapshot.m_overflowEvents);
+    response.setOverflowSamples(snapshot.m_overflowSamples);
+    response.setLastOverflowTime(snapshot.m_lastOverflowMs);
+    response.setUnderrunEvents(snapshot.m_underrunEvents);
+    response.setUnderrunSamples(snapshot.m_underrunSamples);
+    response.setLastUnderrunTime(snapshot.m_lastUnderrunMs);
+}
@@ -0,0 +1,68 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_FIFOCOUNTERS_H_
+#define SDRBASE_DSP_FIFOCOUNTERS_H_
+
+#include <QAtomicInteger>
+
+#include "export.h"
+
+namespace SWGSDRangel {
+    class SWGFifoCounters;
+}
+
+/**
+ * Exact overflow (samples dropped on write) and underrun (samples missing on read) accounting
+ * of a FIFO with the time of the last event. Events are counted from the FIFO access methods
+ * in place of logging so that sample loss costs two atomic additions and can be queried at any
+ * time from another thread.
+ */
+class SDRBASE_API FifoCounters
+{
+public:
+    struct Snapshot
+    {
+        quint64 m_overflowEvents;   //!< writes that could not be stored completely
+        quint64 m_overflowSamples;  //!< samples lost on write
+        quint64 m_lastOverflowMs;   //!< time of the last overflow in ms since epoch or 0
+        quint64 m_underrunEvents;   //!< reads that could not be served completely
+        quint64 m_underrunSamples;  //!< samples missing on read
+        quint64 m_lastUnderrunMs;   //!< time of the last underrun in ms since epoch or 0
+    };
+
+    FifoCounters();
+
+    void overflow(unsigned int nbSamples);
+    void underrun(unsigned int nbSamples);
+    void reset();
+    Snapshot getSnapshot() const;
+    quint64 getOverflowSamples() const { return m_overflowSamples.loadAcquire(); }
+    quint64 getUnderrunSamples() const { return m_underrunSamples.loadAcquire(); }
+
+    static void webapiFormat(SWGSDRangel::SWGFifoCounters& response, const Snapshot& snapshot);
+
+private:
+    QAtomicInteger<quint64> m_overflowEvents;
+    QAtomicInteger<quint64> m_overflowSamples;
+    QAtomicInteger<quint64> m_lastOverflowMs;
+    QAtomicInteger<quint64> m_underrunEvents;
+    QAtomicInteger<quint64> m_underrunSamples;
+    QAtomicInteger<quint64> m_lastUnderrunMs;
+};
+
+#endif // SDRBASE_DSP_FIFOCOUNTERS_H_
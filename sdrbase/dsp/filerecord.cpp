@@ -17,9 +17,15 @@
 
 #include <boost/crc.hpp>
 #include <boost/cstdint.hpp>
+#include <algorithm>
 
 #include <QDebug>
 #include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
 
 #include "dsp/dspcommands.h"
 #include "util/simpleserializer.h"
@@ -27,6 +33,8 @@
 
 #include "filerecord.h"
 
+RecordFormat::Format FileRecord::m_defaultFormat = RecordFormat::FormatNative;
+
 FileRecord::FileRecord() :
 	BasebandSampleSink(),
     m_fileName("test.sdriq"),
@@ -34,7 +42,19 @@ FileRecord::FileRecord() :
     m_centerFrequency(0),
 	m_recordOn(false),
     m_recordStart(false),
-    m_byteCount(0)
+    m_directIO(false),
+    m_channelRecord(false),
+    m_channelFrequency(0),
+    m_format(m_defaultFormat),
+    m_recordFormat(RecordFormat::FormatNative),
+    m_blockCount(0),
+    m_sharedWriter(nullptr),
+    m_streamWriter(nullptr),
+    m_stream(nullptr),
+    m_blockSize(0),
+    m_nbBlocks(0),
+    m_byteCount(0),
+    m_droppedBlocks(0)
 {
 	setObjectName("FileSink");
 }
@@ -46,7 +66,19 @@ FileRecord::FileRecord(const QString& filename) :
     m_centerFrequency(0),
     m_recordOn(false),
     m_recordStart(false),
-    m_byteCount(0)
+    m_directIO(false),
+    m_channelRecord(false),
+    m_channelFrequency(0),
+    m_format(m_defaultFormat),
+    m_recordFormat(RecordFormat::FormatNative),
+    m_blockCount(0),
+    m_sharedWriter(nullptr),
+    m_streamWriter(nullptr),
+    m_stream(nullptr),
+    m_blockSize(0),
+    m_nbBlocks(0),
+    m_byteCount(0),
+    m_droppedBlocks(0)
 {
     setObjectName("FileRecord");
 }
@@ -80,7 +112,11 @@ void FileRecord::feed(const SampleVector::const_iterator& begin, const SampleVec
     if(!m_recordOn)
         return;
 
-    if (begin < end) // if there is something to put out
+    if (!m_mutex.tryLock()) { // recording is being started or stopped
+        return;
+    }
+
+    if (m_stream && (begin < end)) // if there is something to put out
     {
         if (m_recordStart)
         {
@@ -88,9 +124,17 @@ void FileRecord::feed(const SampleVector::const_iterator& begin, const SampleVec
             m_recordStart = false;
         }
 
-        m_sampleFile.write(reinterpret_cast<const char*>(&*(begin)), (end - begin)*sizeof(Sample));
+        // never blocks: data is dropped if the writer thread is late
+        if (m_recordFormat == RecordFormat::FormatNative) {
+            m_stream->write(reinterpret_cast<const char*>(&*(begin)), (end - begin)*sizeof(Sample));
+        } else {
+            writePacked(begin, end);
+        }
+
         m_byteCount += end - begin;
     }
+
+    m_mutex.unlock();
 }
 
 void FileRecord::start()
@@ -104,27 +148,67 @@ void FileRecord::stop()
 
 void FileRecord::startRecording()
 {
-    if (!m_sampleFile.is_open())
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_stream)
     {
     	qDebug() << "FileRecord::startRecording";
-        m_sampleFile.open(m_fileName.toStdString().c_str(), std::ios::binary);
+        m_streamWriter = m_sharedWriter ? m_sharedWriter : &m_writer;
+        m_stream = m_blockSize > 0 ?
+            m_streamWriter->openStream(m_fileName, m_directIO, m_blockSize, m_nbBlocks) :
+            m_streamWriter->openStream(m_fileName, m_directIO);
+
+        if (!m_stream) {
+            return;
+        }
+
         m_recordOn = true;
         m_recordStart = true;
         m_byteCount = 0;
+        m_droppedBlocks = 0;
+        m_recordFormat = m_format;
+        m_recordHeader.startTimeStamp = 0;
+        m_blockSamples.resize(RecordFormat::getUnitSamples(m_recordFormat));
+        m_blockCount = 0;
     }
 }
 
 void FileRecord::stopRecording()
 {
-    if (m_sampleFile.is_open())
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_stream)
     {
     	qDebug() << "FileRecord::stopRecording";
-        m_sampleFile.close();
         m_recordOn = false;
         m_recordStart = false;
+
+        if (m_blockCount > 0) // last block is completed with zeros
+        {
+            std::fill(m_blockSamples.begin() + m_blockCount, m_blockSamples.end(), Sample());
+            writeUnits(&m_blockSamples[0], 1);
+            m_blockCount = 0;
+        }
+
+        m_droppedBlocks = m_streamWriter->closeStream(m_stream); // pending blocks are written by the writer thread
+        m_stream = nullptr;
+
+        if (m_droppedBlocks > 0) {
+            qWarning("FileRecord::stopRecording: %llu blocks dropped in %s", m_droppedBlocks, qPrintable(m_fileName));
+        }
+
+        if (((m_recordFormat != RecordFormat::FormatNative) || m_channelRecord) && (m_recordHeader.startTimeStamp != 0)) {
+            writeSigMF();
+        }
     }
 }
 
+quint64 FileRecord::getDroppedBlocks() const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_stream ? m_stream->getDroppedBlocks() : m_droppedBlocks;
+}
+
 bool FileRecord::handleMessage(const Message& message)
 {
 	if (DSPSignalNotification::match(message))
@@ -160,9 +244,116 @@ void FileRecord::writeHeader()
     std::time_t ts = time(0);
     header.startTimeStamp = ts;
     header.sampleSize = SDR_RX_SAMP_SZ;
-    header.filler = 0;
+    header.format = m_recordFormat;
+
+    boost::crc_32_type crc32;
+    crc32.process_bytes(&header, 28);
+    header.crc32 = crc32.checksum();
+    m_stream->write((const char *) &header, sizeof(Header));
+    m_recordHeader = header;
+}
+
+void FileRecord::writePacked(SampleVector::const_iterator begin, const SampleVector::const_iterator& end)
+{
+    const int unitSamples = m_blockSamples.size();
+
+    if (m_blockCount > 0) // complete the pending block first
+    {
+        int nbSamples = std::min((int) (end - begin), unitSamples - m_blockCount);
+        std::copy(begin, begin + nbSamples, m_blockSamples.begin() + m_blockCount);
+        m_blockCount += nbSamples;
+        begin += nbSamples;
+
+        if (m_blockCount < unitSamples) {
+            return;
+        }
 
-    writeHeader(m_sampleFile, header);
+        writeUnits(&m_blockSamples[0], 1);
+        m_blockCount = 0;
+    }
+
+    int nbUnits = (end - begin) / unitSamples;
+
+    if (nbUnits > 0)
+    {
+        writeUnits(&*begin, nbUnits);
+        begin += nbUnits * unitSamples;
+    }
+
+    std::copy(begin, end, m_blockSamples.begin());
+    m_blockCount = end - begin;
+}
+
+void FileRecord::writeUnits(const Sample *samples, int nbUnits)
+{
+    unsigned int nbBytes = nbUnits * RecordFormat::getUnitBytes(m_recordFormat, SDR_RX_SAMP_SZ);
+
+    if (m_packBuffer.size() < nbBytes) {
+        m_packBuffer.resize(nbBytes);
+    }
+
+    RecordFormat::pack(m_recordFormat, m_packBuffer.data(), samples, nbUnits);
+    m_stream->write(m_packBuffer.data(), nbBytes);
+}
+
+void FileRecord::writeSigMF()
+{
+    // The recording is a SigMF non conforming dataset: samples follow the recording header
+    // and the packed formats need the sdrangel extension to be unpacked. The channel frequency is informative.
+    QFileInfo fileInfo(m_fileName);
+    QString metaFileName = fileInfo.path() + "/" + fileInfo.completeBaseName() + ".sigmf-meta";
+    bool extension = (m_recordFormat == RecordFormat::FormatPacked12) || (m_recordFormat == RecordFormat::FormatBlockScaled8);
+
+    QJsonObject global;
+    global.insert("core:datatype", RecordFormat::getSigMFDatatype(m_recordFormat, m_recordHeader.sampleSize));
+    global.insert("core:sample_rate", (double) m_recordHeader.sampleRate);
+    global.insert("core:version", "1.0.0");
+    global.insert("core:recorder", "SDRangel");
+    global.insert("core:dataset", fileInfo.fileName());
+
+    if (extension || m_channelRecord)
+    {
+        QJsonObject sdrangelExtension;
+        sdrangelExtension.insert("name", "sdrangel");
+        sdrangelExtension.insert("version", "1.0.0");
+        sdrangelExtension.insert("optional", !extension);
+        global.insert("core:extensions", QJsonArray() << sdrangelExtension);
+    }
+
+    if (extension)
+    {
+        global.insert("sdrangel:format", RecordFormat::getName(m_recordFormat));
+        global.insert("sdrangel:sample_size", (int) m_recordHeader.sampleSize);
+
+        if (m_recordFormat == RecordFormat::FormatBlockScaled8)
+        {
+            global.insert("sdrangel:block_samples", RecordFormat::m_block8Samples);
+            global.insert("sdrangel:block_header_bytes", RecordFormat::m_block8HeaderBytes);
+        }
+    }
+
+    QJsonObject capture;
+    capture.insert("core:sample_start", 0);
+    capture.insert("core:frequency", (double) m_recordHeader.centerFrequency);
+    capture.insert("core:datetime", QDateTime::fromMSecsSinceEpoch(m_recordHeader.startTimeStamp * 1000).toUTC().toString(Qt::ISODate));
+    capture.insert("core:header_bytes", (int) sizeof(Header));
+
+    if (m_channelRecord) { // center of the channel within the recorded band
+        capture.insert("sdrangel:channel_frequency", (double) m_channelFrequency);
+    }
+
+    QJsonObject meta;
+    meta.insert("global", global);
+    meta.insert("captures", QJsonArray() << capture);
+    meta.insert("annotations", QJsonArray());
+
+    QFile metaFile(metaFileName);
+
+    if (metaFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        metaFile.write(QJsonDocument(meta).toJson());
+    } else {
+        qWarning("FileRecord::writeSigMF: cannot write %s", qPrintable(metaFileName));
+    }
 }
 
 bool FileRecord::readHeader(std::ifstream& sampleFile, Header& header)
@@ -24,6 +24,10 @@
 #include <fstream>
 
 #include <ctime>
+#include <QMutex>
+
+#include "dsp/asyncfilewriter.h"
+#include "dsp/recordformat.h"
 #include "export.h"
 
 class Message;
@@ -38,7 +42,7 @@ public:
         quint64 centerFrequency;
         quint64 startTimeStamp;
         quint32 sampleSize;
-        quint32 filler;
+        quint32 format;          //!< RecordFormat::Format. Native (0) in older recordings
         quint32 crc32;
     };
 #pragma pack(pop)
@@ -48,6 +52,16 @@ public:
 	virtual ~FileRecord();
 
     quint64 getByteCount() const { return m_byteCount; }
+    quint64 getDroppedBlocks() const; //!< Blocks lost in the current or last recording because the disk was too slow
+
+    void setDirectIO(bool directIO) { m_directIO = directIO; } //!< Bypass the page cache (Linux O_DIRECT) from the next recording
+    void setWriter(AsyncFileWriter *writer) { m_sharedWriter = writer; } //!< Shared writer thread from the next recording. nullptr for the dedicated one
+    void setStreamBlocks(std::size_t blockSize, unsigned int nbBlocks) { m_blockSize = blockSize; m_nbBlocks = nbBlocks; } //!< Write blocks from the next recording. 0 size for the writer default
+    void setFormat(RecordFormat::Format format) { m_format = format; } //!< On-disk format from the next recording
+    void setChannelFrequency(qint64 frequency) { m_channelFrequency = frequency; m_channelRecord = true; } //!< Channel recordings: frequency of the channel in the recorded band for the SigMF metadata
+    RecordFormat::Format getFormat() const { return m_format; }
+    static void setDefaultFormat(RecordFormat::Format format) { m_defaultFormat = format; } //!< Format of new file records. To be called at startup
+    static RecordFormat::Format getDefaultFormat() { return m_defaultFormat; }
 
     void setFileName(const QString& filename);
     void genUniqueFileName(uint deviceUID, int istream = -1);
@@ -68,11 +82,32 @@ private:
 	quint64 m_centerFrequency;
 	bool m_recordOn;
     bool m_recordStart;
-    std::ofstream m_sampleFile;
+    bool m_directIO;
+    bool m_channelRecord;                //!< SigMF metadata with the channel frequency whatever the format
+    qint64 m_channelFrequency;
+    RecordFormat::Format m_format;       //!< Of the next recording
+    RecordFormat::Format m_recordFormat; //!< Of the current recording
+    Header m_recordHeader;               //!< Of the current recording. Zero time stamp until written
+    std::vector<char> m_packBuffer;
+    SampleVector m_blockSamples;         //!< Samples of the incomplete block of the block scaled format
+    int m_blockCount;
+    AsyncFileWriter m_writer;            //!< Dedicated writer thread
+    AsyncFileWriter *m_sharedWriter;     //!< Used in place of the dedicated writer if set
+    AsyncFileWriter *m_streamWriter;     //!< Of the current recording
+    AsyncFileWriter::Stream *m_stream;
+    std::size_t m_blockSize;             //!< Of the write blocks of the next recording. 0 for the writer default
+    unsigned int m_nbBlocks;
     quint64 m_byteCount;
+    quint64 m_droppedBlocks;             //!< Of the last recording
+    mutable QMutex m_mutex;              //!< Start and stop of recording against feed
+
+    static RecordFormat::Format m_defaultFormat;
 
 	void handleConfigure(const QString& fileName);
     void writeHeader();
+    void writePacked(SampleVector::const_iterator begin, const SampleVector::const_iterator& end);
+    void writeUnits(const Sample *samples, int nbUnits);
+    void writeSigMF(); //!< SigMF metadata file alongside the recording
 };
 
 #endif // INCLUDE_FILERECORD_H
@@ -0,0 +1,47 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_GLSPECTRUMINTERFACE_H_
+#define SDRBASE_DSP_GLSPECTRUMINTERFACE_H_
+
+#include <vector>
+
+#include <QAtomicInt>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+/**
+ * What the spectrum engine (SpectrumVis) needs from a spectrum display so that the engine
+ * does not depend on the GUI. Implemented by GLSpectrum.
+ */
+class SDRBASE_API GLSpectrumInterface
+{
+public:
+    GLSpectrumInterface() : m_displayed(1) {}
+    virtual ~GLSpectrumInterface() {}
+    virtual void newSpectrum(const std::vector<Real>& spectrum, int fftSize) = 0; //!< Called from the DSP thread
+    bool isDisplayed() const { return m_displayed.load() != 0; } //!< From the DSP thread. No spectrum is computed for a hidden display
+
+protected:
+    void setDisplayed(bool displayed) { m_displayed.store(displayed ? 1 : 0); }
+
+private:
+    QAtomicInt m_displayed;
+};
+
+#endif // SDRBASE_DSP_GLSPECTRUMINTERFACE_H_
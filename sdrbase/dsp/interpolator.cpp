@@ -1,6 +1,7 @@
 #define _USE_MATH_DEFINES
 #include <math.h>
 #include <vector>
+#include <algorithm>
 #include "dsp/interpolator.h"
 
 
@@ -74,7 +75,9 @@ Interpolator::Interpolator() :
 	m_alignedTaps2(0),
     m_ptr(0),
 	m_phaseSteps(1),
-    m_nTaps(1)
+    m_nTaps(1),
+    m_kernels(&SIMDKernels::instance()),
+    m_nBlockTaps(0)
 {
 }
 
@@ -159,6 +162,26 @@ void Interpolator::create(int phaseSteps, double sampleRate, double cutoff, doub
 		m_alignedTaps2[2 * (i - 1) + 0] = polyphase[i];
 		m_alignedTaps2[2 * (i - 1) + 1] = polyphase[i];
 	}
+
+	// block taps: phase filters reversed so that the dot product runs forward over samples in time order
+	m_nBlockTaps = (m_nTaps + 7) & ~7;
+	int pad = m_nBlockTaps - m_nTaps;
+	m_blockTaps.assign(2 * m_nBlockTaps * phaseSteps, 0.0f);
+
+	for (int phase = 0; phase < phaseSteps; phase++)
+	{
+		float *blockTaps = &m_blockTaps[2 * m_nBlockTaps * phase];
+
+		for (int i = 0; i < m_nTaps; i++)
+		{
+			blockTaps[2 * (pad + i) + 0] = polyphase[phase * m_nTaps + m_nTaps - 1 - i];
+			blockTaps[2 * (pad + i) + 1] = polyphase[phase * m_nTaps + m_nTaps - 1 - i];
+		}
+	}
+
+	m_blockSamples.resize(m_nBlockTaps + BlockSize);
+	m_blockOffsets.resize(BlockSize + 1);
+	m_blockPhases.resize(BlockSize + 1);
 }
 
 void Interpolator::free()
@@ -171,5 +194,119 @@ void Interpolator::free()
 		delete[] m_taps2;
 		m_taps2 = NULL;
 		m_alignedTaps2 = NULL;
+		m_blockTaps.clear();
+		m_blockSamples.clear();
+		m_nBlockTaps = 0;
+	}
+}
+
+int Interpolator::decimate(Real *distance, Real step, const Complex *in, int nbIn, Complex *out, int nbOutMax, int& nbConsumed)
+{
+	return resampleBlock(false, distance, step, in, nbIn, out, nbOutMax, nbConsumed);
+}
+
+int Interpolator::interpolate(Real *distance, Real step, const Complex *in, int nbIn, Complex *out, int nbOutMax, int& nbConsumed)
+{
+	return resampleBlock(true, distance, step, in, nbIn, out, nbOutMax, nbConsumed);
+}
+
+// The ring buffer m_samples of the per sample methods stays the reference state so that both APIs can be mixed.
+// The block methods copy it in time order in front of the input in m_blockSamples and write it back when done.
+
+void Interpolator::loadBlockHistory()
+{
+	for (int i = 0; i < m_nBlockTaps; i++)
+	{
+		int age = m_nBlockTaps - 1 - i;
+		m_blockSamples[i] = age < m_nTaps ? m_samples[(m_ptr + age) % m_nTaps] : Complex{0.0f, 0.0f};
+	}
+}
+
+void Interpolator::storeBlockHistory()
+{
+	const Complex *newest = &m_blockSamples[m_nBlockTaps - 1];
+	m_ptr = 0;
+
+	for (int age = 0; age < m_nTaps; age++) {
+		m_samples[age] = newest[-age];
+	}
+}
+
+int Interpolator::resampleBlock(bool interpolation, Real *distance, Real step, const Complex *in, int nbIn, Complex *out, int nbOutMax, int& nbConsumed)
+{
+	int nbOut = 0;
+	nbConsumed = 0;
+
+	if (m_nBlockTaps == 0) {
+		return 0;
+	}
+
+	loadBlockHistory();
+	Real d = *distance;
+	bool full = false;
+
+	while (!full && (nbConsumed < nbIn))
+	{
+		int nbChunk = std::min(nbIn - nbConsumed, (int) BlockSize);
+		std::copy(in + nbConsumed, in + nbConsumed + nbChunk, m_blockSamples.begin() + m_nBlockTaps);
+		int nbChunkOutMax = std::min(nbOutMax - nbOut, (int) BlockSize);
+		int nbChunkOut = 0;
+		int i = 0;
+
+		// phase schedule: the window of the output taken after the input sample of index i in
+		// the chunk is consumed starts at i + 1 (decimation) and before it is consumed at i (interpolation)
+		if (interpolation)
+		{
+			for (; i < nbChunk; i++)
+			{
+				while ((d < 1.0f) && (nbChunkOut < nbChunkOutMax))
+				{
+					m_blockOffsets[nbChunkOut] = i;
+					m_blockPhases[nbChunkOut] = phaseIndex(d);
+					nbChunkOut++;
+					d += step;
+				}
+
+				if (d < 1.0f) {
+					break;
+				}
+
+				d -= 1.0f;
+			}
+		}
+		else
+		{
+			for (; (i < nbChunk) && (nbChunkOut < nbChunkOutMax); i++)
+			{
+				d -= 1.0f;
+
+				if (d < 1.0f)
+				{
+					m_blockOffsets[nbChunkOut] = i + 1;
+					m_blockPhases[nbChunkOut] = phaseIndex(d);
+					nbChunkOut++;
+					d += step;
+				}
+			}
+		}
+
+		m_kernels->polyphaseIQ((float*) &out[nbOut], (const float*) m_blockSamples.data(), m_blockOffsets.data(),
+			m_blockPhases.data(), nbChunkOut, m_blockTaps.data(), m_nBlockTaps);
+		nbOut += nbChunkOut;
+		nbConsumed += i;
+		full = nbOut == nbOutMax;
+
+		// slide the history to the front for the next chunk or storeBlockHistory()
+		if (i != 0) {
+			std::copy(m_blockSamples.begin() + i, m_blockSamples.begin() + i + m_nBlockTaps, m_blockSamples.begin());
+		}
 	}
+
+	*distance = d;
+
+	if (nbConsumed != 0) {
+		storeBlockHistory();
+	}
+
+	return nbOut;
 }
@@ -22,11 +22,14 @@
 #include <emmintrin.h>
 #endif
 #include "dsp/dsptypes.h"
+#include "dsp/simdkernels.h"
 #include "export.h"
 #include <stdio.h>
 
 class SDRBASE_API Interpolator {
 public:
+	enum { BlockSize = 256 }; //!< maximum number of input samples processed in one pass by the block methods
+
 	Interpolator();
 	~Interpolator();
 
@@ -89,6 +92,21 @@ public:
 		return true;
 	}
 
+	/**
+	 * Block version of decimate(). Runs the per sample sequence over the input span with distance
+	 * incremented by step after each output sample. Stops when the input is exhausted or when
+	 * nbOutMax samples have been produced.
+	 * @return number of samples written to out. nbConsumed is set to the number of input samples used.
+	 */
+	int decimate(Real *distance, Real step, const Complex *in, int nbIn, Complex *out, int nbOutMax, int& nbConsumed);
+
+	/**
+	 * Block version of interpolate(). Produces output samples while distance is below 1 before
+	 * consuming each input sample the same way as the per sample loop of the channel sinks.
+	 * @return number of samples written to out. nbConsumed is set to the number of input samples used.
+	 */
+	int interpolate(Real *distance, Real step, const Complex *in, int nbIn, Complex *out, int nbOutMax, int& nbConsumed);
+
 private:
 	float* m_taps;
 	float* m_alignedTaps;
@@ -98,6 +116,13 @@ private:
 	int m_ptr;
 	int m_phaseSteps;
 	int m_nTaps;
+	// block processing
+	const SIMDKernels *m_kernels;
+	int m_nBlockTaps;                   //!< m_nTaps rounded up to a multiple of 8
+	std::vector<float> m_blockTaps;     //!< per phase taps in sample order zero padded on the oldest side with I/Q duplicates
+	std::vector<Complex> m_blockSamples; //!< linear history of m_nBlockTaps samples followed by the input block
+	std::vector<int32_t> m_blockOffsets; //!< phase schedule: first sample of each output in m_blockSamples
+	std::vector<int32_t> m_blockPhases;  //!< phase schedule: phase of each output
 
 	static void createPolyphaseLowPass(
 	    std::vector<Real>& taps,
@@ -117,6 +142,15 @@ private:
         double nbTapsPerPhase);
 
 	void createTaps(int nTaps, double sampleRate, double cutoff, std::vector<Real>* taps);
+	int resampleBlock(bool interpolation, Real *distance, Real step, const Complex *in, int nbIn, Complex *out, int nbOutMax, int& nbConsumed);
+	void loadBlockHistory();
+	void storeBlockHistory();
+
+	int phaseIndex(Real distance) const
+	{
+		int phase = (int) floor(distance * (Real) m_phaseSteps);
+		return phase < 0 ? 0 : phase < m_phaseSteps ? phase : m_phaseSteps - 1;
+	}
 
 	void advanceFilter(const Complex& next)
 	{
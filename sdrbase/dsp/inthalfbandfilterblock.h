@@ -0,0 +1,404 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Integer half-band FIR based decimator and interpolator working on blocks of   //
+// samples. Same filter and same results as IntHalfbandFilterEO decimators and   //
+// IntHalfbandFilterEO1 interpolators but samples are stored in planar buffers   //
+// so that the FIR loop runs over consecutive outputs and can be vectorized      //
+// by the compiler. The FIR core runs through the kernels selected at runtime    //
+// for the SIMD capabilities of the CPU (see SIMDKernels)                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_INTHALFBANDFILTERBLOCK_H_
+#define SDRBASE_DSP_INTHALFBANDFILTERBLOCK_H_
+
+#include <stdint.h>
+#include <algorithm>
+
+#include "dsp/dsptypes.h"
+#include "dsp/hbfiltertraits.h"
+#include "dsp/simdkernels.h"
+
+template<typename EOStorageType, typename AccuType, uint32_t HBFilterOrder>
+class IntHalfbandFilterBlock {
+public:
+    IntHalfbandFilterBlock() :
+        m_kernels(&SIMDKernels::instance())
+    {
+        std::fill(m_evenI, m_evenI + m_history + m_chunkSize + 1, 0);
+        std::fill(m_evenQ, m_evenQ + m_history + m_chunkSize + 1, 0);
+        std::fill(m_oddI, m_oddI + m_history + m_chunkSize, 0);
+        std::fill(m_oddQ, m_oddQ + m_history + m_chunkSize, 0);
+        m_evenCount = m_history;
+        m_oddCount = m_history;
+        m_phase = 0;
+        m_pendingI = 0;
+        m_pendingQ = 0;
+    }
+
+    /**
+     * Decimate nbIn samples from in by 2 and write the result to out. Return the number of output samples.
+     * Input samples are always read before an output is written at the same or a lower index
+     * so out may be the same buffer as in (in place decimation).
+     * halfInput: divide input by 2 to avoid saturation on 16 bit samples
+     */
+    int workDecimateCenter(const Sample *in, int nbIn, Sample *out, bool halfInput)
+    {
+        return workDecimate<ModeCenter>(in, nbIn, out, halfInput);
+    }
+
+    int workDecimateLowerHalf(const Sample *in, int nbIn, Sample *out, bool halfInput)
+    {
+        return workDecimate<ModeLowerHalf>(in, nbIn, out, halfInput);
+    }
+
+    int workDecimateUpperHalf(const Sample *in, int nbIn, Sample *out, bool halfInput)
+    {
+        return workDecimate<ModeUpperHalf>(in, nbIn, out, halfInput);
+    }
+
+    /** Number of input samples consumed by the next interpolation of nbOut samples */
+    int getNbInterpolationInputs(int nbOut) const
+    {
+        return (nbOut + (m_phase & 1)) / 2;
+    }
+
+    /**
+     * Interpolate by 2 and write nbOut samples to out consuming getNbInterpolationInputs(nbOut) samples from in.
+     * in and out must not overlap.
+     */
+    void workInterpolateCenter(const Sample *in, int nbOut, Sample *out)
+    {
+        workInterpolate<ModeCenter>(in, nbOut, out);
+    }
+
+    void workInterpolateLowerHalf(const Sample *in, int nbOut, Sample *out)
+    {
+        workInterpolate<ModeLowerHalf>(in, nbOut, out);
+    }
+
+    void workInterpolateUpperHalf(const Sample *in, int nbOut, Sample *out)
+    {
+        workInterpolate<ModeUpperHalf>(in, nbOut, out);
+    }
+
+private:
+    enum Mode {
+        ModeCenter,
+        ModeLowerHalf,
+        ModeUpperHalf
+    };
+
+    static const int m_order = HBFIRFilterTraits<HBFilterOrder>::hbOrder;
+    static const int m_history = HBFIRFilterTraits<HBFilterOrder>::hbOrder/2; //!< past samples kept in each plane
+    static const int m_chunkSize = 256; //!< number of outputs computed in one FIR pass
+
+    // Sample at time 2k goes to the even plane and sample at time 2k+1 to the odd plane at the same index k.
+    // The symmetric taps only apply to odd samples and the center tap to an even one.
+    EOStorageType m_evenI[m_history + m_chunkSize + 1];
+    EOStorageType m_evenQ[m_history + m_chunkSize + 1];
+    EOStorageType m_oddI[m_history + m_chunkSize];
+    EOStorageType m_oddQ[m_history + m_chunkSize];
+    AccuType m_accI[m_chunkSize];
+    AccuType m_accQ[m_chunkSize];
+    int m_evenCount;
+    int m_oddCount;
+    int m_phase; //!< input sample time modulo 4 (output sample time for the interpolator)
+    EOStorageType m_pendingI; //!< interpolator input received but not yet in the FIR history
+    EOStorageType m_pendingQ;
+    const SIMDKernels *m_kernels;
+
+    template<Mode mode>
+    int workDecimate(const Sample *in, int nbIn, Sample *out, bool halfInput)
+    {
+        int nbOut = 0;
+        int i = 0;
+
+        while (i < nbIn)
+        {
+            int nbGroups = (m_phase == 0) ? std::min((nbIn - i) / 4, (m_history + m_chunkSize - m_oddCount) / 2) : 0;
+
+            if (nbGroups == 0) // one sample at a time until aligned on a group of 4
+            {
+                storeSample<mode>(in[i], halfInput);
+                i++;
+            }
+            else
+            {
+                if (halfInput) {
+                    storeGroups<mode, true>(&in[i], nbGroups);
+                } else {
+                    storeGroups<mode, false>(&in[i], nbGroups);
+                }
+
+                i += 4*nbGroups;
+            }
+
+            if (m_oddCount == m_history + m_chunkSize) {
+                nbOut += doFIR(&out[nbOut]);
+            }
+        }
+
+        if (m_oddCount > m_history) {
+            nbOut += doFIR(&out[nbOut]);
+        }
+
+        return nbOut;
+    }
+
+    /** Store one sample with frequency shift by +/- fs/4 for the lower and upper half */
+    template<Mode mode>
+    void storeSample(const Sample& sample, bool halfInput)
+    {
+        EOStorageType re = halfInput ? sample.m_real / 2 : sample.m_real;
+        EOStorageType im = halfInput ? sample.m_imag / 2 : sample.m_imag;
+
+        switch (m_phase)
+        {
+        case 0:
+            if (mode == ModeLowerHalf) {
+                storeEven(-im, re);
+            } else if (mode == ModeUpperHalf) {
+                storeEven(im, -re);
+            } else {
+                storeEven(re, im);
+            }
+            break;
+        case 1:
+            if (mode == ModeCenter) {
+                storeOdd(re, im);
+            } else {
+                storeOdd(-re, -im);
+            }
+            break;
+        case 2:
+            if (mode == ModeLowerHalf) {
+                storeEven(im, -re);
+            } else if (mode == ModeUpperHalf) {
+                storeEven(-im, re);
+            } else {
+                storeEven(re, im);
+            }
+            break;
+        default:
+            storeOdd(re, im);
+            break;
+        }
+
+        m_phase = (m_phase + 1) & 3;
+    }
+
+    /**
+     * Store groups of 4 samples starting at phase 0. Same as storeSample but with the phase and the
+     * frequency shift resolved at compile time and local pointers so that the planes are written
+     * without reloading the counters after each store.
+     */
+    template<Mode mode, bool halfInput>
+    void storeGroups(const Sample *in, int nbGroups)
+    {
+        EOStorageType *evenI = &m_evenI[m_evenCount];
+        EOStorageType *evenQ = &m_evenQ[m_evenCount];
+        EOStorageType *oddI = &m_oddI[m_oddCount];
+        EOStorageType *oddQ = &m_oddQ[m_oddCount];
+        for (int g = 0; g < nbGroups; g++, in += 4)
+        {
+            EOStorageType re0 = halve<halfInput>(in[0].m_real), im0 = halve<halfInput>(in[0].m_imag);
+            EOStorageType re1 = halve<halfInput>(in[1].m_real), im1 = halve<halfInput>(in[1].m_imag);
+            EOStorageType re2 = halve<halfInput>(in[2].m_real), im2 = halve<halfInput>(in[2].m_imag);
+            EOStorageType re3 = halve<halfInput>(in[3].m_real), im3 = halve<halfInput>(in[3].m_imag);
+
+            if (mode == ModeLowerHalf)
+            {
+                evenI[2*g] = -im0;  evenQ[2*g] = re0;
+                oddI[2*g] = -re1;   oddQ[2*g] = -im1;
+                evenI[2*g+1] = im2; evenQ[2*g+1] = -re2;
+            }
+            else if (mode == ModeUpperHalf)
+            {
+                evenI[2*g] = im0;    evenQ[2*g] = -re0;
+                oddI[2*g] = -re1;    oddQ[2*g] = -im1;
+                evenI[2*g+1] = -im2; evenQ[2*g+1] = re2;
+            }
+            else
+            {
+                evenI[2*g] = re0;   evenQ[2*g] = im0;
+                oddI[2*g] = re1;    oddQ[2*g] = im1;
+                evenI[2*g+1] = re2; evenQ[2*g+1] = im2;
+            }
+
+            oddI[2*g+1] = re3;
+            oddQ[2*g+1] = im3;
+        }
+
+        m_evenCount += 2*nbGroups;
+        m_oddCount += 2*nbGroups;
+    }
+
+    template<bool halfInput>
+    static EOStorageType halve(FixReal x)
+    {
+        return halfInput ? x / 2 : x;
+    }
+
+    void storeEven(EOStorageType re, EOStorageType im)
+    {
+        m_evenI[m_evenCount] = re;
+        m_evenQ[m_evenCount] = im;
+        m_evenCount++;
+    }
+
+    void storeOdd(EOStorageType re, EOStorageType im)
+    {
+        m_oddI[m_oddCount] = re;
+        m_oddQ[m_oddCount] = im;
+        m_oddCount++;
+    }
+
+    /** Compute one output per new odd sample then keep the last samples as history for the next pass */
+    int doFIR(Sample *out)
+    {
+        const int nbOut = m_oddCount - m_history;
+        const int center = m_history + 1 - m_order/4;
+
+        for (int k = 0; k < nbOut; k++)
+        {
+            m_accI[k] = ((AccuType) m_evenI[center + k]) << (HBFIRFilterTraits<HBFilterOrder>::hbShift - 1);
+            m_accQ[k] = ((AccuType) m_evenQ[center + k]) << (HBFIRFilterTraits<HBFilterOrder>::hbShift - 1);
+        }
+
+        symmetricFIR(m_accI, &m_oddI[m_history], &m_oddI[m_history - m_order/2 + 1], nbOut);
+        symmetricFIR(m_accQ, &m_oddQ[m_history], &m_oddQ[m_history - m_order/2 + 1], nbOut);
+
+        for (int k = 0; k < nbOut; k++)
+        {
+            out[k].setReal(m_accI[k] >> (HBFIRFilterTraits<HBFilterOrder>::hbShift - 1));
+            out[k].setImag(m_accQ[k] >> (HBFIRFilterTraits<HBFilterOrder>::hbShift - 1));
+        }
+
+        // even plane has the same or one more sample than the odd plane and is shifted by the same amount
+        std::copy(m_oddI + nbOut, m_oddI + m_oddCount, m_oddI);
+        std::copy(m_oddQ + nbOut, m_oddQ + m_oddCount, m_oddQ);
+        std::copy(m_evenI + nbOut, m_evenI + m_evenCount, m_evenI);
+        std::copy(m_evenQ + nbOut, m_evenQ + m_evenCount, m_evenQ);
+        m_oddCount -= nbOut;
+        m_evenCount -= nbOut;
+
+        return nbOut;
+    }
+
+    // The interpolator uses the odd plane as its history of input samples. Odd outputs are computed
+    // by the FIR over the last samples of the history after which the pending input enters the history.
+    // Even outputs are the center tap sample (the other taps apply to the null stuffed samples).
+
+    template<Mode mode>
+    void workInterpolate(const Sample *in, int nbOut, Sample *out)
+    {
+        while (nbOut > 0)
+        {
+            int nbOutChunk = std::min(nbOut, 2*m_chunkSize - (m_phase & 1));
+            int nbIn = getNbInterpolationInputs(nbOutChunk);
+            const int base = m_oddCount;
+
+            for (int k = 0; k < nbIn; k++)
+            {
+                storeOdd(m_pendingI, m_pendingQ);
+                m_pendingI = in[k].m_real;
+                m_pendingQ = in[k].m_imag;
+            }
+
+            doInterpolateFIR(base, nbIn);
+            int r = 0; // FIR outputs used so far
+
+            for (int k = 0; k < nbOutChunk; k++)
+            {
+                if (m_phase & 1)
+                {
+                    if (m_phase == 1 && mode != ModeCenter) {
+                        out[k].setReal(-m_accI[r]);
+                        out[k].setImag(-m_accQ[r]);
+                    } else {
+                        out[k].setReal(m_accI[r]);
+                        out[k].setImag(m_accQ[r]);
+                    }
+
+                    r++;
+                }
+                else
+                {
+                    const int center = base + r - m_order/4 - 1;
+                    EOStorageType re = m_oddI[center];
+                    EOStorageType im = m_oddQ[center];
+
+                    if ((mode == ModeLowerHalf && m_phase == 0) || (mode == ModeUpperHalf && m_phase == 2)) {
+                        out[k].setReal(im);
+                        out[k].setImag(-re);
+                    } else if ((mode == ModeLowerHalf && m_phase == 2) || (mode == ModeUpperHalf && m_phase == 0)) {
+                        out[k].setReal(-im);
+                        out[k].setImag(re);
+                    } else {
+                        out[k].setReal(re);
+                        out[k].setImag(im);
+                    }
+                }
+
+                m_phase = (m_phase + 1) & 3;
+            }
+
+            // keep the last samples as history for the next pass
+            const int shift = m_oddCount - m_history;
+            std::copy(m_oddI + shift, m_oddI + m_oddCount, m_oddI);
+            std::copy(m_oddQ + shift, m_oddQ + m_oddCount, m_oddQ);
+            m_oddCount = m_history;
+
+            in += nbIn;
+            out += nbOutChunk;
+            nbOut -= nbOutChunk;
+        }
+    }
+
+    /** FIR for the nbIn history windows ending just before base, base + 1, ... base + nbIn - 1 */
+    void doInterpolateFIR(int base, int nbIn)
+    {
+        for (int k = 0; k < nbIn; k++)
+        {
+            m_accI[k] = 0;
+            m_accQ[k] = 0;
+        }
+
+        symmetricFIR(m_accI, &m_oddI[base - 1], &m_oddI[base - m_order/2], nbIn);
+        symmetricFIR(m_accQ, &m_oddQ[base - 1], &m_oddQ[base - m_order/2], nbIn);
+
+        for (int k = 0; k < nbIn; k++)
+        {
+            m_accI[k] >>= (HBFIRFilterTraits<HBFilterOrder>::hbShift - 1);
+            m_accQ[k] >>= (HBFIRFilterTraits<HBFilterOrder>::hbShift - 1);
+        }
+    }
+
+    /** acc[k] += sum of coeff[i] * (newest[k - i] + oldest[k + i]) over the symmetric taps */
+    void symmetricFIR(int32_t *acc, const int32_t *newest, const int32_t *oldest, int nbOut) const
+    {
+        m_kernels->symmetricFIR32(acc, newest, oldest, HBFIRFilterTraits<HBFilterOrder>::hbCoeffs, m_order/4, nbOut);
+    }
+
+    void symmetricFIR(int64_t *acc, const int32_t *newest, const int32_t *oldest, int nbOut) const
+    {
+        m_kernels->symmetricFIR64(acc, newest, oldest, HBFIRFilterTraits<HBFilterOrder>::hbCoeffs, m_order/4, nbOut);
+    }
+};
+
+#endif /* SDRBASE_DSP_INTHALFBANDFILTERBLOCK_H_ */
@@ -1,17 +1,27 @@
 #include "dsp/kissengine.h"
 
-void KissEngine::configure(int n, bool inverse)
+KissEngine::KissEngine() :
+	m_n(0),
+	m_batch(1)
+{
+}
+
+void KissEngine::configure(int n, bool inverse, int batch)
 {
 	m_fft.configure(n, inverse);
-	if(n > m_in.size())
-		m_in.resize(n);
-	if(n > m_out.size())
-		m_out.resize(n);
+	m_n = n;
+	m_batch = batch;
+	if(n * batch > m_in.size())
+		m_in.resize(n * batch);
+	if(n * batch > m_out.size())
+		m_out.resize(n * batch);
 }
 
 void KissEngine::transform()
 {
-	m_fft.transform(&m_in[0], &m_out[0]);
+	for (int i = 0; i < m_batch; i++) {
+		m_fft.transform(&m_in[i * m_n], &m_out[i * m_n]);
+	}
 }
 
 Complex* KissEngine::in()
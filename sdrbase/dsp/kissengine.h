@@ -7,7 +7,9 @@
 
 class SDRBASE_API KissEngine : public FFTEngine {
 public:
-	virtual void configure(int n, bool inverse);
+	KissEngine();
+
+	virtual void configure(int n, bool inverse, int batch = 1);
 	virtual void transform();
 
 	virtual Complex* in();
@@ -21,6 +23,8 @@ protected:
 
 	std::vector<Complex> m_in;
 	std::vector<Complex> m_out;
+	int m_n;
+	int m_batch;
 };
 
 #endif // INCLUDE_KISSENGINE_H
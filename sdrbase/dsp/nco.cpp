@@ -18,9 +18,11 @@
 
 #include <QtGlobal>
 #include <stdio.h>
+#include <algorithm>
 #define _USE_MATH_DEFINES
 #include <math.h>
 #include "dsp/nco.h"
+#include "dsp/simdkernels.h"
 
 #undef M_PI
 #define M_PI		3.14159265358979323846
@@ -107,3 +109,57 @@ void NCO::getQI(Complex& c)
 	c.imag(m_table[m_phase]);
 	c.real(-m_table[(m_phase + TableSize / 4) % TableSize]);
 }
+
+void NCO::nextPhases(int32_t *phases, unsigned int nbPhases)
+{
+	// the phase after k increments is known in closed form: this loop is vectorized
+	for (unsigned int k = 0; k < nbPhases; k++) {
+		phases[k] = (m_phase + (int) (k + 1) * m_phaseIncrement) & (TableSize - 1);
+	}
+
+	m_phase = phases[nbPhases - 1];
+}
+
+void NCO::nextIQ(Complex *iq, unsigned int nbSamples)
+{
+	const SIMDKernels& kernels = SIMDKernels::instance();
+	int32_t phases[BlockSize];
+
+	while (nbSamples > 0)
+	{
+		unsigned int n = std::min(nbSamples, (unsigned int) BlockSize);
+		nextPhases(phases, n);
+		kernels.tableIQ(reinterpret_cast<float*>(iq), phases, n, m_table, TableSize - 1);
+		iq += n;
+		nbSamples -= n;
+	}
+}
+
+void NCO::nextIQMul(Complex *iq, unsigned int nbSamples)
+{
+	const SIMDKernels& kernels = SIMDKernels::instance();
+	int32_t phases[BlockSize];
+
+	while (nbSamples > 0)
+	{
+		unsigned int n = std::min(nbSamples, (unsigned int) BlockSize);
+		nextPhases(phases, n);
+		kernels.tableMulIQ(reinterpret_cast<float*>(iq), phases, n, m_table, TableSize - 1);
+		iq += n;
+		nbSamples -= n;
+	}
+}
+
+void NCO::nextIQMul(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, ComplexVector& iq, Real scale)
+{
+	unsigned int nbSamples = end - begin;
+	iq.resize(nbSamples);
+
+	for (unsigned int k = 0; k < nbSamples; k++) {
+		iq[k] = Complex(begin[k].real() * scale, begin[k].imag() * scale);
+	}
+
+	if (nbSamples > 0) {
+		nextIQMul(iq.data(), nbSamples);
+	}
+}
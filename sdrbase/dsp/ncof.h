@@ -25,6 +25,7 @@ class SDRBASE_API NCOF {
 private:
 	enum {
 		TableSize = (1 << 12),
+		BlockSize = 256 //!< phases computed at once by the block methods
 	};
 	static Real m_table[TableSize+1];
 	static bool m_tableInitialized;
@@ -35,6 +36,8 @@ private:
 	Real m_phaseIncrement;
 	Real m_phase;
 
+	void nextPhases(int32_t *phases, unsigned int nbPhases); //!< Increment phase nbPhases times and store the successive integer phases
+
 public:
 	NCOF();
 
@@ -62,6 +65,11 @@ public:
 	void getIQ(Complex& c);             //!< Sets to the current complex sample (no phase increment)
 	Complex getQI();                    //!< Return current complex sample (no phase increment, reversed)
 	void getQI(Complex& c);             //!< Sets to the current complex sample (no phase increment, reversed)
+
+	// Block methods: same values as the same number of nextIQ calls
+	void nextIQ(Complex *iq, unsigned int nbSamples);    //!< Write the next nbSamples complex samples to iq
+	void nextIQMul(Complex *iq, unsigned int nbSamples); //!< Multiply iq by the next nbSamples complex samples
+	void nextIQMul(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, ComplexVector& iq, Real scale = 1.0f); //!< Convert samples to complex times scale into iq and multiply by the next complex samples
 };
 
 #endif // INCLUDE_NCO_H
@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include "dsp/simdkernels.h"
+#include "recordformat.h"
+
+QString RecordFormat::getName(Format format)
+{
+    switch (format)
+    {
+    case FormatPacked12:
+        return "packed12";
+    case FormatBlockScaled8:
+        return "block8";
+    case FormatFloat32:
+        return "cf32";
+    default:
+        return "native";
+    }
+}
+
+bool RecordFormat::getFormat(const QString& name, Format& format)
+{
+    for (int i = 0; i < (int) FormatEnd; i++)
+    {
+        if (name == getName((Format) i))
+        {
+            format = (Format) i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int RecordFormat::getUnitSamples(Format format)
+{
+    return format == FormatBlockScaled8 ? m_block8Samples : 1;
+}
+
+int RecordFormat::getUnitBytes(Format format, int sampleSize)
+{
+    switch (format)
+    {
+    case FormatPacked12:
+        return 3;
+    case FormatBlockScaled8:
+        return m_block8HeaderBytes + 2*m_block8Samples;
+    case FormatFloat32:
+        return 2*sizeof(float);
+    default:
+        return sampleSize > 16 ? 2*sizeof(int32_t) : 2*sizeof(int16_t);
+    }
+}
+
+QString RecordFormat::getSigMFDatatype(Format format, int sampleSize)
+{
+    switch (format)
+    {
+    case FormatPacked12:
+        return "ci16_le";
+    case FormatBlockScaled8:
+        return "ci8";
+    case FormatFloat32:
+        return "cf32_le";
+    default:
+        return sampleSize > 16 ? "ci32_le" : "ci16_le";
+    }
+}
+
+int RecordFormat::pack(Format format, char *out, const Sample *in, int nbUnits)
+{
+    const SIMDKernels& kernels = SIMDKernels::instance();
+    const FixReal *iq = &in->m_real;
+
+    switch (format)
+    {
+    case FormatPacked12:
+        kernels.pack12((uint8_t*) out, iq, nbUnits, SDR_RX_SAMP_SZ - 12);
+        break;
+    case FormatBlockScaled8:
+        for (int i = 0; i < nbUnits; i++, iq += 2*m_block8Samples)
+        {
+            // smallest exponent that keeps the rounded block peak within 8 bits
+            int32_t max = kernels.maxAbs(iq, m_block8Samples);
+            int8_t exponent = 0;
+
+            while ((max + (exponent > 0 ? 1 << (exponent - 1) : 0)) >> exponent > 127) {
+                exponent++;
+            }
+
+            char *block = out + i * getUnitBytes(format, SDR_RX_SAMP_SZ);
+            memset(block, 0, m_block8HeaderBytes);
+            block[0] = exponent;
+            kernels.pack8((int8_t*) (block + m_block8HeaderBytes), iq, m_block8Samples, exponent);
+        }
+        break;
+    case FormatFloat32:
+        kernels.packF32((float*) out, iq, nbUnits, 1.0f / SDR_RX_SCALEF);
+        break;
+    default:
+        memcpy(out, in, nbUnits * sizeof(Sample));
+        break;
+    }
+
+    return nbUnits * getUnitBytes(format, SDR_RX_SAMP_SZ);
+}
+
+void RecordFormat::unpack(Format format, int sampleSize, Sample *out, const char *in, int nbUnits)
+{
+    const SIMDKernels& kernels = SIMDKernels::instance();
+    FixReal *iq = &out->m_real;
+
+    switch (format)
+    {
+    case FormatPacked12:
+        kernels.unpack12(iq, (const uint8_t*) in, nbUnits, SDR_RX_SAMP_SZ - 12);
+        break;
+    case FormatBlockScaled8:
+        for (int i = 0; i < nbUnits; i++, iq += 2*m_block8Samples)
+        {
+            const char *block = in + i * getUnitBytes(format, sampleSize);
+            int exponent = (int8_t) block[0] + SDR_RX_SAMP_SZ - sampleSize; // exponent is relative to the recorded sample size
+            kernels.unpack8(iq, (const int8_t*) (block + m_block8HeaderBytes), m_block8Samples, exponent);
+        }
+        break;
+    case FormatFloat32:
+        kernels.unpackF32(iq, (const float*) in, nbUnits, SDR_RX_SCALEF);
+        break;
+    default:
+        if (sampleSize == SDR_RX_SAMP_SZ)
+        {
+            memcpy(out, in, nbUnits * sizeof(Sample));
+        }
+        else if (sampleSize > 16) // 24 bit recording into 16 bit samples
+        {
+            const int32_t *fileBuf = (const int32_t*) in;
+
+            for (int is = 0; is < 2*nbUnits; is++) {
+                iq[is] = fileBuf[is] >> 8;
+            }
+        }
+        else // 16 bit recording into 24 bit samples
+        {
+            const int16_t *fileBuf = (const int16_t*) in;
+
+            for (int is = 0; is < 2*nbUnits; is++) {
+                iq[is] = fileBuf[is] << 8;
+            }
+        }
+        break;
+    }
+}
@@ -0,0 +1,63 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_RECORDFORMAT_H_
+#define SDRBASE_DSP_RECORDFORMAT_H_
+
+#include <QString>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+/**
+ * On-disk sample formats of I/Q recordings (see FileRecord). The format is stored in the
+ * recording header together with the sample size in bits of the recording application.
+ * Samples are written in units: one complex sample or one block of the block scaled format.
+ * - Native: samples as in memory (16 bit values in 16 bit words or 24 bit values in 32 bit words)
+ * - Packed12: 12 most significant bits of I and Q in 3 bytes (I bits 0..11, Q bits 12..23 little endian)
+ * - BlockScaled8: blocks of m_block8Samples samples with 8 bit I and Q preceded by a header
+ *   of 4 bytes: a signed exponent then 3 reserved bytes. Values are the 8 bit values << exponent
+ * - Float32: I and Q as little endian floats with 1.0 full scale
+ */
+class SDRBASE_API RecordFormat
+{
+public:
+    enum Format
+    {
+        FormatNative,
+        FormatPacked12,
+        FormatBlockScaled8,
+        FormatFloat32,
+        FormatEnd
+    };
+
+    static const int m_block8Samples = 256;   //!< Complex samples per block of the block scaled format
+    static const int m_block8HeaderBytes = 4; //!< Block exponent and reserved bytes
+
+    static QString getName(Format format);
+    static bool getFormat(const QString& name, Format& format); //!< returns false if the name is unknown
+    static int getUnitSamples(Format format); //!< Complex samples per unit
+    static int getUnitBytes(Format format, int sampleSize); //!< Bytes per unit of samples of sampleSize bits
+    static QString getSigMFDatatype(Format format, int sampleSize); //!< Type of the unpacked samples for the SigMF core:datatype field
+
+    /** Pack nbUnits units of samples of the build into out. Returns the number of bytes written. */
+    static int pack(Format format, char *out, const Sample *in, int nbUnits);
+    /** Unpack nbUnits units of samples of sampleSize bits into samples of the build */
+    static void unpack(Format format, int sampleSize, Sample *out, const char *in, int nbUnits);
+};
+
+#endif // SDRBASE_DSP_RECORDFORMAT_H_
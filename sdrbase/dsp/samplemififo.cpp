@@ -47,6 +47,15 @@ void SampleMIFifo::reset()
     }
 }
 
+void SampleMIFifo::countOverflow(unsigned int size, unsigned int head, unsigned int fill)
+{
+    unsigned int unread = head <= fill ? fill - head : m_size - (head - fill);
+
+    if (unread + size >= m_size) { // write index passes the read index: the reader only gets the samples written past it
+        m_counters.overflow(m_size);
+    }
+}
+
 SampleMIFifo::SampleMIFifo(QObject *parent) :
     QObject(parent),
     m_nbStreams(0),
@@ -83,11 +92,13 @@ void SampleMIFifo::writeSync(const quint8* data, unsigned int count)
 
     if (size > m_size)
     {
-        qWarning("SampleMIFifo::writeSync: input size %u greater that FIFO size %u: truncating input", size, m_size);
+        m_counters.overflow(size - m_size);
         size = m_size;
         count = m_size * sizeof(Sample);
     }
 
+    countOverflow(size, m_head, m_fill);
+
     for (unsigned int stream = 0; stream < m_data.size(); stream++)
     {
         if (size <= spaceLeft)
@@ -119,10 +130,12 @@ void SampleMIFifo::writeSync(const std::vector<SampleVector::const_iterator>& vb
 
     if (size > m_size)
     {
-        qWarning("SampleMIFifo::writeSync: input size %u greater that FIFO size %u: truncating input", size, m_size);
+        m_counters.overflow(size - m_size);
         size = m_size;
     }
 
+    countOverflow(size, m_head, m_fill);
+
     if (size <= spaceLeft)
     {
         for (unsigned int stream = 0; stream < m_data.size(); stream++) {
@@ -267,11 +280,13 @@ void SampleMIFifo::writeAsync(const quint8* data, unsigned int count, unsigned i
 
     if (size > m_size)
     {
-        qWarning("SampleMIFifo::writeAsync: input size %u greater that FIFO size %u: truncating input", size, m_size);
+        m_counters.overflow(size - m_size);
         size = m_size;
         count = m_size * sizeof(Sample);
     }
 
+    countOverflow(size, m_vHead[stream], m_vFill[stream]);
+
     if (size <= spaceLeft)
     {
         std::copy(&data[stream*count], &data[stream*count] + count, m_data[stream].begin() + m_vFill[stream]);
@@ -300,10 +315,12 @@ void SampleMIFifo::writeAsync(const SampleVector::const_iterator& begin, unsigne
 
     if (size > m_size)
     {
-        qWarning("SampleMIFifo::writeAsync: input size %u greater that FIFO size %u: truncating input", size, m_size);
+        m_counters.overflow(size - m_size);
         size = m_size;
     }
 
+    countOverflow(size, m_vHead[stream], m_vFill[stream]);
+
     if (size <= spaceLeft)
     {
         std::copy(begin, begin + size, m_data[stream].begin() + m_vFill[stream]);
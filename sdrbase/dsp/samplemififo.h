@@ -22,6 +22,7 @@
 #include <QMutex>
 #include <vector>
 #include "dsp/dsptypes.h"
+#include "dsp/fifocounters.h"
 #include "export.h"
 
 class SDRBASE_API SampleMIFifo : public QObject {
@@ -64,6 +65,7 @@ public:
     const std::vector<SampleVector>& getData() { return m_data; }
     const SampleVector& getData(unsigned int stream) { return m_data[stream]; }
     unsigned int getNbStreams() const { return m_data.size(); }
+    const FifoCounters& getCounters() const { return m_counters; } //!< all streams: overflows are samples overwritten before being read. No underruns
 
     inline unsigned int fillSync()
     {
@@ -96,6 +98,9 @@ private:
     std::vector<unsigned int> m_vFill; //!< Number of samples written from beginning of samples vector (async)
     std::vector<unsigned int> m_vHead; //!< Number of samples read from beginning of samples vector (async)
 	QMutex m_mutex;
+    FifoCounters m_counters;
+
+    void countOverflow(unsigned int size, unsigned int head, unsigned int fill);
 };
 
 #endif // INCLUDE_SAMPLEMIFIFO_H
\ No newline at end of file
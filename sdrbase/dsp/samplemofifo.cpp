@@ -117,12 +117,12 @@ void SampleMOFifo::writeSync(
 
     if (rwDelta < m_lowGuard)
     {
-        qWarning("SampleMOFifo::write: underrun (write too slow) using %d old samples", m_midPoint - m_lowGuard);
+        m_counters.underrun(m_midPoint - rwDelta); // write too slow: old samples will be read again
         m_writeHead = m_readHead + m_midPoint < m_size ? m_readHead + m_midPoint : m_readHead + m_midPoint - m_size;
     }
     else if (rwDelta > m_highGuard)
     {
-        qWarning("SampleMOFifo::write: overrrun (read too slow) dropping %d samples", m_highGuard - m_midPoint);
+        m_counters.overflow(rwDelta - m_midPoint); // read too slow: written samples are overwritten
         m_writeHead = m_readHead + m_midPoint < m_size ? m_readHead + m_midPoint : m_readHead + m_midPoint - m_size;
     }
 
@@ -194,13 +194,13 @@ void SampleMOFifo::writeAsync( //!< in place write with given amount
 
     if (rwDelta < m_lowGuard)
     {
-        qWarning("SampleMOFifo::write: underrun on stream %u (write too slow) using %d old samples", stream, m_midPoint - m_lowGuard);
+        m_counters.underrun(m_midPoint - rwDelta);
         m_vWriteHead[stream] = m_vReadHead[stream] + m_midPoint < m_size ?
             m_vReadHead[stream] + m_midPoint : m_vReadHead[stream] + m_midPoint - m_size;
     }
     else if (rwDelta > m_highGuard)
     {
-        qWarning("SampleMOFifo::write: overrrun on stream %u (read too slow) dropping %d samples", stream, m_highGuard - m_midPoint);
+        m_counters.overflow(rwDelta - m_midPoint);
         m_vWriteHead[stream] = m_vReadHead[stream] + m_midPoint < m_size ?
             m_vReadHead[stream] + m_midPoint : m_vReadHead[stream] + m_midPoint - m_size;
     }
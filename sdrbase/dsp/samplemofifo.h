@@ -21,6 +21,7 @@
 #include <QObject>
 #include <QMutex>
 #include "dsp/dsptypes.h"
+#include "dsp/fifocounters.h"
 #include "export.h"
 
 class SDRBASE_API SampleMOFifo : public QObject {
@@ -81,6 +82,8 @@ public:
         return m_vReadCount[stream];
     }
 
+    const FifoCounters& getCounters() const { return m_counters; } //!< all streams: underruns are old samples replayed, overflows samples never read
+
     static unsigned int getSizePolicy(unsigned int sampleRate);
     static const unsigned int m_rwDivisor;
     static const unsigned int m_guardDivisor;
@@ -102,6 +105,7 @@ private:
     std::vector<unsigned int> m_vReadCount;
     std::vector<unsigned int> m_vReadHead;
     std::vector<unsigned int> m_vWriteHead;
+    FifoCounters m_counters;
 	QMutex m_mutex;
 };
 
@@ -23,9 +23,10 @@
 void SampleSinkFifo::create(unsigned int s)
 {
 	m_size = 0;
-	m_fill = 0;
+	m_fill.storeRelease(0);
 	m_head = 0;
 	m_tail = 0;
+	m_notified.storeRelease(0);
 
 	m_data.resize(s);
 	m_size = m_data.size();
@@ -33,40 +34,45 @@ void SampleSinkFifo::create(unsigned int s)
 
 void SampleSinkFifo::reset()
 {
-	m_suppressed = -1;
-	m_fill = 0;
+	m_fill.storeRelease(0);
 	m_head = 0;
 	m_tail = 0;
+	m_notified.storeRelease(0);
 }
 
 SampleSinkFifo::SampleSinkFifo(QObject* parent) :
 	QObject(parent),
-	m_data()
+	m_data(),
+	m_lockFree(false),
+	m_wakeupThreshold(1)
 {
-	m_suppressed = -1;
 	m_size = 0;
-	m_fill = 0;
+	m_fill.storeRelease(0);
 	m_head = 0;
 	m_tail = 0;
+	m_notified.storeRelease(0);
 }
 
 SampleSinkFifo::SampleSinkFifo(int size, QObject* parent) :
 	QObject(parent),
-	m_data()
+	m_data(),
+	m_lockFree(false),
+	m_wakeupThreshold(1)
 {
-	m_suppressed = -1;
 	create(size);
 }
 
 SampleSinkFifo::SampleSinkFifo(const SampleSinkFifo& other) :
     QObject(other.parent()),
-    m_data(other.m_data)
+    m_data(other.m_data),
+	m_lockFree(other.m_lockFree),
+	m_wakeupThreshold(other.m_wakeupThreshold.loadAcquire())
 {
-  	m_suppressed = -1;
 	m_size = m_data.size();
-	m_fill = 0;
+	m_fill.storeRelease(0);
 	m_head = 0;
 	m_tail = 0;
+	m_notified.storeRelease(0);
 }
 
 SampleSinkFifo::~SampleSinkFifo()
@@ -84,36 +90,29 @@ bool SampleSinkFifo::setSize(int size)
 
 unsigned int SampleSinkFifo::write(const quint8* data, unsigned int count)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	return writeSamples((const Sample*) data, count / sizeof(Sample));
+}
+
+unsigned int SampleSinkFifo::write(SampleVector::const_iterator begin, SampleVector::const_iterator end)
+{
+	if (begin == end) {
+		return 0;
+	}
+
+	return writeSamples(&(*begin), end - begin);
+}
+
+unsigned int SampleSinkFifo::writeSamples(const Sample* begin, unsigned int count)
+{
+	QMutexLocker mutexLocker(m_lockFree ? nullptr : &m_mutex);
 	unsigned int total;
 	unsigned int remaining;
 	unsigned int len;
-	const Sample* begin = (const Sample*)data;
-	count /= sizeof(Sample);
 
-	total = std::min(count, m_size - m_fill);
+	total = std::min(count, m_size - m_fill.loadAcquire());
 
-    if (total < count)
-    {
-		if (m_suppressed < 0)
-        {
-			m_suppressed = 0;
-			m_msgRateTimer.start();
-			qCritical("SampleSinkFifo::write: overflow - dropping %u samples", count - total);
-		}
-        else
-        {
-			if (m_msgRateTimer.elapsed() > 2500)
-            {
-				qCritical("SampleSinkFifo::write: %u messages dropped", m_suppressed);
-				qCritical("SampleSinkFifo::write: overflow - dropping %u samples", count - total);
-				m_suppressed = -1;
-			}
-            else
-            {
-				m_suppressed++;
-			}
-		}
+    if (total < count) {
+		m_counters.overflow(count - total);
 	}
 
 	remaining = total;
@@ -124,83 +123,45 @@ unsigned int SampleSinkFifo::write(const quint8* data, unsigned int count)
 		std::copy(begin, begin + len, m_data.begin() + m_tail);
 		m_tail += len;
 		m_tail %= m_size;
-		m_fill += len;
 		begin += len;
 		remaining -= len;
 	}
 
-	if (m_fill > 0) {
-		emit dataReady();
-    }
+	m_fill.fetchAndAddOrdered(total); // publish data to the consumer
+	notify();
 
 	return total;
 }
 
-unsigned int SampleSinkFifo::write(SampleVector::const_iterator begin, SampleVector::const_iterator end)
+void SampleSinkFifo::notify()
 {
-	QMutexLocker mutexLocker(&m_mutex);
-	unsigned int count = end - begin;
-	unsigned int total;
-	unsigned int remaining;
-	unsigned int len;
+	unsigned int fill = m_fill.loadAcquire();
 
-	total = std::min(count, m_size - m_fill);
-
-    if (total < count)
-    {
-		if (m_suppressed < 0)
-        {
-			m_suppressed = 0;
-			m_msgRateTimer.start();
-			qCritical("SampleSinkFifo::write: overflow - dropping %u samples", count - total);
-		}
-        else
-        {
-			if (m_msgRateTimer.elapsed() > 2500)
-            {
-				qCritical("SampleSinkFifo::write: %u messages dropped", m_suppressed);
-				qCritical("SampleSinkFifo::write: overflow - dropping %u samples", count - total);
-				m_suppressed = -1;
-			}
-            else
-            {
-				m_suppressed++;
-			}
+	if (!m_lockFree)
+	{
+		if (fill > 0) {
+			emit dataReady();
 		}
 	}
-
-	remaining = total;
-
-    while (remaining > 0)
-    {
-		len = std::min(remaining, m_size - m_tail);
-		std::copy(begin, begin + len, m_data.begin() + m_tail);
-		m_tail += len;
-		m_tail %= m_size;
-		m_fill += len;
-		begin += len;
-		remaining -= len;
-	}
-
-	if (m_fill > 0) {
+	else if ((fill > 0) && (fill >= std::min(m_wakeupThreshold.loadAcquire(), m_size / 2)) && m_notified.testAndSetOrdered(0, 1))
+	{
 		emit dataReady();
-    }
-
-	return total;
+	}
 }
 
 unsigned int SampleSinkFifo::read(SampleVector::iterator begin, SampleVector::iterator end)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	QMutexLocker mutexLocker(m_lockFree ? nullptr : &m_mutex);
 	unsigned int count = end - begin;
 	unsigned int total;
 	unsigned int remaining;
 	unsigned int len;
 
-	total = std::min(count, m_fill);
+	m_notified.storeRelease(0); // consumer is active: next write may notify again
+	total = std::min(count, m_fill.loadAcquire());
 
     if (total < count) {
-		qCritical("SampleSinkFifo::read: underflow - missing %u samples", count - total);
+		m_counters.underrun(count - total);
     }
 
 	remaining = total;
@@ -211,11 +172,12 @@ unsigned int SampleSinkFifo::read(SampleVector::iterator begin, SampleVector::it
 		std::copy(m_data.begin() + m_head, m_data.begin() + m_head + len, begin);
 		m_head += len;
 		m_head %= m_size;
-		m_fill -= len;
 		begin += len;
 		remaining -= len;
 	}
 
+	m_fill.fetchAndSubOrdered(total); // release space to the producer
+
 	return total;
 }
 
@@ -223,16 +185,17 @@ unsigned int SampleSinkFifo::readBegin(unsigned int count,
 	SampleVector::iterator* part1Begin, SampleVector::iterator* part1End,
 	SampleVector::iterator* part2Begin, SampleVector::iterator* part2End)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	QMutexLocker mutexLocker(m_lockFree ? nullptr : &m_mutex);
 	unsigned int total;
 	unsigned int remaining;
 	unsigned int len;
 	unsigned int head = m_head;
 
-	total = std::min(count, m_fill);
+	m_notified.storeRelease(0); // consumer is active: next write may notify again
+	total = std::min(count, m_fill.loadAcquire());
 
     if (total < count) {
-		qCritical("SampleSinkFifo::readBegin: underflow - missing %u samples", count - total);
+		m_counters.underrun(count - total);
     }
 
 	remaining = total;
@@ -269,16 +232,17 @@ unsigned int SampleSinkFifo::readBegin(unsigned int count,
 
 unsigned int SampleSinkFifo::readCommit(unsigned int count)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	QMutexLocker mutexLocker(m_lockFree ? nullptr : &m_mutex);
+	unsigned int fill = m_fill.loadAcquire();
 
-	if (count > m_fill)
+	if (count > fill)
     {
 		qCritical("SampleSinkFifo::readCommit: cannot commit more than available samples");
-		count = m_fill;
+		count = fill;
 	}
 
     m_head = (m_head + count) % m_size;
-	m_fill -= count;
+	m_fill.fetchAndSubOrdered(count);
 
 	return count;
 }
@@ -286,4 +250,9 @@ unsigned int SampleSinkFifo::readCommit(unsigned int count)
 unsigned int SampleSinkFifo::getSizePolicy(unsigned int sampleRate)
 {
     return (sampleRate/100)*64; // .64s
-}
\ No newline at end of file
+}
+
+unsigned int SampleSinkFifo::getWakeupThresholdPolicy(unsigned int sampleRate)
+{
+    return std::max(sampleRate/500, 1U); // 2ms
+}
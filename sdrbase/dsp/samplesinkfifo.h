@@ -21,26 +21,55 @@
 
 #include <QObject>
 #include <QMutex>
-#include <QTime>
+#include <QAtomicInteger>
 #include "dsp/dsptypes.h"
+#include "dsp/fifocounters.h"
 #include "export.h"
 
+/**
+ * Sample FIFO between a producer (device thread or engine) and a consumer (engine or channel baseband).
+ *
+ * By default all accesses are serialized with a mutex and dataReady() is emitted on every write.
+ * In lock free mode (setLockFree(true)) there must be exactly one producer thread and one consumer
+ * thread. The producer owns the tail, the consumer owns the head and they only share the atomic fill
+ * counter. dataReady() is then emitted once per batch: only when the fill reaches the wakeup threshold
+ * and no notification is already pending, i.e. the consumer has not taken the last one. The consumer
+ * must call consumerWoken() as soon as it gets dataReady() even if it does not read then (e.g. not running
+ * or messages pending) else no further dataReady() would be emitted.
+ * setSize, reset and setLockFree must be called when neither side is active.
+ */
 class SDRBASE_API SampleSinkFifo : public QObject {
 	Q_OBJECT
 
 private:
 	QMutex m_mutex;
-	QTime m_msgRateTimer;
-	int m_suppressed;
-
 	SampleVector m_data;
-
 	unsigned int m_size;
-	unsigned int m_fill;
+	bool m_lockFree;
+	QAtomicInteger<unsigned int> m_wakeupThreshold;
+
+	// Explicit padding keeps the producer, consumer and shared fields on separate cache lines
+	// without over-aligning the object (alignas(64) members need aligned new for heap instances)
+	char m_pad0[64];
+
+	// shared between producer and consumer
+	QAtomicInteger<unsigned int> m_fill;
+	QAtomicInt m_notified; //!< a dataReady() notification is pending (lock free mode)
+
+	FifoCounters m_counters; //!< overflows counted by the producer, underruns by the consumer
+	char m_pad1[64];
+
+	// consumer side
 	unsigned int m_head;
+	char m_pad2[64 - sizeof(unsigned int)];
+
+	// producer side
 	unsigned int m_tail;
+	char m_pad3[64 - sizeof(unsigned int)];
 
 	void create(unsigned int s);
+	unsigned int writeSamples(const Sample* begin, unsigned int count);
+	void notify();
 
 public:
 	SampleSinkFifo(QObject* parent = nullptr);
@@ -50,8 +79,13 @@ public:
 
 	bool setSize(int size);
     void reset();
+	void setLockFree(bool lockFree) { m_lockFree = lockFree; } //!< single producer single consumer mode without mutex
+	bool getLockFree() const { return m_lockFree; }
+	void setWakeupThreshold(unsigned int threshold) { m_wakeupThreshold.storeRelease(threshold); } //!< minimum fill to emit dataReady() in lock free mode. From any thread
+	void consumerWoken() { m_notified.storeRelease(0); } //!< the consumer got dataReady(): next write may notify again (lock free mode)
 	inline unsigned int size() const { return m_size; }
-	inline unsigned int fill() { QMutexLocker mutexLocker(&m_mutex); unsigned int fill = m_fill; return fill; }
+	inline unsigned int fill() { return m_fill.loadAcquire(); }
+	const FifoCounters& getCounters() const { return m_counters; }
 
 	unsigned int write(const quint8* data, unsigned int count);
 	unsigned int write(SampleVector::const_iterator begin, SampleVector::const_iterator end);
@@ -63,6 +97,7 @@ public:
 		SampleVector::iterator* part2Begin, SampleVector::iterator* part2End);
 	unsigned int readCommit(unsigned int count);
     static unsigned int getSizePolicy(unsigned int sampleRate);
+    static unsigned int getWakeupThresholdPolicy(unsigned int sampleRate);
 
 signals:
 	void dataReady();
@@ -0,0 +1,294 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <QDebug>
+
+#include "samplesinkring.h"
+
+SampleSinkRing::SampleSinkRing() :
+    m_writeCount(0),
+    m_size(0),
+    m_dropped(0)
+{}
+
+SampleSinkRing::~SampleSinkRing()
+{
+    for (std::vector<SampleSinkRingReader*>::iterator it = m_readers.begin(); it != m_readers.end(); ++it) {
+        (*it)->m_ring.storeRelease(nullptr);
+    }
+}
+
+void SampleSinkRing::setSize(unsigned int size)
+{
+    if (size == m_size) {
+        return;
+    }
+
+    qDebug("SampleSinkRing::setSize: %u", size);
+    m_size = size;
+
+    if (m_readers.size() > 0) {
+        allocate();
+    }
+}
+
+void SampleSinkRing::allocate()
+{
+    // readers that lag behind the new base count will skip to it
+    std::shared_ptr<Buffer> buffer;
+
+    if (m_size > 0) {
+        buffer = std::make_shared<Buffer>(m_size, m_writeCount.loadAcquire());
+    }
+
+    std::atomic_store(&m_buffer, buffer);
+}
+
+void SampleSinkRing::attach(SampleSinkRingReader *reader)
+{
+    if (std::find(m_readers.begin(), m_readers.end(), reader) != m_readers.end()) {
+        return;
+    }
+
+    if (m_readers.size() == 0) {
+        allocate();
+    }
+
+    reader->m_readCount.storeRelease(m_writeCount.loadAcquire());
+    reader->m_ring.storeRelease(this);
+    QMutexLocker mutexLocker(&m_readersMutex);
+    m_readers.push_back(reader);
+    qDebug("SampleSinkRing::attach: %u readers", (unsigned int) m_readers.size());
+}
+
+void SampleSinkRing::detach(SampleSinkRingReader *reader)
+{
+    std::vector<SampleSinkRingReader*>::iterator it = std::find(m_readers.begin(), m_readers.end(), reader);
+
+    if (it == m_readers.end()) {
+        return;
+    }
+
+    reader->m_ring.storeRelease(nullptr);
+    QMutexLocker mutexLocker(&m_readersMutex);
+    m_readers.erase(it);
+
+    if (m_readers.size() == 0) {
+        std::atomic_store(&m_buffer, std::shared_ptr<Buffer>()); // last reference from the writer side
+    }
+
+    qDebug("SampleSinkRing::detach: %u readers", (unsigned int) m_readers.size());
+}
+
+unsigned int SampleSinkRing::write(SampleVector::const_iterator begin, SampleVector::const_iterator end)
+{
+    if ((m_readers.size() == 0) || !m_buffer) {
+        return 0;
+    }
+
+    unsigned int count = end - begin;
+    quint64 writeCount = m_writeCount.loadAcquire();
+    quint64 newWriteCount = writeCount + count;
+    quint64 oldest = newWriteCount > m_buffer->m_baseCount + m_size ? newWriteCount - m_size : m_buffer->m_baseCount;
+
+    // readers that would be overwritten skip to the oldest sample kept. The others are not affected.
+    for (std::vector<SampleSinkRingReader*>::const_iterator it = m_readers.begin(); it != m_readers.end(); ++it)
+    {
+        SampleSinkRingReader *reader = *it;
+        quint64 readCount = std::max(advance(reader->m_readCount, oldest), m_buffer->m_baseCount);
+
+        if (readCount < oldest)
+        {
+            reader->m_counters.overflow((unsigned int) (oldest - readCount));
+            m_dropped.fetchAndAddOrdered(oldest - readCount);
+        }
+    }
+
+    // only the last ring size samples of a larger block can be kept
+    if (count > m_size)
+    {
+        writeCount += count - m_size;
+        begin += count - m_size;
+    }
+
+    unsigned int tail = (writeCount - m_buffer->m_baseCount) % m_size;
+    unsigned int remaining = newWriteCount - writeCount;
+
+    while (remaining > 0)
+    {
+        unsigned int len = std::min(remaining, m_size - tail);
+        std::copy(begin, begin + len, m_buffer->m_data.begin() + tail);
+        tail = (tail + len) % m_size;
+        begin += len;
+        remaining -= len;
+    }
+
+    m_writeCount.storeRelease(newWriteCount);
+
+    return count;
+}
+
+unsigned int SampleSinkRing::getMaxFill() const
+{
+    QMutexLocker mutexLocker(&m_readersMutex);
+    quint64 writeCount = m_writeCount.loadAcquire();
+    std::shared_ptr<Buffer> buffer = getBuffer();
+    unsigned int maxFill = 0;
+
+    if (!buffer) {
+        return 0;
+    }
+
+    for (std::vector<SampleSinkRingReader*>::const_iterator it = m_readers.begin(); it != m_readers.end(); ++it)
+    {
+        quint64 readCount = std::max((*it)->m_readCount.loadAcquire(), buffer->m_baseCount);
+        unsigned int fill = readCount < writeCount ? (unsigned int) std::min(writeCount - readCount, (quint64) m_size) : 0;
+        maxFill = std::max(maxFill, fill);
+    }
+
+    return maxFill;
+}
+
+quint64 SampleSinkRing::advance(QAtomicInteger<quint64>& count, quint64 value)
+{
+    for (;;)
+    {
+        quint64 current = count.loadAcquire();
+
+        if ((current >= value) || count.testAndSetOrdered(current, value)) {
+            return current;
+        }
+    }
+}
+
+void SampleSinkRing::notify()
+{
+    for (std::vector<SampleSinkRingReader*>::const_iterator it = m_readers.begin(); it != m_readers.end(); ++it) {
+        emit (*it)->dataReady();
+    }
+}
+
+SampleSinkRingReader::SampleSinkRingReader(QObject *parent) :
+    QObject(parent),
+    m_ring(nullptr),
+    m_readCount(0),
+    m_readBeginCount(0)
+{}
+
+SampleSinkRingReader::~SampleSinkRingReader()
+{}
+
+void SampleSinkRingReader::reset()
+{
+    SampleSinkRing *ring = m_ring.loadAcquire();
+
+    if (ring) {
+        SampleSinkRing::advance(m_readCount, ring->m_writeCount.loadAcquire());
+    }
+}
+
+unsigned int SampleSinkRingReader::size() const
+{
+    SampleSinkRing *ring = m_ring.loadAcquire();
+    return ring ? ring->size() : 0;
+}
+
+unsigned int SampleSinkRingReader::fill()
+{
+    SampleSinkRing *ring = m_ring.loadAcquire();
+
+    if (!ring) {
+        return 0;
+    }
+
+    // load the write count first so that the buffer it refers to is visible
+    quint64 writeCount = ring->m_writeCount.loadAcquire();
+    std::shared_ptr<SampleSinkRing::Buffer> buffer = ring->getBuffer();
+
+    if (!buffer) {
+        return 0;
+    }
+
+    quint64 readCount = std::max(m_readCount.loadAcquire(), buffer->m_baseCount);
+
+    return readCount < writeCount ? (unsigned int) std::min(writeCount - readCount, (quint64) buffer->m_data.size()) : 0;
+}
+
+unsigned int SampleSinkRingReader::readBegin(unsigned int count,
+    SampleVector::const_iterator* part1Begin, SampleVector::const_iterator* part1End,
+    SampleVector::const_iterator* part2Begin, SampleVector::const_iterator* part2End)
+{
+    SampleSinkRing *ring = m_ring.loadAcquire();
+    m_readBuffer.reset();
+    unsigned int total = 0;
+
+    if (ring)
+    {
+        quint64 writeCount = ring->m_writeCount.loadAcquire();
+        m_readBuffer = ring->getBuffer();
+
+        if (m_readBuffer)
+        {
+            // catch up after a resize. The writer may also have moved the count forward if lagging
+            m_readBeginCount = std::max(SampleSinkRing::advance(m_readCount, m_readBuffer->m_baseCount), m_readBuffer->m_baseCount);
+            quint64 available = m_readBeginCount < writeCount ? writeCount - m_readBeginCount : 0;
+            total = (unsigned int) std::min((quint64) count, std::min(available, (quint64) m_readBuffer->m_data.size()));
+        }
+    }
+
+    if (total == 0)
+    {
+        m_readBuffer.reset();
+        *part1Begin = *part1End = *part2Begin = *part2End = SampleVector::const_iterator();
+        return 0;
+    }
+
+    const SampleVector& data = m_readBuffer->m_data;
+    unsigned int size = data.size();
+    unsigned int head = (m_readBeginCount - m_readBuffer->m_baseCount) % size;
+    unsigned int len = std::min(total, size - head);
+    *part1Begin = data.begin() + head;
+    *part1End = data.begin() + head + len;
+
+    if (len < total)
+    {
+        *part2Begin = data.begin();
+        *part2End = data.begin() + (total - len);
+    }
+    else
+    {
+        *part2Begin = data.end();
+        *part2End = data.end();
+    }
+
+    return total;
+}
+
+unsigned int SampleSinkRingReader::readCommit(unsigned int count)
+{
+    if (!m_readBuffer) {
+        return 0;
+    }
+
+    // no effect if the writer has moved the count past these samples meanwhile
+    SampleSinkRing::advance(m_readCount, m_readBeginCount + count);
+    m_readBuffer.reset(); // release storage reference taken by readBegin
+
+    return count;
+}
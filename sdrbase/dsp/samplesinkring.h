@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_SAMPLESINKRING_H
+#define INCLUDE_SAMPLESINKRING_H
+
+#include <memory>
+#include <vector>
+
+#include <QObject>
+#include <QAtomicInteger>
+#include <QAtomicPointer>
+#include <QMutex>
+
+#include "dsp/dsptypes.h"
+#include "dsp/fifocounters.h"
+#include "export.h"
+
+class SampleSinkRingReader;
+
+/**
+ * Baseband ring buffer shared by all channels of a device set.
+ *
+ * Samples are written once by the device engine thread and each attached reader
+ * consumes them in place through its own cursor. The writer never waits for a reader:
+ * when a reader lags by more than the ring size its cursor is moved forward to the oldest
+ * sample still in the ring and the skipped samples are counted as overflow of that reader
+ * only. The other readers are not affected. A reader that holds samples between readBegin
+ * and readCommit for as long as the ring lasts may see part of them overwritten. This is
+ * also counted as an overflow of that reader.
+ *
+ * The sample storage is reference counted: it is allocated when the first reader
+ * attaches and freed when the last one detaches. A reader keeps a reference to the
+ * storage between readBegin and readCommit so that a resize by the writer cannot
+ * pull the data from under its feet.
+ *
+ * setSize, attach, detach and write must be called from the writer thread only.
+ * getMaxFill may be called from any thread.
+ */
+class SDRBASE_API SampleSinkRing
+{
+public:
+    SampleSinkRing();
+    ~SampleSinkRing();
+
+    void setSize(unsigned int size);
+    unsigned int size() const { return m_size; }
+    void attach(SampleSinkRingReader *reader);
+    void detach(SampleSinkRingReader *reader);
+    unsigned int getNbReaders() const { return m_readers.size(); }
+    unsigned int write(SampleVector::const_iterator begin, SampleVector::const_iterator end);
+    void notify(); //!< signal readers that new data is available
+    quint64 getDropped() const { return m_dropped.loadAcquire(); } //!< samples skipped by all lagging readers
+    unsigned int getMaxFill() const; //!< samples pending in the slowest reader
+
+private:
+    friend class SampleSinkRingReader;
+
+    struct Buffer
+    {
+        SampleVector m_data;
+        quint64 m_baseCount; //!< write count when this buffer was installed
+
+        Buffer(unsigned int size, quint64 baseCount) :
+            m_data(size),
+            m_baseCount(baseCount)
+        {}
+    };
+
+    std::shared_ptr<Buffer> m_buffer;
+    QAtomicInteger<quint64> m_writeCount; //!< total number of samples written since creation
+    std::vector<SampleSinkRingReader*> m_readers;
+    mutable QMutex m_readersMutex;        //!< Changes of the readers list against getMaxFill from other threads
+    unsigned int m_size;
+    QAtomicInteger<quint64> m_dropped;
+
+    void allocate();
+    std::shared_ptr<Buffer> getBuffer() const { return std::atomic_load(&m_buffer); }
+    static quint64 advance(QAtomicInteger<quint64>& count, quint64 value); //!< moves count forward to value if behind. Returns the previous count
+};
+
+/**
+ * Read side of a SampleSinkRing. Mimics the SampleSinkFifo read interface so that
+ * channel basebands can consume the shared baseband with the same loop as their private FIFO.
+ * All methods must be called from the consumer thread only.
+ */
+class SDRBASE_API SampleSinkRingReader : public QObject {
+    Q_OBJECT
+
+public:
+    SampleSinkRingReader(QObject *parent = nullptr);
+    ~SampleSinkRingReader();
+
+    bool isAttached() const { return m_ring.loadAcquire() != nullptr; }
+    void reset(); //!< skip all pending samples
+    unsigned int fill();
+    unsigned int size() const; //!< size of the attached ring or 0
+
+    unsigned int readBegin(unsigned int count,
+        SampleVector::const_iterator* part1Begin, SampleVector::const_iterator* part1End,
+        SampleVector::const_iterator* part2Begin, SampleVector::const_iterator* part2End);
+    unsigned int readCommit(unsigned int count);
+    const FifoCounters& getCounters() const { return m_counters; } //!< overflow counts samples skipped when the reader lagged
+
+signals:
+    void dataReady();
+
+private:
+    friend class SampleSinkRing;
+
+    QAtomicPointer<SampleSinkRing> m_ring;
+    QAtomicInteger<quint64> m_readCount;     //!< total number of samples consumed. Also moved forward by the writer when lagging
+    quint64 m_readBeginCount;                //!< read count at readBegin
+    std::shared_ptr<SampleSinkRing::Buffer> m_readBuffer; //!< storage held between readBegin and readCommit
+    FifoCounters m_counters;
+};
+
+#endif // INCLUDE_SAMPLESINKRING_H
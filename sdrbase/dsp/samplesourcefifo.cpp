@@ -96,12 +96,12 @@ void SampleSourceFifo::write(
 
     if (rwDelta < m_lowGuard)
     {
-        qWarning("SampleSourceFifo::write: underrun (write too slow) using %d old samples", m_midPoint - m_lowGuard);
+        m_counters.underrun(m_midPoint - rwDelta); // write too slow: old samples will be read again
         m_writeHead = m_readHead + m_midPoint < m_size ? m_readHead + m_midPoint : m_readHead + m_midPoint - m_size;
     }
     else if (rwDelta > m_highGuard)
     {
-        qWarning("SampleSourceFifo::write: overrrun (read too slow) dropping %d samples", m_highGuard - m_midPoint);
+        m_counters.overflow(rwDelta - m_midPoint); // read too slow: written samples are overwritten
         m_writeHead = m_readHead + m_midPoint < m_size ? m_readHead + m_midPoint : m_readHead + m_midPoint - m_size;
     }
 
@@ -21,6 +21,7 @@
 #include <QObject>
 #include <QMutex>
 #include "dsp/dsptypes.h"
+#include "dsp/fifocounters.h"
 #include "export.h"
 
 class SDRBASE_API SampleSourceFifo : public QObject {
@@ -60,6 +61,7 @@ public:
         return delta / (float) m_size;
     }
     unsigned int size() const { return m_size; }
+    const FifoCounters& getCounters() const { return m_counters; } //!< underruns: old samples replayed, overflows: samples written but never read
 
     static unsigned int getSizePolicy(unsigned int sampleRate);
     static const unsigned int m_rwDivisor;
@@ -77,6 +79,7 @@ private:
     unsigned int m_readHead;
     unsigned int m_writeHead;
     unsigned int m_readCount;
+    FifoCounters m_counters;
     QMutex m_mutex;
 };
 
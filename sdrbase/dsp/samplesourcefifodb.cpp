@@ -54,6 +54,7 @@ void SampleSourceFifoDB::init()
     std::fill(m_data.begin(), m_data.end(), zero);
     m_ir = 0;
     m_iw = m_size/2;
+    m_unread = m_size/2;
     m_init = true;
 }
 
@@ -63,6 +64,16 @@ void SampleSourceFifoDB::readAdvance(SampleVector::iterator& readUntil, unsigned
     assert(nbSamples <= m_size/2);
     emit dataWrite(nbSamples);
 
+    if (nbSamples > m_unread)
+    {
+        m_counters.underrun(nbSamples - m_unread); // write too slow
+        m_unread = 0;
+    }
+    else
+    {
+        m_unread -= nbSamples;
+    }
+
     m_ir = (m_ir + nbSamples) % m_size;
     readUntil =  m_data.begin() + m_size + m_ir;
     emit dataRead(nbSamples);
@@ -74,6 +85,16 @@ void SampleSourceFifoDB::readAdvance(SampleVector::const_iterator& readUntil, un
     assert(nbSamples <= m_size/2);
     emit dataWrite(nbSamples);
 
+    if (nbSamples > m_unread)
+    {
+        m_counters.underrun(nbSamples - m_unread); // write too slow
+        m_unread = 0;
+    }
+    else
+    {
+        m_unread -= nbSamples;
+    }
+
     m_ir = (m_ir + nbSamples) % m_size;
     readUntil =  m_data.begin() + m_size + m_ir;
     emit dataRead(nbSamples);
@@ -88,6 +109,8 @@ void SampleSourceFifoDB::write(const Sample& sample)
 //        QMutexLocker mutexLocker(&m_mutex);
         m_iw = (m_iw+1) % m_size;
     }
+
+    written();
 }
 
 void SampleSourceFifoDB::getReadIterator(SampleVector::iterator& readUntil)
@@ -109,9 +132,19 @@ void SampleSourceFifoDB::bumpIndex(SampleVector::iterator& writeAt)
         m_iw = (m_iw+1) % m_size;
     }
 
+    written();
     writeAt = m_data.begin() + m_iw;
 }
 
+void SampleSourceFifoDB::written()
+{
+    if (m_unread < m_size) {
+        m_unread++;
+    } else {
+        m_counters.overflow(1); // read too slow: the oldest unread sample is overwritten
+    }
+}
+
 int SampleSourceFifoDB::getIteratorOffset(const SampleVector::iterator& iterator)
 {
     return iterator - m_data.begin();
@@ -24,6 +24,7 @@
 #include <assert.h>
 #include "export.h"
 #include "dsp/dsptypes.h"
+#include "dsp/fifocounters.h"
 
 class SDRBASE_API SampleSourceFifoDB : public QObject {
     Q_OBJECT
@@ -47,6 +48,7 @@ public:
     void setIteratorFromOffset(SampleVector::iterator& iterator, int offset);
 
     void write(const Sample& sample);                        //!< write directly - phase 1 + phase 2
+    const FifoCounters& getCounters() const { return m_counters; } //!< underruns: old samples replayed, overflows: samples overwritten before being read
 
     /** returns ratio of off center over buffer size with sign: negative read lags and positive read leads */
     float getRWBalance() const
@@ -66,7 +68,11 @@ private:
     uint32_t m_iw;
     uint32_t m_ir;
     bool m_init;
+    uint32_t m_unread; //!< samples written and not read yet
     QMutex m_mutex;
+    FifoCounters m_counters;
+
+    void written();
 
 signals:
     void dataWrite(int nbSamples); // signal data is read past a threshold and writing new samples to fill in is needed
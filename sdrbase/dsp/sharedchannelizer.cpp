@@ -0,0 +1,298 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+
+#include <QDebug>
+
+#include "dsp/dspengine.h"
+#include "dsp/fftfactory.h"
+#include "dsp/fftengine.h"
+#include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinkring.h"
+#include "dsp/wfir.h"
+#include "sharedchannelizer.h"
+
+SharedChannelizer::SharedChannelizer(unsigned int log2NbBands, unsigned int tapsPerBand) :
+    m_nbBands(1 << log2NbBands),
+    m_decimation(1 << (log2NbBands - 1)),
+    m_tapsPerBand(tapsPerBand),
+    m_nbTaps((1 << log2NbBands) * tapsPerBand),
+    m_basebandSampleRate(0),
+    m_historyIndex(0),
+    m_inputCount(0),
+    m_oddOutput(false),
+    m_fft(nullptr),
+    m_fftSequence(0),
+    m_nbFrames(0),
+    m_bandRings(1 << log2NbBands, nullptr),
+    m_bandBuffers(1 << log2NbBands),
+    m_nbSubscribers(0)
+{
+    m_history.resize(2*m_nbTaps);
+    createPrototypeFilter();
+}
+
+SharedChannelizer::~SharedChannelizer()
+{
+    for (std::vector<SampleSinkRing*>::iterator it = m_bandRings.begin(); it != m_bandRings.end(); ++it) {
+        delete *it;
+    }
+
+    if (m_fft) {
+        DSPEngine::instance()->getFFTFactory()->releaseEngine(m_nbBands, true, m_fftSequence, m_fftBatch);
+    }
+}
+
+void SharedChannelizer::createPrototypeFilter()
+{
+    // Low pass cut at the sub-band spacing (fs/M) i.e. the Nyquist frequency of the 2x oversampled sub-band.
+    // Kaiser window gives a flat response up to ~0.8 fs/M with P=16 taps per band
+    std::vector<double> taps(m_nbTaps);
+    WFIR::BasicFIR(taps.data(), m_nbTaps, WFIR::LPF, 2.0 / m_nbBands, 0, WFIR::wtKAISER, 8.0);
+    double sum = 0.0;
+
+    for (unsigned int i = 0; i < m_nbTaps; i++) {
+        sum += taps[i];
+    }
+
+    m_taps.resize(m_nbTaps);
+
+    for (unsigned int i = 0; i < m_nbTaps; i++) {
+        m_taps[i] = taps[m_nbTaps - 1 - i] / sum; // unity gain and time reversed to match history order
+    }
+}
+
+void SharedChannelizer::setBasebandSampleRate(int basebandSampleRate)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (basebandSampleRate == m_basebandSampleRate) {
+        return;
+    }
+
+    m_basebandSampleRate = basebandSampleRate;
+    std::fill(m_history.begin(), m_history.end(), Complex{0.0f, 0.0f});
+    m_historyIndex = 0;
+    m_inputCount = 0;
+    m_oddOutput = false;
+
+    for (std::vector<SampleSinkRing*>::iterator it = m_bandRings.begin(); it != m_bandRings.end(); ++it)
+    {
+        if (*it) {
+            (*it)->setSize(getBandRingSize());
+        }
+    }
+
+    qDebug("SharedChannelizer::setBasebandSampleRate: %d S/s %u bands of %d S/s",
+        m_basebandSampleRate, m_nbBands, getBandSampleRate());
+}
+
+unsigned int SharedChannelizer::getBandRingSize() const
+{
+    return SampleSinkFifo::getSizePolicy(getBandSampleRate());
+}
+
+int SharedChannelizer::getBandCenterFrequency(unsigned int band) const
+{
+    int bandSpacing = m_basebandSampleRate / (int) m_nbBands;
+    return band < m_nbBands/2 ? band * bandSpacing : ((int) band - (int) m_nbBands) * bandSpacing;
+}
+
+bool SharedChannelizer::subscribe(
+    SampleSinkRingReader *reader,
+    qint64 centerFrequency,
+    int bandwidth,
+    int& bandSampleRate,
+    int& bandFrequencyOffset)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_basebandSampleRate == 0)
+    {
+        removeSubscription(reader);
+        return false;
+    }
+
+    double bandSpacing = m_basebandSampleRate / (double) m_nbBands;
+    int band = (int) std::round(centerFrequency / bandSpacing);
+    double offset = centerFrequency - band * bandSpacing;
+
+    // channel must lie within the flat part of the sub-band
+    if ((std::abs(offset) + bandwidth / 2.0 > 0.8 * bandSpacing) || (std::abs(band) > (int) m_nbBands/2 - 1))
+    {
+        qDebug("SharedChannelizer::subscribe: channel %lld (BW %d) does not fit in a %.0f Hz sub-band",
+            centerFrequency, bandwidth, bandSpacing);
+        removeSubscription(reader);
+        return false;
+    }
+
+    unsigned int bandIndex = band < 0 ? band + m_nbBands : band;
+    std::map<SampleSinkRingReader*, unsigned int>::iterator it = m_subscriptions.find(reader);
+
+    if ((it == m_subscriptions.end()) || (it->second != bandIndex))
+    {
+        removeSubscription(reader);
+
+        if (!m_fft) {
+            m_fftSequence = DSPEngine::instance()->getFFTFactory()->getEngine(m_nbBands, true, &m_fft, m_fftBatch);
+        }
+
+        if (!m_bandRings[bandIndex]) {
+            m_bandRings[bandIndex] = new SampleSinkRing();
+        }
+
+        m_bandRings[bandIndex]->setSize(getBandRingSize());
+        m_bandRings[bandIndex]->attach(reader);
+        m_subscriptions[reader] = bandIndex;
+        m_nbSubscribers.storeRelease(m_subscriptions.size());
+    }
+
+    bandSampleRate = getBandSampleRate();
+    bandFrequencyOffset = centerFrequency - getBandCenterFrequency(bandIndex);
+
+    qDebug("SharedChannelizer::subscribe: band %u rate: %d offset: %d subscribers: %lu",
+        bandIndex, bandSampleRate, bandFrequencyOffset, m_subscriptions.size());
+
+    return true;
+}
+
+void SharedChannelizer::unsubscribe(SampleSinkRingReader *reader)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    removeSubscription(reader);
+}
+
+void SharedChannelizer::removeSubscription(SampleSinkRingReader *reader)
+{
+    std::map<SampleSinkRingReader*, unsigned int>::iterator it = m_subscriptions.find(reader);
+
+    if (it == m_subscriptions.end()) {
+        return;
+    }
+
+    m_bandRings[it->second]->detach(reader);
+    m_subscriptions.erase(it);
+    m_nbSubscribers.storeRelease(m_subscriptions.size());
+}
+
+void SharedChannelizer::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    QMutexLocker mutexLocker(&m_mutex); // once per block, only contended on subscription changes
+
+    if (!m_fft || (m_subscriptions.size() == 0)) {
+        return;
+    }
+
+    for (SampleVector::const_iterator it = begin; it != end; ++it)
+    {
+        Complex c(it->m_real, it->m_imag);
+        m_history[m_historyIndex] = c;
+        m_history[m_historyIndex + m_nbTaps] = c;
+        m_historyIndex = (m_historyIndex + 1) % m_nbTaps;
+
+        if (++m_inputCount < m_decimation) {
+            continue;
+        }
+
+        m_inputCount = 0;
+        computePartition(m_fft->in() + m_nbFrames * m_nbBands);
+
+        if (++m_nbFrames == m_fftBatch) {
+            computeBands();
+        }
+    }
+
+    if (m_nbFrames > 0) { // remainder of the block
+        computeBands();
+    }
+
+    for (unsigned int band = 0; band < m_nbBands; band++)
+    {
+        SampleVector& buffer = m_bandBuffers[band];
+
+        if (buffer.size() > 0)
+        {
+            m_bandRings[band]->write(buffer.begin(), buffer.end());
+            buffer.clear();
+        }
+    }
+}
+
+void SharedChannelizer::computePartition(Complex *u)
+{
+    // window of the last L samples in chronological order
+    const Complex *window = &m_history[m_historyIndex];
+
+    // polyphase partition: u[r] = sum_p h[r + pM] x[n - r - pM]
+    for (unsigned int r = 0; r < m_nbBands; r++)
+    {
+        float re = 0.0f, im = 0.0f;
+
+        for (unsigned int p = 0; p < m_tapsPerBand; p++)
+        {
+            unsigned int j = m_nbTaps - 1 - r - p*m_nbBands;
+            re += m_taps[j] * window[j].real();
+            im += m_taps[j] * window[j].imag();
+        }
+
+        u[r] = Complex{re, im};
+    }
+}
+
+void SharedChannelizer::computeBands()
+{
+    // one batched transform for all the frames collected. Unused frames of the batch are ignored.
+    m_fft->transform();
+
+    for (unsigned int frame = 0; frame < m_nbFrames; frame++)
+    {
+        const Complex *y = m_fft->out() + frame * m_nbBands;
+
+        // with a decimation of M/2 the band rotation reduces to (-1)^(k*n) up to a constant phase per band
+        for (unsigned int band = 0; band < m_nbBands; band++)
+        {
+            if (!m_bandRings[band] || (m_bandRings[band]->getNbReaders() == 0)) {
+                continue;
+            }
+
+            Complex s = (m_oddOutput && (band & 1)) ? -y[band] : y[band];
+            m_bandBuffers[band].push_back(Sample(s.real(), s.imag()));
+        }
+
+        m_oddOutput = !m_oddOutput;
+    }
+
+    m_nbFrames = 0;
+}
+
+void SharedChannelizer::notify()
+{
+    if (!isActive()) {
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    for (std::vector<SampleSinkRing*>::iterator it = m_bandRings.begin(); it != m_bandRings.end(); ++it)
+    {
+        if (*it) {
+            (*it)->notify();
+        }
+    }
+}
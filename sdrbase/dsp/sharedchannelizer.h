@@ -0,0 +1,101 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SHAREDCHANNELIZER_H
+#define SDRBASE_DSP_SHAREDCHANNELIZER_H
+
+#include <map>
+#include <vector>
+
+#include <QMutex>
+#include <QAtomicInt>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+class FFTEngine;
+class SampleSinkRing;
+class SampleSinkRingReader;
+
+/**
+ * Device set level channelizer shared by all channels of a wideband source.
+ *
+ * This is a 2x oversampled polyphase FFT filter bank: the baseband is split in M sub-bands spaced
+ * by fs/M and each sub-band is output at 2*fs/M. The filter bank is computed once per baseband block
+ * whatever the number of channels so the per sample cost does not depend on the channel count.
+ * A channel subscribes with its center frequency and bandwidth and is attached to the nearest
+ * sub-band that fully contains it. It then receives the sub-band samples through a SampleSinkRingReader
+ * and is left with a small residual frequency shift and rate conversion (its own NCO and interpolator).
+ *
+ * All methods are called from the device engine thread which is the writer of the sub-band rings.
+ * Channels post DSPSharedChannelizerSubscribe to the engine and get the outcome back asynchronously.
+ */
+class SDRBASE_API SharedChannelizer
+{
+public:
+    SharedChannelizer(unsigned int log2NbBands = 6, unsigned int tapsPerBand = 16);
+    ~SharedChannelizer();
+
+    void setBasebandSampleRate(int basebandSampleRate);
+    int getBasebandSampleRate() const { return m_basebandSampleRate; }
+    unsigned int getNbBands() const { return m_nbBands; }
+    int getBandSampleRate() const { return (2 * m_basebandSampleRate) / (int) m_nbBands; }
+    bool isActive() const { return m_nbSubscribers.loadAcquire() > 0; }
+
+    void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    void notify();
+
+    /**
+     * Attach reader to the sub-band containing the channel [centerFrequency - bandwidth/2, centerFrequency + bandwidth/2].
+     * Returns false if no sub-band fits in which case the channel should use its own DownChannelizer.
+     * On success bandSampleRate and bandFrequencyOffset give the channel sample rate and the residual shift of the channel
+     * in the sub-band (same meaning as DownChannelizer getChannelSampleRate and getChannelFrequencyOffset)
+     */
+    bool subscribe(SampleSinkRingReader *reader, qint64 centerFrequency, int bandwidth, int& bandSampleRate, int& bandFrequencyOffset);
+    void unsubscribe(SampleSinkRingReader *reader);
+
+private:
+    unsigned int m_nbBands;       //!< M
+    unsigned int m_decimation;    //!< M/2
+    unsigned int m_tapsPerBand;   //!< P
+    unsigned int m_nbTaps;        //!< L = M*P
+    int m_basebandSampleRate;
+    std::vector<float> m_taps;    //!< prototype low pass filter time reversed
+    std::vector<Complex> m_history; //!< doubled circular buffer of the last L input samples
+    unsigned int m_historyIndex;
+    unsigned int m_inputCount;    //!< samples received since last output
+    bool m_oddOutput;             //!< output index parity for the (-1)^(k*n) band rotation
+    FFTEngine *m_fft;             //!< batched inverse FFT of m_fftBatch frames
+    unsigned int m_fftSequence;
+    unsigned int m_nbFrames;      //!< frames (filter bank outputs) collected in the FFT batch
+    std::vector<SampleSinkRing*> m_bandRings;     //!< ring per sub-band (allocated when subscribed)
+    std::vector<SampleVector> m_bandBuffers;      //!< sub-band samples produced by the current block
+    std::map<SampleSinkRingReader*, unsigned int> m_subscriptions;
+    QAtomicInt m_nbSubscribers;
+    QMutex m_mutex;
+
+    void createPrototypeFilter();
+    void computePartition(Complex *u);
+    void computeBands();
+    void removeSubscription(SampleSinkRingReader *reader);
+
+    static const unsigned int m_fftBatch = 16; //!< filter bank outputs transformed at once
+    int getBandCenterFrequency(unsigned int band) const;
+    unsigned int getBandRingSize() const;
+};
+
+#endif // SDRBASE_DSP_SHAREDCHANNELIZER_H
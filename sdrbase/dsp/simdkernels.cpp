@@ -0,0 +1,65 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "simdkernels.h"
+#include "simdkernelsimpl.h"
+
+// Generic kernels compiled with the baseline flags of the build (SSE2 on x86)
+SIMDKERNELS_DEFINE_FILL(simdKernelsFillGeneric)
+
+#ifdef SIMDKERNELS_X86
+void simdKernelsFillSSE41(SIMDKernels& kernels);
+void simdKernelsFillAVX2(SIMDKernels& kernels);
+void simdKernelsFillAVX512(SIMDKernels& kernels);
+#endif
+
+const SIMDKernels& SIMDKernels::instance()
+{
+    static SIMDKernels kernels;
+    return kernels;
+}
+
+SIMDKernels::SIMDKernels()
+{
+    CPUFeatures::SIMDPath cpuPath = CPUFeatures::instance().getSIMDPath();
+    simdKernelsFillGeneric(*this);
+    path = cpuPath >= CPUFeatures::SIMDSSE2 ? CPUFeatures::SIMDSSE2 : CPUFeatures::SIMDGeneric;
+
+#ifdef SIMDKERNELS_X86
+    switch (cpuPath)
+    {
+    case CPUFeatures::SIMDAVX512:
+        simdKernelsFillAVX512(*this);
+        path = cpuPath;
+        break;
+    case CPUFeatures::SIMDAVX2:
+        simdKernelsFillAVX2(*this);
+        path = cpuPath;
+        break;
+    case CPUFeatures::SIMDSSE41:
+        simdKernelsFillSSE41(*this);
+        path = cpuPath;
+        break;
+    default:
+        break;
+    }
+#endif
+
+    qDebug("SIMDKernels::SIMDKernels: using %s kernels", qPrintable(CPUFeatures::getSIMDPathName(path)));
+}
@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SIMDKERNELS_H
+#define SDRBASE_DSP_SIMDKERNELS_H
+
+#include <stdint.h>
+
+#include "dsp/cpufeatures.h"
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+/**
+ * Table of the DSP kernels selected at runtime for the SIMD path of the CPU (see CPUFeatures).
+ * Each kernel is compiled once per SIMD path from the same source (simdkernelsimpl.h) in a
+ * translation unit built with the corresponding instruction set flags so that a binary built
+ * for the lowest common denominator still runs the wide kernels where available.
+ * The table is filled once on first use and is read only afterwards.
+ *
+ * The per sample half-band filters of the device Decimators and Interpolators (IntHalfbandFilterEO,
+ * IntHalfbandFilterST and their USE_SSE4_1 intrinsics) are not dispatched here: they compute one
+ * output per call where an indirect call would cost more than it saves. Their SIMD path is still
+ * the one of the build flags (see FindCPUflags). Block processing as in IntHalfbandFilterBlock
+ * would be needed first.
+ */
+struct SDRBASE_API SIMDKernels
+{
+    /**
+     * Symmetric FIR accumulation over a block of nbOut outputs:
+     * acc[k] += sum over i in [0, nbCoeffs) of coeffs[i] * (newest[k - i] + oldest[k + i])
+     * This is the half-band filter core with the taps applied to the samples in planar buffers.
+     */
+    typedef void (*SymmetricFIR32)(int32_t *acc, const int32_t *newest, const int32_t *oldest,
+        const int32_t *coeffs, int nbCoeffs, int nbOut);
+    typedef void (*SymmetricFIR64)(int64_t *acc, const int32_t *newest, const int32_t *oldest,
+        const int32_t *coeffs, int nbCoeffs, int nbOut);
+
+    /**
+     * NCO table lookup over a block of n samples. iq holds n complex samples as interleaved floats
+     * and phases the n table indexes. The NCO value at phase p is table[p] - j * table[(p + (mask+1)/4) & mask]
+     * TableIQ writes the NCO values to iq and TableMulIQ multiplies iq by them.
+     */
+    typedef void (*TableIQ)(float *iq, const int32_t *phases, int n, const float *table, int32_t mask);
+
+    /**
+     * Polyphase FIR over a block of nbOut complex outputs (interleaved floats). Output k is the dot product
+     * of the nbTaps complex samples of iq starting at sample offsets[k] with the taps of phase phases[k].
+     * Taps are stored per phase as 2*nbTaps floats with each tap duplicated for I and Q. nbTaps is a multiple of 8.
+     */
+    typedef void (*PolyphaseIQ)(float *out, const float *iq, const int32_t *offsets, const int32_t *phases, int nbOut,
+        const float *taps, int nbTaps);
+
+    /**
+     * Complex multiply over a block of n complex samples (interleaved floats): out[k] = a[k] * b[k].
+     * out does not overlap a nor b. This is the fast convolution core with b the filter spectrum.
+     */
+    typedef void (*MulIQ)(float *out, const float *a, const float *b, int n);
+
+    /**
+     * Spectrum stages over blocks of n bins. iq holds complex samples as interleaved floats, other buffers are
+     * planar (one value per bin). Output buffers do not overlap inputs.
+     * PowerIQ: out[k] = |iq[k]|^2
+     * PowerDB: out[k] = mult * log2(in[k]) + ofs with a fast approximation of log2 (accurate to about 1e-5 dB)
+     * ScaleF: out[k] = in[k] * scale
+     * MovingSum: sum[k] += in[k] - slot[k], slot[k] = in[k], out[k] = sum[k] (moving average window slot)
+     * AccumulateF: acc[k] += in[k]
+     * MaxF: acc[k] = max(acc[k], in[k])
+     */
+    typedef void (*PowerIQ)(float *out, const float *iq, int n);
+    typedef void (*PowerDB)(float *out, const float *in, int n, float mult, float ofs);
+    typedef void (*ScaleF)(float *out, const float *in, int n, float scale);
+    typedef void (*MovingSum)(float *out, double *sum, float *slot, const float *in, int n);
+    typedef void (*AccumulateF)(float *acc, const float *in, int n);
+
+    /**
+     * Sample packing of the recording formats (see RecordFormat) over n complex samples. Samples are
+     * interleaved I/Q FixReal values of the build.
+     * Pack12: 12 bit I and Q in 3 bytes from in >> shift rounded. Unpack12 gives back the 12 bit values << shift
+     * Pack8: 8 bit I and Q from in >> shift rounded. Unpack8 gives back the 8 bit values << shift (>> -shift if negative)
+     * MaxAbs: largest magnitude of the I and Q values
+     * PackF32: float I and Q = in * scale. UnpackF32: in * scale rounded and clipped to the FixReal range
+     */
+    typedef void (*Pack12)(uint8_t *out, const FixReal *in, int n, int shift);
+    typedef void (*Unpack12)(FixReal *out, const uint8_t *in, int n, int shift);
+    typedef void (*Pack8)(int8_t *out, const FixReal *in, int n, int shift);
+    typedef void (*Unpack8)(FixReal *out, const int8_t *in, int n, int shift);
+    typedef int32_t (*MaxAbs)(const FixReal *in, int n);
+    typedef void (*PackF32)(float *out, const FixReal *in, int n, float scale);
+    typedef void (*UnpackF32)(FixReal *out, const float *in, int n, float scale);
+
+    SymmetricFIR32 symmetricFIR32; //!< 32 bit accumulator (16 bit samples)
+    SymmetricFIR64 symmetricFIR64; //!< 64 bit accumulator (24 bit samples)
+    TableIQ tableIQ;               //!< NCO values
+    TableIQ tableMulIQ;            //!< mix with NCO values
+    PolyphaseIQ polyphaseIQ;       //!< polyphase resampler filter
+    MulIQ mulIQ;                   //!< complex multiply
+    PowerIQ powerIQ;               //!< squared magnitude
+    PowerDB powerDB;               //!< power to dB
+    ScaleF scaleF;                 //!< scaling
+    MovingSum movingSum;           //!< moving sum
+    AccumulateF accumulateF;       //!< sum
+    AccumulateF maxF;              //!< maximum
+    Pack12 pack12;                 //!< 12 bit packing
+    Unpack12 unpack12;             //!< 12 bit unpacking
+    Pack8 pack8;                   //!< 8 bit packing
+    Unpack8 unpack8;               //!< 8 bit unpacking
+    MaxAbs maxAbs;                 //!< block peak for 8 bit scaling
+    PackF32 packF32;               //!< to float
+    UnpackF32 unpackF32;           //!< from float
+    CPUFeatures::SIMDPath path;    //!< SIMD path of the kernels in this table
+
+    static const SIMDKernels& instance();
+
+private:
+    SIMDKernels();
+};
+
+#endif // SDRBASE_DSP_SIMDKERNELS_H
@@ -0,0 +1,24 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+// Kernels of the AVX-512 (F, BW, DQ and VL) SIMD path. This file is compiled with the AVX-512 (F, BW, DQ and VL) instruction set
+// flags (see sdrbase/CMakeLists.txt) and must only be called after runtime detection.
+
+#include "simdkernels.h"
+#include "simdkernelsimpl.h"
+
+SIMDKERNELS_DEFINE_FILL(simdKernelsFillAVX512)
@@ -0,0 +1,373 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+// Source of the runtime dispatched kernels. This file is included by one translation unit
+// per SIMD path each compiled with its own instruction set flags. Everything here has
+// internal linkage so that the differently compiled copies never get merged by the linker.
+// Loops are written so that the compiler vectorizes them: unit stride over the output index
+// in the inner loop and no aliasing between the accumulator and the sample planes.
+
+#ifndef SDRBASE_DSP_SIMDKERNELSIMPL_H
+#define SDRBASE_DSP_SIMDKERNELSIMPL_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "dsp/dsptypes.h"
+
+#if defined(_MSC_VER)
+#define SIMDKERNELS_RESTRICT __restrict
+#else
+#define SIMDKERNELS_RESTRICT __restrict__
+#endif
+
+namespace {
+
+template<typename AccuType>
+void symmetricFIR(AccuType * SIMDKERNELS_RESTRICT acc, const int32_t *newest, const int32_t *oldest,
+    const int32_t *coeffs, int nbCoeffs, int nbOut)
+{
+    for (int i = 0; i < nbCoeffs; i++)
+    {
+        const AccuType coeff = coeffs[i];
+        const int32_t * SIMDKERNELS_RESTRICT tip = newest - i;
+        const int32_t * SIMDKERNELS_RESTRICT tail = oldest + i;
+
+        for (int k = 0; k < nbOut; k++) {
+            acc[k] += ((int32_t) (tip[k] + tail[k])) * coeff;
+        }
+    }
+}
+
+void symmetricFIR32Impl(int32_t *acc, const int32_t *newest, const int32_t *oldest,
+    const int32_t *coeffs, int nbCoeffs, int nbOut)
+{
+    symmetricFIR<int32_t>(acc, newest, oldest, coeffs, nbCoeffs, nbOut);
+}
+
+void symmetricFIR64Impl(int64_t *acc, const int32_t *newest, const int32_t *oldest,
+    const int32_t *coeffs, int nbCoeffs, int nbOut)
+{
+#if defined(__SSE4_1__) || defined(__AVX2__) || !(defined(__x86_64__) || defined(_M_X64) || defined(__i386__))
+    symmetricFIR<int64_t>(acc, newest, oldest, coeffs, nbCoeffs, nbOut);
+#else
+    // SSE2 has no signed 32x32->64 multiply so the 64 bit accumulation would not be vectorized.
+    // It is done in double precision instead: the products of 25 bit sample sums by the half-band
+    // coefficients and their sums stay well below 2^53 so they are exact and the result is the same.
+    double sum[256];
+
+    for (int k0 = 0; k0 < nbOut; k0 += 256)
+    {
+        const int n = nbOut - k0 < 256 ? nbOut - k0 : 256;
+
+        for (int k = 0; k < n; k++) {
+            sum[k] = (double) acc[k0 + k];
+        }
+
+        symmetricFIR<double>(sum, newest + k0, oldest + k0, coeffs, nbCoeffs, n);
+
+        for (int k = 0; k < n; k++) {
+            acc[k0 + k] = (int64_t) sum[k];
+        }
+    }
+#endif
+}
+
+// NCO table lookup. iq is an array of n interleaved complex samples (std::complex layout) and
+// phases an array of n table indexes. The complex value at phase p is (cos, -sin) read from the
+// cosine table at p and p + 1/4 turn.
+
+void tableIQImpl(float * SIMDKERNELS_RESTRICT iq, const int32_t * SIMDKERNELS_RESTRICT phases, int n,
+    const float * SIMDKERNELS_RESTRICT table, int32_t mask)
+{
+    const int32_t quarter = (mask + 1) / 4;
+
+    for (int k = 0; k < n; k++)
+    {
+        const int32_t p = phases[k];
+        iq[2*k] = table[p];
+        iq[2*k + 1] = -table[(p + quarter) & mask];
+    }
+}
+
+void tableMulIQImpl(float * SIMDKERNELS_RESTRICT iq, const int32_t * SIMDKERNELS_RESTRICT phases, int n,
+    const float * SIMDKERNELS_RESTRICT table, int32_t mask)
+{
+    const int32_t quarter = (mask + 1) / 4;
+
+    for (int k = 0; k < n; k++)
+    {
+        const int32_t p = phases[k];
+        const float u = table[p];
+        const float v = -table[(p + quarter) & mask];
+        const float x = iq[2*k];
+        const float y = iq[2*k + 1];
+        iq[2*k] = x*u - y*v;
+        iq[2*k + 1] = x*v + y*u;
+    }
+}
+
+// Polyphase resampler filter. Each dot product is accumulated in 16 independent float lanes
+// (8 complex samples) so that the compiler maps them to vector registers of any width and the
+// summation order, hence the result, is the same on every SIMD path.
+
+void polyphaseIQImpl(float * SIMDKERNELS_RESTRICT out, const float * SIMDKERNELS_RESTRICT iq,
+    const int32_t * SIMDKERNELS_RESTRICT offsets, const int32_t * SIMDKERNELS_RESTRICT phases, int nbOut,
+    const float * SIMDKERNELS_RESTRICT taps, int nbTaps)
+{
+    for (int k = 0; k < nbOut; k++)
+    {
+        const float * SIMDKERNELS_RESTRICT x = iq + 2 * offsets[k];
+        const float * SIMDKERNELS_RESTRICT h = taps + 2 * phases[k] * nbTaps;
+        float acc[16];
+
+        for (int l = 0; l < 16; l++) {
+            acc[l] = 0.0f;
+        }
+
+        for (int i = 0; i < 2 * nbTaps; i += 16)
+        {
+            for (int l = 0; l < 16; l++) {
+                acc[l] += h[i + l] * x[i + l];
+            }
+        }
+
+        for (int l = 0; l < 8; l++) {
+            acc[l] += acc[l + 8];
+        }
+        for (int l = 0; l < 4; l++) {
+            acc[l] += acc[l + 4];
+        }
+
+        out[2*k] = acc[0] + acc[2];
+        out[2*k + 1] = acc[1] + acc[3];
+    }
+}
+
+// Complex multiply of two arrays of n interleaved complex samples into a third one
+
+void mulIQImpl(float * SIMDKERNELS_RESTRICT out, const float * SIMDKERNELS_RESTRICT a,
+    const float * SIMDKERNELS_RESTRICT b, int n)
+{
+    for (int k = 0; k < n; k++)
+    {
+        const float x = a[2*k];
+        const float y = a[2*k + 1];
+        const float u = b[2*k];
+        const float v = b[2*k + 1];
+        out[2*k] = x*u - y*v;
+        out[2*k + 1] = x*v + y*u;
+    }
+}
+
+// Spectrum stages. The log2 approximation splits the float in exponent and mantissa with the
+// mantissa brought into [sqrt(1/2), sqrt(2)) then uses the odd series of 2*atanh((m-1)/(m+1))/ln(2)
+// up to the 7th power. It works on the float bits with integer arithmetic and has no table lookup
+// nor branch so that it vectorizes. Zero gives -127.
+
+inline float fastLog2(float x)
+{
+    int32_t bits;
+    memcpy(&bits, &x, sizeof(float));
+    const int32_t mantissa = bits & 0x007fffff;
+    const int32_t high = mantissa > 0x003504f3; // mantissa of sqrt(2)
+    const int32_t e = ((bits >> 23) & 0xff) - 127 + high;
+    bits = mantissa | ((127 - high) << 23);
+    float m;
+    memcpy(&m, &bits, sizeof(float));
+    const float s = (m - 1.0f) / (m + 1.0f);
+    const float s2 = s * s;
+    return (float) e + s * (2.88539008f + s2 * (0.961796694f + s2 * (0.577078016f + s2 * 0.412198583f)));
+}
+
+void powerIQImpl(float * SIMDKERNELS_RESTRICT out, const float * SIMDKERNELS_RESTRICT iq, int n)
+{
+    for (int k = 0; k < n; k++) {
+        out[k] = iq[2*k] * iq[2*k] + iq[2*k + 1] * iq[2*k + 1];
+    }
+}
+
+void powerDBImpl(float * SIMDKERNELS_RESTRICT out, const float * SIMDKERNELS_RESTRICT in, int n, float mult, float ofs)
+{
+    for (int k = 0; k < n; k++) {
+        out[k] = mult * fastLog2(in[k]) + ofs;
+    }
+}
+
+void scaleFImpl(float * SIMDKERNELS_RESTRICT out, const float * SIMDKERNELS_RESTRICT in, int n, float scale)
+{
+    for (int k = 0; k < n; k++) {
+        out[k] = in[k] * scale;
+    }
+}
+
+void movingSumImpl(float * SIMDKERNELS_RESTRICT out, double * SIMDKERNELS_RESTRICT sum,
+    float * SIMDKERNELS_RESTRICT slot, const float * SIMDKERNELS_RESTRICT in, int n)
+{
+    for (int k = 0; k < n; k++)
+    {
+        sum[k] += (double) in[k] - (double) slot[k]; // double sum so that it does not drift
+        slot[k] = in[k];
+        out[k] = (float) sum[k];
+    }
+}
+
+void accumulateFImpl(float * SIMDKERNELS_RESTRICT acc, const float * SIMDKERNELS_RESTRICT in, int n)
+{
+    for (int k = 0; k < n; k++) {
+        acc[k] += in[k];
+    }
+}
+
+void maxFImpl(float * SIMDKERNELS_RESTRICT acc, const float * SIMDKERNELS_RESTRICT in, int n)
+{
+    for (int k = 0; k < n; k++) {
+        acc[k] = in[k] > acc[k] ? in[k] : acc[k];
+    }
+}
+
+// Recording formats packing. Rounding and clipping use min/max and masks so that the loops
+// vectorize. Left shifts of signed values are written as multiplications.
+
+void pack12Impl(uint8_t * SIMDKERNELS_RESTRICT out, const FixReal * SIMDKERNELS_RESTRICT in, int n, int shift)
+{
+    const int32_t half = shift > 0 ? 1 << (shift - 1) : 0;
+
+    for (int k = 0; k < n; k++)
+    {
+        int32_t i = ((int32_t) in[2*k] + half) >> shift;
+        int32_t q = ((int32_t) in[2*k + 1] + half) >> shift;
+        i = i > 2047 ? 2047 : i;
+        q = q > 2047 ? 2047 : q;
+        out[3*k] = i & 0xff;
+        out[3*k + 1] = ((i >> 8) & 0x0f) | ((q & 0x0f) << 4);
+        out[3*k + 2] = (q >> 4) & 0xff;
+    }
+}
+
+void unpack12Impl(FixReal * SIMDKERNELS_RESTRICT out, const uint8_t * SIMDKERNELS_RESTRICT in, int n, int shift)
+{
+    const int32_t mult = 1 << shift;
+
+    for (int k = 0; k < n; k++)
+    {
+        const uint32_t b0 = in[3*k];
+        const uint32_t b1 = in[3*k + 1];
+        const uint32_t b2 = in[3*k + 2];
+        const int32_t i = ((int32_t) ((b0 | (b1 << 8)) << 20)) >> 20;
+        const int32_t q = ((int32_t) ((b1 | (b2 << 8)) << 16)) >> 20;
+        out[2*k] = i * mult;
+        out[2*k + 1] = q * mult;
+    }
+}
+
+void pack8Impl(int8_t * SIMDKERNELS_RESTRICT out, const FixReal * SIMDKERNELS_RESTRICT in, int n, int shift)
+{
+    const int32_t half = shift > 0 ? 1 << (shift - 1) : 0;
+    const int32_t fullScale = (((int32_t) SDR_RX_SCALEF) - 1) >> shift; // rounding must not overflow when unpacked
+    const int32_t high = fullScale < 127 ? fullScale : 127;
+
+    for (int k = 0; k < 2*n; k++)
+    {
+        int32_t v = ((int32_t) in[k] + half) >> shift;
+        v = v > high ? high : v;
+        v = v < -128 ? -128 : v;
+        out[k] = (int8_t) v;
+    }
+}
+
+void unpack8Impl(FixReal * SIMDKERNELS_RESTRICT out, const int8_t * SIMDKERNELS_RESTRICT in, int n, int shift)
+{
+    if (shift < 0)
+    {
+        for (int k = 0; k < 2*n; k++) {
+            out[k] = ((int32_t) in[k]) >> -shift;
+        }
+    }
+    else
+    {
+        const int32_t mult = 1 << shift;
+
+        for (int k = 0; k < 2*n; k++) {
+            out[k] = ((int32_t) in[k]) * mult;
+        }
+    }
+}
+
+int32_t maxAbsImpl(const FixReal * SIMDKERNELS_RESTRICT in, int n)
+{
+    int32_t max = 0;
+
+    for (int k = 0; k < 2*n; k++)
+    {
+        const int32_t v = in[k] < 0 ? -(int32_t) in[k] : (int32_t) in[k];
+        max = v > max ? v : max;
+    }
+
+    return max;
+}
+
+void packF32Impl(float * SIMDKERNELS_RESTRICT out, const FixReal * SIMDKERNELS_RESTRICT in, int n, float scale)
+{
+    for (int k = 0; k < 2*n; k++) {
+        out[k] = in[k] * scale;
+    }
+}
+
+void unpackF32Impl(FixReal * SIMDKERNELS_RESTRICT out, const float * SIMDKERNELS_RESTRICT in, int n, float scale)
+{
+    const float high = SDR_RX_SCALEF - 1.0f;
+    const float low = -SDR_RX_SCALEF;
+
+    for (int k = 0; k < 2*n; k++)
+    {
+        float v = in[k] * scale;
+        v += v < 0.0f ? -0.5f : 0.5f;
+        v = v > high ? high : v;
+        v = v < low ? low : v;
+        out[k] = (int32_t) v;
+    }
+}
+
+} // namespace
+
+/** Define the kernel table filler of a SIMD path */
+#define SIMDKERNELS_DEFINE_FILL(fillName) \
+    void fillName(SIMDKernels& kernels) \
+    { \
+        kernels.symmetricFIR32 = symmetricFIR32Impl; \
+        kernels.symmetricFIR64 = symmetricFIR64Impl; \
+        kernels.tableIQ = tableIQImpl; \
+        kernels.tableMulIQ = tableMulIQImpl; \
+        kernels.polyphaseIQ = polyphaseIQImpl; \
+        kernels.mulIQ = mulIQImpl; \
+        kernels.powerIQ = powerIQImpl; \
+        kernels.powerDB = powerDBImpl; \
+        kernels.scaleF = scaleFImpl; \
+        kernels.movingSum = movingSumImpl; \
+        kernels.accumulateF = accumulateFImpl; \
+        kernels.maxF = maxFImpl; \
+        kernels.pack12 = pack12Impl; \
+        kernels.unpack12 = unpack12Impl; \
+        kernels.pack8 = pack8Impl; \
+        kernels.unpack8 = unpack8Impl; \
+        kernels.maxAbs = maxAbsImpl; \
+        kernels.packF32 = packF32Impl; \
+        kernels.unpackF32 = unpackF32Impl; \
+    }
+
+#endif // SDRBASE_DSP_SIMDKERNELSIMPL_H
@@ -0,0 +1,276 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <QtEndian>
+#include <QDateTime>
+#include <QHostAddress>
+#include <QUdpSocket>
+#include <QWebSocketServer>
+#include <QWebSocket>
+#include <QDebug>
+
+#include "spectrumstreamer.h"
+
+const quint32 SpectrumStreamer::m_magic = 0x43455053; // "SPEC"
+const quint16 SpectrumStreamer::m_version = 1;
+const quint16 SpectrumStreamer::m_headerSize = 48;
+
+SpectrumStreamer::Settings::Settings()
+{
+    resetToDefaults();
+}
+
+void SpectrumStreamer::Settings::resetToDefaults()
+{
+    m_wsEnable = false;
+    m_wsAddress = "0.0.0.0";
+    m_wsPort = 8887;
+    m_udpEnable = false;
+    m_udpAddress = "127.0.0.1";
+    m_udpPort = 8886;
+    m_maxFrameRate = 25.0f;
+    m_maxBins = 0;
+    m_refLevel = 0.0f;
+    m_powerRange = 100.0f;
+}
+
+SpectrumStreamer::SpectrumStreamer(QObject *parent) :
+    QObject(parent),
+    m_centerFrequency(0),
+    m_sampleRate(0),
+    m_sequence(0),
+    m_streaming(0),
+    m_nbWebSocketClients(0),
+    m_webSocketServer(nullptr),
+    m_udpSocket(nullptr)
+{
+    connect(this, SIGNAL(frameReady(QByteArray)), this, SLOT(sendFrame(QByteArray)), Qt::QueuedConnection);
+}
+
+SpectrumStreamer::~SpectrumStreamer()
+{
+    stopWebSocketServer();
+    delete m_udpSocket;
+}
+
+SpectrumStreamer::Settings SpectrumStreamer::getSettings() const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_settings;
+}
+
+void SpectrumStreamer::applySettings(const Settings& settings)
+{
+    qDebug() << "SpectrumStreamer::applySettings:"
+        << " m_wsEnable: " << settings.m_wsEnable
+        << " m_wsAddress: " << settings.m_wsAddress
+        << " m_wsPort: " << settings.m_wsPort
+        << " m_udpEnable: " << settings.m_udpEnable
+        << " m_udpAddress: " << settings.m_udpAddress
+        << " m_udpPort: " << settings.m_udpPort
+        << " m_maxFrameRate: " << settings.m_maxFrameRate
+        << " m_maxBins: " << settings.m_maxBins
+        << " m_refLevel: " << settings.m_refLevel
+        << " m_powerRange: " << settings.m_powerRange;
+
+    bool restartWebSocket;
+
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        restartWebSocket = (settings.m_wsEnable != (m_webSocketServer != nullptr))
+            || (settings.m_wsAddress != m_settings.m_wsAddress)
+            || (settings.m_wsPort != m_settings.m_wsPort);
+        m_settings = settings;
+
+        if (m_settings.m_powerRange < 1.0f) {
+            m_settings.m_powerRange = 1.0f;
+        }
+
+        m_frameTimer.invalidate();
+    }
+
+    if (restartWebSocket)
+    {
+        stopWebSocketServer();
+
+        if (settings.m_wsEnable) {
+            startWebSocketServer();
+        }
+    }
+
+    if (settings.m_udpEnable && !m_udpSocket) {
+        m_udpSocket = new QUdpSocket(this);
+    } else if (!settings.m_udpEnable && m_udpSocket) {
+        delete m_udpSocket;
+        m_udpSocket = nullptr;
+    }
+
+    m_streaming.store(((m_webSocketServer != nullptr) || (m_udpSocket != nullptr)) ? 1 : 0);
+}
+
+void SpectrumStreamer::setSignal(qint64 centerFrequency, int sampleRate)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_centerFrequency = centerFrequency;
+    m_sampleRate = sampleRate;
+}
+
+void SpectrumStreamer::pushSpectrum(const std::vector<Real>& spectrum, int fftSize, bool linear)
+{
+    if (!isStreaming()) {
+        return;
+    }
+
+    QByteArray frame;
+
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+
+        if (m_settings.m_maxFrameRate > 0)
+        {
+            if (m_frameTimer.isValid() && (m_frameTimer.nsecsElapsed() < 1e9 / m_settings.m_maxFrameRate)) {
+                return;
+            }
+
+            m_frameTimer.start();
+        }
+
+        int maxBins = m_settings.m_maxBins;
+        int decimation = (maxBins > 0) && (fftSize > maxBins) ? (fftSize + maxBins - 1) / maxBins : 1;
+        int nbBins = fftSize / decimation;
+        frame.resize(m_headerSize + nbBins);
+        uchar *p = (uchar*) frame.data();
+        quint32 floatBits;
+
+        qToLittleEndian<quint32>(m_magic, p);
+        qToLittleEndian<quint16>(m_version, p + 4);
+        qToLittleEndian<quint16>(m_headerSize, p + 6);
+        qToLittleEndian<quint32>(nbBins, p + 8);
+        qToLittleEndian<quint32>(fftSize, p + 12);
+        qToLittleEndian<quint32>(m_sampleRate, p + 16);
+        qToLittleEndian<qint64>(m_centerFrequency, p + 20);
+        qToLittleEndian<quint64>(QDateTime::currentMSecsSinceEpoch(), p + 28);
+        std::memcpy(&floatBits, &m_settings.m_refLevel, sizeof(float));
+        qToLittleEndian<quint32>(floatBits, p + 36);
+        std::memcpy(&floatBits, &m_settings.m_powerRange, sizeof(float));
+        qToLittleEndian<quint32>(floatBits, p + 40);
+        qToLittleEndian<quint32>(m_sequence++, p + 44);
+
+        // quantize the maximum of each group of bins
+        uchar *bins = p + m_headerSize;
+        Real floor = m_settings.m_refLevel - m_settings.m_powerRange;
+        Real scale = 255.0f / m_settings.m_powerRange;
+
+        for (int i = 0; i < nbBins; i++)
+        {
+            const Real *group = &spectrum[i * decimation];
+            Real v = *std::max_element(group, group + decimation);
+
+            if (linear) {
+                v = 10.0f * log10f(v > 1e-20f ? v : 1e-20f);
+            }
+
+            Real q = (v - floor) * scale + 0.5f;
+            bins[i] = q < 0.0f ? 0 : q > 255.0f ? 255 : (uchar) q;
+        }
+    }
+
+    emit frameReady(frame);
+}
+
+void SpectrumStreamer::sendFrame(QByteArray frame)
+{
+    for (QWebSocket *client : m_webSocketClients) {
+        client->sendBinaryMessage(frame);
+    }
+
+    if (m_udpSocket)
+    {
+        Settings settings = getSettings();
+        m_udpSocket->writeDatagram(frame, QHostAddress(settings.m_udpAddress), settings.m_udpPort);
+    }
+}
+
+void SpectrumStreamer::startWebSocketServer()
+{
+    Settings settings = getSettings();
+    m_webSocketServer = new QWebSocketServer(QStringLiteral("SDRangel spectrum"), QWebSocketServer::NonSecureMode, this);
+
+    if (m_webSocketServer->listen(QHostAddress(settings.m_wsAddress), settings.m_wsPort))
+    {
+        qDebug("SpectrumStreamer::startWebSocketServer: listening on %s:%u",
+            qPrintable(settings.m_wsAddress), settings.m_wsPort);
+        connect(m_webSocketServer, SIGNAL(newConnection()), this, SLOT(onNewConnection()));
+    }
+    else
+    {
+        qWarning("SpectrumStreamer::startWebSocketServer: cannot listen on %s:%u: %s",
+            qPrintable(settings.m_wsAddress), settings.m_wsPort, qPrintable(m_webSocketServer->errorString()));
+        delete m_webSocketServer;
+        m_webSocketServer = nullptr;
+    }
+}
+
+void SpectrumStreamer::stopWebSocketServer()
+{
+    for (QWebSocket *client : m_webSocketClients)
+    {
+        disconnect(client, SIGNAL(disconnected()), this, SLOT(onDisconnected()));
+        client->close();
+        delete client;
+    }
+
+    m_webSocketClients.clear();
+    m_nbWebSocketClients.store(0);
+
+    if (m_webSocketServer)
+    {
+        m_webSocketServer->close();
+        delete m_webSocketServer;
+        m_webSocketServer = nullptr;
+    }
+}
+
+void SpectrumStreamer::onNewConnection()
+{
+    while (m_webSocketServer->hasPendingConnections())
+    {
+        QWebSocket *client = m_webSocketServer->nextPendingConnection();
+        qDebug() << "SpectrumStreamer::onNewConnection:" << client->peerAddress().toString() << ":" << client->peerPort();
+        connect(client, SIGNAL(disconnected()), this, SLOT(onDisconnected()));
+        m_webSocketClients.append(client);
+    }
+
+    m_nbWebSocketClients.store(m_webSocketClients.size());
+}
+
+void SpectrumStreamer::onDisconnected()
+{
+    QWebSocket *client = qobject_cast<QWebSocket*>(sender());
+
+    if (client)
+    {
+        qDebug() << "SpectrumStreamer::onDisconnected:" << client->peerAddress().toString() << ":" << client->peerPort();
+        m_webSocketClients.removeAll(client);
+        m_nbWebSocketClients.store(m_webSocketClients.size());
+        client->deleteLater();
+    }
+}
@@ -0,0 +1,125 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SPECTRUMSTREAMER_H_
+#define SDRBASE_DSP_SPECTRUMSTREAMER_H_
+
+#include <vector>
+
+#include <QObject>
+#include <QByteArray>
+#include <QString>
+#include <QList>
+#include <QMutex>
+#include <QAtomicInt>
+#include <QElapsedTimer>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+class QWebSocketServer;
+class QWebSocket;
+class QUdpSocket;
+
+/**
+ * Sends the spectrum frames of a SpectrumVis to remote clients over WebSocket (binary messages)
+ * and/or UDP (one datagram per frame) so that spectrum and waterfall can be displayed without
+ * a GUI instance per receiver.
+ *
+ * Each frame is a little endian header followed by one byte per bin that is the power quantized
+ * linearly from refLevel - powerRange dB (0) to refLevel dB (255):
+ *
+ * | Offset | Type    | Content                               |
+ * |--------|---------|---------------------------------------|
+ * | 0      | uint32  | magic "SPEC"                          |
+ * | 4      | uint16  | version (1)                           |
+ * | 6      | uint16  | header size in bytes (48)             |
+ * | 8      | uint32  | number of bins in this frame          |
+ * | 12     | uint32  | FFT size                              |
+ * | 16     | uint32  | sample rate (S/s)                     |
+ * | 20     | int64   | center frequency (Hz)                 |
+ * | 28     | uint64  | timestamp (ms since epoch)            |
+ * | 36     | float32 | reference level (dB)                  |
+ * | 40     | float32 | power range (dB)                      |
+ * | 44     | uint32  | frame sequence number                 |
+ *
+ * Frames are built in the DSP thread calling pushSpectrum and sent from the thread the streamer
+ * lives in. The frame rate is limited and bins are decimated (keeping the maximum) to the
+ * configured maximum number of bins.
+ */
+class SDRBASE_API SpectrumStreamer : public QObject
+{
+    Q_OBJECT
+public:
+    struct SDRBASE_API Settings
+    {
+        bool m_wsEnable;
+        QString m_wsAddress;    //!< WebSocket server listening address
+        uint16_t m_wsPort;
+        bool m_udpEnable;
+        QString m_udpAddress;   //!< UDP destination address (unicast, multicast or broadcast)
+        uint16_t m_udpPort;
+        float m_maxFrameRate;   //!< Frames per second. 0 for no limit
+        int m_maxBins;          //!< Maximum number of bins per frame. 0 for all FFT bins
+        Real m_refLevel;        //!< dB quantized to 255
+        Real m_powerRange;      //!< dB range of the quantization
+
+        Settings();
+        void resetToDefaults();
+    };
+
+    SpectrumStreamer(QObject *parent = nullptr);
+    ~SpectrumStreamer();
+
+    void applySettings(const Settings& settings); //!< From the streamer thread
+    Settings getSettings() const;
+    bool isStreaming() const { return m_streaming.load() != 0; }
+    int getNbWebSocketClients() const { return m_nbWebSocketClients.load(); }
+    void setSignal(qint64 centerFrequency, int sampleRate); //!< From any thread
+    void pushSpectrum(const std::vector<Real>& spectrum, int fftSize, bool linear); //!< From the DSP thread
+
+    static const quint32 m_magic;
+    static const quint16 m_version;
+    static const quint16 m_headerSize;
+
+signals:
+    void frameReady(QByteArray frame);
+
+private:
+    mutable QMutex m_mutex;     //!< Protects settings and signal characteristics shared with the DSP thread
+    Settings m_settings;
+    qint64 m_centerFrequency;
+    int m_sampleRate;
+    quint32 m_sequence;
+    QElapsedTimer m_frameTimer;
+    QAtomicInt m_streaming;
+    QAtomicInt m_nbWebSocketClients;
+
+    QWebSocketServer *m_webSocketServer;
+    QList<QWebSocket*> m_webSocketClients;
+    QUdpSocket *m_udpSocket;
+
+    void startWebSocketServer();
+    void stopWebSocketServer();
+
+private slots:
+    void sendFrame(QByteArray frame);
+    void onNewConnection();
+    void onDisconnected();
+};
+
+#endif // SDRBASE_DSP_SPECTRUMSTREAMER_H_
@@ -0,0 +1,416 @@
+#include "dsp/spectrumvis.h"
+#include "dsp/glspectruminterface.h"
+#include "dsp/dspcommands.h"
+#include "dsp/dspengine.h"
+#include "dsp/fftfactory.h"
+#include "dsp/simdkernels.h"
+#include "util/messagequeue.h"
+
+#define MAX_FFT_SIZE 4096
+
+#ifndef LINUX
+inline double log2f(double n)
+{
+	return log(n) / log(2.0);
+}
+#endif
+
+MESSAGE_CLASS_DEFINITION(SpectrumVis::MsgConfigureSpectrumVis, Message)
+MESSAGE_CLASS_DEFINITION(SpectrumVis::MsgConfigureScalingFactor, Message)
+MESSAGE_CLASS_DEFINITION(SpectrumVis::MsgConfigureSpectrumStreamer, Message)
+MESSAGE_CLASS_DEFINITION(SpectrumVis::MsgConfigureFrameRate, Message)
+
+const Real SpectrumVis::m_mult = (10.0f / log2f(10.0f));
+
+SpectrumVis::SpectrumVis(Real scalef, GLSpectrumInterface* glSpectrum) :
+	BasebandSampleSink(),
+	m_fft(nullptr),
+    m_fftEngineSequence(0),
+	m_fftBuffer(MAX_FFT_SIZE),
+	m_powerSpectrum(MAX_FFT_SIZE),
+	m_power(MAX_FFT_SIZE),
+	m_positiveSpectrum(MAX_FFT_SIZE / 2),
+	m_avgPower(MAX_FFT_SIZE),
+	m_avgSum(MAX_FFT_SIZE),
+	m_avgDepth(1),
+	m_avgIndex(0),
+	m_frameAgg(MAX_FFT_SIZE),
+	m_frameAggCount(0),
+	m_frameAggWidth(0),
+	m_frameRate(50),
+	m_frameAggMode(FrameAggMax),
+	m_kernels(&SIMDKernels::instance()),
+	m_fftBufferFill(0),
+	m_needMoreSamples(false),
+	m_scalef(scalef),
+	m_glSpectrum(glSpectrum),
+	m_streamer(this),
+	m_averageNb(0),
+	m_avgMode(AvgModeNone),
+	m_linear(false),
+	m_ofs(0),
+    m_powFFTDiv(1.0),
+	m_mutex(QMutex::Recursive)
+{
+	setObjectName("SpectrumVis");
+	handleConfigure(1024, 0, 0, AvgModeNone, FFTWindow::BlackmanHarris, false);
+}
+
+SpectrumVis::~SpectrumVis()
+{
+    FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+    fftFactory->releaseEngine(m_fftSize, false, m_fftEngineSequence);
+}
+
+void SpectrumVis::configure(MessageQueue* msgQueue,
+        int fftSize,
+        int overlapPercent,
+        unsigned int averagingNb,
+        AvgMode averagingMode,
+        FFTWindow::Function window,
+        bool linear)
+{
+	MsgConfigureSpectrumVis* cmd = new MsgConfigureSpectrumVis(fftSize, overlapPercent, averagingNb, averagingMode, window, linear);
+	msgQueue->push(cmd);
+}
+
+void SpectrumVis::setScalef(MessageQueue* msgQueue, Real scalef)
+{
+    MsgConfigureScalingFactor* cmd = new MsgConfigureScalingFactor(scalef);
+    getInputMessageQueue()->push(cmd);
+}
+
+void SpectrumVis::configureStreamer(const SpectrumStreamer::Settings& settings)
+{
+    MsgConfigureSpectrumStreamer* cmd = new MsgConfigureSpectrumStreamer(settings);
+    getInputMessageQueue()->push(cmd);
+}
+
+void SpectrumVis::configureFrameRate(unsigned int frameRate, FrameAggMode frameAggMode)
+{
+    MsgConfigureFrameRate* cmd = new MsgConfigureFrameRate(frameRate, frameAggMode);
+    getInputMessageQueue()->push(cmd);
+}
+
+void SpectrumVis::feedTriggered(const SampleVector::const_iterator& triggerPoint, const SampleVector::const_iterator& end, bool positiveOnly)
+{
+	feed(triggerPoint, end, positiveOnly); // normal feed from trigger point
+	/*
+	if (triggerPoint == end)
+	{
+		// the following piece of code allows to terminate the FFT that ends past the end of scope captured data
+		// that is the spectrum will include the captured data
+		// just do nothing if you want the spectrum to be included inside the scope captured data
+		// that is to drop the FFT that dangles past the end of captured data
+		if (m_needMoreSamples) {
+			feed(begin, end, positiveOnly);
+			m_needMoreSamples = false;      // force finish
+		}
+	}
+	else
+	{
+		feed(triggerPoint, end, positiveOnly); // normal feed from trigger point
+	}*/
+}
+
+void SpectrumVis::feed(const SampleVector::const_iterator& cbegin, const SampleVector::const_iterator& end, bool positiveOnly)
+{
+	// if no visualisation is displayed and nothing is streamed, send the samples to /dev/null
+
+	if (!(m_glSpectrum && m_glSpectrum->isDisplayed()) && !m_streamer.isStreaming()) {
+		return;
+	}
+
+    if (!m_mutex.tryLock(0)) { // prevent conflicts with configuration process
+        return;
+    }
+
+	SampleVector::const_iterator begin(cbegin);
+
+	while (begin < end)
+	{
+		std::size_t todo = end - begin;
+		std::size_t samplesNeeded = m_refillSize - m_fftBufferFill;
+
+		if (todo >= samplesNeeded)
+		{
+			// fill up the buffer
+			std::vector<Complex>::iterator it = m_fftBuffer.begin() + m_fftBufferFill;
+
+			for (std::size_t i = 0; i < samplesNeeded; ++i, ++begin)
+			{
+				*it++ = Complex(begin->real() / m_scalef, begin->imag() / m_scalef);
+			}
+
+			// apply fft window (and copy from m_fftBuffer to m_fftIn)
+			m_window.apply(&m_fftBuffer[0], m_fft->in());
+
+			// calculate FFT
+			m_fft->transform();
+
+			// extract power spectrum and reorder buckets
+			const float *fftOut = (const float*) m_fft->out();
+			std::size_t halfSize = m_fftSize / 2;
+			std::size_t width;
+
+			if (positiveOnly)
+			{
+				m_kernels->powerIQ(&m_power[0], fftOut, halfSize);
+				width = halfSize;
+			}
+			else
+			{
+				m_kernels->powerIQ(&m_power[0], fftOut + 2*halfSize, halfSize);
+				m_kernels->powerIQ(&m_power[halfSize], fftOut, halfSize);
+				width = m_fftSize;
+			}
+
+			if ((m_avgMode == AvgModeNone) || (m_averageNb <= 1))
+			{
+				aggregateSpectrum(&m_power[0], width, 1, positiveOnly);
+			}
+			else if (m_avgMode == AvgModeMovingAvg)
+			{
+				m_kernels->movingSum(&m_avgPower[0], &m_avgSum[0], &m_avgSlots[m_avgIndex * m_fftSize], &m_power[0], width);
+				m_avgIndex = m_avgIndex == m_avgDepth - 1 ? 0 : m_avgIndex + 1;
+				aggregateSpectrum(&m_avgPower[0], width, m_avgDepth, positiveOnly);
+			}
+			else if (m_avgMode == AvgModeFixedAvg)
+			{
+				if (m_avgIndex == 0) {
+					std::copy(m_power.begin(), m_power.begin() + width, m_avgPower.begin());
+				} else {
+					m_kernels->accumulateF(&m_avgPower[0], &m_power[0], width);
+				}
+
+				if (++m_avgIndex == m_averageNb) // result available
+				{
+					m_avgIndex = 0;
+					aggregateSpectrum(&m_avgPower[0], width, m_averageNb, positiveOnly);
+				}
+			}
+			else if (m_avgMode == AvgModeMax)
+			{
+				if (m_avgIndex == 0) {
+					std::copy(m_power.begin(), m_power.begin() + width, m_avgPower.begin());
+				} else {
+					m_kernels->maxF(&m_avgPower[0], &m_power[0], width);
+				}
+
+				if (++m_avgIndex == m_averageNb) // result available
+				{
+					m_avgIndex = 0;
+					aggregateSpectrum(&m_avgPower[0], width, 1, positiveOnly);
+				}
+			}
+
+			// advance buffer respecting the fft overlap factor
+			std::copy(m_fftBuffer.begin() + m_refillSize, m_fftBuffer.end(), m_fftBuffer.begin());
+
+			// start over
+			m_fftBufferFill = m_overlapSize;
+			m_needMoreSamples = false;
+		}
+		else
+		{
+			// not enough samples for FFT - just fill in new data and return
+			for(std::vector<Complex>::iterator it = m_fftBuffer.begin() + m_fftBufferFill; begin < end; ++begin)
+			{
+				*it++ = Complex(begin->real() / m_scalef, begin->imag() / m_scalef);
+			}
+
+			m_fftBufferFill += todo;
+			m_needMoreSamples = true;
+		}
+	}
+
+	 m_mutex.unlock();
+}
+
+void SpectrumVis::start()
+{
+}
+
+void SpectrumVis::stop()
+{
+}
+
+void SpectrumVis::aggregateSpectrum(const float *power, std::size_t width, unsigned int divisor, bool positiveOnly)
+{
+    if (m_frameRate == 0)
+    {
+        outputSpectrum(power, width, divisor, positiveOnly);
+        return;
+    }
+
+    // FFTs in excess of the frame rate are merged in linear power and only frames are converted
+    if ((m_frameAggCount == 0) || (width != m_frameAggWidth))
+    {
+        std::copy(power, power + width, m_frameAgg.begin());
+        m_frameAggCount = 1;
+        m_frameAggWidth = width;
+    }
+    else
+    {
+        if (m_frameAggMode == FrameAggMax) {
+            m_kernels->maxF(&m_frameAgg[0], power, width);
+        } else {
+            m_kernels->accumulateF(&m_frameAgg[0], power, width);
+        }
+
+        m_frameAggCount++;
+    }
+
+    if (m_frameTimer.isValid() && (m_frameTimer.nsecsElapsed() < 1000000000LL / m_frameRate)) {
+        return;
+    }
+
+    m_frameTimer.start();
+    outputSpectrum(&m_frameAgg[0], width, m_frameAggMode == FrameAggAverage ? divisor * m_frameAggCount : divisor, positiveOnly);
+    m_frameAggCount = 0;
+}
+
+void SpectrumVis::outputSpectrum(const float *power, std::size_t width, unsigned int divisor, bool positiveOnly)
+{
+    // averaging divisor is folded in the scale or the dB offset
+    float *out = positiveOnly ? &m_positiveSpectrum[0] : &m_powerSpectrum[0];
+
+    if (m_linear) {
+        m_kernels->scaleF(out, power, width, 1.0f / (m_powFFTDiv * divisor));
+    } else {
+        m_kernels->powerDB(out, power, width, m_mult, m_ofs - m_mult * log2f((float) divisor));
+    }
+
+    if (positiveOnly)
+    {
+        for (std::size_t i = 0; i < width; i++)
+        {
+            m_powerSpectrum[i * 2] = out[i];
+            m_powerSpectrum[i * 2 + 1] = out[i];
+        }
+    }
+
+    sendSpectrum();
+}
+
+void SpectrumVis::sendSpectrum()
+{
+    if (m_glSpectrum) {
+        m_glSpectrum->newSpectrum(m_powerSpectrum, m_fftSize);
+    }
+
+    m_streamer.pushSpectrum(m_powerSpectrum, m_fftSize, m_linear);
+}
+
+bool SpectrumVis::handleMessage(const Message& message)
+{
+    if (DSPSignalNotification::match(message))
+    {
+        // called synchronously by the device engine
+        DSPSignalNotification& notif = (DSPSignalNotification&) message;
+        m_streamer.setSignal(notif.getCenterFrequency(), notif.getSampleRate());
+        return true;
+    }
+	else if (MsgConfigureSpectrumVis::match(message))
+	{
+		MsgConfigureSpectrumVis& conf = (MsgConfigureSpectrumVis&) message;
+		handleConfigure(conf.getFFTSize(),
+		        conf.getOverlapPercent(),
+		        conf.getAverageNb(),
+		        conf.getAvgMode(),
+		        conf.getWindow(),
+		        conf.getLinear());
+		return true;
+	}
+    else if (MsgConfigureScalingFactor::match(message))
+    {
+        MsgConfigureScalingFactor& conf = (MsgConfigureScalingFactor&) message;
+        handleScalef(conf.getScalef());
+        return true;
+    }
+    else if (MsgConfigureSpectrumStreamer::match(message))
+    {
+        MsgConfigureSpectrumStreamer& conf = (MsgConfigureSpectrumStreamer&) message;
+        m_streamer.applySettings(conf.getSettings());
+        return true;
+    }
+    else if (MsgConfigureFrameRate::match(message))
+    {
+        MsgConfigureFrameRate& conf = (MsgConfigureFrameRate&) message;
+        handleFrameRate(conf.getFrameRate(), conf.getFrameAggMode());
+        return true;
+    }
+	else
+	{
+		return false;
+	}
+}
+
+void SpectrumVis::handleConfigure(int fftSize,
+        int overlapPercent,
+        unsigned int averageNb,
+        AvgMode averagingMode,
+        FFTWindow::Function window,
+        bool linear)
+{
+//    qDebug("SpectrumVis::handleConfigure, fftSize: %d overlapPercent: %d averageNb: %u averagingMode: %d window: %d linear: %s",
+//            fftSize, overlapPercent, averageNb, (int) averagingMode, (int) window, linear ? "true" : "false");
+	QMutexLocker mutexLocker(&m_mutex);
+
+	if (fftSize > MAX_FFT_SIZE)
+	{
+		fftSize = MAX_FFT_SIZE;
+	}
+	else if (fftSize < 64)
+	{
+		fftSize = 64;
+	}
+
+	if (overlapPercent > 100)
+	{
+		m_overlapPercent = 100;
+	}
+	else if (overlapPercent < 0)
+	{
+		m_overlapPercent = 0;
+	}
+	else
+	{
+        m_overlapPercent = overlapPercent;
+	}
+
+    FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+    fftFactory->releaseEngine(m_fftSize, false, m_fftEngineSequence);
+    m_fftEngineSequence = fftFactory->getEngine(fftSize, false, &m_fft);
+	m_fftSize = fftSize;
+	m_window.create(window, m_fftSize);
+	m_windowFunction = window;
+	m_overlapSize = (m_fftSize * m_overlapPercent) / 100;
+	m_refillSize = m_fftSize - m_overlapSize;
+	m_fftBufferFill = m_overlapSize;
+	m_averageNb = averageNb;
+	m_avgDepth = averageNb > 1000 ? 1000 : averageNb < 1 ? 1 : averageNb; // Capping to avoid out of memory condition
+	m_avgIndex = 0;
+	m_avgSlots.assign(m_avgDepth * m_fftSize, 0.0f);
+	std::fill(m_avgSum.begin(), m_avgSum.end(), 0.0);
+	m_avgMode = averagingMode;
+	m_frameAggCount = 0;
+	m_linear = linear;
+	m_ofs = 20.0f * log10f(1.0f / m_fftSize);
+	m_powFFTDiv = m_fftSize*m_fftSize;
+}
+
+void SpectrumVis::handleScalef(Real scalef)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_scalef = scalef;
+}
+
+void SpectrumVis::handleFrameRate(unsigned int frameRate, FrameAggMode frameAggMode)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_frameRate = frameRate;
+    m_frameAggMode = frameAggMode;
+    m_frameAggCount = 0;
+    m_frameTimer.invalidate();
+}
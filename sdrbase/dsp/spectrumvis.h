@@ -0,0 +1,207 @@
+#ifndef INCLUDE_SPECTRUMVIS_H
+#define INCLUDE_SPECTRUMVIS_H
+
+#include <dsp/basebandsamplesink.h>
+#include <QMutex>
+#include <QElapsedTimer>
+#include "dsp/fftengine.h"
+#include "dsp/fftwindow.h"
+#include "dsp/spectrumstreamer.h"
+#include "export.h"
+#include "util/message.h"
+
+class GLSpectrumInterface;
+struct SIMDKernels;
+class MessageQueue;
+
+class SDRBASE_API SpectrumVis : public BasebandSampleSink {
+
+public:
+    enum AvgMode
+    {
+        AvgModeNone,
+        AvgModeMovingAvg,
+        AvgModeFixedAvg,
+        AvgModeMax
+    };
+
+    enum FrameAggMode
+    {
+        FrameAggMax,    //!< Max hold of the FFTs between two frames
+        FrameAggAverage //!< Average of the FFTs between two frames
+    };
+
+	class MsgConfigureSpectrumVis : public Message {
+		MESSAGE_CLASS_DECLARATION
+
+	public:
+		MsgConfigureSpectrumVis(
+		        int fftSize,
+		        int overlapPercent,
+		        unsigned int averageNb,
+		        AvgMode avgMode,
+		        FFTWindow::Function window,
+		        bool linear) :
+			Message(),
+			m_fftSize(fftSize),
+			m_overlapPercent(overlapPercent),
+			m_averageNb(averageNb),
+            m_avgMode(avgMode),
+			m_window(window),
+			m_linear(linear)
+		{}
+
+		int getFFTSize() const { return m_fftSize; }
+		int getOverlapPercent() const { return m_overlapPercent; }
+		unsigned int getAverageNb() const { return m_averageNb; }
+		SpectrumVis::AvgMode getAvgMode() const { return m_avgMode; }
+		FFTWindow::Function getWindow() const { return m_window; }
+		bool getLinear() const { return m_linear; }
+
+	private:
+		int m_fftSize;
+		int m_overlapPercent;
+		unsigned int m_averageNb;
+		SpectrumVis::AvgMode m_avgMode;
+		FFTWindow::Function m_window;
+		bool m_linear;
+	};
+
+    class MsgConfigureScalingFactor : public Message
+    {
+		MESSAGE_CLASS_DECLARATION
+
+	public:
+        MsgConfigureScalingFactor(Real scalef) :
+            Message(),
+            m_scalef(scalef)
+        {}
+
+        Real getScalef() const { return m_scalef; }
+
+    private:
+        Real m_scalef;
+    };
+
+    class MsgConfigureSpectrumStreamer : public Message
+    {
+		MESSAGE_CLASS_DECLARATION
+
+	public:
+        MsgConfigureSpectrumStreamer(const SpectrumStreamer::Settings& settings) :
+            Message(),
+            m_settings(settings)
+        {}
+
+        const SpectrumStreamer::Settings& getSettings() const { return m_settings; }
+
+    private:
+        SpectrumStreamer::Settings m_settings;
+    };
+
+    class MsgConfigureFrameRate : public Message
+    {
+		MESSAGE_CLASS_DECLARATION
+
+	public:
+        MsgConfigureFrameRate(unsigned int frameRate, FrameAggMode frameAggMode) :
+            Message(),
+            m_frameRate(frameRate),
+            m_frameAggMode(frameAggMode)
+        {}
+
+        unsigned int getFrameRate() const { return m_frameRate; }
+        FrameAggMode getFrameAggMode() const { return m_frameAggMode; }
+
+    private:
+        unsigned int m_frameRate;
+        FrameAggMode m_frameAggMode;
+    };
+
+	SpectrumVis(Real scalef, GLSpectrumInterface* glSpectrum = nullptr);
+	virtual ~SpectrumVis();
+
+	void configure(MessageQueue* msgQueue,
+	        int fftSize,
+	        int overlapPercent,
+	        unsigned int averagingNb,
+	        AvgMode averagingMode,
+	        FFTWindow::Function window,
+	        bool m_linear);
+    void setScalef(MessageQueue* msgQueue, Real scalef);
+    void configureStreamer(const SpectrumStreamer::Settings& settings); //!< Streaming to remote clients from any thread
+    const SpectrumStreamer& getStreamer() const { return m_streamer; }
+    void configureFrameRate(unsigned int frameRate, FrameAggMode frameAggMode); //!< Spectrum frames per second to the display and streams (0: every FFT) from any thread
+
+    int getFFTSize() const { return m_fftSize; }
+    int getOverlapPercent() const { return m_overlapPercent; }
+    unsigned int getAverageNb() const { return m_averageNb; }
+    AvgMode getAvgMode() const { return m_avgMode; }
+    FFTWindow::Function getWindow() const { return m_windowFunction; }
+    bool getLinear() const { return m_linear; }
+    unsigned int getFrameRate() const { return m_frameRate; }
+    FrameAggMode getFrameAggMode() const { return m_frameAggMode; }
+
+	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
+	void feedTriggered(const SampleVector::const_iterator& triggerPoint, const SampleVector::const_iterator& end, bool positiveOnly);
+	virtual void start();
+	virtual void stop();
+	virtual bool handleMessage(const Message& message);
+
+private:
+	FFTEngine* m_fft;
+	FFTWindow m_window;
+	FFTWindow::Function m_windowFunction;
+    unsigned int m_fftEngineSequence;
+
+	std::vector<Complex> m_fftBuffer;
+	std::vector<Real> m_powerSpectrum;
+	std::vector<float> m_power;            //!< Squared magnitude of the current FFT in display order
+	std::vector<float> m_positiveSpectrum; //!< Output of positive frequencies only before bins are doubled
+	std::vector<float> m_avgPower;         //!< Moving sum, fixed average sum or maximum
+	std::vector<double> m_avgSum;          //!< Moving average running sum
+	std::vector<float> m_avgSlots;         //!< Moving average window: m_avgDepth FFTs of m_fftSize bins
+	unsigned int m_avgDepth;               //!< Moving average window depth
+	unsigned int m_avgIndex;               //!< Moving average window slot or index of the FFT in the fixed average or max
+	std::vector<float> m_frameAgg;         //!< Max or sum of the averaged FFTs since the last frame
+	unsigned int m_frameAggCount;          //!< Number of FFTs in m_frameAgg
+	std::size_t m_frameAggWidth;
+	unsigned int m_frameRate;              //!< Maximum number of frames per second. 0 for every FFT
+	FrameAggMode m_frameAggMode;
+	QElapsedTimer m_frameTimer;            //!< Time since the last frame
+	const SIMDKernels *m_kernels;
+
+	std::size_t m_fftSize;
+	std::size_t m_overlapPercent;
+	std::size_t m_overlapSize;
+	std::size_t m_refillSize;
+	std::size_t m_fftBufferFill;
+	bool m_needMoreSamples;
+
+	Real m_scalef;
+	GLSpectrumInterface* m_glSpectrum;
+	SpectrumStreamer m_streamer;
+	unsigned int m_averageNb;
+	AvgMode m_avgMode;
+	bool m_linear;
+
+	Real m_ofs;
+	Real m_powFFTDiv;
+	static const Real m_mult;
+
+	QMutex m_mutex;
+
+	void handleConfigure(int fftSize,
+	        int overlapPercent,
+	        unsigned int averageNb,
+	        AvgMode averagingMode,
+	        FFTWindow::Function window,
+	        bool linear);
+    void handleScalef(Real scalef);
+    void handleFrameRate(unsigned int frameRate, FrameAggMode frameAggMode);
+    void aggregateSpectrum(const float *power, std::size_t width, unsigned int divisor, bool positiveOnly);
+    void outputSpectrum(const float *power, std::size_t width, unsigned int divisor, bool positiveOnly);
+    void sendSpectrum();
+};
+
+#endif // INCLUDE_SPECTRUMVIS_H
@@ -0,0 +1,237 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QMutexLocker>
+#include <QDebug>
+
+#include "dsp/downchannelizer.h"
+#include "dsp/dspcommands.h"
+#include "dsp/hbfilterchainconverter.h"
+#include "spectrumzoom.h"
+
+MESSAGE_CLASS_DEFINITION(SpectrumZoom::MsgConfigureSpectrumZoom, Message)
+
+const unsigned int SpectrumZoom::m_maxLog2Decim = 20; // base 3 hash fits in 32 bits
+
+SpectrumZoom::Settings::Settings() :
+    m_centerFrequencyOffset(0),
+    m_span(48000)
+{}
+
+SpectrumZoom::SpectrumZoom(Real scalef, GLSpectrumInterface* glSpectrum) :
+    m_basebandSampleRate(0),
+    m_centerFrequency(0),
+    m_span(0),
+    m_centerFrequencyOffset(0),
+    m_channelSink(this),
+    m_interpolatorDistance(1.0f),
+    m_interpolatorDistanceRemain(0.0f),
+    m_spectrumVis(scalef, glSpectrum),
+    m_mutex(QMutex::Recursive)
+{
+    setObjectName("SpectrumZoom");
+    m_channelizer = new DownChannelizer(&m_channelSink);
+    m_resampleBuffer.resize(Interpolator::BlockSize);
+}
+
+SpectrumZoom::~SpectrumZoom()
+{
+    delete m_channelizer;
+}
+
+void SpectrumZoom::configure(const Settings& settings)
+{
+    MsgConfigureSpectrumZoom *cmd = MsgConfigureSpectrumZoom::create(settings);
+    getInputMessageQueue()->push(cmd);
+}
+
+int SpectrumZoom::getChannelSampleRate() const
+{
+    return m_channelizer->getChannelSampleRate();
+}
+
+void SpectrumZoom::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly)
+{
+    (void) positiveOnly;
+
+    if (m_basebandSampleRate == 0) {
+        return;
+    }
+
+    if (!m_mutex.tryLock(0)) { // prevent conflicts with configuration process
+        return;
+    }
+
+    m_channelizer->feed(begin, end);
+    m_mutex.unlock();
+}
+
+void SpectrumZoom::feedChannel(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    m_nco.nextIQMul(begin, end, m_mixBuffer);
+    const Complex *in = m_mixBuffer.data();
+    int nbIn = m_mixBuffer.size();
+    m_zoomSamples.clear();
+
+    while (nbIn > 0)
+    {
+        int nbConsumed;
+        int nbOut = m_interpolator.decimate(&m_interpolatorDistanceRemain, m_interpolatorDistance,
+            in, nbIn, m_resampleBuffer.data(), m_resampleBuffer.size(), nbConsumed);
+
+        if ((nbOut == 0) && (nbConsumed == 0)) {
+            break;
+        }
+
+        for (int i = 0; i < nbOut; i++) {
+            m_zoomSamples.push_back(Sample(m_resampleBuffer[i].real(), m_resampleBuffer[i].imag()));
+        }
+
+        in += nbConsumed;
+        nbIn -= nbConsumed;
+    }
+
+    if (m_zoomSamples.size() > 0) {
+        m_spectrumVis.feed(m_zoomSamples.begin(), m_zoomSamples.end(), false);
+    }
+}
+
+void SpectrumZoom::start()
+{
+    m_spectrumVis.start();
+}
+
+void SpectrumZoom::stop()
+{
+    m_spectrumVis.stop();
+}
+
+bool SpectrumZoom::handleMessage(const Message& message)
+{
+    if (DSPSignalNotification::match(message))
+    {
+        // called synchronously by the device engine
+        DSPSignalNotification& notif = (DSPSignalNotification&) message;
+        applySettings(m_settings, notif.getSampleRate(), notif.getCenterFrequency());
+        return true;
+    }
+    else if (MsgConfigureSpectrumZoom::match(message))
+    {
+        MsgConfigureSpectrumZoom& conf = (MsgConfigureSpectrumZoom&) message;
+        applySettings(conf.getSettings(), m_basebandSampleRate, m_centerFrequency);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void SpectrumZoom::applySettings(const Settings& settings, int basebandSampleRate, qint64 centerFrequency)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    int span = settings.m_span < 1 ? 1 : settings.m_span;
+    qint64 centerFrequencyOffset = settings.m_centerFrequencyOffset;
+
+    // the span must fit in the baseband
+    if (basebandSampleRate > 0)
+    {
+        span = span > basebandSampleRate ? basebandSampleRate : span;
+        qint64 maxOffset = (basebandSampleRate - span) / 2;
+        centerFrequencyOffset = centerFrequencyOffset < -maxOffset ? -maxOffset : centerFrequencyOffset > maxOffset ? maxOffset : centerFrequencyOffset;
+    }
+
+    qDebug() << "SpectrumZoom::applySettings:"
+        << " basebandSampleRate: " << basebandSampleRate
+        << " centerFrequency: " << centerFrequency
+        << " m_centerFrequencyOffset: " << settings.m_centerFrequencyOffset << " (" << centerFrequencyOffset << ")"
+        << " m_span: " << settings.m_span << " (" << span << ")";
+
+    if ((basebandSampleRate != m_basebandSampleRate)
+     || (span != m_span)
+     || (centerFrequencyOffset != m_centerFrequencyOffset))
+    {
+        m_basebandSampleRate = basebandSampleRate;
+        m_span = span;
+        m_centerFrequencyOffset = centerFrequencyOffset;
+
+        if (m_basebandSampleRate > 0)
+        {
+            unsigned int log2Decim;
+            unsigned int filterChainHash = createFilterChain(m_basebandSampleRate, m_span, m_centerFrequencyOffset, log2Decim);
+            m_channelizer->setBasebandSampleRate(m_basebandSampleRate, true);
+            m_channelizer->setDecimation(log2Decim, filterChainHash);
+            // exact rate and center of the decimated band
+            double channelSampleRate = (double) m_basebandSampleRate / (1<<log2Decim);
+            double channelCenterFrequency = m_basebandSampleRate * HBFilterChainConverter::getShiftFactor(log2Decim, filterChainHash);
+            m_nco.setFreq(channelCenterFrequency - m_centerFrequencyOffset, channelSampleRate);
+            // 90% of the span is passed and the Hamming window transition is 10% of the span
+            m_interpolator.create(16, channelSampleRate, 0.45f * m_span, (33.0 * channelSampleRate) / m_span);
+            m_interpolatorDistanceRemain = 0;
+            m_interpolatorDistance = channelSampleRate / m_span;
+        }
+    }
+
+    m_settings = settings;
+    m_centerFrequency = centerFrequency;
+
+    // the zoomed spectrum sees the span as its own baseband
+    DSPSignalNotification notif(m_span, m_centerFrequency + m_centerFrequencyOffset);
+    m_spectrumVis.handleMessage(notif);
+}
+
+unsigned int SpectrumZoom::createFilterChain(int basebandSampleRate, int span, qint64 centerFrequencyOffset, unsigned int& log2Decim)
+{
+    // Unlike DownChannelizer::setChannelization the span is kept off the half band
+    // transitions (5% of the stage input band on each side) so that it is seen flat
+    double sigStart = basebandSampleRate / -2.0;
+    double sigEnd = basebandSampleRate / 2.0;
+    double chanStart = centerFrequencyOffset - span / 2.0;
+    double chanEnd = centerFrequencyOffset + span / 2.0;
+    unsigned int filterChainHash = 0;
+    log2Decim = 0;
+
+    while (log2Decim < m_maxLog2Decim)
+    {
+        double sigBw = sigEnd - sigStart;
+        double guard = sigBw / 20.0;
+        int stage = 0;
+
+        // 0: lower half, 1: center half, 2: upper half
+        for (; stage < 3; stage++)
+        {
+            double halfStart = sigStart + stage * (sigBw / 4.0);
+
+            if ((chanStart >= halfStart + guard) && (chanEnd <= halfStart + sigBw / 2.0 - guard))
+            {
+                sigStart = halfStart;
+                sigEnd = halfStart + sigBw / 2.0;
+                break;
+            }
+        }
+
+        if (stage == 3) {
+            break;
+        }
+
+        // first stage is the most significant digit of the base 3 hash
+        filterChainHash = 3 * filterChainHash + stage;
+        log2Decim++;
+    }
+
+    return filterChainHash;
+}
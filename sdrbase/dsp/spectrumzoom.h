@@ -0,0 +1,125 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SPECTRUMZOOM_H_
+#define SDRBASE_DSP_SPECTRUMZOOM_H_
+
+#include <QMutex>
+
+#include "dsp/basebandsamplesink.h"
+#include "dsp/channelsamplesink.h"
+#include "dsp/ncof.h"
+#include "dsp/interpolator.h"
+#include "dsp/spectrumvis.h"
+#include "util/message.h"
+#include "export.h"
+
+class DownChannelizer;
+class GLSpectrumInterface;
+
+/**
+ * Spectrum of a narrow span of the baseband at a fraction of the cost of a full band FFT
+ * of the same resolution.
+ *
+ * The span is brought down with the half band stages of a DownChannelizer keeping clear
+ * of the filters transitions, centered exactly with a NCO and resampled to the span width
+ * with the polyphase Interpolator before being fed to its own SpectrumVis. Thus the FFT
+ * size sets the resolution over the span only (span / FFT size). Several zooms can be
+ * added as baseband sample sinks to the same device engine each with its own span,
+ * display and streaming.
+ */
+class SDRBASE_API SpectrumZoom : public BasebandSampleSink {
+public:
+    struct Settings
+    {
+        qint64 m_centerFrequencyOffset; //!< Center of the span relative to the baseband center (Hz)
+        int m_span;                     //!< Width of the span and sample rate of the zoomed spectrum (Hz)
+
+        Settings();
+    };
+
+    class MsgConfigureSpectrumZoom : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        const Settings& getSettings() const { return m_settings; }
+
+        static MsgConfigureSpectrumZoom* create(const Settings& settings) {
+            return new MsgConfigureSpectrumZoom(settings);
+        }
+
+    private:
+        Settings m_settings;
+
+        MsgConfigureSpectrumZoom(const Settings& settings) :
+            Message(),
+            m_settings(settings)
+        { }
+    };
+
+    SpectrumZoom(Real scalef, GLSpectrumInterface* glSpectrum = nullptr);
+    virtual ~SpectrumZoom();
+
+    void configure(const Settings& settings); //!< From any thread
+    const Settings& getSettings() const { return m_settings; } //!< Requested settings
+    int getSpan() const { return m_span; } //!< Span actually zoomed in (Hz)
+    qint64 getCenterFrequencyOffset() const { return m_centerFrequencyOffset; } //!< Center of the span actually zoomed in (Hz)
+    SpectrumVis *getSpectrumVis() { return &m_spectrumVis; } //!< To configure the FFT, averaging and streaming of the zoomed spectrum
+    const SpectrumVis *getSpectrumVis() const { return &m_spectrumVis; }
+    int getChannelSampleRate() const; //!< Rate out of the half band stages before resampling to the span
+
+    virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
+    virtual void start();
+    virtual void stop();
+    virtual bool handleMessage(const Message& message);
+
+private:
+    class ZoomChannelSink : public ChannelSampleSink {
+    public:
+        ZoomChannelSink(SpectrumZoom *zoom) : m_zoom(zoom) {}
+        virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end) {
+            m_zoom->feedChannel(begin, end);
+        }
+    private:
+        SpectrumZoom *m_zoom;
+    };
+
+    Settings m_settings;
+    int m_basebandSampleRate;
+    qint64 m_centerFrequency;       //!< Baseband center frequency
+    int m_span;                     //!< Effective span once fitted in the baseband
+    qint64 m_centerFrequencyOffset; //!< Effective span center once fitted in the baseband
+    ZoomChannelSink m_channelSink;
+    DownChannelizer *m_channelizer; //!< Half band stages down to the smallest rate containing the span
+    NCOF m_nco;                     //!< Residual shift of the span to zero
+    Interpolator m_interpolator;    //!< Resampling of the channel to the span width
+    Real m_interpolatorDistance;
+    Real m_interpolatorDistanceRemain;
+    ComplexVector m_mixBuffer;      //!< channel samples shifted by m_nco
+    ComplexVector m_resampleBuffer; //!< m_mixBuffer samples at span rate
+    SampleVector m_zoomSamples;     //!< span samples fed to the spectrum
+    SpectrumVis m_spectrumVis;
+    QMutex m_mutex;
+
+    static const unsigned int m_maxLog2Decim;
+
+    static unsigned int createFilterChain(int basebandSampleRate, int span, qint64 centerFrequencyOffset, unsigned int& log2Decim);
+    void feedChannel(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    void applySettings(const Settings& settings, int basebandSampleRate, qint64 centerFrequency);
+};
+
+#endif // SDRBASE_DSP_SPECTRUMZOOM_H_
@@ -60,28 +60,9 @@ void UpChannelizer::pullOne(Sample& sample)
     }
     else
     {
-        FilterStages::iterator stage = m_filterStages.begin();
-        std::vector<Sample>::iterator stageSample = m_stageSamples.begin();
-
-        for (; stage != m_filterStages.end(); ++stage, ++stageSample)
-        {
-            if(stage == m_filterStages.end() - 1)
-            {
-                if ((*stage)->work(&m_sampleIn, &(*stageSample)))
-                {
-                    m_sampleSource->pullOne(m_sampleIn); // get new input sample
-                }
-            }
-            else
-            {
-                if (!(*stage)->work(&(*(stageSample+1)), &(*stageSample)))
-                {
-                    break;
-                }
-            }
-        }
-
-        sample = *m_stageSamples.begin();
+        m_oneSample.resize(1);
+        pull(m_oneSample.begin(), 1);
+        sample = m_oneSample[0];
     }
 }
 
@@ -99,15 +80,35 @@ void UpChannelizer::pull(SampleVector::iterator begin, unsigned int nbSamples)
     {
         m_sampleSource->pull(begin, nbSamples);
     }
-    else
+    else if (nbSamples > 0)
     {
-        std::for_each(
-            begin,
-            begin + nbSamples,
-            [this](Sample& s) {
-                pullOne(s);
-            }
-        );
+        // number of samples to produce at each stage from the baseband side down to the source
+        m_stageNbSamples.resize(log2Interp + 1);
+        m_stageNbSamples[0] = nbSamples;
+
+        for (unsigned int i = 0; i < log2Interp; i++) {
+            m_stageNbSamples[i+1] = m_filterStages[i].getNbInputs(m_stageNbSamples[i]);
+        }
+
+        if (m_sampleBuffer.size() < nbSamples)
+        {
+            m_sampleBuffer.resize(nbSamples);
+            m_stageBuffer.resize(nbSamples);
+        }
+
+        SampleVector *stageIn = &m_sampleBuffer;
+        SampleVector *stageOut = &m_stageBuffer;
+
+        if (m_stageNbSamples[log2Interp] > 0) {
+            m_sampleSource->pull(stageIn->begin(), m_stageNbSamples[log2Interp]);
+        }
+
+        for (int i = log2Interp - 1; i >= 0; i--)
+        {
+            Sample *out = (i == 0) ? &(*begin) : stageOut->data();
+            m_filterStages[i].work(stageIn->data(), m_stageNbSamples[i], out);
+            std::swap(stageIn, stageOut);
+        }
     }
 }
 
@@ -192,49 +193,9 @@ void UpChannelizer::applyInterpolation()
 			<< " fc:" << m_channelFrequencyOffset;
 }
 
-#ifdef USE_SSE4_1
-UpChannelizer::FilterStage::FilterStage(Mode mode) :
-    m_filter(new IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>),
-    m_workFunction(0)
-{
-    switch(mode) {
-        case ModeCenter:
-            m_workFunction = &IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateCenter;
-            break;
-
-        case ModeLowerHalf:
-            m_workFunction = &IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateLowerHalf;
-            break;
-
-        case ModeUpperHalf:
-            m_workFunction = &IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateUpperHalf;
-            break;
-    }
-}
-#else
 UpChannelizer::FilterStage::FilterStage(Mode mode) :
-    m_filter(new IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>),
-    m_workFunction(0)
-{
-    switch(mode) {
-        case ModeCenter:
-            m_workFunction = &IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateCenter;
-            break;
-
-        case ModeLowerHalf:
-            m_workFunction = &IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateLowerHalf;
-            break;
-
-        case ModeUpperHalf:
-            m_workFunction = &IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateUpperHalf;
-            break;
-    }
-}
-#endif
-
-UpChannelizer::FilterStage::~FilterStage()
+    m_mode(mode)
 {
-    delete m_filter;
 }
 
 bool UpChannelizer::signalContainsChannel(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd) const
@@ -251,7 +212,6 @@ Real UpChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanStart
 {
     Real sigBw = sigEnd - sigStart;
     Real rot = sigBw / 4;
-    Sample s;
 
     qDebug() << "UpChannelizer::createFilterChain: start:"
             << " sig: ["  << sigStart << ":" << sigEnd << "]"
@@ -265,8 +225,7 @@ Real UpChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanStart
         qDebug() << "UpChannelizer::createFilterChain: take left half (rotate by +1/4 and decimate by 2):"
                 << " [" << m_filterStages.size() << "]"
                 << " sig: ["  << sigStart << ":" << sigStart + sigBw / 2.0 << "]";
-        m_filterStages.push_back(new FilterStage(FilterStage::ModeLowerHalf));
-        m_stageSamples.push_back(s);
+        m_filterStages.push_back(FilterStage(FilterStage::ModeLowerHalf));
         return createFilterChain(sigStart, sigStart + sigBw / 2.0, chanStart, chanEnd);
     }
 
@@ -276,8 +235,7 @@ Real UpChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanStart
         qDebug() << "UpChannelizer::createFilterChain: take right half (rotate by -1/4 and decimate by 2):"
                 << " [" << m_filterStages.size() << "]"
                 << " sig: ["  << sigEnd - sigBw / 2.0f << ":" << sigEnd << "]";
-        m_filterStages.push_back(new FilterStage(FilterStage::ModeUpperHalf));
-        m_stageSamples.push_back(s);
+        m_filterStages.push_back(FilterStage(FilterStage::ModeUpperHalf));
         return createFilterChain(sigEnd - sigBw / 2.0f, sigEnd, chanStart, chanEnd);
     }
 
@@ -288,8 +246,7 @@ Real UpChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanStart
         qDebug() << "UpChannelizer::createFilterChain: take center half (decimate by 2):"
                 << " [" << m_filterStages.size() << "]"
                 << " sig: ["  << sigStart + rot << ":" << sigEnd - rot << "]";
-        m_filterStages.push_back(new FilterStage(FilterStage::ModeCenter));
-        m_stageSamples.push_back(s);
+        m_filterStages.push_back(FilterStage(FilterStage::ModeCenter));
         // Was: return createFilterChain(sigStart + rot, sigStart + sigBw / 2.0f + rot, chanStart, chanEnd);
         return createFilterChain(sigStart + rot, sigEnd - rot, chanStart, chanEnd);
     }
@@ -309,7 +266,6 @@ double UpChannelizer::setFilterChain(const std::vector<unsigned int>& stageIndex
     // filters are described from lower to upper level but the chain is constructed the other way round
     std::vector<unsigned int>::const_reverse_iterator rit = stageIndexes.rbegin();
     double ofs = 0.0, ofs_stage = 0.25;
-    Sample s;
 
     // Each index is a base 3 number with 0 = low, 1 = center, 2 = high
     // Functions at upper level will convert a number to base 3 to describe the filter chain. Common converting
@@ -318,21 +274,18 @@ double UpChannelizer::setFilterChain(const std::vector<unsigned int>& stageIndex
     {
         if (*rit == 0)
         {
-            m_filterStages.push_back(new FilterStage(FilterStage::ModeLowerHalf));
-            m_stageSamples.push_back(s);
+            m_filterStages.push_back(FilterStage(FilterStage::ModeLowerHalf));
             ofs -= ofs_stage;
             qDebug("UpChannelizer::setFilterChain: lower half: ofs: %f", ofs);
         }
         else if (*rit == 1)
         {
-            m_filterStages.push_back(new FilterStage(FilterStage::ModeCenter));
-            m_stageSamples.push_back(s);
+            m_filterStages.push_back(FilterStage(FilterStage::ModeCenter));
             qDebug("UpChannelizer::setFilterChain: center: ofs: %f", ofs);
         }
         else if (*rit == 2)
         {
-            m_filterStages.push_back(new FilterStage(FilterStage::ModeUpperHalf));
-            m_stageSamples.push_back(s);
+            m_filterStages.push_back(FilterStage(FilterStage::ModeUpperHalf));
             ofs += ofs_stage;
             qDebug("UpChannelizer::setFilterChain: upper half: ofs: %f", ofs);
         }
@@ -349,10 +302,7 @@ double UpChannelizer::setFilterChain(const std::vector<unsigned int>& stageIndex
 
 void UpChannelizer::freeFilterChain()
 {
-    for(FilterStages::iterator it = m_filterStages.begin(); it != m_filterStages.end(); ++it)
-        delete *it;
     m_filterStages.clear();
-    m_stageSamples.clear();
 }
 
 
@@ -27,11 +27,7 @@
 
 #include "channelsamplesource.h"
 
-#ifdef USE_SSE4_1
-#include "dsp/inthalfbandfiltereo1.h"
-#else
-#include "dsp/inthalfbandfilterdb.h"
-#endif
+#include "dsp/inthalfbandfilterblock.h"
 
 #define UPCHANNELIZER_HB_FILTER_ORDER 96
 
@@ -58,27 +54,39 @@ protected:
             ModeUpperHalf
         };
 
-#ifdef USE_SSE4_1
-        typedef bool (IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>::*WorkFunction)(Sample* sIn, Sample *sOut);
-        IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>* m_filter;
-#else
-        typedef bool (IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>::*WorkFunction)(Sample* sIn, Sample *sOut);
-        IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>* m_filter;
-#endif
-        WorkFunction m_workFunction;
+        IntHalfbandFilterBlock<qint32, qint32, UPCHANNELIZER_HB_FILTER_ORDER> m_filter;
+        Mode m_mode;
 
         FilterStage(Mode mode);
-        ~FilterStage();
 
-        bool work(Sample* sampleIn, Sample *sampleOut) {
-            return (m_filter->*m_workFunction)(sampleIn, sampleOut);
+        /** Number of input samples needed to produce the next nbOut samples */
+        int getNbInputs(int nbOut) const {
+            return m_filter.getNbInterpolationInputs(nbOut);
+        }
+
+        /** Interpolate a block by 2 producing nbOut samples. in and out must not overlap. */
+        void work(const Sample* in, int nbOut, Sample* out)
+        {
+            switch (m_mode)
+            {
+            case ModeLowerHalf:
+                m_filter.workInterpolateLowerHalf(in, nbOut, out);
+                break;
+            case ModeUpperHalf:
+                m_filter.workInterpolateUpperHalf(in, nbOut, out);
+                break;
+            case ModeCenter:
+            default:
+                m_filter.workInterpolateCenter(in, nbOut, out);
+                break;
+            }
         }
     };
 
-    typedef std::vector<FilterStage*> FilterStages;
+    typedef std::vector<FilterStage> FilterStages; //!< from the baseband side to the channel side
     FilterStages m_filterStages;
     bool m_filterChainSetMode;
-    std::vector<Sample> m_stageSamples;
+    std::vector<int> m_stageNbSamples; //!< number of samples produced by each stage in the current pull
     ChannelSampleSource* m_sampleSource; //!< Modulator
     int m_basebandSampleRate;
     int m_requestedInputSampleRate;
@@ -87,8 +95,9 @@ protected:
     int m_channelFrequencyOffset;
     unsigned int m_log2Interp;
     unsigned int m_filterChainHash;
-    SampleVector m_sampleBuffer;
-    Sample m_sampleIn;
+    SampleVector m_sampleBuffer; //!< stage input and output buffers used alternately
+    SampleVector m_stageBuffer;
+    SampleVector m_oneSample;    //!< for pullOne
 
     void applyChannelization();
     void applyInterpolation();
@@ -18,6 +18,7 @@
 
 #include <QCommandLineOption>
 #include <QRegExpValidator>
+#include <QStandardPaths>
 #include <QDebug>
 
 #include "mainparser.h"
@@ -32,14 +33,24 @@ MainParser::MainParser() :
         "port",
         "8091"),
     m_fftwfWisdomOption(QStringList() << "w" << "fftwf-wisdom",
-        "FFTW Wisdom file.",
+        "FFTW Wisdom file. Generated in the background if it does not exist (default: fftw-wisdom in the application data directory).",
         "file",
-        "")
+        ""),
+    m_channelPoolOption(QStringList() << "c" << "channel-pool",
+        "Run channels on a shared pool of threads (0 for one per core) instead of one thread per channel.",
+        "threads",
+        "0"),
+    m_recordFormatOption(QStringList() << "record-format",
+        "Sample format of the device I/Q recordings: native, packed12, block8 or cf32.",
+        "format",
+        "native")
 {
     m_serverAddress = "127.0.0.1";
     m_serverPort = 8091;
     m_mimoSupport = false;
     m_fftwfWindowFileName = "";
+    m_channelPoolThreads = -1;
+    m_recordFormat = RecordFormat::FormatNative;
 
     m_parser.setApplicationDescription("Software Defined Radio application");
     m_parser.addHelpOption();
@@ -48,6 +59,8 @@ MainParser::MainParser() :
     m_parser.addOption(m_serverAddressOption);
     m_parser.addOption(m_serverPortOption);
     m_parser.addOption(m_fftwfWisdomOption);
+    m_parser.addOption(m_channelPoolOption);
+    m_parser.addOption(m_recordFormatOption);
 }
 
 MainParser::~MainParser()
@@ -90,7 +103,38 @@ void MainParser::parse(const QCoreApplication& app)
 
     // FFTWF wisdom file
 
-    m_fftwfWindowFileName = m_parser.value(m_fftwfWisdomOption);
+    if (m_parser.isSet(m_fftwfWisdomOption))
+    {
+        m_fftwfWindowFileName = m_parser.value(m_fftwfWisdomOption);
+    }
+    else
+    {
+        QString dataLocation = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+        m_fftwfWindowFileName = dataLocation.isEmpty() ? "" : dataLocation + "/fftw-wisdom";
+    }
+
+    // channel threads pool
+
+    if (m_parser.isSet(m_channelPoolOption))
+    {
+        int channelPoolThreads = m_parser.value(m_channelPoolOption).toInt(&ok);
+
+        if (ok && (channelPoolThreads >= 0)) {
+            m_channelPoolThreads = channelPoolThreads;
+        } else {
+            qWarning() << "MainParser::parse: channel pool threads invalid. Defaulting to one per core";
+            m_channelPoolThreads = 0;
+        }
+    }
+
+    // I/Q recordings format
+
+    if (m_parser.isSet(m_recordFormatOption))
+    {
+        if (!RecordFormat::getFormat(m_parser.value(m_recordFormatOption), m_recordFormat)) {
+            qWarning() << "MainParser::parse: record format invalid. Defaulting to native";
+        }
+    }
 
     // MIMO - from version
 
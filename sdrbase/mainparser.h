@@ -22,6 +22,7 @@
 #include <QCommandLineParser>
 #include <stdint.h>
 
+#include "dsp/recordformat.h"
 #include "export.h"
 
 class SDRBASE_API MainParser
@@ -36,17 +37,23 @@ public:
     uint16_t getServerPort() const { return m_serverPort; }
     bool getMIMOSupport() const { return m_mimoSupport; }
     const QString& getFFTWFWisdomFileName() const { return m_fftwfWindowFileName; }
+    int getChannelPoolThreads() const { return m_channelPoolThreads; } //!< -1 if channels run in their own thread
+    RecordFormat::Format getRecordFormat() const { return m_recordFormat; }
 
 private:
     QString  m_serverAddress;
     uint16_t m_serverPort;
     QString  m_fftwfWindowFileName;
     bool m_mimoSupport; //!< obtained from major version
+    int m_channelPoolThreads;
+    RecordFormat::Format m_recordFormat;
 
     QCommandLineParser m_parser;
     QCommandLineOption m_serverAddressOption;
     QCommandLineOption m_serverPortOption;
     QCommandLineOption m_fftwfWisdomOption;
+    QCommandLineOption m_channelPoolOption;
+    QCommandLineOption m_recordFormatOption;
 };
 
 
@@ -36,7 +36,8 @@ Preset::Preset(const Preset& other) :
 	m_iqImbalanceCorrection(other.m_iqImbalanceCorrection),
 	m_channelConfigs(other.m_channelConfigs),
 	m_deviceConfigs(other.m_deviceConfigs),
-	m_layout(other.m_layout)
+	m_layout(other.m_layout),
+	m_threadPolicy(other.m_threadPolicy)
 {}
 
 void Preset::resetToDefaults()
@@ -50,6 +51,7 @@ void Preset::resetToDefaults()
 	m_channelConfigs.clear();
 	m_dcOffsetCorrection = false;
 	m_iqImbalanceCorrection = false;
+	m_threadPolicy.resetToDefaults();
 }
 
 QByteArray Preset::serialize() const
@@ -69,6 +71,18 @@ QByteArray Preset::serialize() const
 	s.writeBlob(5, m_spectrumConfig);
     s.writeBool(6, m_presetType == PresetSource);
 	s.writeS32(7, (int) m_presetType);
+	s.writeBlob(8, m_threadPolicy.serialize());
+
+	SimpleSerializer channelPolicies(1); // only channels with their own policy
+
+	for (int i = 0; i < m_channelConfigs.size(); i++)
+	{
+		if (!m_channelConfigs[i].m_threadPolicy.isDefault()) {
+			channelPolicies.writeBlob(1 + i, m_channelConfigs[i].m_threadPolicy.serialize());
+		}
+	}
+
+	s.writeBlob(9, channelPolicies.final());
 
 	s.writeS32(20, m_deviceConfigs.size());
 
@@ -118,6 +132,7 @@ bool Preset::deserialize(const QByteArray& data)
 	{
         bool tmpBool;
         int tmp;
+        QByteArray bytetmp;
 
 		d.readString(1, &m_group, "default");
 		d.readString(2, &m_description, "no name");
@@ -132,6 +147,9 @@ bool Preset::deserialize(const QByteArray& data)
             m_presetType = tmpBool ? PresetSource : PresetSink;
         }
 
+        d.readBlob(8, &bytetmp);
+        m_threadPolicy.deserialize(bytetmp);
+
 //		qDebug("Preset::deserialize: m_group: %s mode: %s m_description: %s m_centerFrequency: %llu",
 //				qPrintable(m_group),
 //				m_sourcePreset ? "Rx" : "Tx",
@@ -174,17 +192,25 @@ bool Preset::deserialize(const QByteArray& data)
         d.readS32(200, &channelCount, 0);
 
 		m_channelConfigs.clear();
+		d.readBlob(9, &bytetmp);
+		SimpleDeserializer channelPolicies(bytetmp);
 
 		for (int i = 0; i < channelCount; i++)
 		{
 			QString channel;
 			QByteArray config;
+			QByteArray policy;
+			ThreadPolicy threadPolicy;
 
 			d.readString(201 + i * 2, &channel, "unknown-channel");
 			d.readBlob(202 + i * 2, &config);
 
+			if (channelPolicies.isValid() && channelPolicies.readBlob(1 + i, &policy)) {
+				threadPolicy.deserialize(policy);
+			}
+
 //			qDebug("Preset::deserialize:  channel: id: %s", qPrintable(channel));
-			m_channelConfigs.append(ChannelConfig(channel, config));
+			m_channelConfigs.append(ChannelConfig(channel, config, threadPolicy));
 		}
 
 		return true;
@@ -23,6 +23,7 @@
 #include <QList>
 #include <QMetaType>
 
+#include "util/threadpolicy.h"
 #include "export.h"
 
 class SDRBASE_API Preset {
@@ -30,10 +31,12 @@ public:
 	struct ChannelConfig {
 		QString m_channelIdURI; //!< Channel type ID in URI form
 		QByteArray m_config;
+		ThreadPolicy m_threadPolicy; //!< Policy of the channel baseband thread
 
-		ChannelConfig(const QString& channelIdURI, const QByteArray& config) :
+		ChannelConfig(const QString& channelIdURI, const QByteArray& config, const ThreadPolicy& threadPolicy = ThreadPolicy()) :
 			m_channelIdURI(channelIdURI),
-			m_config(config)
+			m_config(config),
+			m_threadPolicy(threadPolicy)
 		{ }
 	};
 	typedef QList<ChannelConfig> ChannelConfigs;
@@ -99,8 +102,13 @@ public:
 	void setLayout(const QByteArray& data) { m_layout = data; }
 	const QByteArray& getLayout() const { return m_layout; }
 
+	void setThreadPolicy(const ThreadPolicy& threadPolicy) { m_threadPolicy = threadPolicy; }
+	const ThreadPolicy& getThreadPolicy() const { return m_threadPolicy; }
+
 	void clearChannels() { m_channelConfigs.clear(); }
-	void addChannel(const QString& channel, const QByteArray& config) { m_channelConfigs.append(ChannelConfig(channel, config)); }
+	void addChannel(const QString& channel, const QByteArray& config, const ThreadPolicy& threadPolicy = ThreadPolicy()) {
+		m_channelConfigs.append(ChannelConfig(channel, config, threadPolicy));
+	}
 	int getChannelCount() const { return m_channelConfigs.count(); }
 	const ChannelConfig& getChannelConfig(int index) const { return m_channelConfigs.at(index); }
 
@@ -166,6 +174,9 @@ protected:
 	// screen and dock layout
 	QByteArray m_layout;
 
+	// device engine and worker threads policy. Default for channels
+	ThreadPolicy m_threadPolicy;
+
 private:
 	const QByteArray* findBestDeviceConfigSoapy(const QString& sourceId, const QString& deviceSerial) const;
 };
@@ -0,0 +1,372 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <map>
+#include <string.h>
+
+#if defined(__linux__)
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#elif defined(_WIN32) || defined(WIN32)
+#include <windows.h>
+#endif
+
+#include <QThread>
+#include <QTimer>
+#include <QMutex>
+#include <QStringList>
+#include <QDebug>
+
+#include "SWGThreadPolicy.h"
+
+#include "util/simpleserializer.h"
+#include "threadpolicy.h"
+
+namespace {
+
+// Policies of the threads on which apply() was called. Read back from the thread when it (re)starts.
+QMutex threadPoliciesMutex;
+std::map<QThread*, ThreadPolicy> threadPolicies;
+
+ThreadPolicy getThreadPolicy(QThread *thread)
+{
+    QMutexLocker mutexLocker(&threadPoliciesMutex);
+    std::map<QThread*, ThreadPolicy>::const_iterator it = threadPolicies.find(thread);
+    return it == threadPolicies.end() ? ThreadPolicy() : it->second;
+}
+
+} // namespace
+
+ThreadPolicy::ThreadPolicy()
+{
+    resetToDefaults();
+}
+
+void ThreadPolicy::resetToDefaults()
+{
+    m_cpus = "";
+    m_scheduling = SchedNormal;
+    m_priority = 50;
+    m_nice = 0;
+}
+
+bool ThreadPolicy::isDefault() const
+{
+    return m_cpus.isEmpty() && (m_scheduling == SchedNormal) && (m_nice == 0);
+}
+
+bool ThreadPolicy::operator==(const ThreadPolicy& other) const
+{
+    return (m_cpus == other.m_cpus)
+        && (m_scheduling == other.m_scheduling)
+        && (m_priority == other.m_priority)
+        && (m_nice == other.m_nice);
+}
+
+QByteArray ThreadPolicy::serialize() const
+{
+    SimpleSerializer s(1);
+
+    s.writeString(1, m_cpus);
+    s.writeS32(2, (int) m_scheduling);
+    s.writeS32(3, m_priority);
+    s.writeS32(4, m_nice);
+
+    return s.final();
+}
+
+bool ThreadPolicy::deserialize(const QByteArray& data)
+{
+    SimpleDeserializer d(data);
+
+    if (!d.isValid())
+    {
+        resetToDefaults();
+        return false;
+    }
+
+    if (d.getVersion() == 1)
+    {
+        int tmp;
+
+        d.readString(1, &m_cpus, "");
+        d.readS32(2, &tmp, (int) SchedNormal);
+        m_scheduling = tmp == (int) SchedFIFO ? SchedFIFO : SchedNormal;
+        d.readS32(3, &m_priority, 50);
+        d.readS32(4, &m_nice, 0);
+
+        return true;
+    }
+    else
+    {
+        resetToDefaults();
+        return false;
+    }
+}
+
+ThreadPolicy ThreadPolicy::inherit(const ThreadPolicy& deviceSetPolicy) const
+{
+    if (!isDefault()) {
+        return *this;
+    }
+
+    ThreadPolicy policy;
+    policy.m_cpus = deviceSetPolicy.m_cpus;
+    return policy;
+}
+
+bool ThreadPolicy::parseCPUs(const QString& cpus, std::vector<int>& cpuList)
+{
+    cpuList.clear();
+
+    if (cpus.trimmed().isEmpty()) {
+        return true;
+    }
+
+    QStringList ranges = cpus.split(',');
+
+    for (const QString& range : ranges)
+    {
+        QStringList bounds = range.trimmed().split('-');
+        bool ok1 = false, ok2 = false;
+        int first = 0, last = 0;
+
+        if (bounds.size() == 1)
+        {
+            first = bounds[0].trimmed().toInt(&ok1);
+            last = first;
+            ok2 = true;
+        }
+        else if (bounds.size() == 2)
+        {
+            first = bounds[0].trimmed().toInt(&ok1);
+            last = bounds[1].trimmed().toInt(&ok2);
+        }
+
+        if (!ok1 || !ok2 || (first < 0) || (last < first))
+        {
+            cpuList.clear();
+            return false;
+        }
+
+        for (int cpu = first; cpu <= last; cpu++) {
+            cpuList.push_back(cpu);
+        }
+    }
+
+    return true;
+}
+
+bool ThreadPolicy::applyToCurrentThread() const
+{
+    std::vector<int> cpuList;
+
+    if (!parseCPUs(m_cpus, cpuList))
+    {
+        qWarning("ThreadPolicy::applyToCurrentThread: malformed CPU list: %s", qPrintable(m_cpus));
+        return false;
+    }
+
+#if defined(__linux__)
+    bool success = true;
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+
+    if (cpuList.size() == 0)
+    {
+        long nbCPUs = sysconf(_SC_NPROCESSORS_CONF);
+
+        for (long cpu = 0; (cpu < nbCPUs) && (cpu < CPU_SETSIZE); cpu++) {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+    else
+    {
+        for (int cpu : cpuList)
+        {
+            if (cpu < CPU_SETSIZE) {
+                CPU_SET(cpu, &cpuSet);
+            }
+        }
+    }
+
+    int res = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+
+    if (res != 0)
+    {
+        qWarning("ThreadPolicy::applyToCurrentThread: cannot set affinity to CPUs \"%s\": %s", qPrintable(m_cpus), strerror(res));
+        success = false;
+    }
+
+    struct sched_param param;
+
+    if (m_scheduling == SchedFIFO)
+    {
+        param.sched_priority = std::max(sched_get_priority_min(SCHED_FIFO), std::min(m_priority, sched_get_priority_max(SCHED_FIFO)));
+        res = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+
+        if (res != 0)
+        {
+            qWarning("ThreadPolicy::applyToCurrentThread: cannot set SCHED_FIFO priority %d: %s", param.sched_priority, strerror(res));
+            success = false;
+        }
+    }
+    else
+    {
+        param.sched_priority = 0;
+        res = pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
+
+        if (res != 0)
+        {
+            qWarning("ThreadPolicy::applyToCurrentThread: cannot set SCHED_OTHER: %s", strerror(res));
+            success = false;
+        }
+
+        if (setpriority(PRIO_PROCESS, (id_t) syscall(SYS_gettid), m_nice) != 0) // per thread on Linux
+        {
+            qWarning("ThreadPolicy::applyToCurrentThread: cannot set nice %d: %s", m_nice, strerror(errno));
+            success = false;
+        }
+    }
+
+    return success;
+#elif defined(_WIN32) || defined(WIN32)
+    bool success = true;
+    DWORD_PTR mask = 0;
+
+    if (cpuList.size() == 0)
+    {
+        DWORD_PTR systemMask;
+        GetProcessAffinityMask(GetCurrentProcess(), &mask, &systemMask);
+    }
+    else
+    {
+        for (int cpu : cpuList)
+        {
+            if (cpu < (int) (8*sizeof(DWORD_PTR))) {
+                mask |= ((DWORD_PTR) 1) << cpu;
+            }
+        }
+    }
+
+    if (SetThreadAffinityMask(GetCurrentThread(), mask) == 0)
+    {
+        qWarning("ThreadPolicy::applyToCurrentThread: cannot set affinity to CPUs \"%s\"", qPrintable(m_cpus));
+        success = false;
+    }
+
+    int priority = m_scheduling == SchedFIFO ? THREAD_PRIORITY_TIME_CRITICAL
+        : m_nice < 0 ? THREAD_PRIORITY_ABOVE_NORMAL
+        : m_nice > 0 ? THREAD_PRIORITY_BELOW_NORMAL : THREAD_PRIORITY_NORMAL;
+
+    if (!SetThreadPriority(GetCurrentThread(), priority))
+    {
+        qWarning("ThreadPolicy::applyToCurrentThread: cannot set thread priority");
+        success = false;
+    }
+
+    return success;
+#else
+    if (!isDefault()) {
+        qDebug("ThreadPolicy::applyToCurrentThread: not supported on this platform");
+    }
+
+    return false;
+#endif
+}
+
+void ThreadPolicy::apply(QThread *thread, QObject *threadObject) const
+{
+    if (!thread) {
+        return;
+    }
+
+    bool hooked;
+
+    {
+        QMutexLocker mutexLocker(&threadPoliciesMutex);
+        hooked = threadPolicies.find(thread) != threadPolicies.end();
+
+        if (!hooked && isDefault()) { // never changed: nothing to restore
+            return;
+        }
+
+        threadPolicies[thread] = *this;
+    }
+
+    if (!hooked)
+    {
+        // no context object: the functor is called directly from the thread emitting the signal
+        QObject::connect(thread, &QThread::started, [thread]() {
+            getThreadPolicy(thread).applyToCurrentThread();
+        });
+        QObject::connect(thread, &QObject::destroyed, [thread]() {
+            QMutexLocker mutexLocker(&threadPoliciesMutex);
+            threadPolicies.erase(thread);
+        });
+    }
+
+    if (thread == QThread::currentThread())
+    {
+        applyToCurrentThread();
+    }
+    else if (thread->isRunning() && threadObject)
+    {
+        ThreadPolicy policy(*this);
+        QTimer::singleShot(0, threadObject, [policy]() { // run from the thread event loop
+            policy.applyToCurrentThread();
+        });
+    }
+    else if (thread->isRunning())
+    {
+        qDebug("ThreadPolicy::apply: thread is running: policy will apply when it is restarted");
+    }
+}
+
+void ThreadPolicy::webapiFormat(SWGSDRangel::SWGThreadPolicy& response) const
+{
+    if (response.getCpus()) {
+        *response.getCpus() = m_cpus;
+    } else {
+        response.setCpus(new QString(m_cpus));
+    }
+
+    response.setScheduling((int) m_scheduling);
+    response.setPriority(m_priority);
+    response.setNice(m_nice);
+}
+
+void ThreadPolicy::webapiUpdate(const QStringList& policyKeys, SWGSDRangel::SWGThreadPolicy& query)
+{
+    if (policyKeys.contains("cpus")) {
+        m_cpus = query.getCpus() ? *query.getCpus() : "";
+    }
+    if (policyKeys.contains("scheduling")) {
+        m_scheduling = query.getScheduling() == (int) SchedFIFO ? SchedFIFO : SchedNormal;
+    }
+    if (policyKeys.contains("priority")) {
+        m_priority = query.getPriority();
+    }
+    if (policyKeys.contains("nice")) {
+        m_nice = query.getNice();
+    }
+}
@@ -0,0 +1,80 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_UTIL_THREADPOLICY_H_
+#define SDRBASE_UTIL_THREADPOLICY_H_
+
+#include <vector>
+
+#include <QString>
+#include <QStringList>
+#include <QByteArray>
+
+#include "export.h"
+
+class QThread;
+class QObject;
+
+namespace SWGSDRangel {
+    class SWGThreadPolicy;
+}
+
+/**
+ * CPU affinity and scheduling of a DSP thread (device engine, device worker or channel baseband).
+ * The default policy (any CPU, normal scheduling, nice 0) leaves the thread as the OS created it.
+ * Affinity and scheduling are fully supported on Linux. On Windows the affinity is supported and
+ * FIFO scheduling maps to time critical priority. Elsewhere applying a policy has no effect.
+ */
+struct SDRBASE_API ThreadPolicy
+{
+    enum Scheduling
+    {
+        SchedNormal, //!< SCHED_OTHER with nice value
+        SchedFIFO    //!< SCHED_FIFO with real time priority (needs CAP_SYS_NICE or rtprio limit on Linux)
+    };
+
+    QString m_cpus;          //!< CPU list as in taskset -c e.g. "0-3,8". Empty for any CPU
+    Scheduling m_scheduling;
+    int m_priority;          //!< SCHED_FIFO priority 1..99
+    int m_nice;              //!< SCHED_OTHER nice value -20..19
+
+    ThreadPolicy();
+    void resetToDefaults();
+    bool isDefault() const;
+    QByteArray serialize() const;
+    bool deserialize(const QByteArray& data);
+    bool operator==(const ThreadPolicy& other) const;
+    bool operator!=(const ThreadPolicy& other) const { return !(*this == other); }
+
+    /** Policy of a channel: its own if set else the device set CPUs with normal scheduling (co-location) */
+    ThreadPolicy inherit(const ThreadPolicy& deviceSetPolicy) const;
+
+    bool applyToCurrentThread() const;
+    /**
+     * Apply to a thread each time it is (re)started until another policy is applied. It is applied
+     * at once if the thread is the calling thread or if threadObject is given: an object living in
+     * the thread that runs an event loop. Any other running thread gets it when it is restarted.
+     */
+    void apply(QThread *thread, QObject *threadObject = nullptr) const;
+
+    void webapiFormat(SWGSDRangel::SWGThreadPolicy& response) const;
+    void webapiUpdate(const QStringList& policyKeys, SWGSDRangel::SWGThreadPolicy& query); //!< only the keys given are changed
+
+    static bool parseCPUs(const QString& cpus, std::vector<int>& cpuList); //!< false if the list is malformed
+};
+
+#endif // SDRBASE_UTIL_THREADPOLICY_H_
@@ -17,12 +17,35 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <QDateTime>
+
+#include "SWGChannelReport.h"
+#include "SWGDeviceReport.h"
+#include "SWGDSPTelemetry.h"
+#include "SWGDeviceSetThreading.h"
+#include "SWGChannelThreadPolicy.h"
+#include "SWGThreadPolicy.h"
+#include "SWGSpectrumStream.h"
+#include "SWGSpectrumZoom.h"
+#include "SWGChannelRecord.h"
+
 #include "plugin/pluginmanager.h"
+#include "channel/channelapi.h"
 #include "channel/channelwebapiadapter.h"
 #include "channel/channelutils.h"
+#include "device/deviceapi.h"
 #include "device/devicewebapiadapter.h"
 #include "device/deviceutils.h"
 #include "dsp/glspectrumsettings.h"
+#include "dsp/dspdevicesourceengine.h"
+#include "dsp/dspdevicesinkengine.h"
+#include "dsp/dsptelemetry.h"
+#include "dsp/devicesamplesource.h"
+#include "dsp/devicesamplemimo.h"
+#include "dsp/filerecord.h"
+#include "dsp/channelrecorder.h"
+#include "dsp/spectrumvis.h"
+#include "dsp/spectrumzoom.h"
 #include "webapiadapterbase.h"
 
 WebAPIAdapterBase::WebAPIAdapterBase()
@@ -418,6 +441,534 @@ void WebAPIAdapterBase::webapiUpdateCommand(
     }
 }
 
+void WebAPIAdapterBase::webapiFormatTelemetry(
+        SWGSDRangel::SWGDeviceReport& response,
+        const DSPTelemetry& telemetry
+)
+{
+    response.setTelemetry(new SWGSDRangel::SWGDSPTelemetry());
+    telemetry.webapiFormat(*response.getTelemetry());
+}
+
+void WebAPIAdapterBase::webapiFormatTelemetry(
+        SWGSDRangel::SWGChannelReport& response,
+        const ChannelAPI *channelAPI
+)
+{
+    const DSPTelemetry *telemetry = channelAPI->getTelemetry();
+
+    if (telemetry)
+    {
+        response.setTelemetry(new SWGSDRangel::SWGDSPTelemetry());
+        telemetry->webapiFormat(*response.getTelemetry());
+    }
+}
+
+void WebAPIAdapterBase::webapiFormatMetrics(
+        QString& metrics,
+        const std::vector<DeviceAPI*>& deviceAPIs
+)
+{
+    std::vector<std::pair<QString, DSPTelemetry::Snapshot>> deviceSnapshots;
+    std::vector<std::pair<QString, DSPTelemetry::Snapshot>> channelSnapshots;
+
+    for (unsigned int deviceSetIndex = 0; deviceSetIndex < deviceAPIs.size(); deviceSetIndex++)
+    {
+        DeviceAPI *deviceAPI = deviceAPIs[deviceSetIndex];
+        QString deviceLabels = QString("deviceset=\"%1\",device=\"%2\"")
+            .arg(deviceSetIndex)
+            .arg(deviceAPI->getHardwareId());
+
+        if (deviceAPI->getDeviceSourceEngine())
+        {
+            deviceSnapshots.push_back(std::pair<QString, DSPTelemetry::Snapshot>{
+                deviceLabels + ",direction=\"rx\"",
+                deviceAPI->getDeviceSourceEngine()->getTelemetry().getSnapshot()
+            });
+        }
+        else if (deviceAPI->getDeviceSinkEngine())
+        {
+            deviceSnapshots.push_back(std::pair<QString, DSPTelemetry::Snapshot>{
+                deviceLabels + ",direction=\"tx\"",
+                deviceAPI->getDeviceSinkEngine()->getTelemetry().getSnapshot()
+            });
+        }
+
+        // channel indexes as in the channel report URL: sink channels first then source channels
+        int nbSinkChannels = deviceAPI->getNbSinkChannels();
+        int nbChannels = nbSinkChannels + deviceAPI->getNbSourceChannels();
+
+        for (int channelIndex = 0; channelIndex < nbChannels; channelIndex++)
+        {
+            ChannelAPI *channelAPI = channelIndex < nbSinkChannels ?
+                deviceAPI->getChanelSinkAPIAt(channelIndex) :
+                deviceAPI->getChanelSourceAPIAt(channelIndex - nbSinkChannels);
+            const DSPTelemetry *telemetry = channelAPI ? channelAPI->getTelemetry() : nullptr;
+
+            if (!telemetry) {
+                continue;
+            }
+
+            QString channelId;
+            channelAPI->getIdentifier(channelId);
+            channelSnapshots.push_back(std::pair<QString, DSPTelemetry::Snapshot>{
+                QString("deviceset=\"%1\",channel=\"%2\",type=\"%3\",direction=\"%4\"")
+                    .arg(deviceSetIndex)
+                    .arg(channelIndex)
+                    .arg(channelId)
+                    .arg(channelIndex < nbSinkChannels ? "rx" : "tx"),
+                telemetry->getSnapshot()
+            });
+        }
+    }
+
+    DSPTelemetry::formatPrometheus(metrics, "sdrangel_device", deviceSnapshots);
+    DSPTelemetry::formatPrometheus(metrics, "sdrangel_channel", channelSnapshots);
+}
+
+static ChannelAPI *getChannelAPIAt(DeviceAPI *deviceAPI, int channelIndex)
+{
+    // channel indexes as in the channel URLs: sink channels then source channels then MIMO channels
+    int nbSinkChannels = deviceAPI->getNbSinkChannels();
+    int nbSourceChannels = deviceAPI->getNbSourceChannels();
+
+    if (channelIndex < 0) {
+        return nullptr;
+    } else if (channelIndex < nbSinkChannels) {
+        return deviceAPI->getChanelSinkAPIAt(channelIndex);
+    } else if (channelIndex < nbSinkChannels + nbSourceChannels) {
+        return deviceAPI->getChanelSourceAPIAt(channelIndex - nbSinkChannels);
+    } else if (channelIndex < nbSinkChannels + nbSourceChannels + deviceAPI->getNbMIMOChannels()) {
+        return deviceAPI->getMIMOChannelAPIAt(channelIndex - nbSinkChannels - nbSourceChannels);
+    } else {
+        return nullptr;
+    }
+}
+
+void WebAPIAdapterBase::webapiFormatThreading(
+        SWGSDRangel::SWGDeviceSetThreading& response,
+        DeviceAPI *deviceAPI
+)
+{
+    response.init();
+    deviceAPI->getThreadPolicy().webapiFormat(*response.getPolicy());
+    int nbChannels = deviceAPI->getNbSinkChannels() + deviceAPI->getNbSourceChannels() + deviceAPI->getNbMIMOChannels();
+
+    for (int channelIndex = 0; channelIndex < nbChannels; channelIndex++)
+    {
+        ChannelAPI *channelAPI = getChannelAPIAt(deviceAPI, channelIndex);
+
+        if (!channelAPI || channelAPI->getThreadPolicy().isDefault()) {
+            continue;
+        }
+
+        response.getChannels()->append(new SWGSDRangel::SWGChannelThreadPolicy);
+        response.getChannels()->back()->init();
+        response.getChannels()->back()->setIndex(channelIndex);
+        channelAPI->getThreadPolicy().webapiFormat(*response.getChannels()->back()->getPolicy());
+    }
+}
+
+static QStringList getSubKeys(const QStringList& keys, const QString& parentKey)
+{
+    QStringList subKeys;
+    QString prefix = parentKey + QString(".");
+
+    for (const QString& key : keys)
+    {
+        if (key.startsWith(prefix)) {
+            subKeys.append(key.mid(prefix.size()));
+        }
+    }
+
+    return subKeys;
+}
+
+bool WebAPIAdapterBase::webapiUpdateThreading(
+        const QStringList& threadingKeys,
+        SWGSDRangel::SWGDeviceSetThreading& query,
+        DeviceAPI *deviceAPI,
+        QString& errorMessage
+)
+{
+    std::vector<int> cpuList;
+    ThreadPolicy deviceSetPolicy = deviceAPI->getThreadPolicy();
+    std::vector<std::pair<ChannelAPI*, ThreadPolicy>> channelPolicies;
+
+    if (query.getPolicy())
+    {
+        deviceSetPolicy.webapiUpdate(getSubKeys(threadingKeys, "policy"), *query.getPolicy());
+
+        if (!ThreadPolicy::parseCPUs(deviceSetPolicy.m_cpus, cpuList))
+        {
+            errorMessage = QString("Malformed CPU list: %1").arg(deviceSetPolicy.m_cpus);
+            return false;
+        }
+    }
+
+    if (query.getChannels())
+    {
+        for (int arrayIndex = 0; arrayIndex < query.getChannels()->size(); arrayIndex++)
+        {
+            SWGSDRangel::SWGChannelThreadPolicy *channelPolicy = query.getChannels()->at(arrayIndex);
+            ChannelAPI *channelAPI = getChannelAPIAt(deviceAPI, channelPolicy->getIndex());
+
+            if (!channelAPI)
+            {
+                errorMessage = QString("There is no channel with index %1").arg(channelPolicy->getIndex());
+                return false;
+            }
+
+            ThreadPolicy policy; // absent policy reverts to the device set default
+
+            if (channelPolicy->getPolicy())
+            {
+                policy = channelAPI->getThreadPolicy();
+                policy.webapiUpdate(
+                    getSubKeys(threadingKeys, QString("channels[%1].policy").arg(arrayIndex)),
+                    *channelPolicy->getPolicy()
+                );
+            }
+
+            if (!ThreadPolicy::parseCPUs(policy.m_cpus, cpuList))
+            {
+                errorMessage = QString("Malformed CPU list of channel %1: %2").arg(channelPolicy->getIndex()).arg(policy.m_cpus);
+                return false;
+            }
+
+            channelPolicies.push_back(std::pair<ChannelAPI*, ThreadPolicy>{channelAPI, policy});
+        }
+    }
+
+    // the query is valid: apply
+    for (const auto& channelPolicy : channelPolicies) {
+        channelPolicy.first->setThreadPolicy(channelPolicy.second);
+    }
+
+    deviceAPI->setThreadPolicy(deviceSetPolicy); // also re-applies channel policies
+
+    return true;
+}
+
+static ChannelRecorder *getChannelRecorder(DeviceAPI *deviceAPI, int channelIndex, QString& errorMessage, int& status)
+{
+    ChannelAPI *channelAPI = getChannelAPIAt(deviceAPI, channelIndex);
+
+    if (!channelAPI)
+    {
+        errorMessage = QString("There is no channel with index %1").arg(channelIndex);
+        status = 404;
+        return nullptr;
+    }
+
+    ChannelRecorder *recorder = channelAPI->getRecorder();
+
+    if (!recorder)
+    {
+        errorMessage = QString("Channel %1 has no recording tap").arg(channelIndex);
+        status = 400;
+        return nullptr;
+    }
+
+    return recorder;
+}
+
+int WebAPIAdapterBase::webapiFormatChannelRecord(
+        SWGSDRangel::SWGChannelRecord& response,
+        DeviceAPI *deviceAPI,
+        int channelIndex,
+        QString& errorMessage
+)
+{
+    int status = 200;
+    ChannelRecorder *recorder = getChannelRecorder(deviceAPI, channelIndex, errorMessage, status);
+
+    if (!recorder) {
+        return status;
+    }
+
+    response.init();
+    response.setRecording(recorder->isRecording() ? 1 : 0);
+    response.setFileName(new QString(recorder->getFileName()));
+    response.setFormat(new QString(RecordFormat::getName(recorder->getFormat())));
+    response.setSampleRate(recorder->getSampleRate());
+    response.setCenterFrequency(recorder->getCenterFrequency());
+    response.setSamplesCount(recorder->getSamplesCount());
+    response.setDroppedBlocks(recorder->getDroppedBlocks());
+
+    return 200;
+}
+
+int WebAPIAdapterBase::webapiStartChannelRecord(
+        SWGSDRangel::SWGChannelRecord& query,
+        SWGSDRangel::SWGChannelRecord& response,
+        DeviceAPI *deviceAPI,
+        int deviceSetIndex,
+        int channelIndex,
+        QString& errorMessage
+)
+{
+    int status = 200;
+    ChannelRecorder *recorder = getChannelRecorder(deviceAPI, channelIndex, errorMessage, status);
+
+    if (!recorder) {
+        return status;
+    }
+
+    RecordFormat::Format format = FileRecord::getDefaultFormat();
+
+    if (query.getFormat() && !query.getFormat()->isEmpty() && !RecordFormat::getFormat(*query.getFormat(), format))
+    {
+        errorMessage = QString("Unknown recording format %1").arg(*query.getFormat());
+        return 400;
+    }
+
+    QString fileName;
+
+    if (query.getFileName() && !query.getFileName()->isEmpty()) {
+        fileName = *query.getFileName();
+    } else {
+        fileName = QString("ch%1_%2_%3.sdriq").arg(deviceSetIndex).arg(channelIndex).arg(QDateTime::currentDateTimeUtc().toString("yyyy-MM-ddTHH_mm_ss_zzz"));
+    }
+
+    qint64 deviceCenterFrequency = 0;
+
+    if (deviceAPI->getSampleSource()) {
+        deviceCenterFrequency = deviceAPI->getSampleSource()->getCenterFrequency();
+    } else if (deviceAPI->getSampleMIMO()) { // Rx channels are not bound to a stream here: first one
+        deviceCenterFrequency = deviceAPI->getSampleMIMO()->getSourceCenterFrequency(0);
+    }
+
+    if (!recorder->startRecording(fileName, format, deviceCenterFrequency))
+    {
+        errorMessage = QString("Cannot open %1").arg(fileName);
+        return 500;
+    }
+
+    return webapiFormatChannelRecord(response, deviceAPI, channelIndex, errorMessage);
+}
+
+int WebAPIAdapterBase::webapiStopChannelRecord(
+        SWGSDRangel::SWGChannelRecord& response,
+        DeviceAPI *deviceAPI,
+        int channelIndex,
+        QString& errorMessage
+)
+{
+    int status = 200;
+    ChannelRecorder *recorder = getChannelRecorder(deviceAPI, channelIndex, errorMessage, status);
+
+    if (!recorder) {
+        return status;
+    }
+
+    recorder->stopRecording(); // waits for the pending data to be written
+    return webapiFormatChannelRecord(response, deviceAPI, channelIndex, errorMessage);
+}
+
+void WebAPIAdapterBase::webapiFormatSpectrumStream(
+        SWGSDRangel::SWGSpectrumStream& response,
+        const SpectrumVis *spectrumVis
+)
+{
+    const SpectrumStreamer& streamer = spectrumVis->getStreamer();
+    SpectrumStreamer::Settings settings = streamer.getSettings();
+    response.init();
+    response.setWsEnable(settings.m_wsEnable ? 1 : 0);
+    *response.getWsAddress() = settings.m_wsAddress;
+    response.setWsPort(settings.m_wsPort);
+    response.setWsClients(streamer.getNbWebSocketClients());
+    response.setUdpEnable(settings.m_udpEnable ? 1 : 0);
+    *response.getUdpAddress() = settings.m_udpAddress;
+    response.setUdpPort(settings.m_udpPort);
+    response.setMaxFrameRate(settings.m_maxFrameRate);
+    response.setMaxBins(settings.m_maxBins);
+    response.setRefLevel(settings.m_refLevel);
+    response.setPowerRange(settings.m_powerRange);
+    response.setFftSize(spectrumVis->getFFTSize());
+    response.setFftOverlap(spectrumVis->getOverlapPercent());
+    response.setFftWindow((int) spectrumVis->getWindow());
+    response.setAveragingMode((int) spectrumVis->getAvgMode());
+    response.setAveragingNb(spectrumVis->getAverageNb());
+    response.setLinear(spectrumVis->getLinear() ? 1 : 0);
+    response.setFrameRate(spectrumVis->getFrameRate());
+    response.setFrameAggregation((int) spectrumVis->getFrameAggMode());
+}
+
+void WebAPIAdapterBase::webapiUpdateSpectrumStream(
+        const QStringList& spectrumStreamKeys,
+        SWGSDRangel::SWGSpectrumStream& query,
+        SWGSDRangel::SWGSpectrumStream& response,
+        SpectrumVis *spectrumVis,
+        bool fftSettings
+)
+{
+    SpectrumStreamer::Settings settings = spectrumVis->getStreamer().getSettings();
+
+    if (spectrumStreamKeys.contains("wsEnable")) {
+        settings.m_wsEnable = query.getWsEnable() != 0;
+    }
+    if (spectrumStreamKeys.contains("wsAddress")) {
+        settings.m_wsAddress = *query.getWsAddress();
+    }
+    if (spectrumStreamKeys.contains("wsPort")) {
+        settings.m_wsPort = query.getWsPort();
+    }
+    if (spectrumStreamKeys.contains("udpEnable")) {
+        settings.m_udpEnable = query.getUdpEnable() != 0;
+    }
+    if (spectrumStreamKeys.contains("udpAddress")) {
+        settings.m_udpAddress = *query.getUdpAddress();
+    }
+    if (spectrumStreamKeys.contains("udpPort")) {
+        settings.m_udpPort = query.getUdpPort();
+    }
+    if (spectrumStreamKeys.contains("maxFrameRate")) {
+        settings.m_maxFrameRate = query.getMaxFrameRate();
+    }
+    if (spectrumStreamKeys.contains("maxBins")) {
+        settings.m_maxBins = query.getMaxBins();
+    }
+    if (spectrumStreamKeys.contains("refLevel")) {
+        settings.m_refLevel = query.getRefLevel();
+    }
+    if (spectrumStreamKeys.contains("powerRange")) {
+        settings.m_powerRange = query.getPowerRange();
+    }
+
+    unsigned int frameRate = spectrumVis->getFrameRate();
+    SpectrumVis::FrameAggMode frameAggMode = spectrumVis->getFrameAggMode();
+
+    if (spectrumStreamKeys.contains("frameRate")) {
+        frameRate = query.getFrameRate() < 0 ? 0 : query.getFrameRate();
+    }
+    if (spectrumStreamKeys.contains("frameAggregation")) {
+        frameAggMode = query.getFrameAggregation() == 1 ? SpectrumVis::FrameAggAverage : SpectrumVis::FrameAggMax;
+    }
+
+    spectrumVis->configureStreamer(settings);
+    spectrumVis->configureFrameRate(frameRate, frameAggMode);
+    webapiFormatSpectrumStream(response, spectrumVis);
+    // configuration is asynchronous: respond with the new settings
+    response.setWsEnable(settings.m_wsEnable ? 1 : 0);
+    *response.getWsAddress() = settings.m_wsAddress;
+    response.setWsPort(settings.m_wsPort);
+    response.setUdpEnable(settings.m_udpEnable ? 1 : 0);
+    *response.getUdpAddress() = settings.m_udpAddress;
+    response.setUdpPort(settings.m_udpPort);
+    response.setMaxFrameRate(settings.m_maxFrameRate);
+    response.setMaxBins(settings.m_maxBins);
+    response.setRefLevel(settings.m_refLevel);
+    response.setPowerRange(settings.m_powerRange);
+    response.setFrameRate(frameRate);
+    response.setFrameAggregation((int) frameAggMode);
+
+    if (!fftSettings) {
+        return;
+    }
+
+    bool fftChanged = false;
+
+    if (spectrumStreamKeys.contains("fftSize")) {
+        response.setFftSize(query.getFftSize());
+        fftChanged = true;
+    }
+    if (spectrumStreamKeys.contains("fftOverlap")) {
+        response.setFftOverlap(query.getFftOverlap());
+        fftChanged = true;
+    }
+    if (spectrumStreamKeys.contains("fftWindow")) {
+        response.setFftWindow(query.getFftWindow());
+        fftChanged = true;
+    }
+    if (spectrumStreamKeys.contains("averagingMode")) {
+        response.setAveragingMode(query.getAveragingMode());
+        fftChanged = true;
+    }
+    if (spectrumStreamKeys.contains("averagingNb")) {
+        response.setAveragingNb(query.getAveragingNb());
+        fftChanged = true;
+    }
+    if (spectrumStreamKeys.contains("linear")) {
+        response.setLinear(query.getLinear());
+        fftChanged = true;
+    }
+
+    if (fftChanged)
+    {
+        spectrumVis->configure(
+            spectrumVis->getInputMessageQueue(),
+            response.getFftSize(),
+            response.getFftOverlap(),
+            response.getAveragingNb(),
+            (SpectrumVis::AvgMode) response.getAveragingMode(),
+            (FFTWindow::Function) response.getFftWindow(),
+            response.getLinear() != 0
+        );
+    }
+}
+
+void WebAPIAdapterBase::webapiFormatSpectrumZoom(
+        SWGSDRangel::SWGSpectrumZoom& response,
+        const SpectrumZoom *spectrumZoom,
+        bool enabled
+)
+{
+    response.init();
+    response.setEnable(enabled ? 1 : 0);
+
+    if (spectrumZoom)
+    {
+        response.setCenterFrequencyOffset(spectrumZoom->getSettings().m_centerFrequencyOffset);
+        response.setSpan(spectrumZoom->getSettings().m_span);
+        response.setZoomCenterFrequencyOffset(spectrumZoom->getCenterFrequencyOffset());
+        response.setZoomSpan(spectrumZoom->getSpan());
+        webapiFormatSpectrumStream(*response.getStream(), spectrumZoom->getSpectrumVis());
+    }
+    else
+    {
+        SpectrumZoom::Settings settings;
+        response.setCenterFrequencyOffset(settings.m_centerFrequencyOffset);
+        response.setSpan(settings.m_span);
+    }
+}
+
+void WebAPIAdapterBase::webapiUpdateSpectrumZoom(
+        const QStringList& spectrumZoomKeys,
+        SWGSDRangel::SWGSpectrumZoom& query,
+        SWGSDRangel::SWGSpectrumZoom& response,
+        SpectrumZoom *spectrumZoom,
+        bool enabled
+)
+{
+    SpectrumZoom::Settings settings = spectrumZoom->getSettings();
+
+    if (spectrumZoomKeys.contains("centerFrequencyOffset")) {
+        settings.m_centerFrequencyOffset = query.getCenterFrequencyOffset();
+    }
+    if (spectrumZoomKeys.contains("span")) {
+        settings.m_span = query.getSpan();
+    }
+
+    spectrumZoom->configure(settings);
+    // configuration is asynchronous: respond with the new settings. Zoomed span is the current one
+    response.init();
+    response.setEnable(enabled ? 1 : 0);
+    response.setCenterFrequencyOffset(settings.m_centerFrequencyOffset);
+    response.setSpan(settings.m_span);
+    response.setZoomCenterFrequencyOffset(spectrumZoom->getCenterFrequencyOffset());
+    response.setZoomSpan(spectrumZoom->getSpan());
+    SWGSDRangel::SWGSpectrumStream noStreamQuery;
+    // the zoomed spectrum has no display: the FFT settings are always those of the query
+    webapiUpdateSpectrumStream(
+        getSubKeys(spectrumZoomKeys, "stream"),
+        query.getStream() ? *query.getStream() : noStreamQuery,
+        *response.getStream(),
+        spectrumZoom->getSpectrumVis(),
+        true
+    );
+}
+
 ChannelWebAPIAdapter *WebAPIAdapterBase::WebAPIChannelAdapters::getChannelWebAPIAdapter(const QString& channelURI, const PluginManager *pluginManager)
 {
     QString registeredChannelURI = ChannelUtils::getRegisteredChannelURI(channelURI);
@@ -19,6 +19,8 @@
 #ifndef SDRBASE_WEBAPI_WEBAPIADAPTERBASE_H_
 #define SDRBASE_WEBAPI_WEBAPIADAPTERBASE_H_
 
+#include <vector>
+
 #include <QMap>
 
 #include "export.h"
@@ -34,6 +36,21 @@
 class PluginManager;
 class ChannelWebAPIAdapter;
 class DeviceWebAPIAdapter;
+class DeviceAPI;
+class ChannelAPI;
+class DSPTelemetry;
+class SpectrumVis;
+class SpectrumZoom;
+
+namespace SWGSDRangel
+{
+    class SWGChannelReport;
+    class SWGChannelRecord;
+    class SWGDeviceReport;
+    class SWGDeviceSetThreading;
+    class SWGSpectrumStream;
+    class SWGSpectrumZoom;
+}
 
 /**
  * Adapter between API and objects in sdrbase library
@@ -77,6 +94,85 @@ public:
         const WebAPIAdapterInterface::CommandKeys& commandKeys,
         Command& command
     );
+    static void webapiFormatTelemetry(
+        SWGSDRangel::SWGDeviceReport& response,
+        const DSPTelemetry& telemetry
+    );
+    static void webapiFormatTelemetry(
+        SWGSDRangel::SWGChannelReport& response,
+        const ChannelAPI *channelAPI
+    );
+    /** Prometheus text exposition of the telemetry of the device engines and channels of all device sets */
+    static void webapiFormatMetrics(
+        QString& metrics,
+        const std::vector<DeviceAPI*>& deviceAPIs
+    );
+    /** Thread policies of a device set and of its channels with their own policy */
+    static void webapiFormatThreading(
+        SWGSDRangel::SWGDeviceSetThreading& response,
+        DeviceAPI *deviceAPI
+    );
+    /**
+     * Set and apply thread policies. Only the keys present in the query are changed. Keys are
+     * "policy.<key>" for the device set and "channels.<position>.policy.<key>" for the channels.
+     * Returns false with an error message if the query is not valid
+     */
+    static bool webapiUpdateThreading(
+        const QStringList& threadingKeys,
+        SWGSDRangel::SWGDeviceSetThreading& query,
+        DeviceAPI *deviceAPI,
+        QString& errorMessage
+    );
+    /** Spectrum engine and streaming settings and streaming status of a device set spectrum */
+    static void webapiFormatSpectrumStream(
+        SWGSDRangel::SWGSpectrumStream& response,
+        const SpectrumVis *spectrumVis
+    );
+    /** Apply the streaming settings and if fftSettings the spectrum engine settings given in the query */
+    static void webapiUpdateSpectrumStream(
+        const QStringList& spectrumStreamKeys,
+        SWGSDRangel::SWGSpectrumStream& query,
+        SWGSDRangel::SWGSpectrumStream& response,
+        SpectrumVis *spectrumVis,
+        bool fftSettings
+    );
+    /** Spectrum zoom settings and status of a Rx device set. spectrumZoom is null if it was never enabled */
+    static void webapiFormatSpectrumZoom(
+        SWGSDRangel::SWGSpectrumZoom& response,
+        const SpectrumZoom *spectrumZoom,
+        bool enabled
+    );
+    /** Apply the span, streaming and FFT settings given in the query to the spectrum zoom */
+    static void webapiUpdateSpectrumZoom(
+        const QStringList& spectrumZoomKeys,
+        SWGSDRangel::SWGSpectrumZoom& query,
+        SWGSDRangel::SWGSpectrumZoom& response,
+        SpectrumZoom *spectrumZoom,
+        bool enabled
+    );
+    /** Status of the recording of a channel after its channelizer. Returns the Http status code */
+    static int webapiFormatChannelRecord(
+        SWGSDRangel::SWGChannelRecord& response,
+        DeviceAPI *deviceAPI,
+        int channelIndex,
+        QString& errorMessage
+    );
+    /** (Re)start the recording of a channel with the file name and format of the query if any. Returns the Http status code */
+    static int webapiStartChannelRecord(
+        SWGSDRangel::SWGChannelRecord& query,
+        SWGSDRangel::SWGChannelRecord& response,
+        DeviceAPI *deviceAPI,
+        int deviceSetIndex,
+        int channelIndex,
+        QString& errorMessage
+    );
+    /** Stop the recording of a channel. Returns the Http status code */
+    static int webapiStopChannelRecord(
+        SWGSDRangel::SWGChannelRecord& response,
+        DeviceAPI *deviceAPI,
+        int channelIndex,
+        QString& errorMessage
+    );
 
 private:
     class WebAPIChannelAdapters
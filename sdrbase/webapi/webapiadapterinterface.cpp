@@ -30,6 +30,7 @@ QString WebAPIAdapterInterface::instanceAudioOutputParametersURL = "/sdrangel/au
 QString WebAPIAdapterInterface::instanceAudioInputCleanupURL = "/sdrangel/audio/input/cleanup";
 QString WebAPIAdapterInterface::instanceAudioOutputCleanupURL = "/sdrangel/audio/output/cleanup";
 QString WebAPIAdapterInterface::instanceLocationURL = "/sdrangel/location";
+QString WebAPIAdapterInterface::instanceMetricsURL = "/sdrangel/metrics";
 QString WebAPIAdapterInterface::instanceAMBESerialURL = "/sdrangel/ambe/serial";
 QString WebAPIAdapterInterface::instanceAMBEDevicesURL = "/sdrangel/ambe/devices";
 QString WebAPIAdapterInterface::instanceLimeRFESerialURL = "/sdrangel/limerfe/serial";
@@ -44,6 +45,9 @@ QString WebAPIAdapterInterface::instanceDeviceSetURL = "/sdrangel/deviceset";
 
 std::regex WebAPIAdapterInterface::devicesetURLRe("^/sdrangel/deviceset/([0-9]{1,2})$");
 std::regex WebAPIAdapterInterface::devicesetFocusURLRe("^/sdrangel/deviceset/([0-9]{1,2})/focus$");
+std::regex WebAPIAdapterInterface::devicesetThreadingURLRe("^/sdrangel/deviceset/([0-9]{1,2})/threading$");
+std::regex WebAPIAdapterInterface::devicesetSpectrumStreamURLRe("^/sdrangel/deviceset/([0-9]{1,2})/spectrum/stream$");
+std::regex WebAPIAdapterInterface::devicesetSpectrumZoomURLRe("^/sdrangel/deviceset/([0-9]{1,2})/spectrum/zoom$");
 std::regex WebAPIAdapterInterface::devicesetDeviceURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device$");
 std::regex WebAPIAdapterInterface::devicesetDeviceSettingsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/settings$");
 std::regex WebAPIAdapterInterface::devicesetDeviceRunURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/run$");
@@ -56,6 +60,7 @@ std::regex WebAPIAdapterInterface::devicesetChannelIndexURLRe("^/sdrangel/device
 std::regex WebAPIAdapterInterface::devicesetChannelSettingsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/settings$");
 std::regex WebAPIAdapterInterface::devicesetChannelReportURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/report");
 std::regex WebAPIAdapterInterface::devicesetChannelActionsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/actions");
+std::regex WebAPIAdapterInterface::devicesetChannelRecordURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/record$");
 
 void WebAPIAdapterInterface::ConfigKeys::debug() const
 {
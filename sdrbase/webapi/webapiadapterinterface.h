@@ -52,6 +52,9 @@ namespace SWGSDRangel
     class SWGPresetExport;
     class SWGDeviceSetList;
     class SWGDeviceSet;
+    class SWGDeviceSetThreading;
+    class SWGSpectrumStream;
+    class SWGSpectrumZoom;
     class SWGDeviceListItem;
     class SWGDeviceSettings;
     class SWGDeviceState;
@@ -61,6 +64,7 @@ namespace SWGSDRangel
     class SWGChannelSettings;
     class SWGChannelReport;
     class SWGChannelActions;
+    class SWGChannelRecord;
     class SWGSuccessResponse;
 }
 
@@ -354,6 +358,21 @@ public:
     	return 501;
     }
 
+    /**
+     * Handler of /sdrangel/metrics (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceMetrics
+     * DSP hot path telemetry of device engines and channels in Prometheus text exposition format
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int instanceMetricsGet(
+            QString& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) response;
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
     /**
      * Handler of /sdrangel/ambe/serial (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
      * returns the Http status code (default 501: not implemented)
@@ -690,6 +709,114 @@ public:
         return 501;
     }
 
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/threading (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetThreadingGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGDeviceSetThreading& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/threading (PUT) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetThreadingPut(
+            int deviceSetIndex,
+            const QStringList& threadingKeys,
+            SWGSDRangel::SWGDeviceSetThreading& query,
+            SWGSDRangel::SWGDeviceSetThreading& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) threadingKeys;
+        (void) query;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/spectrum/stream (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumStreamGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGSpectrumStream& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/spectrum/stream (PUT) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumStreamPut(
+            int deviceSetIndex,
+            const QStringList& spectrumStreamKeys,
+            SWGSDRangel::SWGSpectrumStream& query,
+            SWGSDRangel::SWGSpectrumStream& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) spectrumStreamKeys;
+        (void) query;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/spectrum/zoom (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumZoomGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGSpectrumZoom& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/spectrum/zoom (PUT) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumZoomPut(
+            int deviceSetIndex,
+            const QStringList& spectrumZoomKeys,
+            SWGSDRangel::SWGSpectrumZoom& query,
+            SWGSDRangel::SWGSpectrumZoom& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) spectrumZoomKeys;
+        (void) query;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
     /**
      * Handler of /sdrangel/deviceset/{devicesetIndex}/device (PUT) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
      * returns the Http status code (default 501: not implemented)
@@ -1017,6 +1144,62 @@ public:
         return 501;
     }
 
+    /**
+     * Handler of /sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/record (GET)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetChannelRecordGet(
+            int deviceSetIndex,
+            int channelIndex,
+            SWGSDRangel::SWGChannelRecord& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) channelIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/record (POST)
+     * starts the recording of the channel samples after its channelizer (default 501: not implemented)
+     */
+    virtual int devicesetChannelRecordPost(
+            int deviceSetIndex,
+            int channelIndex,
+            SWGSDRangel::SWGChannelRecord& query,
+            SWGSDRangel::SWGChannelRecord& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) channelIndex;
+        (void) query;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/record (DELETE)
+     * stops the recording of the channel samples (default 501: not implemented)
+     */
+    virtual int devicesetChannelRecordDelete(
+            int deviceSetIndex,
+            int channelIndex,
+            SWGSDRangel::SWGChannelRecord& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) channelIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
     static QString instanceSummaryURL;
     static QString instanceConfigURL;
     static QString instanceDevicesURL;
@@ -1028,6 +1211,7 @@ public:
     static QString instanceAudioInputCleanupURL;
     static QString instanceAudioOutputCleanupURL;
     static QString instanceLocationURL;
+    static QString instanceMetricsURL;
     static QString instanceAMBESerialURL;
     static QString instanceAMBEDevicesURL;
     static QString instanceLimeRFESerialURL;
@@ -1041,6 +1225,9 @@ public:
     static QString instanceDeviceSetURL;
     static std::regex devicesetURLRe;
     static std::regex devicesetFocusURLRe;
+    static std::regex devicesetThreadingURLRe;
+    static std::regex devicesetSpectrumStreamURLRe;
+    static std::regex devicesetSpectrumZoomURLRe;
     static std::regex devicesetDeviceURLRe;
     static std::regex devicesetDeviceSettingsURLRe;
     static std::regex devicesetDeviceRunURLRe;
@@ -1052,6 +1239,7 @@ public:
     static std::regex devicesetChannelSettingsURLRe;
     static std::regex devicesetChannelReportURLRe;
     static std::regex devicesetChannelActionsURLRe;
+    static std::regex devicesetChannelRecordURLRe;
     static std::regex devicesetChannelsReportURLRe;
 };
 
@@ -43,11 +43,15 @@
 #include "SWGPresetExport.h"
 #include "SWGDeviceSettings.h"
 #include "SWGDeviceState.h"
+#include "SWGDeviceSetThreading.h"
+#include "SWGSpectrumStream.h"
+#include "SWGSpectrumZoom.h"
 #include "SWGDeviceReport.h"
 #include "SWGDeviceActions.h"
 #include "SWGChannelsDetail.h"
 #include "SWGChannelSettings.h"
 #include "SWGChannelReport.h"
+#include "SWGChannelRecord.h"
 #include "SWGChannelActions.h"
 #include "SWGSuccessResponse.h"
 #include "SWGErrorResponse.h"
@@ -185,6 +189,7 @@ const QMap<QString, QString> WebAPIRequestMapper::m_sourceDeviceHwIdToActionsKey
     {"BladeRF1", "bladeRF1InputActions"},
     {"FCDPro", "fcdProActions"},
     {"FCDPro+", "fcdProPlusActions"},
+    {"FileInput", "fileInputActions"},
     {"HackRF", "hackRFInputActions"},
     {"KiwiSDR", "kiwiSDRActions"},
     {"LimeSDR", "limeSdrInputActions"},
@@ -293,6 +298,8 @@ void WebAPIRequestMapper::service(qtwebapp::HttpRequest& request, qtwebapp::Http
             instanceAudioOutputCleanupService(request, response);
         } else if (path == WebAPIAdapterInterface::instanceLocationURL) {
             instanceLocationService(request, response);
+        } else if (path == WebAPIAdapterInterface::instanceMetricsURL) {
+            instanceMetricsService(request, response);
         } else if (path == WebAPIAdapterInterface::instanceAMBESerialURL) {
             instanceAMBESerialService(request, response);
         } else if (path == WebAPIAdapterInterface::instanceAMBEDevicesURL) {
@@ -327,6 +334,12 @@ void WebAPIRequestMapper::service(qtwebapp::HttpRequest& request, qtwebapp::Http
                 devicesetDeviceService(std::string(desc_match[1]), request, response);
             } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetFocusURLRe)) {
                 devicesetFocusService(std::string(desc_match[1]), request, response);
+            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetThreadingURLRe)) {
+                devicesetThreadingService(std::string(desc_match[1]), request, response);
+            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetSpectrumStreamURLRe)) {
+                devicesetSpectrumStreamService(std::string(desc_match[1]), request, response);
+            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetSpectrumZoomURLRe)) {
+                devicesetSpectrumZoomService(std::string(desc_match[1]), request, response);
             } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceSettingsURLRe)) {
                 devicesetDeviceSettingsService(std::string(desc_match[1]), request, response);
             } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceRunURLRe)) {
@@ -349,6 +362,8 @@ void WebAPIRequestMapper::service(qtwebapp::HttpRequest& request, qtwebapp::Http
                 devicesetChannelReportService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
             } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelActionsURLRe)) {
                 devicesetChannelActionsService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
+            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelRecordURLRe)) {
+                devicesetChannelRecordService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
             }
             else // serve static documentation pages
             {
@@ -893,6 +908,39 @@ void WebAPIRequestMapper::instanceLocationService(qtwebapp::HttpRequest& request
     }
 }
 
+void WebAPIRequestMapper::instanceMetricsService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    if (request.getMethod() == "GET")
+    {
+        QString normalResponse;
+
+        int status = m_adapter->instanceMetricsGet(normalResponse, errorResponse);
+        response.setStatus(status);
+
+        if (status/100 == 2)
+        {
+            response.setHeader("Content-Type", "text/plain; version=0.0.4");
+            response.write(normalResponse.toUtf8());
+        }
+        else
+        {
+            response.setHeader("Content-Type", "application/json");
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    else
+    {
+        response.setHeader("Content-Type", "application/json");
+        response.setStatus(405,"Invalid HTTP method");
+        errorResponse.init();
+        *errorResponse.getMessage() = "Invalid HTTP method";
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
 void WebAPIRequestMapper::instanceAMBESerialService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
 {
     SWGSDRangel::SWGErrorResponse errorResponse;
@@ -1635,6 +1683,221 @@ void WebAPIRequestMapper::devicesetFocusService(const std::string& indexStr, qtw
     }
 }
 
+void WebAPIRequestMapper::devicesetThreadingService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+
+        if (request.getMethod() == "GET")
+        {
+            SWGSDRangel::SWGDeviceSetThreading normalResponse;
+            int status = m_adapter->devicesetThreadingGet(deviceSetIndex, normalResponse, errorResponse);
+
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else if (request.getMethod() == "PUT")
+        {
+            QString jsonStr = request.getBody();
+            QJsonObject jsonObject;
+
+            if (parseJsonBody(jsonStr, jsonObject, response))
+            {
+                SWGSDRangel::SWGDeviceSetThreading query;
+                SWGSDRangel::SWGDeviceSetThreading normalResponse;
+                QStringList threadingKeys;
+                appendThreadingKeys(jsonObject, threadingKeys);
+                query.fromJson(jsonStr);
+                int status = m_adapter->devicesetThreadingPut(deviceSetIndex, threadingKeys, query, normalResponse, errorResponse);
+
+                response.setStatus(status);
+
+                if (status/100 == 2) {
+                    response.write(normalResponse.asJson().toUtf8());
+                } else {
+                    response.write(errorResponse.asJson().toUtf8());
+                }
+            }
+            else
+            {
+                response.setStatus(400,"Invalid JSON format");
+                errorResponse.init();
+                *errorResponse.getMessage() = "Invalid JSON format";
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(405,"Invalid HTTP method");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid HTTP method";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on device set index";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+void WebAPIRequestMapper::devicesetSpectrumStreamService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+
+        if (request.getMethod() == "GET")
+        {
+            SWGSDRangel::SWGSpectrumStream normalResponse;
+            int status = m_adapter->devicesetSpectrumStreamGet(deviceSetIndex, normalResponse, errorResponse);
+
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else if (request.getMethod() == "PUT")
+        {
+            QString jsonStr = request.getBody();
+            QJsonObject jsonObject;
+
+            if (parseJsonBody(jsonStr, jsonObject, response))
+            {
+                SWGSDRangel::SWGSpectrumStream query;
+                SWGSDRangel::SWGSpectrumStream normalResponse;
+                QStringList spectrumStreamKeys = jsonObject.keys();
+                query.fromJson(jsonStr);
+                int status = m_adapter->devicesetSpectrumStreamPut(deviceSetIndex, spectrumStreamKeys, query, normalResponse, errorResponse);
+
+                response.setStatus(status);
+
+                if (status/100 == 2) {
+                    response.write(normalResponse.asJson().toUtf8());
+                } else {
+                    response.write(errorResponse.asJson().toUtf8());
+                }
+            }
+            else
+            {
+                response.setStatus(400,"Invalid JSON format");
+                errorResponse.init();
+                *errorResponse.getMessage() = "Invalid JSON format";
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(405,"Invalid HTTP method");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid HTTP method";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on device set index";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+void WebAPIRequestMapper::devicesetSpectrumZoomService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+
+        if (request.getMethod() == "GET")
+        {
+            SWGSDRangel::SWGSpectrumZoom normalResponse;
+            int status = m_adapter->devicesetSpectrumZoomGet(deviceSetIndex, normalResponse, errorResponse);
+
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else if (request.getMethod() == "PUT")
+        {
+            QString jsonStr = request.getBody();
+            QJsonObject jsonObject;
+
+            if (parseJsonBody(jsonStr, jsonObject, response))
+            {
+                SWGSDRangel::SWGSpectrumZoom query;
+                SWGSDRangel::SWGSpectrumZoom normalResponse;
+                QStringList spectrumZoomKeys = jsonObject.keys();
+
+                if (jsonObject.contains("stream"))
+                {
+                    QJsonObject streamJsonObject;
+                    appendSettingsSubKeys(jsonObject, streamJsonObject, "stream", spectrumZoomKeys);
+                }
+
+                query.fromJson(jsonStr);
+                int status = m_adapter->devicesetSpectrumZoomPut(deviceSetIndex, spectrumZoomKeys, query, normalResponse, errorResponse);
+
+                response.setStatus(status);
+
+                if (status/100 == 2) {
+                    response.write(normalResponse.asJson().toUtf8());
+                } else {
+                    response.write(errorResponse.asJson().toUtf8());
+                }
+            }
+            else
+            {
+                response.setStatus(400,"Invalid JSON format");
+                errorResponse.init();
+                *errorResponse.getMessage() = "Invalid JSON format";
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(405,"Invalid HTTP method");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid HTTP method";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on device set index";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
 void WebAPIRequestMapper::devicesetDeviceService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
 {
     SWGSDRangel::SWGErrorResponse errorResponse;
@@ -2433,6 +2696,93 @@ bool WebAPIRequestMapper::parseJsonBody(QString& jsonStr, QJsonObject& jsonObjec
     }
 }
 
+void WebAPIRequestMapper::devicesetChannelRecordService(
+        const std::string& deviceSetIndexStr,
+        const std::string& channelIndexStr,
+        qtwebapp::HttpRequest& request,
+        qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(deviceSetIndexStr);
+        int channelIndex = boost::lexical_cast<int>(channelIndexStr);
+
+        if (request.getMethod() == "GET")
+        {
+            SWGSDRangel::SWGChannelRecord normalResponse;
+            int status = m_adapter->devicesetChannelRecordGet(deviceSetIndex, channelIndex, normalResponse, errorResponse);
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else if (request.getMethod() == "POST")
+        {
+            QString jsonStr = request.getBody();
+            QJsonObject jsonObject;
+            SWGSDRangel::SWGChannelRecord query;
+
+            // the body is optional
+            if (!jsonStr.trimmed().isEmpty())
+            {
+                if (!parseJsonBody(jsonStr, jsonObject, response))
+                {
+                    response.setStatus(400,"Invalid JSON format");
+                    errorResponse.init();
+                    *errorResponse.getMessage() = "Invalid JSON format";
+                    response.write(errorResponse.asJson().toUtf8());
+                    return;
+                }
+
+                query.fromJsonObject(jsonObject);
+            }
+
+            SWGSDRangel::SWGChannelRecord normalResponse;
+            int status = m_adapter->devicesetChannelRecordPost(deviceSetIndex, channelIndex, query, normalResponse, errorResponse);
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else if (request.getMethod() == "DELETE")
+        {
+            SWGSDRangel::SWGChannelRecord normalResponse;
+            int status = m_adapter->devicesetChannelRecordDelete(deviceSetIndex, channelIndex, normalResponse, errorResponse);
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(405,"Invalid HTTP method");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid HTTP method";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on index";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
 bool WebAPIRequestMapper::validatePresetTransfer(SWGSDRangel::SWGPresetTransfer& presetTransfer)
 {
     SWGSDRangel::SWGPresetIdentifier *presetIdentifier = presetTransfer.getPreset();
@@ -3502,6 +3852,11 @@ bool WebAPIRequestMapper::getDeviceActions(
             deviceActions->setFcdProPlusActions(new SWGSDRangel::SWGFCDProPlusActions());
             deviceActions->getFcdProPlusActions()->fromJsonObject(actionsJsonObject);
         }
+        else if (deviceActionsKey == "fileInputActions")
+        {
+            deviceActions->setFileInputActions(new SWGSDRangel::SWGFileInputActions());
+            deviceActions->getFileInputActions()->fromJsonObject(actionsJsonObject);
+        }
         else if (deviceActionsKey == "hackRFInputActions")
         {
             deviceActions->setHackRfInputActions(new SWGSDRangel::SWGHackRFInputActions());
@@ -3614,6 +3969,33 @@ void WebAPIRequestMapper::appendSettingsArrayKeys(
     }
 }
 
+void WebAPIRequestMapper::appendThreadingKeys(
+        const QJsonObject& threadingJsonObject,
+        QStringList& threadingKeys)
+{
+    if (threadingJsonObject.contains("policy"))
+    {
+        QJsonObject policyJsonObject;
+        appendSettingsSubKeys(threadingJsonObject, policyJsonObject, "policy", threadingKeys);
+    }
+
+    QJsonArray channelsJson = threadingJsonObject["channels"].toArray();
+
+    for (int arrayIndex = 0; arrayIndex < channelsJson.count(); arrayIndex++)
+    {
+        QJsonObject channelJsonObject = channelsJson.at(arrayIndex).toObject();
+
+        if (channelJsonObject.contains("policy"))
+        {
+            QStringList policyKeys = channelJsonObject["policy"].toObject().keys();
+
+            for (int i = 0; i < policyKeys.size(); i++) {
+                threadingKeys.append(tr("channels[%1].policy.%2").arg(arrayIndex).arg(policyKeys[i]));
+            }
+        }
+    }
+}
+
 void WebAPIRequestMapper::resetDeviceSettings(SWGSDRangel::SWGDeviceSettings& deviceSettings)
 {
     deviceSettings.cleanup();
@@ -3643,6 +4025,7 @@ void WebAPIRequestMapper::resetDeviceReport(SWGSDRangel::SWGDeviceReport& device
 {
     deviceReport.cleanup();
     deviceReport.setDeviceHwType(nullptr);
+    deviceReport.setTelemetry(nullptr);
     deviceReport.setAirspyHfReport(nullptr);
     deviceReport.setAirspyReport(nullptr);
     deviceReport.setFileInputReport(nullptr);
@@ -3666,6 +4049,7 @@ void WebAPIRequestMapper::resetDeviceActions(SWGSDRangel::SWGDeviceActions& devi
     deviceActions.setBladeRf1InputActions(nullptr);
     deviceActions.setFcdProActions(nullptr);
     deviceActions.setFcdProPlusActions(nullptr);
+    deviceActions.setFileInputActions(nullptr);
     deviceActions.setHackRfInputActions(nullptr);
     deviceActions.setKiwiSdrActions(nullptr);
     deviceActions.setLimeSdrInputActions(nullptr);
@@ -3705,6 +4089,7 @@ void WebAPIRequestMapper::resetChannelReport(SWGSDRangel::SWGChannelReport& chan
 {
     channelReport.cleanup();
     channelReport.setChannelType(nullptr);
+    channelReport.setTelemetry(nullptr);
     channelReport.setAmDemodReport(nullptr);
     channelReport.setAmModReport(nullptr);
     channelReport.setAtvModReport(nullptr);
@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+#include <random>
+
+#include <QDebug>
+
+#include "device/deviceapi.h"
+#include "dsp/dspcommands.h"
+
+#include "benchsamplesource.h"
+
+static const unsigned int benchBlockSize = 4096;     //!< samples written to the FIFO at once
+static const unsigned int benchSignalSize = 1 << 16; //!< test signal period in samples (multiple of benchBlockSize)
+
+BenchSampleSource::BenchSampleSource(DeviceAPI *deviceAPI, int sampleRate, quint64 nbSamples, bool realtime) :
+    m_deviceAPI(deviceAPI),
+    m_deviceDescription("BenchSampleSource"),
+    m_sampleRate(sampleRate),
+    m_centerFrequency(100000000),
+    m_nbSamples(nbSamples),
+    m_realtime(realtime),
+    m_thread(this),
+    m_running(0),
+    m_dispatchedCount(0),
+    m_elapsedNsecs(0),
+    m_fifoHighWater(0)
+{
+    m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(m_sampleRate));
+    createSignal();
+}
+
+BenchSampleSource::~BenchSampleSource()
+{
+    stop();
+}
+
+void BenchSampleSource::createSignal()
+{
+    // AM carrier at the center plus two tones in white noise
+    std::mt19937 generator;
+    std::uniform_real_distribution<float> noise(-0.01f, 0.01f);
+    m_signal.resize(benchSignalSize);
+
+    for (unsigned int i = 0; i < benchSignalSize; i++)
+    {
+        float am = 0.2f * (1.0f + 0.5f * sin(2.0 * M_PI * 1000.0 * i / m_sampleRate));
+        float phi1 = 2.0 * M_PI * 12500.0 * i / m_sampleRate;
+        float phi2 = 2.0 * M_PI * -100000.0 * i / m_sampleRate;
+        float re = am + 0.1f * cos(phi1) + 0.1f * cos(phi2) + noise(generator);
+        float im = 0.1f * sin(phi1) + 0.1f * sin(phi2) + noise(generator);
+        m_signal[i].setReal(re * SDR_RX_SCALEF);
+        m_signal[i].setImag(im * SDR_RX_SCALEF);
+    }
+}
+
+bool BenchSampleSource::start()
+{
+    if (m_thread.isRunning()) {
+        return true;
+    }
+
+    DSPSignalNotification *notif = new DSPSignalNotification(m_sampleRate, m_centerFrequency);
+    m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
+
+    m_running.storeRelease(1);
+    m_clock.start();
+    m_thread.start();
+    return true;
+}
+
+void BenchSampleSource::stop()
+{
+    m_running.storeRelease(0);
+    m_thread.wait();
+}
+
+void BenchSampleSource::generate()
+{
+    quint64 written = 0;
+    unsigned int index = 0;
+
+    while (m_running.loadAcquire() && (written < m_nbSamples))
+    {
+        unsigned int count = std::min((quint64) benchBlockSize, m_nbSamples - written);
+
+        if (m_realtime)
+        {
+            qint64 dueNsecs = (written * 1000000000ULL) / m_sampleRate;
+            qint64 nowNsecs = m_clock.nsecsElapsed();
+
+            if (dueNsecs > nowNsecs) {
+                QThread::usleep((dueNsecs - nowNsecs) / 1000);
+            }
+        }
+
+        // never overflow the FIFO: the measure is the rate at which the pipeline drains it
+        while (m_sampleFifo.size() - m_sampleFifo.fill() < count)
+        {
+            if (!m_running.loadAcquire()) {
+                return;
+            }
+
+            QThread::usleep(50);
+        }
+
+        m_mutex.lock();
+        m_blocks.push_back(Block{written + count, m_clock.nsecsElapsed()});
+        m_mutex.unlock();
+
+        m_sampleFifo.write(m_signal.begin() + index, m_signal.begin() + index + count);
+        m_fifoHighWater = std::max(m_fifoHighWater, m_sampleFifo.fill());
+        written += count;
+        index = (index + count) % benchSignalSize;
+    }
+}
+
+void BenchSampleSource::samplesDispatched(unsigned int count)
+{
+    quint64 dispatchedCount = m_dispatchedCount.loadAcquire() + count;
+    qint64 nowNsecs = m_clock.nsecsElapsed();
+
+    m_mutex.lock();
+
+    while (!m_blocks.empty() && (m_blocks.front().m_endCount <= dispatchedCount))
+    {
+        m_latencies.push_back(nowNsecs - m_blocks.front().m_writeNsecs);
+        m_blocks.pop_front();
+    }
+
+    m_mutex.unlock();
+
+    if (dispatchedCount >= m_nbSamples) {
+        m_elapsedNsecs = nowNsecs;
+    }
+
+    m_dispatchedCount.storeRelease(dispatchedCount);
+}
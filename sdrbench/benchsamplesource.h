@@ -0,0 +1,111 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBENCH_BENCHSAMPLESOURCE_H_
+#define SDRBENCH_BENCHSAMPLESOURCE_H_
+
+#include <deque>
+#include <vector>
+
+#include <QThread>
+#include <QMutex>
+#include <QElapsedTimer>
+#include <QAtomicInteger>
+
+#include "dsp/devicesamplesource.h"
+#include "dsp/dsptypes.h"
+
+class DeviceAPI;
+
+/**
+ * Synthetic device sample source for the pipeline benchmark. Writes a fixed number of samples
+ * of a multi tone test signal to its FIFO from its own thread either as fast as the device engine
+ * drains the FIFO or paced at the nominal sample rate (realtime).
+ * Each block written is time stamped so that the latency up to the dispatch of the samples
+ * to the channels can be measured by a probe sink attached last to the device engine.
+ * The probe is one of the sinks fed directly by the engine which are fed before the copy to the
+ * shared baseband ring. Thus the latency spans the FIFO, the engine wakeup and the feed of the
+ * direct sinks (channels with their own FIFO) but not the ring copy nor the wakeup of its readers.
+ */
+class BenchSampleSource : public DeviceSampleSource
+{
+public:
+    BenchSampleSource(DeviceAPI *deviceAPI, int sampleRate, quint64 nbSamples, bool realtime);
+    virtual ~BenchSampleSource();
+    virtual void destroy() { delete this; }
+
+    virtual void init() {}
+    virtual bool start();
+    virtual void stop();
+
+    virtual QByteArray serialize() const { return QByteArray(); }
+    virtual bool deserialize(const QByteArray& data) { (void) data; return false; }
+
+    virtual const QString& getDeviceDescription() const { return m_deviceDescription; }
+    virtual int getSampleRate() const { return m_sampleRate; }
+    virtual void setSampleRate(int sampleRate) { (void) sampleRate; }
+    virtual quint64 getCenterFrequency() const { return m_centerFrequency; }
+    virtual void setCenterFrequency(qint64 centerFrequency) { (void) centerFrequency; }
+
+    virtual bool handleMessage(const Message& message) { (void) message; return false; }
+    virtual void setMessageQueueToGUI(MessageQueue *queue) { m_guiMessageQueue = queue; }
+
+    void samplesDispatched(unsigned int count); //!< called from the device engine thread when count samples have been sent to the channels
+    bool isDone() { return m_dispatchedCount.loadAcquire() >= m_nbSamples; }
+    quint64 getDispatchedCount() { return m_dispatchedCount.loadAcquire(); }
+    qint64 getElapsedNsecs() const { return m_elapsedNsecs; } //!< from start to the dispatch of the last sample
+    unsigned int getFifoHighWater() const { return m_fifoHighWater; }
+    const std::vector<qint64>& getLatencies() const { return m_latencies; } //!< nanoseconds per block. Valid after stop.
+
+private:
+    class GeneratorThread : public QThread
+    {
+    public:
+        GeneratorThread(BenchSampleSource *source) : m_source(source) {}
+    private:
+        virtual void run() { m_source->generate(); }
+        BenchSampleSource *m_source;
+    };
+
+    struct Block
+    {
+        quint64 m_endCount;   //!< total samples written including this block
+        qint64 m_writeNsecs;  //!< time stamp of the write
+    };
+
+    DeviceAPI *m_deviceAPI;
+    QString m_deviceDescription;
+    int m_sampleRate;
+    quint64 m_centerFrequency;
+    quint64 m_nbSamples;
+    bool m_realtime;
+    SampleVector m_signal;
+    GeneratorThread m_thread;
+    QAtomicInteger<int> m_running;
+    QElapsedTimer m_clock;
+    QMutex m_mutex;              //!< protects m_blocks and m_latencies
+    std::deque<Block> m_blocks;  //!< written blocks not yet dispatched
+    std::vector<qint64> m_latencies;
+    QAtomicInteger<quint64> m_dispatchedCount;
+    qint64 m_elapsedNsecs;
+    unsigned int m_fifoHighWater;
+
+    void createSignal();
+    void generate();
+};
+
+#endif // SDRBENCH_BENCHSAMPLESOURCE_H_
@@ -17,10 +17,48 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#define _USE_MATH_DEFINES
+#include <math.h>
+#include <algorithm>
+#include <ctime>
+
 #include <QDebug>
 #include <QElapsedTimer>
+#include <QCoreApplication>
+#include <QThread>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
 
 #include "ambe/ambeengine.h"
+#include "audio/audiofifo.h"
+#include "audio/audiooutput.h"
+#include "channel/channelapi.h"
+#include "device/deviceapi.h"
+#include "dsp/downchannelizer.h"
+#include "dsp/upchannelizer.h"
+#include "dsp/dspengine.h"
+#include "dsp/dspcommands.h"
+#include "dsp/dspdevicesourceengine.h"
+#include "dsp/spectrumvis.h"
+#include "dsp/spectrumzoom.h"
+#include "dsp/cpufeatures.h"
+#include "dsp/simdkernels.h"
+#include "dsp/samplesinkfifo.h"
+#include "dsp/fftfilt.h"
+#include "dsp/hbfilterchainconverter.h"
+#include "dsp/interpolator.h"
+#include "dsp/nco.h"
+#include "dsp/ncof.h"
+#include "dsp/kissengine.h"
+#ifdef USE_FFTW
+#include "dsp/fftwengine.h"
+#endif
+#include "dsp/phasediscri.h"
+#include "dsp/agc.h"
+#include "dsp/ctcssdetector.h"
+#include "plugin/plugininterface.h"
+#include "plugin/pluginmanager.h"
 
 #include "mainbench.h"
 
@@ -31,7 +69,8 @@ MainBench::MainBench(qtwebapp::LoggerWithFile *logger, const ParserBench& parser
     m_logger(logger),
     m_parser(parser),
     m_uniform_distribution_f(-1.0, 1.0),
-    m_uniform_distribution_s16(-2048, 2047)
+    m_uniform_distribution_s16(-2048, 2047),
+    m_sink(0.0)
 {
     qDebug() << "MainBench::MainBench: start";
     m_instance = this;
@@ -62,12 +101,64 @@ void MainBench::run()
         testDecimateFI();
     } else if (m_parser.getTestType() == ParserBench::TestDecimatorsFF) {
         testDecimateFF();
+    } else if (m_parser.getTestType() == ParserBench::TestDownChannelizer) {
+        testDownChannelizer();
+    } else if (m_parser.getTestType() == ParserBench::TestUpChannelizer) {
+        testUpChannelizer();
+    } else if (m_parser.getTestType() == ParserBench::TestFFTFilter) {
+        testFFTFilter();
+    } else if (m_parser.getTestType() == ParserBench::TestInterpolator) {
+        testInterpolator();
+    } else if (m_parser.getTestType() == ParserBench::TestNCO) {
+        testNCO();
+    } else if (m_parser.getTestType() == ParserBench::TestFFTEngine) {
+        testFFTEngine();
+    } else if (m_parser.getTestType() == ParserBench::TestPhaseDiscriminators) {
+        testPhaseDiscriminators();
+    } else if (m_parser.getTestType() == ParserBench::TestMagAGC) {
+        testMagAGC();
+    } else if (m_parser.getTestType() == ParserBench::TestCTCSS) {
+        testCTCSS();
+    } else if (m_parser.getTestType() == ParserBench::TestAudioMix) {
+        testAudioMix();
+    } else if (m_parser.getTestType() == ParserBench::TestSpectrumZoom) {
+        testSpectrumZoom();
+    } else if (m_parser.getTestType() == ParserBench::TestRecordFormat) {
+        testRecordFormat();
+    } else if (m_parser.getTestType() == ParserBench::TestSampleFifo) {
+        testSampleFifo();
+    } else if (m_parser.getTestType() == ParserBench::TestAll) {
+        testDecimateII();
+        testDecimateII(ParserBench::TestDecimatorsInfII);
+        testDecimateII(ParserBench::TestDecimatorsSupII);
+        testDecimateIF();
+        testDecimateFI();
+        testDecimateFF();
+        testDownChannelizer();
+        testUpChannelizer();
+        testFFTFilter();
+        testInterpolator();
+        testNCO();
+        testFFTEngine();
+        testPhaseDiscriminators();
+        testMagAGC();
+        testCTCSS();
+        testAudioMix();
+        testSpectrumZoom();
+        testRecordFormat();
+        testSampleFifo();
+    } else if (m_parser.getTestType() == ParserBench::TestPipeline) {
+        testPipeline();
     } else if (m_parser.getTestType() == ParserBench::TestAMBE) {
         testAMBE();
     } else {
         qDebug() << "MainBench::run: unknown test type: " << m_parser.getTestType();
     }
 
+    if (!m_parser.getJsonFileName().isEmpty()) {
+        writeJSON();
+    }
+
     emit finished();
 }
 
@@ -195,6 +286,1184 @@ void MainBench::testDecimateFF()
     delete[] buf;
 }
 
+void MainBench::testDownChannelizer()
+{
+    QElapsedTimer timer;
+    qint64 nsecs = 0;
+    qint64 referenceNsecs = 0;
+    const unsigned int blockSize = 16384; // typical baseband block size
+
+    qDebug() << "MainBench::testDownChannelizer: create test data";
+
+    SampleVector samples(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+
+    for (SampleVector::iterator it = samples.begin(); it != samples.end(); ++it)
+    {
+        it->m_real = my_rand();
+        it->m_imag = my_rand();
+    }
+
+    qDebug() << "MainBench::testDownChannelizer: compare with reference";
+
+    {
+        CaptureChannelSink sink, referenceSink;
+        DownChannelizer channelizer(&sink);
+        channelizer.setDecimation(m_parser.getLog2Factor(), 0);
+        channelizer.setBasebandSampleRate(3000000, true);
+        ReferenceDownChannelizer reference(m_parser.getLog2Factor(), 0);
+
+        for (unsigned int j = 0; j < samples.size(); j += blockSize)
+        {
+            unsigned int count = std::min(blockSize, (unsigned int) samples.size() - j);
+            channelizer.feed(samples.begin() + j, samples.begin() + j + count);
+            reference.feed(samples.begin() + j, samples.begin() + j + count, &referenceSink);
+        }
+
+        bool identical = sink.m_samples.size() == referenceSink.m_samples.size();
+
+        for (unsigned int i = 0; identical && (i < sink.m_samples.size()); i++)
+        {
+            identical = (sink.m_samples[i].m_real == referenceSink.m_samples[i].m_real)
+                && (sink.m_samples[i].m_imag == referenceSink.m_samples[i].m_imag);
+        }
+
+        qInfo("MainBench::testDownChannelizer: outputs %s the reference", identical ? "identical to" : "DIFFERENT from");
+    }
+
+    NullChannelSink sink, referenceSink;
+    DownChannelizer channelizer(&sink);
+    channelizer.setDecimation(m_parser.getLog2Factor(), 0);
+    channelizer.setBasebandSampleRate(3000000, true);
+    ReferenceDownChannelizer reference(m_parser.getLog2Factor(), 0);
+
+    qDebug() << "MainBench::testDownChannelizer: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+
+        for (unsigned int j = 0; j < samples.size(); j += blockSize)
+        {
+            unsigned int count = std::min(blockSize, (unsigned int) samples.size() - j);
+            channelizer.feed(samples.begin() + j, samples.begin() + j + count);
+        }
+
+        nsecs += timer.nsecsElapsed();
+        timer.start();
+
+        for (unsigned int j = 0; j < samples.size(); j += blockSize)
+        {
+            unsigned int count = std::min(blockSize, (unsigned int) samples.size() - j);
+            reference.feed(samples.begin() + j, samples.begin() + j + count, &referenceSink);
+        }
+
+        referenceNsecs += timer.nsecsElapsed();
+    }
+
+    printResults("MainBench::testDownChannelizer", nsecs);
+    printResults("MainBench::testDownChannelizer: reference", referenceNsecs);
+    qInfo("MainBench::testDownChannelizer: speedup over the per sample reference: %.2fx (%d bit samples, %s kernels)",
+        referenceNsecs / (double) nsecs, SDR_RX_SAMP_SZ, qPrintable(CPUFeatures::instance().getSIMDPathName()));
+    qDebug() << "MainBench::testDownChannelizer: output samples: " << sink.m_count << " reference: " << referenceSink.m_count;
+}
+
+MainBench::ReferenceDownChannelizer::ReferenceDownChannelizer(unsigned int log2Decim, unsigned int filterChainHash)
+{
+    std::vector<unsigned int> stageIndexes;
+    HBFilterChainConverter::convertToIndexes(log2Decim, filterChainHash, stageIndexes);
+
+    // same construction as DownChannelizer::setFilterChain
+    for (std::vector<unsigned int>::const_reverse_iterator rit = stageIndexes.rbegin(); rit != stageIndexes.rend(); ++rit)
+    {
+        if (*rit == 0) {
+            m_filterStages.push_back(new FilterStage(&Filter::workDecimateLowerHalf));
+        } else if (*rit == 1) {
+            m_filterStages.push_back(new FilterStage(&Filter::workDecimateCenter));
+        } else {
+            m_filterStages.push_back(new FilterStage(&Filter::workDecimateUpperHalf));
+        }
+    }
+}
+
+MainBench::ReferenceDownChannelizer::~ReferenceDownChannelizer()
+{
+    for (std::list<FilterStage*>::iterator it = m_filterStages.begin(); it != m_filterStages.end(); ++it) {
+        delete *it;
+    }
+}
+
+void MainBench::ReferenceDownChannelizer::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, ChannelSampleSink *sink)
+{
+    for (SampleVector::const_iterator sample = begin; sample != end; ++sample)
+    {
+        Sample s(*sample);
+        std::list<FilterStage*>::iterator stage = m_filterStages.begin();
+
+        for (; stage != m_filterStages.end(); ++stage)
+        {
+#ifndef SDR_RX_SAMPLE_24BIT
+            s.m_real /= 2; // avoid saturation on 16 bit samples
+            s.m_imag /= 2;
+#endif
+            if (!(*stage)->work(&s)) {
+                break;
+            }
+        }
+
+        if (stage == m_filterStages.end())
+        {
+#ifdef SDR_RX_SAMPLE_24BIT
+            s.m_real /= (1<<(m_filterStages.size())); // on 32 bit samples there is enough headroom to just divide the final result
+            s.m_imag /= (1<<(m_filterStages.size()));
+#endif
+            m_sampleBuffer.push_back(s);
+        }
+    }
+
+    sink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end());
+    m_sampleBuffer.clear();
+}
+
+void MainBench::testUpChannelizer()
+{
+    QElapsedTimer timer;
+    qint64 nsecs = 0;
+    const unsigned int blockSize = 16384; // typical baseband block size
+
+    qDebug() << "MainBench::testUpChannelizer: create test data";
+
+    SampleVector channelSamples(4096);
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+
+    for (SampleVector::iterator it = channelSamples.begin(); it != channelSamples.end(); ++it)
+    {
+        it->m_real = my_rand() / 2; // leave headroom for the interpolation filters
+        it->m_imag = my_rand() / 2;
+    }
+
+    SampleVector samples(blockSize);
+    NullChannelSource source(channelSamples);
+    UpChannelizer channelizer(&source);
+    channelizer.setInterpolation(m_parser.getLog2Factor(), 0);
+    channelizer.setBasebandSampleRate(3000000, true);
+
+    qDebug() << "MainBench::testUpChannelizer: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+
+        for (unsigned int j = 0; j < m_parser.getNbSamples(); j += blockSize)
+        {
+            unsigned int count = std::min(blockSize, m_parser.getNbSamples() - j);
+            channelizer.prefetch(count);
+            channelizer.pull(samples.begin(), count);
+        }
+
+        nsecs += timer.nsecsElapsed();
+    }
+
+    printResults("MainBench::testUpChannelizer", nsecs);
+    qDebug() << "MainBench::testUpChannelizer: channel samples: " << source.m_count;
+}
+
+void MainBench::createComplexSamples(std::vector<Complex>& samples)
+{
+    samples.resize(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+
+    for (std::vector<Complex>::iterator it = samples.begin(); it != samples.end(); ++it) {
+        *it = Complex(my_rand(), my_rand());
+    }
+}
+
+void MainBench::testFFTFilter()
+{
+    QElapsedTimer timer;
+    qint64 nsecsFilt = 0, nsecsSSB = 0, nsecsDSB = 0;
+    qint64 nsecsFiltBlock = 0, nsecsSSBBlock = 0, nsecsDSBBlock = 0;
+    const unsigned int blockSize = 4096;
+
+    if (!DSPEngine::instance()->getFFTFactory()) { // block versions take their FFTs from the factory
+        DSPEngine::instance()->createFFTFactory("");
+    }
+
+    qDebug() << "MainBench::testFFTFilter: create test data";
+
+    std::vector<Complex> samples;
+    createComplexSamples(samples);
+    std::vector<Complex> outBlock(blockSize);
+    fftfilt ssbFilter(0.01f, 0.1f, 1024); // SSB demodulator style band pass
+    fftfilt dsbFilter(0.1f, 2 * 1024);    // AM and DSB demodulator style low pass
+    fftfilt ssbBlockFilter(0.01f, 0.1f, 1024);
+    fftfilt dsbBlockFilter(0.1f, 2 * 1024);
+    fftfilt::cmplx *out;
+
+    qDebug() << "MainBench::testFFTFilter: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+
+        for (std::vector<Complex>::const_iterator it = samples.begin(); it != samples.end(); ++it)
+        {
+            if (ssbFilter.runFilt(*it, &out) > 0) {
+                m_sink += out[0].real();
+            }
+        }
+
+        nsecsFilt += timer.nsecsElapsed();
+        timer.start();
+
+        for (std::vector<Complex>::const_iterator it = samples.begin(); it != samples.end(); ++it)
+        {
+            if (ssbFilter.runSSB(*it, &out, true) > 0) {
+                m_sink += out[0].real();
+            }
+        }
+
+        nsecsSSB += timer.nsecsElapsed();
+        timer.start();
+
+        for (std::vector<Complex>::const_iterator it = samples.begin(); it != samples.end(); ++it)
+        {
+            if (dsbFilter.runDSB(*it, &out) > 0) {
+                m_sink += out[0].real();
+            }
+        }
+
+        nsecsDSB += timer.nsecsElapsed();
+
+        for (int mode = 0; mode < 3; mode++)
+        {
+            timer.start();
+
+            for (unsigned int j = 0; j < samples.size(); j += blockSize)
+            {
+                int count = std::min(blockSize, (unsigned int) samples.size() - j);
+
+                if (mode == 0) {
+                    ssbBlockFilter.runFilt(&samples[j], outBlock.data(), count);
+                } else if (mode == 1) {
+                    ssbBlockFilter.runSSB(&samples[j], outBlock.data(), count, true);
+                } else {
+                    dsbBlockFilter.runDSB(&samples[j], outBlock.data(), count);
+                }
+
+                m_sink += outBlock[0].real();
+            }
+
+            if (mode == 0) {
+                nsecsFiltBlock += timer.nsecsElapsed();
+            } else if (mode == 1) {
+                nsecsSSBBlock += timer.nsecsElapsed();
+            } else {
+                nsecsDSBBlock += timer.nsecsElapsed();
+            }
+        }
+    }
+
+    printResults("MainBench::testFFTFilter: runFilt", nsecsFilt);
+    printResults("MainBench::testFFTFilter: runSSB", nsecsSSB);
+    printResults("MainBench::testFFTFilter: runDSB", nsecsDSB);
+    printResults("MainBench::testFFTFilter: runFilt block", nsecsFiltBlock);
+    printResults("MainBench::testFFTFilter: runSSB block", nsecsSSBBlock);
+    printResults("MainBench::testFFTFilter: runDSB block", nsecsDSBBlock);
+}
+
+void MainBench::testInterpolator()
+{
+    QElapsedTimer timer;
+    const Real decimationDistance = 62500.0f / 48000.0f;    // typical channel to audio rate
+    const Real interpolationDistance = 8000.0f / 48000.0f;  // typical audio to channel rate
+    const unsigned int blockSize = 4096;
+
+    qDebug() << "MainBench::testInterpolator: create test data";
+
+    std::vector<Complex> samples;
+    createComplexSamples(samples);
+    std::vector<Complex> outBlock(blockSize);
+
+    qDebug() << "MainBench::testInterpolator: run test";
+
+    for (int mode = 0; mode < 4; mode++)
+    {
+        bool interpolation = mode >= 2;
+        bool block = (mode % 2) != 0;
+        Real step = interpolation ? interpolationDistance : decimationDistance;
+        Interpolator interpolator;
+        interpolator.create(16, 62500, 62500 / 2.2f);
+        Real distance = 0;
+        qint64 nsecs = 0;
+        Complex ci;
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            timer.start();
+
+            if (block)
+            {
+                const Complex *in = samples.data();
+                int nbIn = samples.size();
+
+                while (nbIn > 0)
+                {
+                    int nbConsumed;
+                    int nbOut = interpolation ?
+                        interpolator.interpolate(&distance, step, in, nbIn, outBlock.data(), outBlock.size(), nbConsumed) :
+                        interpolator.decimate(&distance, step, in, nbIn, outBlock.data(), outBlock.size(), nbConsumed);
+
+                    if (nbOut > 0) {
+                        m_sink += outBlock[nbOut - 1].real();
+                    }
+
+                    in += nbConsumed;
+                    nbIn -= nbConsumed;
+                }
+            }
+            else if (interpolation)
+            {
+                for (std::vector<Complex>::const_iterator it = samples.begin(); it != samples.end(); ++it)
+                {
+                    while (!interpolator.interpolate(&distance, *it, &ci))
+                    {
+                        m_sink += ci.real();
+                        distance += step;
+                    }
+                }
+            }
+            else
+            {
+                for (std::vector<Complex>::const_iterator it = samples.begin(); it != samples.end(); ++it)
+                {
+                    if (interpolator.decimate(&distance, *it, &ci))
+                    {
+                        m_sink += ci.real();
+                        distance += step;
+                    }
+                }
+            }
+
+            nsecs += timer.nsecsElapsed();
+        }
+
+        printResults(QString("MainBench::testInterpolator: %1%2")
+            .arg(interpolation ? "interpolate" : "decimate")
+            .arg(block ? " block" : ""), nsecs);
+    }
+}
+
+void MainBench::testNCO()
+{
+    QElapsedTimer timer;
+    const unsigned int blockSize = 4096;
+
+    qDebug() << "MainBench::testNCO: create test data";
+
+    SampleVector samples(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+
+    for (SampleVector::iterator it = samples.begin(); it != samples.end(); ++it)
+    {
+        it->m_real = my_rand();
+        it->m_imag = my_rand();
+    }
+
+    ComplexVector mixBuffer;
+    NCO nco;
+    NCOF ncof;
+    nco.setFreq(12345.6f, 250000.0f);
+    ncof.setFreq(12345.6f, 250000.0f);
+    qint64 nsecsNCO = 0, nsecsNCOMix = 0, nsecsNCOF = 0, nsecsNCOFMix = 0;
+
+    qDebug() << "MainBench::testNCO: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        Complex acc(0, 0);
+        timer.start();
+
+        for (unsigned int j = 0; j < samples.size(); j++) {
+            acc += Complex(samples[j].m_real, samples[j].m_imag) * nco.nextIQ();
+        }
+
+        nsecsNCO += timer.nsecsElapsed();
+        timer.start();
+
+        for (unsigned int j = 0; j < samples.size(); j += blockSize)
+        {
+            unsigned int count = std::min(blockSize, (unsigned int) samples.size() - j);
+            nco.nextIQMul(samples.begin() + j, samples.begin() + j + count, mixBuffer);
+            acc += mixBuffer.back();
+        }
+
+        nsecsNCOMix += timer.nsecsElapsed();
+        timer.start();
+
+        for (unsigned int j = 0; j < samples.size(); j++) {
+            acc += Complex(samples[j].m_real, samples[j].m_imag) * ncof.nextIQ();
+        }
+
+        nsecsNCOF += timer.nsecsElapsed();
+        timer.start();
+
+        for (unsigned int j = 0; j < samples.size(); j += blockSize)
+        {
+            unsigned int count = std::min(blockSize, (unsigned int) samples.size() - j);
+            ncof.nextIQMul(samples.begin() + j, samples.begin() + j + count, mixBuffer);
+            acc += mixBuffer.back();
+        }
+
+        nsecsNCOFMix += timer.nsecsElapsed();
+        m_sink += acc.real();
+    }
+
+    printResults("MainBench::testNCO: NCO mix", nsecsNCO);
+    printResults("MainBench::testNCO: NCO block mix", nsecsNCOMix);
+    printResults("MainBench::testNCO: NCOF mix", nsecsNCOF);
+    printResults("MainBench::testNCO: NCOF block mix", nsecsNCOFMix);
+}
+
+void MainBench::testFFTEngine()
+{
+    QElapsedTimer timer;
+
+    qDebug() << "MainBench::testFFTEngine: run test";
+
+    for (int engineIndex = 0; engineIndex < 2; engineIndex++)
+    {
+        FFTEngine *engine;
+        QString engineName;
+
+        if (engineIndex == 0)
+        {
+            engine = new KissEngine();
+            engineName = "Kiss";
+        }
+        else
+        {
+#ifdef USE_FFTW
+            engine = new FFTWEngine(QString());
+            engineName = "FFTW";
+#else
+            break;
+#endif
+        }
+
+        for (int fftSize = 256; fftSize <= 16384; fftSize *= 4)
+        {
+            engine->configure(fftSize, false);
+            auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+
+            for (int j = 0; j < fftSize; j++) {
+                engine->in()[j] = Complex(my_rand(), my_rand());
+            }
+
+            unsigned int nbTransforms = std::max(1U, m_parser.getNbSamples() / fftSize);
+            qint64 nsecs = 0;
+
+            for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+            {
+                timer.start();
+
+                for (unsigned int j = 0; j < nbTransforms; j++) {
+                    engine->transform();
+                }
+
+                nsecs += timer.nsecsElapsed();
+                m_sink += engine->out()[0].real();
+            }
+
+            printResults(QString("MainBench::testFFTEngine: %1 %2").arg(engineName).arg(fftSize),
+                nsecs, (quint64) nbTransforms * fftSize * m_parser.getRepetition());
+        }
+
+        delete engine;
+    }
+}
+
+void MainBench::testPhaseDiscriminators()
+{
+    QElapsedTimer timer;
+    qint64 nsecs1 = 0, nsecsDelta = 0, nsecs2 = 0;
+
+    qDebug() << "MainBench::testPhaseDiscriminators: create test data";
+
+    std::vector<Complex> samples;
+    createComplexSamples(samples);
+    PhaseDiscriminators phaseDiscri;
+    phaseDiscri.setFMScaling(1.0f);
+
+    qDebug() << "MainBench::testPhaseDiscriminators: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        Real acc = 0;
+        timer.start();
+
+        for (std::vector<Complex>::const_iterator it = samples.begin(); it != samples.end(); ++it) {
+            acc += phaseDiscri.phaseDiscriminator(*it);
+        }
+
+        nsecs1 += timer.nsecsElapsed();
+        double magsq;
+        Real fmDev;
+        timer.start();
+
+        for (std::vector<Complex>::const_iterator it = samples.begin(); it != samples.end(); ++it) {
+            acc += phaseDiscri.phaseDiscriminatorDelta(*it, magsq, fmDev);
+        }
+
+        nsecsDelta += timer.nsecsElapsed();
+        timer.start();
+
+        for (std::vector<Complex>::const_iterator it = samples.begin(); it != samples.end(); ++it) {
+            acc += phaseDiscri.phaseDiscriminator2(*it);
+        }
+
+        nsecs2 += timer.nsecsElapsed();
+        m_sink += acc;
+    }
+
+    printResults("MainBench::testPhaseDiscriminators: phaseDiscriminator", nsecs1);
+    printResults("MainBench::testPhaseDiscriminators: phaseDiscriminatorDelta", nsecsDelta);
+    printResults("MainBench::testPhaseDiscriminators: phaseDiscriminator2", nsecs2);
+}
+
+void MainBench::testMagAGC()
+{
+    QElapsedTimer timer;
+    qint64 nsecs = 0;
+
+    qDebug() << "MainBench::testMagAGC: create test data";
+
+    std::vector<Complex> samples;
+    createComplexSamples(samples);
+    MagAGC agc(12000, 0.1, 1e-2); // SSB demodulator settings
+    agc.setStepDownDelay(12000);
+
+    qDebug() << "MainBench::testMagAGC: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        double acc = 0;
+        timer.start();
+
+        for (std::vector<Complex>::const_iterator it = samples.begin(); it != samples.end(); ++it) {
+            acc += agc.feedAndGetValue(*it);
+        }
+
+        nsecs += timer.nsecsElapsed();
+        m_sink += acc;
+    }
+
+    printResults("MainBench::testMagAGC", nsecs);
+}
+
+void MainBench::testCTCSS()
+{
+    QElapsedTimer timer;
+    qint64 nsecs = 0;
+    const int sampleRate = 6000; // NFM demodulator CTCSS decimated rate
+
+    qDebug() << "MainBench::testCTCSS: create test data";
+
+    std::vector<Real> samples(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+
+    for (unsigned int i = 0; i < samples.size(); i++) {
+        samples[i] = 0.5f * sin(2.0 * M_PI * 88.5 * i / sampleRate) + 0.1f * my_rand();
+    }
+
+    CTCSSDetector ctcssDetector;
+    ctcssDetector.setCoefficients(sampleRate / 16, sampleRate / 8.0f);
+
+    qDebug() << "MainBench::testCTCSS: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        int detections = 0;
+        timer.start();
+
+        for (std::vector<Real>::iterator it = samples.begin(); it != samples.end(); ++it)
+        {
+            if (ctcssDetector.analyze(&(*it))) {
+                detections++;
+            }
+        }
+
+        nsecs += timer.nsecsElapsed();
+        m_sink += detections;
+    }
+
+    printResults("MainBench::testCTCSS", nsecs);
+}
+
+void MainBench::testAudioMix()
+{
+    QElapsedTimer timer;
+    qint64 nsecs = 0;
+    const unsigned int nbFifos = 4;         // channels sharing one audio device
+    const unsigned int bufferSize = 1024;   // audio callback size in stereo samples
+
+    qDebug() << "MainBench::testAudioMix: create test data";
+
+    std::vector<AudioSample> audio(bufferSize);
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+
+    for (std::vector<AudioSample>::iterator it = audio.begin(); it != audio.end(); ++it)
+    {
+        it->l = my_rand() * 4;
+        it->r = my_rand() * 4;
+    }
+
+    AudioOutput audioOutput;
+    std::vector<AudioFifo*> fifos;
+
+    for (unsigned int i = 0; i < nbFifos; i++)
+    {
+        fifos.push_back(new AudioFifo(4 * bufferSize));
+        audioOutput.addFifo(fifos.back());
+    }
+
+    std::vector<qint16> out(2 * bufferSize);
+
+    qDebug() << "MainBench::testAudioMix: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        for (unsigned int j = 0; j < m_parser.getNbSamples(); j += bufferSize)
+        {
+            for (unsigned int k = 0; k < nbFifos; k++) {
+                fifos[k]->write((const quint8*) audio.data(), bufferSize);
+            }
+
+            timer.start();
+            audioOutput.mix(out.data(), bufferSize);
+            nsecs += timer.nsecsElapsed();
+            m_sink += out[0];
+        }
+    }
+
+    for (unsigned int i = 0; i < nbFifos; i++)
+    {
+        audioOutput.removeFifo(fifos[i]);
+        delete fifos[i];
+    }
+
+    printResults(QString("MainBench::testAudioMix: %1 FIFOs").arg(nbFifos), nsecs,
+        (quint64) ((m_parser.getNbSamples() + bufferSize - 1) / bufferSize) * bufferSize * m_parser.getRepetition());
+}
+
+void MainBench::testSpectrumZoom()
+{
+    QElapsedTimer timer;
+    qint64 nsecs = 0;
+    const unsigned int blockSize = 16384;     // typical baseband block size
+    const int basebandSampleRate = 3000000;
+    const int fftSize = 512;
+    SpectrumZoom::Settings settings;
+    settings.m_centerFrequencyOffset = 310000;
+    settings.m_span = 8000;                   // 15.6 Hz bins
+    const double inSpanOffset = 1234.5;       // from the span center
+    const double outOfSpanOffset = -6000.0;   // aliases to +2000 Hz if not rejected before resampling
+
+    if (!DSPEngine::instance()->getFFTFactory()) { // SpectrumVis takes its FFT from the factory
+        DSPEngine::instance()->createFFTFactory("");
+    }
+
+    qDebug() << "MainBench::testSpectrumZoom: create test data";
+
+    SampleVector samples(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+    NCOF inSpanNCO, outOfSpanNCO;
+    inSpanNCO.setFreq(settings.m_centerFrequencyOffset + inSpanOffset, basebandSampleRate);
+    outOfSpanNCO.setFreq(settings.m_centerFrequencyOffset + outOfSpanOffset, basebandSampleRate);
+    const Real amplitude = SDR_RX_SCALEF / 4;
+
+    for (SampleVector::iterator it = samples.begin(); it != samples.end(); ++it)
+    {
+        Complex c = (inSpanNCO.nextIQ() + outOfSpanNCO.nextIQ()) * amplitude;
+        it->m_real = c.real() + my_rand();
+        it->m_imag = c.imag() + my_rand();
+    }
+
+    CaptureSpectrum spectrum;
+    SpectrumZoom zoom(SDR_RX_SCALEF, &spectrum);
+    // no event loop here: messages are handled directly
+    zoom.getSpectrumVis()->handleMessage(SpectrumVis::MsgConfigureSpectrumVis(fftSize, 0, 0, SpectrumVis::AvgModeNone, FFTWindow::BlackmanHarris, false));
+    zoom.getSpectrumVis()->handleMessage(SpectrumVis::MsgConfigureFrameRate(0, SpectrumVis::FrameAggMax));
+    zoom.handleMessage(DSPSignalNotification(basebandSampleRate, 0));
+    SpectrumZoom::MsgConfigureSpectrumZoom *conf = SpectrumZoom::MsgConfigureSpectrumZoom::create(settings);
+    zoom.handleMessage(*conf);
+    delete conf;
+    zoom.start();
+
+    qDebug() << "MainBench::testSpectrumZoom: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+
+        for (unsigned int j = 0; j < samples.size(); j += blockSize)
+        {
+            unsigned int count = std::min(blockSize, (unsigned int) samples.size() - j);
+            zoom.feed(samples.begin() + j, samples.begin() + j + count, false);
+        }
+
+        nsecs += timer.nsecsElapsed();
+    }
+
+    zoom.stop();
+    printResults(QString("MainBench::testSpectrumZoom: %1 Hz span at %2 S/s with %3 bins").arg(settings.m_span).arg(basebandSampleRate).arg(fftSize), nsecs);
+    int fullBandFFTSize = 1;
+
+    while (fullBandFFTSize < ((qint64) basebandSampleRate * fftSize) / settings.m_span) {
+        fullBandFFTSize *= 2;
+    }
+
+    qInfo("MainBench::testSpectrumZoom: full band FFT size for the same resolution: %d", fullBandFFTSize);
+
+    if (spectrum.m_count == 0)
+    {
+        qInfo("MainBench::testSpectrumZoom: no spectrum: increase the number of samples");
+        return;
+    }
+
+    // bins go from -span/2 to +span/2 with the span center at fftSize/2
+    int expectedBin = fftSize/2 + (int) round((inSpanOffset * fftSize) / settings.m_span);
+    int aliasBin = fftSize/2 + (int) round(((outOfSpanOffset + settings.m_span) * fftSize) / settings.m_span);
+    int peakBin = std::max_element(spectrum.m_spectrum.begin(), spectrum.m_spectrum.end()) - spectrum.m_spectrum.begin();
+    qInfo("MainBench::testSpectrumZoom: %u spectra: in span tone at bin %d %s expected %d",
+        spectrum.m_count, peakBin, peakBin == expectedBin ? "as" : "WRONG:", expectedBin);
+    qInfo("MainBench::testSpectrumZoom: out of span tone rejection: %.1f dB at its alias bin %d",
+        spectrum.m_spectrum[peakBin] - spectrum.m_spectrum[aliasBin], aliasBin);
+}
+
+void MainBench::testRecordFormat()
+{
+    QElapsedTimer timer;
+    qint64 nsecsPack12 = 0, nsecsUnpack12 = 0, nsecsPack8 = 0, nsecsUnpack8 = 0, nsecsPackF32 = 0, nsecsUnpackF32 = 0;
+    const SIMDKernels& kernels = SIMDKernels::instance();
+    const int32_t fullScale = (int32_t) SDR_RX_SCALEF;
+    const int shift12 = SDR_RX_SAMP_SZ - 12; // as in RecordFormat
+    const int shift8 = SDR_RX_SAMP_SZ - 8;   // exponent of a full scale 8 bit block
+    const int32_t step12 = 1 << shift12;
+    const int32_t step8 = 1 << shift8;
+
+    qDebug() << "MainBench::testRecordFormat: create test data";
+
+    // full range I/Q starting with the extremes and the rounding boundaries
+    const int32_t specials[] = {
+        -fullScale, fullScale - 1, -fullScale + 1, fullScale - 2, 0, -1, 1,
+        -step12 / 2, step12 / 2, -step12 / 2 - 1, step12 / 2 - 1,
+        -step8 / 2, step8 / 2, -step8 / 2 - 1, step8 / 2 - 1,
+        2047 * step12 + step12 / 2 - 1, 2047 * step12 + step12 / 2,
+        127 * step8 + step8 / 2 - 1, 127 * step8 + step8 / 2
+    };
+    const int nbSpecials = sizeof(specials) / sizeof(specials[0]);
+    const int nbSamples = std::max((int) m_parser.getNbSamples(), nbSpecials);
+    std::uniform_int_distribution<int32_t> distribution(-fullScale, fullScale - 1);
+    std::vector<FixReal> iq(2*nbSamples);
+
+    for (int k = 0; k < 2*nbSamples; k++) {
+        iq[k] = k < nbSpecials ? specials[k] : distribution(m_generator);
+    }
+
+    std::vector<uint8_t> packed12(3*nbSamples);
+    std::vector<int8_t> packed8(2*nbSamples);
+    std::vector<float> packedF32(2*nbSamples);
+    std::vector<FixReal> unpacked12(2*nbSamples), unpacked8(2*nbSamples), unpackedF32(2*nbSamples);
+
+    qDebug() << "MainBench::testRecordFormat: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+        kernels.pack12(packed12.data(), iq.data(), nbSamples, shift12);
+        nsecsPack12 += timer.nsecsElapsed();
+        timer.start();
+        kernels.unpack12(unpacked12.data(), packed12.data(), nbSamples, shift12);
+        nsecsUnpack12 += timer.nsecsElapsed();
+        timer.start();
+        kernels.pack8(packed8.data(), iq.data(), nbSamples, shift8);
+        nsecsPack8 += timer.nsecsElapsed();
+        timer.start();
+        kernels.unpack8(unpacked8.data(), packed8.data(), nbSamples, shift8);
+        nsecsUnpack8 += timer.nsecsElapsed();
+        timer.start();
+        kernels.packF32(packedF32.data(), iq.data(), nbSamples, 1.0f / SDR_RX_SCALEF);
+        nsecsPackF32 += timer.nsecsElapsed();
+        timer.start();
+        kernels.unpackF32(unpackedF32.data(), packedF32.data(), nbSamples, SDR_RX_SCALEF);
+        nsecsUnpackF32 += timer.nsecsElapsed();
+    }
+
+    const quint64 nbRun = (quint64) nbSamples * m_parser.getRepetition();
+    printResults("MainBench::testRecordFormat: pack 12 bit", nsecsPack12, nbRun);
+    printResults("MainBench::testRecordFormat: unpack 12 bit", nsecsUnpack12, nbRun);
+    printResults("MainBench::testRecordFormat: pack 8 bit", nsecsPack8, nbRun);
+    printResults("MainBench::testRecordFormat: unpack 8 bit", nsecsUnpack8, nbRun);
+    printResults("MainBench::testRecordFormat: pack float", nsecsPackF32, nbRun);
+    printResults("MainBench::testRecordFormat: unpack float", nsecsUnpackF32, nbRun);
+
+    // Rounding to nearest (half up) gives an error in (-step/2, step/2] except for the values above
+    // the largest positive code that are clipped to it. The negative extreme is exact.
+    int wrong12 = 0, wrong8 = 0, wrongF32 = 0;
+    int32_t maxError12 = 0, maxError8 = 0;
+
+    for (int k = 0; k < 2*nbSamples; k++)
+    {
+        const int32_t e12 = unpacked12[k] - iq[k];
+        const int32_t e8 = unpacked8[k] - iq[k];
+
+        if (iq[k] >= 2047 * step12 + step12 / 2) {
+            wrong12 += unpacked12[k] != 2047 * step12;
+        } else {
+            wrong12 += (e12 <= -step12 / 2) || (e12 > step12 / 2);
+            maxError12 = std::max(maxError12, std::abs(e12));
+        }
+
+        if (iq[k] >= 127 * step8 + step8 / 2) {
+            wrong8 += unpacked8[k] != 127 * step8;
+        } else {
+            wrong8 += (e8 <= -step8 / 2) || (e8 > step8 / 2);
+            maxError8 = std::max(maxError8, std::abs(e8));
+        }
+
+        wrongF32 += unpackedF32[k] != iq[k]; // float holds 24 bits exactly
+    }
+
+    wrong12 += unpacked12[0] != -fullScale;
+    wrong8 += unpacked8[0] != -fullScale;
+
+    // Reading a 8 bit block recorded with a sample size 8 bits larger (or smaller) gives the
+    // exponent relative to the build sample size minus (or plus) 8 as in RecordFormat::unpack
+    int wrongCross = 0;
+    std::vector<FixReal> crossUnpacked(2*nbSpecials);
+
+    for (int exponent = 0; exponent <= shift8; exponent++)
+    {
+        kernels.unpack8(unpacked8.data(), packed8.data(), nbSpecials, exponent);
+        kernels.unpack8(crossUnpacked.data(), packed8.data(), nbSpecials, exponent - 8);
+
+        for (int k = 0; k < 2*nbSpecials; k++) {
+            wrongCross += crossUnpacked[k] != (((int32_t) unpacked8[k]) >> 8);
+        }
+
+        if (exponent + 8 <= shift8)
+        {
+            kernels.unpack8(crossUnpacked.data(), packed8.data(), nbSpecials, exponent + 8);
+
+            for (int k = 0; k < 2*nbSpecials; k++) {
+                wrongCross += crossUnpacked[k] != ((int32_t) unpacked8[k]) * 256;
+            }
+        }
+    }
+
+    // Float recordings from other tools: rounding half away from zero and clipping to the FixReal range
+    const float floats[] = {1.0f, -1.0f, 2.0f, -2.0f, 0.4f, -0.4f, 0.5f, -0.5f, 1.5f, -1.5f};
+    const int32_t expected[] = {fullScale - 1, -fullScale, fullScale - 1, -fullScale, 0, 0, 1, -1, 2, -2};
+    const int nbFloats = sizeof(floats) / sizeof(floats[0]);
+    std::vector<float> floatsIn(nbFloats);
+
+    for (int k = 0; k < nbFloats; k++) {
+        floatsIn[k] = k < 4 ? floats[k] : floats[k] / SDR_RX_SCALEF; // beyond full scale then in LSBs
+    }
+
+    kernels.unpackF32(unpackedF32.data(), floatsIn.data(), nbFloats / 2, SDR_RX_SCALEF);
+
+    for (int k = 0; k < nbFloats; k++) {
+        wrongF32 += unpackedF32[k] != expected[k];
+    }
+
+    qInfo("MainBench::testRecordFormat: 12 bit: max error %d (bound %d) %s (%d wrong)",
+        maxError12, step12 / 2, wrong12 == 0 ? "OK" : "WRONG", wrong12);
+    qInfo("MainBench::testRecordFormat: 8 bit: max error %d (bound %d) %s (%d wrong) other sample size %s (%d wrong)",
+        maxError8, step8 / 2, wrong8 == 0 ? "OK" : "WRONG", wrong8, wrongCross == 0 ? "OK" : "WRONG", wrongCross);
+    qInfo("MainBench::testRecordFormat: float: %s (%d wrong) (%d bit samples, %s kernels)",
+        wrongF32 == 0 ? "OK" : "WRONG", wrongF32, SDR_RX_SAMP_SZ, qPrintable(CPUFeatures::getSIMDPathName(kernels.path)));
+}
+
+void MainBench::testSampleFifo()
+{
+    QElapsedTimer timer;
+    const unsigned int blockSize = 16384;
+    SampleVector samples(blockSize);
+    unsigned int nbWakeups = 0;
+    bool ok = true;
+
+    qDebug() << "MainBench::testSampleFifo: run wakeup test";
+
+    // Lock free wakeups: one dataReady() per batch until the consumer takes it even without reading
+    SampleSinkFifo fifo(8 * blockSize);
+    fifo.setLockFree(true);
+    QObject::connect(&fifo, &SampleSinkFifo::dataReady, [&nbWakeups]() { nbWakeups++; }); // direct: same thread
+
+    fifo.write(samples.begin(), samples.begin() + 256);
+    ok = ok && (nbWakeups == 1);
+    fifo.write(samples.begin(), samples.begin() + 256); // notification still pending
+    ok = ok && (nbWakeups == 1);
+    fifo.consumerWoken(); // e.g. consumer not running or with messages pending: no read
+    fifo.write(samples.begin(), samples.begin() + 256);
+    ok = ok && (nbWakeups == 2);
+    fifo.consumerWoken();
+    SampleVector::iterator part1begin, part1end, part2begin, part2end;
+    unsigned int count = fifo.readBegin(fifo.fill(), &part1begin, &part1end, &part2begin, &part2end);
+    fifo.readCommit(count);
+    fifo.write(samples.begin(), samples.begin() + 256);
+    ok = ok && (nbWakeups == 3);
+    qInfo("MainBench::testSampleFifo: wakeups after consumer woken without read: %s", ok ? "OK" : "WRONG");
+
+    // Wakeup threshold
+    fifo.reset();
+    fifo.setWakeupThreshold(1000);
+    nbWakeups = 0;
+    fifo.write(samples.begin(), samples.begin() + 500);
+    ok = (nbWakeups == 0);
+    fifo.write(samples.begin(), samples.begin() + 500);
+    ok = ok && (nbWakeups == 1);
+    qInfo("MainBench::testSampleFifo: wakeup threshold: %s", ok ? "OK" : "WRONG");
+
+    // Write and read cost with and without the mutex
+    for (int lockFree = 0; lockFree < 2; lockFree++)
+    {
+        SampleSinkFifo benchFifo(4 * blockSize);
+        benchFifo.setLockFree(lockFree != 0);
+        qint64 nsecs = 0;
+        quint64 nbSamples = 0;
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            timer.start();
+
+            for (unsigned int j = 0; j < m_parser.getNbSamples(); j += blockSize)
+            {
+                benchFifo.write(samples.begin(), samples.end());
+                count = benchFifo.readBegin(benchFifo.fill(), &part1begin, &part1end, &part2begin, &part2end);
+                benchFifo.consumerWoken();
+                benchFifo.readCommit(count);
+                nbSamples += count;
+            }
+
+            nsecs += timer.nsecsElapsed();
+        }
+
+        printResults(QString("MainBench::testSampleFifo: %1").arg(lockFree ? "lock free" : "mutex"), nsecs, nbSamples);
+    }
+}
+
+void MainBench::testPipeline()
+{
+    qDebug() << "MainBench::testPipeline: load channel plugins";
+
+    PluginManager pluginManager(this);
+    pluginManager.loadPlugins(QString("pluginssrv"));
+    PluginAPI::ChannelRegistrations *registrations = pluginManager.getRxChannelRegistrations();
+    QList<PluginInterface*> channelPlugins;
+    QStringList channelIds;
+
+    for (const QString& channelId : m_parser.getChannels())
+    {
+        PluginAPI::ChannelRegistrations::const_iterator it = registrations->begin();
+
+        for (; it != registrations->end(); ++it)
+        {
+            if (it->m_channelId.compare(channelId, Qt::CaseInsensitive) == 0) {
+                break;
+            }
+        }
+
+        if (it == registrations->end())
+        {
+            qWarning("MainBench::testPipeline: no Rx channel plugin %s", qPrintable(channelId));
+            continue;
+        }
+
+        channelPlugins.append(it->m_plugin);
+        channelIds.append(it->m_channelId);
+    }
+
+    if (channelPlugins.isEmpty())
+    {
+        qWarning("MainBench::testPipeline: no channel to run");
+        return;
+    }
+
+    // Per channel CPU time is the process CPU time with the channel alone minus the time with no channel
+    PipelineResult baseline;
+
+    qDebug() << "MainBench::testPipeline: run device engine alone";
+
+    if (!runPipeline(QList<PluginInterface*>(), baseline)) {
+        return;
+    }
+
+    printPipelineResults("MainBench::testPipeline: no channel", baseline);
+
+    for (int i = 0; i < channelPlugins.size(); i++)
+    {
+        if (channelIds.indexOf(channelIds[i]) != i) { // measured already
+            continue;
+        }
+
+        PipelineResult result;
+        qDebug() << "MainBench::testPipeline: run" << channelIds[i] << "alone";
+
+        if (!runPipeline(QList<PluginInterface*>() << channelPlugins[i], result)) {
+            return;
+        }
+
+        double cpuNsPerSample = (result.m_cpuNsecs - baseline.m_cpuNsecs) / (double) result.m_nbSamples;
+        QDebug info = qInfo();
+        info.noquote();
+        info << tr("MainBench::testPipeline: %1: channel CPU time %2 ns/sample - %3 % of one core at %4 kS/s")
+            .arg(channelIds[i])
+            .arg(cpuNsPerSample, 0, 'f', 2)
+            .arg(cpuNsPerSample * m_parser.getSampleRate() / 1e7, 0, 'f', 1)
+            .arg(m_parser.getSampleRate() / 1000);
+
+        QJsonObject channelResult;
+        channelResult.insert("test", tr("MainBench::testPipeline: %1").arg(channelIds[i]));
+        channelResult.insert("channelCPUNsPerSample", cpuNsPerSample);
+        m_jsonResults.append(channelResult);
+    }
+
+    PipelineResult result;
+    qDebug() << "MainBench::testPipeline: run all channels";
+
+    if (runPipeline(channelPlugins, result)) {
+        printPipelineResults(tr("MainBench::testPipeline: %1").arg(channelIds.join(",")), result);
+    }
+}
+
+bool MainBench::runPipeline(const QList<PluginInterface*>& channelPlugins, PipelineResult& result)
+{
+    DSPEngine *dspEngine = DSPEngine::instance();
+    DSPDeviceSourceEngine *deviceEngine = dspEngine->addDeviceSourceEngine();
+    deviceEngine->start();
+    DeviceAPI *deviceAPI = new DeviceAPI(DeviceAPI::StreamSingleRx, 0, deviceEngine, nullptr, nullptr);
+
+    result.m_nbSamples = (quint64) m_parser.getNbSamples() * std::max(1U, m_parser.getRepetition());
+    BenchSampleSource *source = new BenchSampleSource(deviceAPI, m_parser.getSampleRate(), result.m_nbSamples, m_parser.getRealtime());
+    deviceAPI->setSampleSource(source);
+
+    QList<ChannelAPI*> channels;
+
+    for (PluginInterface *plugin : channelPlugins) {
+        channels.append(plugin->createRxChannelCS(deviceAPI));
+    }
+
+    PipelineProbe probe(source);
+    deviceAPI->addChannelSink(&probe);
+
+    std::clock_t cpuStart = std::clock();
+    bool success = deviceAPI->initDeviceEngine() && deviceAPI->startDeviceEngine();
+
+    if (success)
+    {
+        QElapsedTimer progressTimer;
+        quint64 lastCount = 0;
+        progressTimer.start();
+
+        while (!source->isDone())
+        {
+            QCoreApplication::processEvents(); // channels handle their messages in this thread
+            QThread::msleep(1);
+
+            if (source->getDispatchedCount() != lastCount)
+            {
+                lastCount = source->getDispatchedCount();
+                progressTimer.restart();
+            }
+            else if (progressTimer.hasExpired(5000))
+            {
+                qWarning("MainBench::runPipeline: pipeline stalled after %llu samples", (unsigned long long) lastCount);
+                success = false;
+                break;
+            }
+        }
+
+        // let the channels process their backlog
+        for (int i = 0; i < 100; i++)
+        {
+            QCoreApplication::processEvents();
+            QThread::msleep(1);
+        }
+    }
+    else
+    {
+        qWarning("MainBench::runPipeline: cannot start device engine: %s", qPrintable(deviceEngine->errorMessage()));
+    }
+
+    result.m_cpuNsecs = (std::clock() - cpuStart) * (1000000000.0 / CLOCKS_PER_SEC);
+    deviceAPI->stopDeviceEngine();
+    source->stop();
+
+    result.m_nsecs = source->getElapsedNsecs();
+    result.m_fifoSize = source->getSampleFifo()->size();
+    result.m_fifoHighWater = source->getFifoHighWater();
+    result.m_basebandDropped = deviceEngine->getSharedBasebandDropped();
+    result.m_latencies = source->getLatencies();
+
+    deviceAPI->removeChannelSink(&probe);
+
+    for (ChannelAPI *channel : channels) {
+        channel->destroy();
+    }
+
+    deviceEngine->stop();
+    dspEngine->removeLastDeviceSourceEngine();
+    source->destroy();
+    delete deviceAPI;
+
+    return success;
+}
+
+void MainBench::printPipelineResults(const QString& prefix, const PipelineResult& result)
+{
+    std::vector<qint64> latencies(result.m_latencies);
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double p) -> double {
+        return latencies.size() == 0 ? 0.0 : latencies[std::min(latencies.size() - 1, (std::size_t) (p * latencies.size()))] / 1000.0;
+    };
+
+    double rateMSs = result.m_nsecs > 0 ? (result.m_nbSamples * 1000.0) / result.m_nsecs : 0.0;
+    QDebug info = qInfo();
+    info.noquote();
+    info << tr("%1: sustained rate: %2 MS/s - CPU time %3 ns/sample - FIFO high water %4/%5 - shared baseband dropped %6")
+        .arg(prefix)
+        .arg(rateMSs, 0, 'f', 3)
+        .arg(result.m_cpuNsecs / (double) result.m_nbSamples, 0, 'f', 2)
+        .arg(result.m_fifoHighWater)
+        .arg(result.m_fifoSize)
+        .arg(result.m_basebandDropped);
+    QDebug latencyInfo = qInfo();
+    latencyInfo.noquote();
+    latencyInfo << tr("%1: latency to the direct sinks (us): p50 %2 p90 %3 p99 %4 max %5")
+        .arg(prefix)
+        .arg(percentile(0.5), 0, 'f', 1)
+        .arg(percentile(0.9), 0, 'f', 1)
+        .arg(percentile(0.99), 0, 'f', 1)
+        .arg(percentile(1.0), 0, 'f', 1);
+
+    QJsonObject jsonResult;
+    jsonResult.insert("test", prefix);
+    jsonResult.insert("nsecs", (double) result.m_nsecs);
+    jsonResult.insert("samples", (double) result.m_nbSamples);
+    jsonResult.insert("rateMSs", rateMSs);
+    jsonResult.insert("cpuNsPerSample", result.m_cpuNsecs / (double) result.m_nbSamples);
+    jsonResult.insert("fifoSize", (double) result.m_fifoSize);
+    jsonResult.insert("fifoHighWater", (double) result.m_fifoHighWater);
+    jsonResult.insert("basebandDropped", (double) result.m_basebandDropped);
+    jsonResult.insert("latencyP50us", percentile(0.5));
+    jsonResult.insert("latencyP90us", percentile(0.9));
+    jsonResult.insert("latencyP99us", percentile(0.99));
+    jsonResult.insert("latencyMaxus", percentile(1.0));
+    m_jsonResults.append(jsonResult);
+}
+
 void MainBench::testAMBE()
 {
     qDebug() << "MainBench::testAMBE";
@@ -399,10 +1668,48 @@ void MainBench::decimateFF(const float *buf, int len)
     }
 }
 
-void MainBench::printResults(const QString& prefix, qint64 nsecs)
+void MainBench::printResults(const QString& prefix, qint64 nsecs, quint64 nbSamples)
 {
-    double ratekSs = (m_parser.getNbSamples()*m_parser.getRepetition() / (double) nsecs) * 1e6;
+    if (nbSamples == 0) {
+        nbSamples = (quint64) m_parser.getNbSamples() * m_parser.getRepetition();
+    }
+
+    double ratekSs = (nbSamples / (double) nsecs) * 1e6;
     QDebug info = qInfo();
     info.noquote();
     info << tr("%1: ran test in %L2 ns - sample rate: %3 kS/s").arg(prefix).arg(nsecs).arg(ratekSs);
+
+    QJsonObject result;
+    result.insert("test", prefix);
+    result.insert("nsecs", (double) nsecs);
+    result.insert("samples", (double) nbSamples);
+    result.insert("nsPerSample", nsecs / (double) nbSamples);
+    result.insert("ratekSs", ratekSs);
+    m_jsonResults.append(result);
+}
+
+void MainBench::writeJSON()
+{
+    QJsonObject root;
+    root.insert("version", QCoreApplication::applicationVersion());
+    root.insert("test", m_parser.getTestStr());
+    root.insert("nbSamples", (double) m_parser.getNbSamples());
+    root.insert("repetition", (double) m_parser.getRepetition());
+    root.insert("log2Factor", (double) m_parser.getLog2Factor());
+    root.insert("rxSampleBits", SDR_RX_SAMP_SZ);
+    root.insert("cpuFeatures", CPUFeatures::instance().getFeaturesString());
+    root.insert("simdPath", CPUFeatures::instance().getSIMDPathName());
+    root.insert("results", m_jsonResults);
+
+    QFile file(m_parser.getJsonFileName());
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning("MainBench::writeJSON: cannot open %s", qPrintable(m_parser.getJsonFileName()));
+        return;
+    }
+
+    file.write(QJsonDocument(root).toJson());
+    file.close();
+    qDebug() << "MainBench::writeJSON: results written to" << m_parser.getJsonFileName() << "sink:" << m_sink;
 }
@@ -21,19 +21,32 @@
 #define SDRBENCH_MAINBENCH_H_
 
 #include <QObject>
+#include <QList>
+#include <QJsonArray>
 #include <random>
 #include <functional>
+#include <list>
+#include <vector>
 
 #include "dsp/decimators.h"
 #include "dsp/decimatorsif.h"
 #include "dsp/decimatorsfi.h"
 #include "dsp/decimatorsff.h"
+#include "dsp/downchannelizer.h"
+#include "dsp/inthalfbandfiltereo.h"
+#include "dsp/channelsamplesink.h"
+#include "dsp/channelsamplesource.h"
+#include "dsp/basebandsamplesink.h"
+#include "dsp/glspectruminterface.h"
+#include "benchsamplesource.h"
 #include "parserbench.h"
 
 namespace qtwebapp {
     class LoggerWithFile;
 }
 
+class PluginInterface;
+
 class MainBench: public QObject {
     Q_OBJECT
 
@@ -48,10 +61,136 @@ signals:
     void finished();
 
 private:
+    class NullChannelSink : public ChannelSampleSink
+    {
+    public:
+        NullChannelSink() : m_count(0) {}
+        virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end) { m_count += end - begin; }
+        qint64 m_count;
+    };
+
+    class NullChannelSource : public ChannelSampleSource
+    {
+    public:
+        NullChannelSource(const SampleVector& samples) : m_samples(samples), m_index(0), m_count(0) {}
+        virtual void pull(SampleVector::iterator begin, unsigned int nbSamples)
+        {
+            for (unsigned int i = 0; i < nbSamples; i++) {
+                pullOne(begin[i]);
+            }
+        }
+        virtual void pullOne(Sample& sample)
+        {
+            sample = m_samples[m_index];
+            m_index = m_index + 1 < m_samples.size() ? m_index + 1 : 0;
+            m_count++;
+        }
+        virtual void prefetch(unsigned int nbSamples) { (void) nbSamples; }
+        const SampleVector& m_samples;
+        unsigned int m_index;
+        qint64 m_count;
+    };
+
+    /** Keeps all samples received to compare the outputs of two implementations */
+    class CaptureChannelSink : public ChannelSampleSink
+    {
+    public:
+        virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end) {
+            m_samples.insert(m_samples.end(), begin, end);
+        }
+        SampleVector m_samples;
+    };
+
+    /** Keeps the last spectrum of a SpectrumVis */
+    class CaptureSpectrum : public GLSpectrumInterface
+    {
+    public:
+        CaptureSpectrum() : m_count(0) {}
+        virtual void newSpectrum(const std::vector<Real>& spectrum, int fftSize)
+        {
+            m_spectrum.assign(spectrum.begin(), spectrum.begin() + fftSize);
+            m_count++;
+        }
+        std::vector<Real> m_spectrum;
+        unsigned int m_count;
+    };
+
+    /** Per sample half-band chain of the DownChannelizer before block processing. Reference of the downchannelizer test */
+    class ReferenceDownChannelizer
+    {
+    public:
+        ReferenceDownChannelizer(unsigned int log2Decim, unsigned int filterChainHash);
+        ~ReferenceDownChannelizer();
+        void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, ChannelSampleSink *sink);
+
+    private:
+#ifdef SDR_RX_SAMPLE_24BIT
+        typedef IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER> Filter;
+#else
+        typedef IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER> Filter;
+#endif
+        typedef bool (Filter::*WorkFunction)(Sample* s);
+
+        struct FilterStage
+        {
+            Filter m_filter;
+            WorkFunction m_workFunction;
+            FilterStage(WorkFunction workFunction) : m_workFunction(workFunction) {}
+            bool work(Sample* sample) { return (m_filter.*m_workFunction)(sample); }
+        };
+
+        std::list<FilterStage*> m_filterStages;
+        SampleVector m_sampleBuffer;
+    };
+
+    /** Attached last to the device engine to see when samples have been fed to all its direct sinks.
+     * This is before the shared baseband ring is written and its readers are notified (see BenchSampleSource) */
+    class PipelineProbe : public BasebandSampleSink
+    {
+    public:
+        PipelineProbe(BenchSampleSource *source) : m_source(source) {}
+        virtual void start() {}
+        virtual void stop() {}
+        virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly)
+        {
+            (void) positiveOnly;
+            m_source->samplesDispatched(end - begin);
+        }
+        virtual bool handleMessage(const Message& cmd) { (void) cmd; return false; }
+        BenchSampleSource *m_source;
+    };
+
+    struct PipelineResult
+    {
+        quint64 m_nbSamples;
+        qint64 m_nsecs;        //!< wall clock time to dispatch all samples
+        qint64 m_cpuNsecs;     //!< process CPU time including the channels draining their backlog
+        unsigned int m_fifoSize;
+        unsigned int m_fifoHighWater;
+        quint64 m_basebandDropped;
+        std::vector<qint64> m_latencies;
+    };
+
     void testDecimateII(ParserBench::TestType testType = ParserBench::TestDecimatorsII);
     void testDecimateIF();
     void testDecimateFI();
     void testDecimateFF();
+    void testDownChannelizer();
+    void testUpChannelizer();
+    void testFFTFilter();
+    void testInterpolator();
+    void testNCO();
+    void testFFTEngine();
+    void testPhaseDiscriminators();
+    void testMagAGC();
+    void testCTCSS();
+    void testAudioMix();
+    void testSpectrumZoom();
+    void testRecordFormat();
+    void testSampleFifo();
+    void testPipeline();
+    bool runPipeline(const QList<PluginInterface*>& channelPlugins, PipelineResult& result);
+    void printPipelineResults(const QString& prefix, const PipelineResult& result);
     void testAMBE();
     void decimateII(const qint16 *buf, int len);
     void decimateInfII(const qint16 *buf, int len);
@@ -59,7 +198,9 @@ private:
     void decimateIF(const qint16 *buf, int len);
     void decimateFI(const float *buf, int len);
     void decimateFF(const float *buf, int len);
-    void printResults(const QString& prefix, qint64 nsecs);
+    void printResults(const QString& prefix, qint64 nsecs, quint64 nbSamples = 0);
+    void writeJSON();
+    void createComplexSamples(std::vector<Complex>& samples);
 
     static MainBench *m_instance;
     qtwebapp::LoggerWithFile *m_logger;
@@ -75,6 +216,8 @@ private:
 
     SampleVector m_convertBuffer;
     FSampleVector m_convertBufferF;
+    QJsonArray m_jsonResults;
+    double m_sink; //!< results of the float tests accumulate here so that the compiler cannot drop the work
 };
 
 #endif // SDRBENCH_MAINBENCH_H_
@@ -24,7 +24,8 @@
 
 ParserBench::ParserBench() :
     m_testOption(QStringList() << "t" << "test",
-        "Test type: decimateii, decimatefi, decimateff, decimateif, decimateinfii, decimatesupii, ambe",
+        "Test type: decimateii, decimatefi, decimateff, decimateif, decimateinfii, decimatesupii, downchannelizer, upchannelizer, "
+        "fftfilt, interpolator, nco, fftengine, phasediscri, magagc, ctcss, audiomix, spectrumzoom, recordformat, samplefifo, all (all of the previous), pipeline, ambe",
         "test",
         "decimateii"),
     m_nbSamplesOption(QStringList() << "n" << "nb-samples",
@@ -38,12 +39,28 @@ ParserBench::ParserBench() :
     m_log2FactorOption(QStringList() << "l" << "log2-factor",
         "Log2 factor for rate conversion.",
         "log2",
-        "2")
+        "2"),
+    m_channelsOption(QStringList() << "c" << "channels",
+        "Pipeline test: comma separated list of Rx channel plugin IDs. Repeat an ID to run several instances.",
+        "channels",
+        "AMDemod,NFMDemod,SSBDemod,BFMDemod,UDPSink"),
+    m_sampleRateOption(QStringList() << "s" << "sample-rate",
+        "Pipeline test: device sample rate in S/s.",
+        "rate",
+        "3000000"),
+    m_realtimeOption(QStringList() << "realtime",
+        "Pipeline test: pace the source at the sample rate instead of running as fast as possible. Use it for meaningful latencies."),
+    m_jsonOption(QStringList() << "j" << "json",
+        "Write the results to this file in JSON format.",
+        "file")
 {
     m_testStr = "decimateii";
     m_nbSamples = 1048576;
     m_repetition = 1;
     m_log2Factor = 4;
+    m_channels << "AMDemod" << "NFMDemod" << "SSBDemod" << "BFMDemod" << "UDPSink";
+    m_sampleRate = 3000000;
+    m_realtime = false;
 
     m_parser.setApplicationDescription("Software Defined Radio application benchmarks");
     m_parser.addHelpOption();
@@ -53,6 +70,10 @@ ParserBench::ParserBench() :
     m_parser.addOption(m_nbSamplesOption);
     m_parser.addOption(m_repetitionOption);
     m_parser.addOption(m_log2FactorOption);
+    m_parser.addOption(m_channelsOption);
+    m_parser.addOption(m_sampleRateOption);
+    m_parser.addOption(m_realtimeOption);
+    m_parser.addOption(m_jsonOption);
 }
 
 ParserBench::~ParserBench()
@@ -111,6 +132,36 @@ void ParserBench::parse(const QCoreApplication& app)
     } else {
         qWarning() << "ParserBench::parse: repetilog2 factortion invalid. Defaulting to " << m_log2Factor;
     }
+
+    // pipeline channels
+
+    QStringList channels = m_parser.value(m_channelsOption).split(",");
+    channels.removeAll("");
+
+    if (channels.size() > 0) {
+        m_channels = channels;
+    } else {
+        qWarning() << "ParserBench::parse: channels list empty. Defaulting to " << m_channels;
+    }
+
+    // pipeline sample rate
+
+    QString sampleRateStr = m_parser.value(m_sampleRateOption);
+    int sampleRate = sampleRateStr.toInt(&ok);
+
+    if (ok && (sampleRate >= 48000)) {
+        m_sampleRate = sampleRate;
+    } else {
+        qWarning() << "ParserBench::parse: sample rate invalid. Defaulting to " << m_sampleRate;
+    }
+
+    // pipeline pacing
+
+    m_realtime = m_parser.isSet(m_realtimeOption);
+
+    // JSON results file
+
+    m_jsonFileName = m_parser.value(m_jsonOption);
 }
 
 ParserBench::TestType ParserBench::getTestType() const
@@ -125,6 +176,36 @@ ParserBench::TestType ParserBench::getTestType() const
         return TestDecimatorsInfII;
     } else if (m_testStr == "decimatesupii") {
         return TestDecimatorsSupII;
+    } else if (m_testStr == "downchannelizer") {
+        return TestDownChannelizer;
+    } else if (m_testStr == "upchannelizer") {
+        return TestUpChannelizer;
+    } else if (m_testStr == "fftfilt") {
+        return TestFFTFilter;
+    } else if (m_testStr == "interpolator") {
+        return TestInterpolator;
+    } else if (m_testStr == "nco") {
+        return TestNCO;
+    } else if (m_testStr == "fftengine") {
+        return TestFFTEngine;
+    } else if (m_testStr == "phasediscri") {
+        return TestPhaseDiscriminators;
+    } else if (m_testStr == "magagc") {
+        return TestMagAGC;
+    } else if (m_testStr == "ctcss") {
+        return TestCTCSS;
+    } else if (m_testStr == "audiomix") {
+        return TestAudioMix;
+    } else if (m_testStr == "spectrumzoom") {
+        return TestSpectrumZoom;
+    } else if (m_testStr == "recordformat") {
+        return TestRecordFormat;
+    } else if (m_testStr == "samplefifo") {
+        return TestSampleFifo;
+    } else if (m_testStr == "all") {
+        return TestAll;
+    } else if (m_testStr == "pipeline") {
+        return TestPipeline;
     } else if (m_testStr == "ambe") {
         return TestAMBE;
     } else {
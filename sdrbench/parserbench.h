@@ -20,6 +20,7 @@
 #define SDRBENCH_PARSERBENCH_H_
 
 #include <QCommandLineParser>
+#include <QStringList>
 #include <stdint.h>
 
 class ParserBench
@@ -33,6 +34,21 @@ public:
         TestDecimatorsFF,
         TestDecimatorsInfII,
         TestDecimatorsSupII,
+        TestDownChannelizer,
+        TestUpChannelizer,
+        TestFFTFilter,
+        TestInterpolator,
+        TestNCO,
+        TestFFTEngine,
+        TestPhaseDiscriminators,
+        TestMagAGC,
+        TestCTCSS,
+        TestAudioMix,
+        TestSpectrumZoom,
+        TestRecordFormat,
+        TestSampleFifo,
+        TestAll,
+        TestPipeline,
         TestAMBE
     } TestType;
 
@@ -46,18 +62,30 @@ public:
     uint32_t getNbSamples() const { return m_nbSamples; }
     uint32_t getRepetition() const { return m_repetition; }
     uint32_t getLog2Factor() const { return m_log2Factor; }
+    const QStringList& getChannels() const { return m_channels; }
+    uint32_t getSampleRate() const { return m_sampleRate; }
+    bool getRealtime() const { return m_realtime; }
+    const QString& getJsonFileName() const { return m_jsonFileName; }
 
 private:
     QString  m_testStr;
     uint32_t m_nbSamples;
     uint32_t m_repetition;
     uint32_t m_log2Factor;
+    QStringList m_channels;
+    uint32_t m_sampleRate;
+    bool m_realtime;
+    QString m_jsonFileName;
 
     QCommandLineParser m_parser;
     QCommandLineOption m_testOption;
     QCommandLineOption m_nbSamplesOption;
     QCommandLineOption m_repetitionOption;
     QCommandLineOption m_log2FactorOption;
+    QCommandLineOption m_channelsOption;
+    QCommandLineOption m_sampleRateOption;
+    QCommandLineOption m_realtimeOption;
+    QCommandLineOption m_jsonOption;
 };
 
 
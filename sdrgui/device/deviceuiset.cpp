@@ -19,11 +19,14 @@
 
 #include "gui/glspectrum.h"
 #include "dsp/spectrumvis.h"
+#include "dsp/spectrumzoom.h"
 #include "gui/glspectrumgui.h"
 #include "gui/channelwindow.h"
 #include "gui/samplingdevicecontrol.h"
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
+#include "device/deviceapi.h"
+#include "channel/channelapi.h"
 #include "plugin/plugininstancegui.h"
 #include "plugin/pluginapi.h"
 #include "plugin/plugininterface.h"
@@ -49,7 +52,9 @@ DeviceUISet::DeviceUISet(int tabIndex, int deviceType, QTimer& timer)
     m_deviceSourceEngine = nullptr;
     m_deviceSinkEngine = nullptr;
     m_deviceMIMOEngine = nullptr;
+    m_spectrumZoom = nullptr;
     m_deviceTabIndex = tabIndex;
+    m_spectrumZoomEnabled = false;
     m_nbAvailableRxChannels = 0;   // updated at enumeration for UI selector
     m_nbAvailableTxChannels = 0;   // updated at enumeration for UI selector
     m_nbAvailableMIMOChannels = 0; // updated at enumeration for UI selector
@@ -63,6 +68,8 @@ DeviceUISet::DeviceUISet(int tabIndex, int deviceType, QTimer& timer)
 
 DeviceUISet::~DeviceUISet()
 {
+    enableSpectrumZoom(false); // the device engine is still there
+    delete m_spectrumZoom;
     delete m_samplingDeviceControl;
     delete m_channelWindow;
     delete m_spectrumGUI;
@@ -70,6 +77,28 @@ DeviceUISet::~DeviceUISet()
     delete m_spectrum;
 }
 
+void DeviceUISet::enableSpectrumZoom(bool enable)
+{
+    if (!m_deviceSourceEngine || (enable == m_spectrumZoomEnabled)) {
+        return;
+    }
+
+    if (enable)
+    {
+        if (!m_spectrumZoom) {
+            m_spectrumZoom = new SpectrumZoom(SDR_RX_SCALEF); // no display: streaming only
+        }
+
+        m_deviceSourceEngine->addSink(m_spectrumZoom);
+    }
+    else
+    {
+        m_deviceSourceEngine->removeSink(m_spectrumZoom);
+    }
+
+    m_spectrumZoomEnabled = enable;
+}
+
 void DeviceUISet::setSpectrumScalingFactor(float scalef)
 {
     m_spectrumVis->setScalef(m_spectrumVis->getInputMessageQueue(), scalef);
@@ -87,19 +116,28 @@ void DeviceUISet::addRollupWidget(QWidget *widget)
 
 void DeviceUISet::registerRxChannelInstance(const QString& channelName, PluginInstanceGUI* pluginGUI)
 {
-    m_channelInstanceRegistrations.append(ChannelInstanceRegistration(channelName, pluginGUI, 0));
+    // the GUI is created right after its channel which is therefore the last one in the device set
+    int nbChannels = m_deviceAPI->getNbSinkChannels();
+    ChannelAPI *channelAPI = nbChannels > 0 ? m_deviceAPI->getChanelSinkAPIAt(nbChannels - 1) : nullptr;
+    m_channelInstanceRegistrations.append(ChannelInstanceRegistration(channelName, pluginGUI, 0, channelAPI));
     renameChannelInstances();
 }
 
 void DeviceUISet::registerTxChannelInstance(const QString& channelName, PluginInstanceGUI* pluginGUI)
 {
-    m_channelInstanceRegistrations.append(ChannelInstanceRegistration(channelName, pluginGUI, 1));
+    // the GUI is created right after its channel which is therefore the last one in the device set
+    int nbChannels = m_deviceAPI->getNbSourceChannels();
+    ChannelAPI *channelAPI = nbChannels > 0 ? m_deviceAPI->getChanelSourceAPIAt(nbChannels - 1) : nullptr;
+    m_channelInstanceRegistrations.append(ChannelInstanceRegistration(channelName, pluginGUI, 1, channelAPI));
     renameChannelInstances();
 }
 
 void DeviceUISet::registerChannelInstance(const QString& channelName, PluginInstanceGUI* pluginGUI)
 {
-    m_channelInstanceRegistrations.append(ChannelInstanceRegistration(channelName, pluginGUI, 2));
+    // the GUI is created right after its channel which is therefore the last one in the device set
+    int nbChannels = m_deviceAPI->getNbMIMOChannels();
+    ChannelAPI *channelAPI = nbChannels > 0 ? m_deviceAPI->getMIMOChannelAPIAt(nbChannels - 1) : nullptr;
+    m_channelInstanceRegistrations.append(ChannelInstanceRegistration(channelName, pluginGUI, 2, channelAPI));
     renameChannelInstances();
 }
 
@@ -215,6 +253,7 @@ void DeviceUISet::loadRxChannelSettings(const Preset *preset, PluginAPI *pluginA
             {
                 qDebug("DeviceUISet::loadRxChannelSettings: deserializing channel [%s]", qPrintable(channelConfig.m_channelIdURI));
                 reg.m_gui->deserialize(channelConfig.m_config);
+                setChannelThreadPolicy(reg.m_gui, channelConfig.m_threadPolicy);
             }
         }
 
@@ -235,7 +274,12 @@ void DeviceUISet::saveRxChannelSettings(Preset *preset)
         for(int i = 0; i < m_channelInstanceRegistrations.count(); i++)
         {
             qDebug("DeviceUISet::saveRxChannelSettings: saving channel [%s]", qPrintable(m_channelInstanceRegistrations[i].m_channelName));
-            preset->addChannel(m_channelInstanceRegistrations[i].m_channelName, m_channelInstanceRegistrations[i].m_gui->serialize());
+            ChannelAPI *channelAPI = m_channelInstanceRegistrations[i].m_channelAPI;
+            preset->addChannel(
+                m_channelInstanceRegistrations[i].m_channelName,
+                m_channelInstanceRegistrations[i].m_gui->serialize(),
+                channelAPI ? channelAPI->getThreadPolicy() : ThreadPolicy()
+            );
         }
     }
     else
@@ -292,6 +336,7 @@ void DeviceUISet::loadTxChannelSettings(const Preset *preset, PluginAPI *pluginA
             {
                 qDebug("DeviceUISet::loadTxChannelSettings: deserializing channel [%s]", qPrintable(channelConfig.m_channelIdURI));
                 reg.m_gui->deserialize(channelConfig.m_config);
+                setChannelThreadPolicy(reg.m_gui, channelConfig.m_threadPolicy);
             }
         }
 
@@ -313,7 +358,12 @@ void DeviceUISet::saveTxChannelSettings(Preset *preset)
         for(int i = 0; i < m_channelInstanceRegistrations.count(); i++)
         {
             qDebug("DeviceUISet::saveTxChannelSettings: saving channel [%s]", qPrintable(m_channelInstanceRegistrations[i].m_channelName));
-            preset->addChannel(m_channelInstanceRegistrations[i].m_channelName, m_channelInstanceRegistrations[i].m_gui->serialize());
+            ChannelAPI *channelAPI = m_channelInstanceRegistrations[i].m_channelAPI;
+            preset->addChannel(
+                m_channelInstanceRegistrations[i].m_channelName,
+                m_channelInstanceRegistrations[i].m_gui->serialize(),
+                channelAPI ? channelAPI->getThreadPolicy() : ThreadPolicy()
+            );
         }
     }
     else
@@ -371,6 +421,7 @@ void DeviceUISet::loadMIMOChannelSettings(const Preset *preset, PluginAPI *plugi
             {
                 qDebug("DeviceUISet::loadMIMOChannelSettings: deserializing channel [%s]", qPrintable(channelConfig.m_channelIdURI));
                 reg.m_gui->deserialize(channelConfig.m_config);
+                setChannelThreadPolicy(reg.m_gui, channelConfig.m_threadPolicy);
             }
         }
 
@@ -391,7 +442,12 @@ void DeviceUISet::saveMIMOChannelSettings(Preset *preset)
         for(int i = 0; i < m_channelInstanceRegistrations.count(); i++)
         {
             qDebug("DeviceUISet::saveMIMOChannelSettings: saving channel [%s]", qPrintable(m_channelInstanceRegistrations[i].m_channelName));
-            preset->addChannel(m_channelInstanceRegistrations[i].m_channelName, m_channelInstanceRegistrations[i].m_gui->serialize());
+            ChannelAPI *channelAPI = m_channelInstanceRegistrations[i].m_channelAPI;
+            preset->addChannel(
+                m_channelInstanceRegistrations[i].m_channelName,
+                m_channelInstanceRegistrations[i].m_gui->serialize(),
+                channelAPI ? channelAPI->getThreadPolicy() : ThreadPolicy()
+            );
         }
     }
     else
@@ -427,3 +483,17 @@ bool DeviceUISet::ChannelInstanceRegistration::operator<(const ChannelInstanceRe
     }
 }
 
+void DeviceUISet::setChannelThreadPolicy(PluginInstanceGUI* pluginGUI, const ThreadPolicy& threadPolicy)
+{
+    for (int i = 0; i < m_channelInstanceRegistrations.count(); i++)
+    {
+        ChannelAPI *channelAPI = m_channelInstanceRegistrations[i].m_channelAPI;
+
+        if ((m_channelInstanceRegistrations[i].m_gui == pluginGUI) && channelAPI)
+        {
+            channelAPI->setThreadPolicy(threadPolicy);
+            m_deviceAPI->applyThreadPolicy(channelAPI);
+            break;
+        }
+    }
+}
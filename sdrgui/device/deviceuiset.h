@@ -24,6 +24,7 @@
 #include "export.h"
 
 class SpectrumVis;
+class SpectrumZoom;
 class GLSpectrum;
 class GLSpectrumGUI;
 class ChannelWindow;
@@ -35,7 +36,9 @@ class DSPDeviceMIMOEngine;
 class ChannelMarker;
 class PluginAPI;
 class PluginInstanceGUI;
+class ChannelAPI;
 class Preset;
+struct ThreadPolicy;
 
 class SDRGUI_API DeviceUISet
 {
@@ -49,6 +52,7 @@ public:
     DSPDeviceSourceEngine *m_deviceSourceEngine;
     DSPDeviceSinkEngine *m_deviceSinkEngine;
     DSPDeviceMIMOEngine *m_deviceMIMOEngine;
+    SpectrumZoom *m_spectrumZoom; //!< Zoom on a span of the Rx baseband streamed to remote clients. Created when first enabled
     QByteArray m_mainWindowState;
 
     DeviceUISet(int tabIndex, int deviceType, QTimer& timer);
@@ -58,6 +62,8 @@ public:
     void setSpectrumScalingFactor(float scalef);
     void addChannelMarker(ChannelMarker* channelMarker); //!< Add channel marker to spectrum
     void addRollupWidget(QWidget *widget);               //!< Add rollup widget to channel window
+    void enableSpectrumZoom(bool enable);                //!< Rx only: attach or detach the spectrum zoom to the device engine
+    bool isSpectrumZoomEnabled() const { return m_spectrumZoomEnabled; }
 
     int getNumberOfChannels() const { return m_channelInstanceRegistrations.size(); }
     void registerRxChannelInstance(const QString& channelName, PluginInstanceGUI* pluginGUI);
@@ -89,17 +95,20 @@ private:
         QString m_channelName;
         PluginInstanceGUI* m_gui;
         int m_channelType;
+        ChannelAPI *m_channelAPI; //!< Channel behind the GUI used for its thread policy
 
         ChannelInstanceRegistration() :
             m_channelName(),
             m_gui(nullptr),
-            m_channelType(0)
+            m_channelType(0),
+            m_channelAPI(nullptr)
         { }
 
-        ChannelInstanceRegistration(const QString& channelName, PluginInstanceGUI* pluginGUI, int channelType) :
+        ChannelInstanceRegistration(const QString& channelName, PluginInstanceGUI* pluginGUI, int channelType, ChannelAPI *channelAPI = nullptr) :
             m_channelName(channelName),
             m_gui(pluginGUI),
-            m_channelType(channelType)
+            m_channelType(channelType),
+            m_channelAPI(channelAPI)
         { }
 
         bool operator<(const ChannelInstanceRegistration& other) const;
@@ -111,11 +120,13 @@ private:
     // ChannelInstanceRegistrations m_txChannelInstanceRegistrations;
     ChannelInstanceRegistrations m_channelInstanceRegistrations;
     int m_deviceTabIndex;
+    bool m_spectrumZoomEnabled;
     int m_nbAvailableRxChannels;   //!< Number of Rx channels available for selection
     int m_nbAvailableTxChannels;   //!< Number of Tx channels available for selection
     int m_nbAvailableMIMOChannels; //!< Number of MIMO channels available for selection
 
     void renameChannelInstances();
+    void setChannelThreadPolicy(PluginInstanceGUI* pluginGUI, const ThreadPolicy& threadPolicy);
 };
 
 
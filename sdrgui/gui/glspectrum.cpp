@@ -1863,6 +1863,18 @@ void GLSpectrum::leaveEvent(QEvent* event)
 	QGLWidget::enterEvent(event);
 }
 
+void GLSpectrum::showEvent(QShowEvent* event)
+{
+	setDisplayed(true);
+	QGLWidget::showEvent(event);
+}
+
+void GLSpectrum::hideEvent(QHideEvent* event)
+{
+	setDisplayed(false); // the spectrum engine stops computing frames
+	QGLWidget::hideEvent(event);
+}
+
 void GLSpectrum::tick()
 {
 	if(m_displayChanged) {
@@ -33,6 +33,7 @@
 #include "gui/glshadersimple.h"
 #include "gui/glshadertextured.h"
 #include "dsp/channelmarker.h"
+#include "dsp/glspectruminterface.h"
 #include "export.h"
 #include "util/incrementalarray.h"
 #include "util/message.h"
@@ -40,7 +41,7 @@
 class QOpenGLShaderProgram;
 class MessageQueue;
 
-class SDRGUI_API GLSpectrum : public QGLWidget {
+class SDRGUI_API GLSpectrum : public QGLWidget, public GLSpectrumInterface {
 	Q_OBJECT
 
 public:
@@ -89,7 +90,7 @@ public:
 	void removeChannelMarker(ChannelMarker* channelMarker);
 	void setMessageQueueToGUI(MessageQueue* messageQueue) { m_messageQueueToGUI = messageQueue; }
 
-	void newSpectrum(const std::vector<Real>& spectrum, int fftSize);
+	virtual void newSpectrum(const std::vector<Real>& spectrum, int fftSize);
 	void clearSpectrumHistogram();
 
 	Real getWaterfallShare() const { return m_waterfallShare; }
@@ -223,6 +224,8 @@ private:
 
 	void enterEvent(QEvent* event);
 	void leaveEvent(QEvent* event);
+	void showEvent(QShowEvent* event);
+	void hideEvent(QHideEvent* event);
 
 private slots:
 	void cleanup();
@@ -57,6 +57,7 @@
 #include "dsp/dspcommands.h"
 #include "dsp/devicesamplesource.h"
 #include "dsp/devicesamplesink.h"
+#include "dsp/filerecord.h"
 #include "dsp/devicesamplemimo.h"
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
@@ -192,6 +193,12 @@ MainWindow::MainWindow(qtwebapp::LoggerWithFile *logger, const MainParser& parse
     m_dspEngine->createFFTFactory(parser.getFFTWFWisdomFileName());
     m_dspEngine->preAllocateFFTs();
 
+    if (parser.getChannelPoolThreads() >= 0) {
+        m_dspEngine->getChannelThreadPool()->setNbThreads(parser.getChannelPoolThreads());
+    }
+
+    FileRecord::setDefaultFormat(parser.getRecordFormat());
+
     splash->showStatusMessage("load settings...", Qt::white);
     qDebug() << "MainWindow::MainWindow: load settings...";
 
@@ -34,6 +34,9 @@
 #include "dsp/dspdevicesinkengine.h"
 #include "dsp/dspdevicemimoengine.h"
 #include "dsp/dspengine.h"
+#include "dsp/cpufeatures.h"
+#include "dsp/simdkernels.h"
+#include "dsp/spectrumvis.h"
 #include "plugin/pluginapi.h"
 #include "plugin/pluginmanager.h"
 #include "channel/channelapi.h"
@@ -57,11 +60,15 @@
 #include "SWGPresetIdentifier.h"
 #include "SWGDeviceSettings.h"
 #include "SWGDeviceState.h"
+#include "SWGDeviceSetThreading.h"
+#include "SWGSpectrumStream.h"
+#include "SWGSpectrumZoom.h"
 #include "SWGDeviceReport.h"
 #include "SWGDeviceActions.h"
 #include "SWGChannelsDetail.h"
 #include "SWGChannelSettings.h"
 #include "SWGChannelReport.h"
+#include "SWGChannelRecord.h"
 #include "SWGChannelActions.h"
 #include "SWGSuccessResponse.h"
 #include "SWGErrorResponse.h"
@@ -101,6 +108,8 @@ int WebAPIAdapterGUI::instanceSummary(
     *response.getArchitecture() = QString(QSysInfo::currentCpuArchitecture());
     *response.getOs() = QString(QSysInfo::prettyProductName());
 #endif
+    *response.getSimdPath() = CPUFeatures::getSIMDPathName(SIMDKernels::instance().path);
+    *response.getCpuFeatures() = CPUFeatures::instance().getFeaturesString();
 
     SWGSDRangel::SWGLoggingInfo *logging = response.getLogging();
     logging->init();
@@ -672,6 +681,23 @@ int WebAPIAdapterGUI::instanceLocationPut(
     return 200;
 }
 
+int WebAPIAdapterGUI::instanceMetricsGet(
+        QString& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    (void) error;
+    std::vector<DeviceAPI*> deviceAPIs;
+
+    for (const auto& deviceSet : m_mainWindow.m_deviceUIs) {
+        deviceAPIs.push_back(deviceSet->m_deviceAPI);
+    }
+
+    response.clear();
+    WebAPIAdapterBase::webapiFormatMetrics(response, deviceAPIs);
+
+    return 200;
+}
+
 int WebAPIAdapterGUI::instanceDVSerialGet(
             SWGSDRangel::SWGDVSerialDevices& response,
             SWGSDRangel::SWGErrorResponse& error)
@@ -1415,6 +1441,169 @@ int WebAPIAdapterGUI::devicesetFocusPatch(
     }
 }
 
+int WebAPIAdapterGUI::devicesetThreadingGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGDeviceSetThreading& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+        WebAPIAdapterBase::webapiFormatThreading(response, deviceSet->m_deviceAPI);
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetThreadingPut(
+        int deviceSetIndex,
+        const QStringList& threadingKeys,
+        SWGSDRangel::SWGDeviceSetThreading& query,
+        SWGSDRangel::SWGDeviceSetThreading& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+        error.init();
+
+        if (!WebAPIAdapterBase::webapiUpdateThreading(threadingKeys, query, deviceSet->m_deviceAPI, *error.getMessage())) {
+            return 400;
+        }
+
+        WebAPIAdapterBase::webapiFormatThreading(response, deviceSet->m_deviceAPI);
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetSpectrumStreamGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGSpectrumStream& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+        WebAPIAdapterBase::webapiFormatSpectrumStream(response, deviceSet->m_spectrumVis);
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetSpectrumStreamPut(
+        int deviceSetIndex,
+        const QStringList& spectrumStreamKeys,
+        SWGSDRangel::SWGSpectrumStream& query,
+        SWGSDRangel::SWGSpectrumStream& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+        // FFT settings are those of the spectrum GUI
+        WebAPIAdapterBase::webapiUpdateSpectrumStream(spectrumStreamKeys, query, response, deviceSet->m_spectrumVis, false);
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetSpectrumZoomGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGSpectrumZoom& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+
+        if (!deviceSet->m_deviceSourceEngine)
+        {
+            error.init();
+            *error.getMessage() = QString("Device set %1 is not a Rx device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        WebAPIAdapterBase::webapiFormatSpectrumZoom(response, deviceSet->m_spectrumZoom, deviceSet->isSpectrumZoomEnabled());
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetSpectrumZoomPut(
+        int deviceSetIndex,
+        const QStringList& spectrumZoomKeys,
+        SWGSDRangel::SWGSpectrumZoom& query,
+        SWGSDRangel::SWGSpectrumZoom& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+
+        if (!deviceSet->m_deviceSourceEngine)
+        {
+            error.init();
+            *error.getMessage() = QString("Device set %1 is not a Rx device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        if (spectrumZoomKeys.contains("enable")) {
+            deviceSet->enableSpectrumZoom(query.getEnable() != 0);
+        }
+
+        if (deviceSet->m_spectrumZoom) {
+            WebAPIAdapterBase::webapiUpdateSpectrumZoom(spectrumZoomKeys, query, response, deviceSet->m_spectrumZoom, deviceSet->isSpectrumZoomEnabled());
+        } else {
+            WebAPIAdapterBase::webapiFormatSpectrumZoom(response, nullptr, false);
+        }
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
 int WebAPIAdapterGUI::devicesetDevicePut(
         int deviceSetIndex,
         SWGSDRangel::SWGDeviceListItem& query,
@@ -1968,6 +2157,7 @@ int WebAPIAdapterGUI::devicesetDeviceReportGet(
             response.setDeviceHwType(new QString(deviceSet->m_deviceAPI->getHardwareId()));
             response.setDirection(0);
             DeviceSampleSource *source = deviceSet->m_deviceAPI->getSampleSource();
+            WebAPIAdapterBase::webapiFormatTelemetry(response, deviceSet->m_deviceSourceEngine->getTelemetry());
             return source->webapiReportGet(response, *error.getMessage());
         }
         else if (deviceSet->m_deviceSinkEngine) // Single Tx
@@ -1975,6 +2165,7 @@ int WebAPIAdapterGUI::devicesetDeviceReportGet(
             response.setDeviceHwType(new QString(deviceSet->m_deviceAPI->getHardwareId()));
             response.setDirection(1);
             DeviceSampleSink *sink = deviceSet->m_deviceAPI->getSampleSink();
+            WebAPIAdapterBase::webapiFormatTelemetry(response, deviceSet->m_deviceSinkEngine->getTelemetry());
             return sink->webapiReportGet(response, *error.getMessage());
         }
         else if (deviceSet->m_deviceMIMOEngine) // MIMO
@@ -2314,6 +2505,7 @@ int WebAPIAdapterGUI::devicesetChannelReportGet(
                 response.setChannelType(new QString());
                 channelAPI->getIdentifier(*response.getChannelType());
                 response.setDirection(0);
+                WebAPIAdapterBase::webapiFormatTelemetry(response, channelAPI);
                 return channelAPI->webapiReportGet(response, *error.getMessage());
             }
         }
@@ -2331,6 +2523,7 @@ int WebAPIAdapterGUI::devicesetChannelReportGet(
                 response.setChannelType(new QString());
                 channelAPI->getIdentifier(*response.getChannelType());
                 response.setDirection(1);
+                WebAPIAdapterBase::webapiFormatTelemetry(response, channelAPI);
                 return channelAPI->webapiReportGet(response, *error.getMessage());
             }
         }
@@ -2366,6 +2559,7 @@ int WebAPIAdapterGUI::devicesetChannelReportGet(
             {
                 response.setChannelType(new QString());
                 channelAPI->getIdentifier(*response.getChannelType());
+                WebAPIAdapterBase::webapiFormatTelemetry(response, channelAPI);
                 return channelAPI->webapiReportGet(response, *error.getMessage());
             }
             else
@@ -2387,6 +2581,67 @@ int WebAPIAdapterGUI::devicesetChannelReportGet(
     }
 }
 
+int WebAPIAdapterGUI::devicesetChannelRecordGet(
+        int deviceSetIndex,
+        int channelIndex,
+        SWGSDRangel::SWGChannelRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+        return WebAPIAdapterBase::webapiFormatChannelRecord(response, deviceSet->m_deviceAPI, channelIndex, *error.getMessage());
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetChannelRecordPost(
+        int deviceSetIndex,
+        int channelIndex,
+        SWGSDRangel::SWGChannelRecord& query,
+        SWGSDRangel::SWGChannelRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+        return WebAPIAdapterBase::webapiStartChannelRecord(query, response, deviceSet->m_deviceAPI, deviceSetIndex, channelIndex, *error.getMessage());
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetChannelRecordDelete(
+        int deviceSetIndex,
+        int channelIndex,
+        SWGSDRangel::SWGChannelRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+        return WebAPIAdapterBase::webapiStopChannelRecord(response, deviceSet->m_deviceAPI, channelIndex, *error.getMessage());
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
 int WebAPIAdapterGUI::devicesetChannelActionsPost(
         int deviceSetIndex,
         int channelIndex,
@@ -109,6 +109,10 @@ public:
             SWGSDRangel::SWGLocationInformation& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int instanceMetricsGet(
+            QString& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
     virtual int instanceDVSerialGet(
             SWGSDRangel::SWGDVSerialDevices& response,
             SWGSDRangel::SWGErrorResponse& error);
@@ -212,6 +216,42 @@ public:
             SWGSDRangel::SWGSuccessResponse& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int devicesetThreadingGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGDeviceSetThreading& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetThreadingPut(
+            int deviceSetIndex,
+            const QStringList& threadingKeys,
+            SWGSDRangel::SWGDeviceSetThreading& query,
+            SWGSDRangel::SWGDeviceSetThreading& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetSpectrumStreamGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGSpectrumStream& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetSpectrumStreamPut(
+            int deviceSetIndex,
+            const QStringList& spectrumStreamKeys,
+            SWGSDRangel::SWGSpectrumStream& query,
+            SWGSDRangel::SWGSpectrumStream& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetSpectrumZoomGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGSpectrumZoom& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetSpectrumZoomPut(
+            int deviceSetIndex,
+            const QStringList& spectrumZoomKeys,
+            SWGSDRangel::SWGSpectrumZoom& query,
+            SWGSDRangel::SWGSpectrumZoom& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
     virtual int devicesetDevicePut(
             int deviceSetIndex,
             SWGSDRangel::SWGDeviceListItem& query,
@@ -320,6 +360,25 @@ public:
             SWGSDRangel::SWGChannelReport& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int devicesetChannelRecordGet(
+            int deviceSetIndex,
+            int channelIndex,
+            SWGSDRangel::SWGChannelRecord& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetChannelRecordPost(
+            int deviceSetIndex,
+            int channelIndex,
+            SWGSDRangel::SWGChannelRecord& query,
+            SWGSDRangel::SWGChannelRecord& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetChannelRecordDelete(
+            int deviceSetIndex,
+            int channelIndex,
+            SWGSDRangel::SWGChannelRecord& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
 private:
     MainWindow& m_mainWindow;
 
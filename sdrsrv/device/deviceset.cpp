@@ -15,6 +15,9 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include "device/deviceapi.h"
+#include "dsp/spectrumvis.h"
+#include "dsp/spectrumzoom.h"
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
 #include "plugin/pluginapi.h"
@@ -32,17 +35,50 @@ DeviceSet::ChannelInstanceRegistration::ChannelInstanceRegistration(const QStrin
     m_channelAPI(channelAPI)
 {}
 
-DeviceSet::DeviceSet(int tabIndex)
+DeviceSet::DeviceSet(int tabIndex, int deviceType)
 {
+    if ((deviceType == DeviceAPI::StreamSingleRx) || (deviceType == DeviceAPI::StreamMIMO)) {
+        m_spectrumVis = new SpectrumVis(SDR_RX_SCALEF);
+    } else { // DeviceAPI::StreamSingleTx
+        m_spectrumVis = new SpectrumVis(SDR_TX_SCALEF);
+    }
+
     m_deviceAPI = nullptr;
     m_deviceSourceEngine = nullptr;
     m_deviceSinkEngine = nullptr;
     m_deviceMIMOEngine = nullptr;
+    m_spectrumZoom = nullptr;
     m_deviceTabIndex = tabIndex;
+    m_spectrumZoomEnabled = false;
 }
 
 DeviceSet::~DeviceSet()
 {
+    enableSpectrumZoom(false); // the device engine is still there
+    delete m_spectrumZoom;
+    delete m_spectrumVis;
+}
+
+void DeviceSet::enableSpectrumZoom(bool enable)
+{
+    if (!m_deviceSourceEngine || (enable == m_spectrumZoomEnabled)) {
+        return;
+    }
+
+    if (enable)
+    {
+        if (!m_spectrumZoom) {
+            m_spectrumZoom = new SpectrumZoom(SDR_RX_SCALEF);
+        }
+
+        m_deviceSourceEngine->addSink(m_spectrumZoom);
+    }
+    else
+    {
+        m_deviceSourceEngine->removeSink(m_spectrumZoom);
+    }
+
+    m_spectrumZoomEnabled = enable;
 }
 
 void DeviceSet::registerRxChannelInstance(const QString& channelName, ChannelAPI* channelAPI)
@@ -211,6 +247,8 @@ void DeviceSet::loadRxChannelSettings(const Preset *preset, PluginAPI *pluginAPI
             {
                 qDebug("DeviceSet::loadChannelSettings: deserializing channel [%s]", qPrintable(channelConfig.m_channelIdURI));
                 reg.m_channelAPI->deserialize(channelConfig.m_config);
+                reg.m_channelAPI->setThreadPolicy(channelConfig.m_threadPolicy);
+                m_deviceAPI->applyThreadPolicy(reg.m_channelAPI);
             }
         }
 
@@ -238,7 +276,11 @@ void DeviceSet::saveRxChannelSettings(Preset *preset)
         for (int i = 0; i < m_channelInstanceRegistrations.count(); i++)
         {
             qDebug("DeviceSet::saveChannelSettings: channel [%s] saved", qPrintable(m_channelInstanceRegistrations[i].m_channelName));
-            preset->addChannel(m_channelInstanceRegistrations[i].m_channelName, m_channelInstanceRegistrations[i].m_channelAPI->serialize());
+            preset->addChannel(
+                m_channelInstanceRegistrations[i].m_channelName,
+                m_channelInstanceRegistrations[i].m_channelAPI->serialize(),
+                m_channelInstanceRegistrations[i].m_channelAPI->getThreadPolicy()
+            );
         }
     }
     else
@@ -303,6 +345,8 @@ void DeviceSet::loadTxChannelSettings(const Preset *preset, PluginAPI *pluginAPI
             {
                 qDebug("DeviceSet::loadTxChannelSettings: deserializing channel [%s]", qPrintable(channelConfig.m_channelIdURI));
                 reg.m_channelAPI->deserialize(channelConfig.m_config);
+                reg.m_channelAPI->setThreadPolicy(channelConfig.m_threadPolicy);
+                m_deviceAPI->applyThreadPolicy(reg.m_channelAPI);
             }
         }
 
@@ -331,7 +375,11 @@ void DeviceSet::saveTxChannelSettings(Preset *preset)
         for (int i = 0; i < m_channelInstanceRegistrations.count(); i++)
         {
             qDebug("DeviceSet::saveTxChannelSettings: channel [%s] saved", qPrintable(m_channelInstanceRegistrations[i].m_channelName));
-            preset->addChannel(m_channelInstanceRegistrations[i].m_channelName, m_channelInstanceRegistrations[i].m_channelAPI->serialize());
+            preset->addChannel(
+                m_channelInstanceRegistrations[i].m_channelName,
+                m_channelInstanceRegistrations[i].m_channelAPI->serialize(),
+                m_channelInstanceRegistrations[i].m_channelAPI->getThreadPolicy()
+            );
         }
     }
     else
@@ -400,6 +448,8 @@ void DeviceSet::loadMIMOChannelSettings(const Preset *preset, PluginAPI *pluginA
             {
                 qDebug("DeviceSet::loadMIMOChannelSettings: deserializing channel [%s]", qPrintable(channelConfig.m_channelIdURI));
                 reg.m_channelAPI->deserialize(channelConfig.m_config);
+                reg.m_channelAPI->setThreadPolicy(channelConfig.m_threadPolicy);
+                m_deviceAPI->applyThreadPolicy(reg.m_channelAPI);
             }
         }
 
@@ -427,7 +477,11 @@ void DeviceSet::saveMIMOChannelSettings(Preset *preset)
         for (int i = 0; i < m_channelInstanceRegistrations.count(); i++)
         {
             qDebug("DeviceSet::saveMIMOChannelSettings: channel [%s] saved", qPrintable(m_channelInstanceRegistrations[i].m_channelName));
-            preset->addChannel(m_channelInstanceRegistrations[i].m_channelName, m_channelInstanceRegistrations[i].m_channelAPI->serialize());
+            preset->addChannel(
+                m_channelInstanceRegistrations[i].m_channelName,
+                m_channelInstanceRegistrations[i].m_channelAPI->serialize(),
+                m_channelInstanceRegistrations[i].m_channelAPI->getThreadPolicy()
+            );
         }
     }
     else
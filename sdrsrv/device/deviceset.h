@@ -21,6 +21,8 @@
 #include <QTimer>
 
 class DeviceAPI;
+class SpectrumVis;
+class SpectrumZoom;
 class DSPDeviceSourceEngine;
 class DSPDeviceSinkEngine;
 class DSPDeviceMIMOEngine;
@@ -32,13 +34,17 @@ class DeviceSet
 {
 public:
     DeviceAPI *m_deviceAPI;
+    SpectrumVis *m_spectrumVis;
     DSPDeviceSourceEngine *m_deviceSourceEngine;
     DSPDeviceSinkEngine *m_deviceSinkEngine;
     DSPDeviceMIMOEngine *m_deviceMIMOEngine;
+    SpectrumZoom *m_spectrumZoom; //!< Zoom on a span of the Rx baseband. Created when first enabled
 
-    DeviceSet(int tabIndex);
+    DeviceSet(int tabIndex, int deviceType); //!< deviceType is a DeviceAPI::StreamType
     ~DeviceSet();
 
+    void enableSpectrumZoom(bool enable); //!< Rx only: attach or detach the spectrum zoom to the device engine
+    bool isSpectrumZoomEnabled() const { return m_spectrumZoomEnabled; }
     int getNumberOfChannels() const { return m_channelInstanceRegistrations.size(); }
     void addRxChannel(int selectedChannelIndex, PluginAPI *pluginAPI);
     void addTxChannel(int selectedChannelIndex, PluginAPI *pluginAPI);
@@ -78,6 +84,7 @@ private:
 
     ChannelInstanceRegistrations m_channelInstanceRegistrations;
     int m_deviceTabIndex;
+    bool m_spectrumZoomEnabled;
 
     void renameChannelInstances();
 };
@@ -25,6 +25,7 @@
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
 #include "dsp/dspdevicemimoengine.h"
+#include "dsp/filerecord.h"
 #include "device/deviceapi.h"
 #include "device/deviceset.h"
 #include "device/deviceenumerator.h"
@@ -66,6 +67,14 @@ MainCore::MainCore(qtwebapp::LoggerWithFile *logger, const MainParser& parser, Q
     qDebug() << "MainCore::MainCore: create FFT factory...";
     m_dspEngine->createFFTFactory(parser.getFFTWFWisdomFileName());
 
+    if (parser.getChannelPoolThreads() >= 0)
+    {
+        qDebug() << "MainCore::MainCore: create channel threads pool...";
+        m_dspEngine->getChannelThreadPool()->setNbThreads(parser.getChannelPoolThreads());
+    }
+
+    FileRecord::setDefaultFormat(parser.getRecordFormat());
+
     qDebug() << "MainCore::MainCore: load plugins...";
     m_pluginManager = new PluginManager(this);
     m_pluginManager->loadPlugins(QString("pluginssrv"));
@@ -285,10 +294,11 @@ void MainCore::addSinkDevice()
     sprintf(uidCStr, "UID:%d", dspDeviceSinkEngineUID);
 
     int deviceTabIndex = m_deviceSets.size();
-    m_deviceSets.push_back(new DeviceSet(deviceTabIndex));
+    m_deviceSets.push_back(new DeviceSet(deviceTabIndex, DeviceAPI::StreamSingleTx));
     m_deviceSets.back()->m_deviceSourceEngine = nullptr;
     m_deviceSets.back()->m_deviceSinkEngine = dspDeviceSinkEngine;
     m_deviceSets.back()->m_deviceMIMOEngine = nullptr;
+    dspDeviceSinkEngine->addSpectrumSink(m_deviceSets.back()->m_spectrumVis);
 
     char tabNameCStr[16];
     sprintf(tabNameCStr, "T%d", deviceTabIndex);
@@ -331,10 +341,11 @@ void MainCore::addSourceDevice()
     sprintf(uidCStr, "UID:%d", dspDeviceSourceEngineUID);
 
     int deviceTabIndex = m_deviceSets.size();
-    m_deviceSets.push_back(new DeviceSet(deviceTabIndex));
+    m_deviceSets.push_back(new DeviceSet(deviceTabIndex, DeviceAPI::StreamSingleRx));
     m_deviceSets.back()->m_deviceSourceEngine = dspDeviceSourceEngine;
     m_deviceSets.back()->m_deviceSinkEngine = nullptr;
     m_deviceSets.back()->m_deviceMIMOEngine = nullptr;
+    dspDeviceSourceEngine->addSink(m_deviceSets.back()->m_spectrumVis);
 
     char tabNameCStr[16];
     sprintf(tabNameCStr, "R%d", deviceTabIndex);
@@ -372,6 +383,7 @@ void MainCore::removeLastDevice()
     {
         DSPDeviceSourceEngine *lastDeviceEngine = m_deviceSets.back()->m_deviceSourceEngine;
         lastDeviceEngine->stopAcquistion();
+        lastDeviceEngine->removeSink(m_deviceSets.back()->m_spectrumVis);
 
         // deletes old UI and input object
         m_deviceSets.back()->freeChannels();      // destroys the channel instances
@@ -392,6 +404,7 @@ void MainCore::removeLastDevice()
     {
         DSPDeviceSinkEngine *lastDeviceEngine = m_deviceSets.back()->m_deviceSinkEngine;
         lastDeviceEngine->stopGeneration();
+        lastDeviceEngine->removeSpectrumSink(m_deviceSets.back()->m_spectrumVis);
 
         // deletes old UI and output object
         m_deviceSets.back()->freeChannels();
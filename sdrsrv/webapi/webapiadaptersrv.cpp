@@ -40,10 +40,14 @@
 #include "SWGChannelsDetail.h"
 #include "SWGChannelSettings.h"
 #include "SWGChannelReport.h"
+#include "SWGChannelRecord.h"
 #include "SWGChannelActions.h"
 #include "SWGSuccessResponse.h"
 #include "SWGErrorResponse.h"
 #include "SWGDeviceState.h"
+#include "SWGDeviceSetThreading.h"
+#include "SWGSpectrumStream.h"
+#include "SWGSpectrumZoom.h"
 #include "SWGDeviceReport.h"
 #include "SWGLimeRFEDevices.h"
 #include "SWGLimeRFESettings.h"
@@ -61,6 +65,9 @@
 #include "dsp/dspdevicesinkengine.h"
 #include "dsp/dspdevicemimoengine.h"
 #include "dsp/dspengine.h"
+#include "dsp/cpufeatures.h"
+#include "dsp/simdkernels.h"
+#include "dsp/spectrumvis.h"
 #include "channel/channelapi.h"
 #include "plugin/pluginapi.h"
 #include "plugin/pluginmanager.h"
@@ -96,6 +103,8 @@ int WebAPIAdapterSrv::instanceSummary(
     *response.getArchitecture() = QString(QSysInfo::currentCpuArchitecture());
     *response.getOs() = QString(QSysInfo::prettyProductName());
 #endif
+    *response.getSimdPath() = CPUFeatures::getSIMDPathName(SIMDKernels::instance().path);
+    *response.getCpuFeatures() = CPUFeatures::instance().getFeaturesString();
 
     SWGSDRangel::SWGLoggingInfo *logging = response.getLogging();
     logging->init();
@@ -657,6 +666,23 @@ int WebAPIAdapterSrv::instanceLocationPut(
     return 200;
 }
 
+int WebAPIAdapterSrv::instanceMetricsGet(
+        QString& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    (void) error;
+    std::vector<DeviceAPI*> deviceAPIs;
+
+    for (const auto& deviceSet : m_mainCore.m_deviceSets) {
+        deviceAPIs.push_back(deviceSet->m_deviceAPI);
+    }
+
+    response.clear();
+    WebAPIAdapterBase::webapiFormatMetrics(response, deviceAPIs);
+
+    return 200;
+}
+
 int WebAPIAdapterSrv::instanceDVSerialGet(
             SWGSDRangel::SWGDVSerialDevices& response,
             SWGSDRangel::SWGErrorResponse& error)
@@ -1501,6 +1527,168 @@ int WebAPIAdapterSrv::devicesetFocusPatch(
     return 400;
 }
 
+int WebAPIAdapterSrv::devicesetThreadingGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGDeviceSetThreading& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+        WebAPIAdapterBase::webapiFormatThreading(response, deviceSet->m_deviceAPI);
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetThreadingPut(
+        int deviceSetIndex,
+        const QStringList& threadingKeys,
+        SWGSDRangel::SWGDeviceSetThreading& query,
+        SWGSDRangel::SWGDeviceSetThreading& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+        error.init();
+
+        if (!WebAPIAdapterBase::webapiUpdateThreading(threadingKeys, query, deviceSet->m_deviceAPI, *error.getMessage())) {
+            return 400;
+        }
+
+        WebAPIAdapterBase::webapiFormatThreading(response, deviceSet->m_deviceAPI);
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetSpectrumStreamGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGSpectrumStream& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+        WebAPIAdapterBase::webapiFormatSpectrumStream(response, deviceSet->m_spectrumVis);
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetSpectrumStreamPut(
+        int deviceSetIndex,
+        const QStringList& spectrumStreamKeys,
+        SWGSDRangel::SWGSpectrumStream& query,
+        SWGSDRangel::SWGSpectrumStream& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+        WebAPIAdapterBase::webapiUpdateSpectrumStream(spectrumStreamKeys, query, response, deviceSet->m_spectrumVis, true);
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetSpectrumZoomGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGSpectrumZoom& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+
+        if (!deviceSet->m_deviceSourceEngine)
+        {
+            error.init();
+            *error.getMessage() = QString("Device set %1 is not a Rx device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        WebAPIAdapterBase::webapiFormatSpectrumZoom(response, deviceSet->m_spectrumZoom, deviceSet->isSpectrumZoomEnabled());
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetSpectrumZoomPut(
+        int deviceSetIndex,
+        const QStringList& spectrumZoomKeys,
+        SWGSDRangel::SWGSpectrumZoom& query,
+        SWGSDRangel::SWGSpectrumZoom& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+
+        if (!deviceSet->m_deviceSourceEngine)
+        {
+            error.init();
+            *error.getMessage() = QString("Device set %1 is not a Rx device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        if (spectrumZoomKeys.contains("enable")) {
+            deviceSet->enableSpectrumZoom(query.getEnable() != 0);
+        }
+
+        if (deviceSet->m_spectrumZoom) {
+            WebAPIAdapterBase::webapiUpdateSpectrumZoom(spectrumZoomKeys, query, response, deviceSet->m_spectrumZoom, deviceSet->isSpectrumZoomEnabled());
+        } else {
+            WebAPIAdapterBase::webapiFormatSpectrumZoom(response, nullptr, false);
+        }
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
 int WebAPIAdapterSrv::devicesetDevicePut(
         int deviceSetIndex,
         SWGSDRangel::SWGDeviceListItem& query,
@@ -2065,6 +2253,7 @@ int WebAPIAdapterSrv::devicesetDeviceReportGet(
             response.setDeviceHwType(new QString(deviceSet->m_deviceAPI->getHardwareId()));
             response.setDirection(0);
             DeviceSampleSource *source = deviceSet->m_deviceAPI->getSampleSource();
+            WebAPIAdapterBase::webapiFormatTelemetry(response, deviceSet->m_deviceSourceEngine->getTelemetry());
             return source->webapiReportGet(response, *error.getMessage());
         }
         else if (deviceSet->m_deviceSinkEngine) // Single Tx
@@ -2072,6 +2261,7 @@ int WebAPIAdapterSrv::devicesetDeviceReportGet(
             response.setDeviceHwType(new QString(deviceSet->m_deviceAPI->getHardwareId()));
             response.setDirection(1);
             DeviceSampleSink *sink = deviceSet->m_deviceAPI->getSampleSink();
+            WebAPIAdapterBase::webapiFormatTelemetry(response, deviceSet->m_deviceSinkEngine->getTelemetry());
             return sink->webapiReportGet(response, *error.getMessage());
         }
         else if (deviceSet->m_deviceMIMOEngine) // MIMO
@@ -2410,6 +2600,7 @@ int WebAPIAdapterSrv::devicesetChannelReportGet(
                 response.setChannelType(new QString());
                 channelAPI->getIdentifier(*response.getChannelType());
                 response.setDirection(0);
+                WebAPIAdapterBase::webapiFormatTelemetry(response, channelAPI);
                 return channelAPI->webapiReportGet(response, *error.getMessage());
             }
         }
@@ -2427,6 +2618,7 @@ int WebAPIAdapterSrv::devicesetChannelReportGet(
                 response.setChannelType(new QString());
                 channelAPI->getIdentifier(*response.getChannelType());
                 response.setDirection(1);
+                WebAPIAdapterBase::webapiFormatTelemetry(response, channelAPI);
                 return channelAPI->webapiReportGet(response, *error.getMessage());
             }
         }
@@ -2462,6 +2654,7 @@ int WebAPIAdapterSrv::devicesetChannelReportGet(
             {
                 response.setChannelType(new QString());
                 channelAPI->getIdentifier(*response.getChannelType());
+                WebAPIAdapterBase::webapiFormatTelemetry(response, channelAPI);
                 return channelAPI->webapiReportGet(response, *error.getMessage());
             }
             else
@@ -2483,6 +2676,67 @@ int WebAPIAdapterSrv::devicesetChannelReportGet(
     }
 }
 
+int WebAPIAdapterSrv::devicesetChannelRecordGet(
+        int deviceSetIndex,
+        int channelIndex,
+        SWGSDRangel::SWGChannelRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+        return WebAPIAdapterBase::webapiFormatChannelRecord(response, deviceSet->m_deviceAPI, channelIndex, *error.getMessage());
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetChannelRecordPost(
+        int deviceSetIndex,
+        int channelIndex,
+        SWGSDRangel::SWGChannelRecord& query,
+        SWGSDRangel::SWGChannelRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+        return WebAPIAdapterBase::webapiStartChannelRecord(query, response, deviceSet->m_deviceAPI, deviceSetIndex, channelIndex, *error.getMessage());
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetChannelRecordDelete(
+        int deviceSetIndex,
+        int channelIndex,
+        SWGSDRangel::SWGChannelRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+        return WebAPIAdapterBase::webapiStopChannelRecord(response, deviceSet->m_deviceAPI, channelIndex, *error.getMessage());
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
 int WebAPIAdapterSrv::devicesetChannelActionsPost(
         int deviceSetIndex,
         int channelIndex,
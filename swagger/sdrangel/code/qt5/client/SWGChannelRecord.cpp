@@ -0,0 +1,250 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.14.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGChannelRecord.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGChannelRecord::SWGChannelRecord(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGChannelRecord::SWGChannelRecord() {
+    recording = 0;
+    m_recording_isSet = false;
+    file_name = nullptr;
+    m_file_name_isSet = false;
+    format = nullptr;
+    m_format_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    center_frequency = 0;
+    m_center_frequency_isSet = false;
+    samples_count = 0;
+    m_samples_count_isSet = false;
+    dropped_blocks = 0;
+    m_dropped_blocks_isSet = false;
+}
+
+SWGChannelRecord::~SWGChannelRecord() {
+    this->cleanup();
+}
+
+void
+SWGChannelRecord::init() {
+    recording = 0;
+    m_recording_isSet = false;
+    file_name = new QString("");
+    m_file_name_isSet = false;
+    format = new QString("");
+    m_format_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    center_frequency = 0;
+    m_center_frequency_isSet = false;
+    samples_count = 0;
+    m_samples_count_isSet = false;
+    dropped_blocks = 0;
+    m_dropped_blocks_isSet = false;
+}
+
+void
+SWGChannelRecord::cleanup() {
+
+    if(file_name != nullptr) { 
+        delete file_name;
+    }
+    if(format != nullptr) { 
+        delete format;
+    }
+
+
+
+
+}
+
+SWGChannelRecord*
+SWGChannelRecord::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGChannelRecord::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&recording, pJson["recording"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&file_name, pJson["fileName"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&format, pJson["format"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&sample_rate, pJson["sampleRate"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&center_frequency, pJson["centerFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&samples_count, pJson["samplesCount"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&dropped_blocks, pJson["droppedBlocks"], "qint32", "");
+    
+}
+
+QString
+SWGChannelRecord::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGChannelRecord::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_recording_isSet){
+        obj->insert("recording", QJsonValue(recording));
+    }
+    if(file_name != nullptr && *file_name != QString("")){
+        toJsonValue(QString("fileName"), file_name, obj, QString("QString"));
+    }
+    if(format != nullptr && *format != QString("")){
+        toJsonValue(QString("format"), format, obj, QString("QString"));
+    }
+    if(m_sample_rate_isSet){
+        obj->insert("sampleRate", QJsonValue(sample_rate));
+    }
+    if(m_center_frequency_isSet){
+        obj->insert("centerFrequency", QJsonValue(center_frequency));
+    }
+    if(m_samples_count_isSet){
+        obj->insert("samplesCount", QJsonValue(samples_count));
+    }
+    if(m_dropped_blocks_isSet){
+        obj->insert("droppedBlocks", QJsonValue(dropped_blocks));
+    }
+
+    return obj;
+}
+
+qint32
+SWGChannelRecord::getRecording() {
+    return recording;
+}
+void
+SWGChannelRecord::setRecording(qint32 recording) {
+    this->recording = recording;
+    this->m_recording_isSet = true;
+}
+
+QString*
+SWGChannelRecord::getFileName() {
+    return file_name;
+}
+void
+SWGChannelRecord::setFileName(QString* file_name) {
+    this->file_name = file_name;
+    this->m_file_name_isSet = true;
+}
+
+QString*
+SWGChannelRecord::getFormat() {
+    return format;
+}
+void
+SWGChannelRecord::setFormat(QString* format) {
+    this->format = format;
+    this->m_format_isSet = true;
+}
+
+qint32
+SWGChannelRecord::getSampleRate() {
+    return sample_rate;
+}
+void
+SWGChannelRecord::setSampleRate(qint32 sample_rate) {
+    this->sample_rate = sample_rate;
+    this->m_sample_rate_isSet = true;
+}
+
+qint64
+SWGChannelRecord::getCenterFrequency() {
+    return center_frequency;
+}
+void
+SWGChannelRecord::setCenterFrequency(qint64 center_frequency) {
+    this->center_frequency = center_frequency;
+    this->m_center_frequency_isSet = true;
+}
+
+qint64
+SWGChannelRecord::getSamplesCount() {
+    return samples_count;
+}
+void
+SWGChannelRecord::setSamplesCount(qint64 samples_count) {
+    this->samples_count = samples_count;
+    this->m_samples_count_isSet = true;
+}
+
+qint32
+SWGChannelRecord::getDroppedBlocks() {
+    return dropped_blocks;
+}
+void
+SWGChannelRecord::setDroppedBlocks(qint32 dropped_blocks) {
+    this->dropped_blocks = dropped_blocks;
+    this->m_dropped_blocks_isSet = true;
+}
+
+
+bool
+SWGChannelRecord::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_recording_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(file_name && *file_name != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(format && *format != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_sample_rate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_center_frequency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_samples_count_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_dropped_blocks_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
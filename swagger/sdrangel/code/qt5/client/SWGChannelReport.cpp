@@ -32,6 +32,8 @@ SWGChannelReport::SWGChannelReport() {
     m_channel_type_isSet = false;
     direction = 0;
     m_direction_isSet = false;
+    telemetry = nullptr;
+    m_telemetry_isSet = false;
     am_demod_report = nullptr;
     m_am_demod_report_isSet = false;
     am_mod_report = nullptr;
@@ -80,6 +82,8 @@ SWGChannelReport::init() {
     m_channel_type_isSet = false;
     direction = 0;
     m_direction_isSet = false;
+    telemetry = new SWGDSPTelemetry();
+    m_telemetry_isSet = false;
     am_demod_report = new SWGAMDemodReport();
     m_am_demod_report_isSet = false;
     am_mod_report = new SWGAMModReport();
@@ -178,6 +182,9 @@ SWGChannelReport::cleanup() {
     if(wfm_mod_report != nullptr) { 
         delete wfm_mod_report;
     }
+    if(telemetry != nullptr) { 
+        delete telemetry;
+    }
 }
 
 SWGChannelReport*
@@ -195,6 +202,8 @@ SWGChannelReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&direction, pJson["direction"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&telemetry, pJson["telemetry"], "SWGDSPTelemetry", "SWGDSPTelemetry");
+    
     ::SWGSDRangel::setValue(&am_demod_report, pJson["AMDemodReport"], "SWGAMDemodReport", "SWGAMDemodReport");
     
     ::SWGSDRangel::setValue(&am_mod_report, pJson["AMModReport"], "SWGAMModReport", "SWGAMModReport");
@@ -253,6 +262,9 @@ SWGChannelReport::asJsonObject() {
     if(m_direction_isSet){
         obj->insert("direction", QJsonValue(direction));
     }
+    if((telemetry != nullptr) && (telemetry->isSet())){
+        toJsonValue(QString("telemetry"), telemetry, obj, QString("SWGDSPTelemetry"));
+    }
     if((am_demod_report != nullptr) && (am_demod_report->isSet())){
         toJsonValue(QString("AMDemodReport"), am_demod_report, obj, QString("SWGAMDemodReport"));
     }
@@ -331,6 +343,16 @@ SWGChannelReport::setDirection(qint32 direction) {
     this->m_direction_isSet = true;
 }
 
+SWGDSPTelemetry*
+SWGChannelReport::getTelemetry() {
+    return telemetry;
+}
+void
+SWGChannelReport::setTelemetry(SWGDSPTelemetry* telemetry) {
+    this->telemetry = telemetry;
+    this->m_telemetry_isSet = true;
+}
+
 SWGAMDemodReport*
 SWGChannelReport::getAmDemodReport() {
     return am_demod_report;
@@ -522,6 +544,9 @@ SWGChannelReport::isSet(){
         if(m_direction_isSet){
             isObjectUpdated = true; break;
         }
+        if(telemetry && telemetry->isSet()){
+            isObjectUpdated = true; break;
+        }
         if(am_demod_report && am_demod_report->isSet()){
             isObjectUpdated = true; break;
         }
@@ -27,6 +27,7 @@
 #include "SWGATVModReport.h"
 #include "SWGBFMDemodReport.h"
 #include "SWGDSDDemodReport.h"
+#include "SWGDSPTelemetry.h"
 #include "SWGFileSourceReport.h"
 #include "SWGFreeDVDemodReport.h"
 #include "SWGFreeDVModReport.h"
@@ -66,6 +67,9 @@ public:
     qint32 getDirection();
     void setDirection(qint32 direction);
 
+    SWGDSPTelemetry* getTelemetry();
+    void setTelemetry(SWGDSPTelemetry* telemetry);
+
     SWGAMDemodReport* getAmDemodReport();
     void setAmDemodReport(SWGAMDemodReport* am_demod_report);
 
@@ -130,6 +134,9 @@ private:
     qint32 direction;
     bool m_direction_isSet;
 
+    SWGDSPTelemetry* telemetry;
+    bool m_telemetry_isSet;
+
     SWGAMDemodReport* am_demod_report;
     bool m_am_demod_report_isSet;
 
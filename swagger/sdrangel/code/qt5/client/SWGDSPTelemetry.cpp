@@ -0,0 +1,297 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.14.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGDSPTelemetry.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGDSPTelemetry::SWGDSPTelemetry(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGDSPTelemetry::SWGDSPTelemetry() {
+    samples = 0L;
+    m_samples_isSet = false;
+    blocks = 0L;
+    m_blocks_isSet = false;
+    busy_time = 0L;
+    m_busy_time_isSet = false;
+    max_block_time = 0L;
+    m_max_block_time_isSet = false;
+    last_block_time = 0L;
+    m_last_block_time_isSet = false;
+    fifo_size = 0;
+    m_fifo_size_isSet = false;
+    fifo_high_water = 0;
+    m_fifo_high_water_isSet = false;
+    sample_fifo = nullptr;
+    m_sample_fifo_isSet = false;
+    audio_fifo = nullptr;
+    m_audio_fifo_isSet = false;
+}
+
+SWGDSPTelemetry::~SWGDSPTelemetry() {
+    this->cleanup();
+}
+
+void
+SWGDSPTelemetry::init() {
+    samples = 0L;
+    m_samples_isSet = false;
+    blocks = 0L;
+    m_blocks_isSet = false;
+    busy_time = 0L;
+    m_busy_time_isSet = false;
+    max_block_time = 0L;
+    m_max_block_time_isSet = false;
+    last_block_time = 0L;
+    m_last_block_time_isSet = false;
+    fifo_size = 0;
+    m_fifo_size_isSet = false;
+    fifo_high_water = 0;
+    m_fifo_high_water_isSet = false;
+    sample_fifo = new SWGFifoCounters();
+    m_sample_fifo_isSet = false;
+    audio_fifo = new SWGFifoCounters();
+    m_audio_fifo_isSet = false;
+}
+
+void
+SWGDSPTelemetry::cleanup() {
+
+
+
+
+
+
+
+
+    if(sample_fifo != nullptr) { 
+        delete sample_fifo;
+    }
+    if(audio_fifo != nullptr) { 
+        delete audio_fifo;
+    }
+}
+
+SWGDSPTelemetry*
+SWGDSPTelemetry::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGDSPTelemetry::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&samples, pJson["samples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&blocks, pJson["blocks"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&busy_time, pJson["busyTime"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&max_block_time, pJson["maxBlockTime"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&last_block_time, pJson["lastBlockTime"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&fifo_size, pJson["fifoSize"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fifo_high_water, pJson["fifoHighWater"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&sample_fifo, pJson["sampleFifo"], "SWGFifoCounters", "SWGFifoCounters");
+    
+    ::SWGSDRangel::setValue(&audio_fifo, pJson["audioFifo"], "SWGFifoCounters", "SWGFifoCounters");
+    
+}
+
+QString
+SWGDSPTelemetry::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGDSPTelemetry::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_samples_isSet){
+        obj->insert("samples", QJsonValue(samples));
+    }
+    if(m_blocks_isSet){
+        obj->insert("blocks", QJsonValue(blocks));
+    }
+    if(m_busy_time_isSet){
+        obj->insert("busyTime", QJsonValue(busy_time));
+    }
+    if(m_max_block_time_isSet){
+        obj->insert("maxBlockTime", QJsonValue(max_block_time));
+    }
+    if(m_last_block_time_isSet){
+        obj->insert("lastBlockTime", QJsonValue(last_block_time));
+    }
+    if(m_fifo_size_isSet){
+        obj->insert("fifoSize", QJsonValue(fifo_size));
+    }
+    if(m_fifo_high_water_isSet){
+        obj->insert("fifoHighWater", QJsonValue(fifo_high_water));
+    }
+    if((sample_fifo != nullptr) && (sample_fifo->isSet())){
+        toJsonValue(QString("sampleFifo"), sample_fifo, obj, QString("SWGFifoCounters"));
+    }
+    if((audio_fifo != nullptr) && (audio_fifo->isSet())){
+        toJsonValue(QString("audioFifo"), audio_fifo, obj, QString("SWGFifoCounters"));
+    }
+
+    return obj;
+}
+
+qint64
+SWGDSPTelemetry::getSamples() {
+    return samples;
+}
+void
+SWGDSPTelemetry::setSamples(qint64 samples) {
+    this->samples = samples;
+    this->m_samples_isSet = true;
+}
+
+qint64
+SWGDSPTelemetry::getBlocks() {
+    return blocks;
+}
+void
+SWGDSPTelemetry::setBlocks(qint64 blocks) {
+    this->blocks = blocks;
+    this->m_blocks_isSet = true;
+}
+
+qint64
+SWGDSPTelemetry::getBusyTime() {
+    return busy_time;
+}
+void
+SWGDSPTelemetry::setBusyTime(qint64 busy_time) {
+    this->busy_time = busy_time;
+    this->m_busy_time_isSet = true;
+}
+
+qint64
+SWGDSPTelemetry::getMaxBlockTime() {
+    return max_block_time;
+}
+void
+SWGDSPTelemetry::setMaxBlockTime(qint64 max_block_time) {
+    this->max_block_time = max_block_time;
+    this->m_max_block_time_isSet = true;
+}
+
+qint64
+SWGDSPTelemetry::getLastBlockTime() {
+    return last_block_time;
+}
+void
+SWGDSPTelemetry::setLastBlockTime(qint64 last_block_time) {
+    this->last_block_time = last_block_time;
+    this->m_last_block_time_isSet = true;
+}
+
+qint32
+SWGDSPTelemetry::getFifoSize() {
+    return fifo_size;
+}
+void
+SWGDSPTelemetry::setFifoSize(qint32 fifo_size) {
+    this->fifo_size = fifo_size;
+    this->m_fifo_size_isSet = true;
+}
+
+qint32
+SWGDSPTelemetry::getFifoHighWater() {
+    return fifo_high_water;
+}
+void
+SWGDSPTelemetry::setFifoHighWater(qint32 fifo_high_water) {
+    this->fifo_high_water = fifo_high_water;
+    this->m_fifo_high_water_isSet = true;
+}
+
+SWGFifoCounters*
+SWGDSPTelemetry::getSampleFifo() {
+    return sample_fifo;
+}
+void
+SWGDSPTelemetry::setSampleFifo(SWGFifoCounters* sample_fifo) {
+    this->sample_fifo = sample_fifo;
+    this->m_sample_fifo_isSet = true;
+}
+
+SWGFifoCounters*
+SWGDSPTelemetry::getAudioFifo() {
+    return audio_fifo;
+}
+void
+SWGDSPTelemetry::setAudioFifo(SWGFifoCounters* audio_fifo) {
+    this->audio_fifo = audio_fifo;
+    this->m_audio_fifo_isSet = true;
+}
+
+
+bool
+SWGDSPTelemetry::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_samples_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_blocks_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_busy_time_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_max_block_time_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_last_block_time_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fifo_size_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fifo_high_water_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(sample_fifo && sample_fifo->isSet()){
+            isObjectUpdated = true; break;
+        }
+        if(audio_fifo && audio_fifo->isSet()){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,107 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.14.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGDSPTelemetry.h
+ *
+ * Hot path telemetry of a DSP processing loop (device engine or channel baseband)
+ */
+
+#ifndef SWGDSPTelemetry_H_
+#define SWGDSPTelemetry_H_
+
+#include <QJsonObject>
+
+
+#include "SWGFifoCounters.h"
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGDSPTelemetry: public SWGObject {
+public:
+    SWGDSPTelemetry();
+    SWGDSPTelemetry(QString* json);
+    virtual ~SWGDSPTelemetry();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGDSPTelemetry* fromJson(QString &jsonString) override;
+
+    qint64 getSamples();
+    void setSamples(qint64 samples);
+
+    qint64 getBlocks();
+    void setBlocks(qint64 blocks);
+
+    qint64 getBusyTime();
+    void setBusyTime(qint64 busy_time);
+
+    qint64 getMaxBlockTime();
+    void setMaxBlockTime(qint64 max_block_time);
+
+    qint64 getLastBlockTime();
+    void setLastBlockTime(qint64 last_block_time);
+
+    qint32 getFifoSize();
+    void setFifoSize(qint32 fifo_size);
+
+    qint32 getFifoHighWater();
+    void setFifoHighWater(qint32 fifo_high_water);
+
+    SWGFifoCounters* getSampleFifo();
+    void setSampleFifo(SWGFifoCounters* sample_fifo);
+
+    SWGFifoCounters* getAudioFifo();
+    void setAudioFifo(SWGFifoCounters* audio_fifo);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint64 samples;
+    bool m_samples_isSet;
+
+    qint64 blocks;
+    bool m_blocks_isSet;
+
+    qint64 busy_time;
+    bool m_busy_time_isSet;
+
+    qint64 max_block_time;
+    bool m_max_block_time_isSet;
+
+    qint64 last_block_time;
+    bool m_last_block_time_isSet;
+
+    qint32 fifo_size;
+    bool m_fifo_size_isSet;
+
+    qint32 fifo_high_water;
+    bool m_fifo_high_water_isSet;
+
+    SWGFifoCounters* sample_fifo;
+    bool m_sample_fifo_isSet;
+
+    SWGFifoCounters* audio_fifo;
+    bool m_audio_fifo_isSet;
+
+};
+
+}
+
+#endif /* SWGDSPTelemetry_H_ */
@@ -46,6 +46,8 @@ SWGDeviceActions::SWGDeviceActions() {
     m_fcd_pro_actions_isSet = false;
     fcd_pro_plus_actions = nullptr;
     m_fcd_pro_plus_actions_isSet = false;
+    file_input_actions = nullptr;
+    m_file_input_actions_isSet = false;
     hack_rf_input_actions = nullptr;
     m_hack_rf_input_actions_isSet = false;
     kiwi_sdr_actions = nullptr;
@@ -96,6 +98,8 @@ SWGDeviceActions::init() {
     m_fcd_pro_actions_isSet = false;
     fcd_pro_plus_actions = new SWGFCDProPlusActions();
     m_fcd_pro_plus_actions_isSet = false;
+    file_input_actions = new SWGFileInputActions();
+    m_file_input_actions_isSet = false;
     hack_rf_input_actions = new SWGHackRFInputActions();
     m_hack_rf_input_actions_isSet = false;
     kiwi_sdr_actions = new SWGKiwiSDRActions();
@@ -147,6 +151,9 @@ SWGDeviceActions::cleanup() {
     if(fcd_pro_plus_actions != nullptr) { 
         delete fcd_pro_plus_actions;
     }
+    if(file_input_actions != nullptr) { 
+        delete file_input_actions;
+    }
     if(hack_rf_input_actions != nullptr) { 
         delete hack_rf_input_actions;
     }
@@ -214,6 +221,8 @@ SWGDeviceActions::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&fcd_pro_plus_actions, pJson["fcdProPlusActions"], "SWGFCDProPlusActions", "SWGFCDProPlusActions");
     
+    ::SWGSDRangel::setValue(&file_input_actions, pJson["fileInputActions"], "SWGFileInputActions", "SWGFileInputActions");
+    
     ::SWGSDRangel::setValue(&hack_rf_input_actions, pJson["hackRFInputActions"], "SWGHackRFInputActions", "SWGHackRFInputActions");
     
     ::SWGSDRangel::setValue(&kiwi_sdr_actions, pJson["kiwiSDRActions"], "SWGKiwiSDRActions", "SWGKiwiSDRActions");
@@ -281,6 +290,9 @@ SWGDeviceActions::asJsonObject() {
     if((fcd_pro_plus_actions != nullptr) && (fcd_pro_plus_actions->isSet())){
         toJsonValue(QString("fcdProPlusActions"), fcd_pro_plus_actions, obj, QString("SWGFCDProPlusActions"));
     }
+    if((file_input_actions != nullptr) && (file_input_actions->isSet())){
+        toJsonValue(QString("fileInputActions"), file_input_actions, obj, QString("SWGFileInputActions"));
+    }
     if((hack_rf_input_actions != nullptr) && (hack_rf_input_actions->isSet())){
         toJsonValue(QString("hackRFInputActions"), hack_rf_input_actions, obj, QString("SWGHackRFInputActions"));
     }
@@ -411,6 +423,16 @@ SWGDeviceActions::setFcdProPlusActions(SWGFCDProPlusActions* fcd_pro_plus_action
     this->m_fcd_pro_plus_actions_isSet = true;
 }
 
+SWGFileInputActions*
+SWGDeviceActions::getFileInputActions() {
+    return file_input_actions;
+}
+void
+SWGDeviceActions::setFileInputActions(SWGFileInputActions* file_input_actions) {
+    this->file_input_actions = file_input_actions;
+    this->m_file_input_actions_isSet = true;
+}
+
 SWGHackRFInputActions*
 SWGDeviceActions::getHackRfInputActions() {
     return hack_rf_input_actions;
@@ -563,6 +585,9 @@ SWGDeviceActions::isSet(){
         if(fcd_pro_plus_actions && fcd_pro_plus_actions->isSet()){
             isObjectUpdated = true; break;
         }
+        if(file_input_actions && file_input_actions->isSet()){
+            isObjectUpdated = true; break;
+        }
         if(hack_rf_input_actions && hack_rf_input_actions->isSet()){
             isObjectUpdated = true; break;
         }
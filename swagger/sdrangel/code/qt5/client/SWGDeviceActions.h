@@ -28,6 +28,7 @@
 #include "SWGBladeRF2InputActions.h"
 #include "SWGFCDProActions.h"
 #include "SWGFCDProPlusActions.h"
+#include "SWGFileInputActions.h"
 #include "SWGHackRFInputActions.h"
 #include "SWGKiwiSDRActions.h"
 #include "SWGLimeSdrInputActions.h"
@@ -87,6 +88,9 @@ public:
     SWGFCDProPlusActions* getFcdProPlusActions();
     void setFcdProPlusActions(SWGFCDProPlusActions* fcd_pro_plus_actions);
 
+    SWGFileInputActions* getFileInputActions();
+    void setFileInputActions(SWGFileInputActions* file_input_actions);
+
     SWGHackRFInputActions* getHackRfInputActions();
     void setHackRfInputActions(SWGHackRFInputActions* hack_rf_input_actions);
 
@@ -154,6 +158,9 @@ private:
     SWGFCDProPlusActions* fcd_pro_plus_actions;
     bool m_fcd_pro_plus_actions_isSet;
 
+    SWGFileInputActions* file_input_actions;
+    bool m_file_input_actions_isSet;
+
     SWGHackRFInputActions* hack_rf_input_actions;
     bool m_hack_rf_input_actions_isSet;
 
@@ -32,6 +32,8 @@ SWGDeviceReport::SWGDeviceReport() {
     m_device_hw_type_isSet = false;
     direction = 0;
     m_direction_isSet = false;
+    telemetry = nullptr;
+    m_telemetry_isSet = false;
     airspy_report = nullptr;
     m_airspy_report_isSet = false;
     airspy_hf_report = nullptr;
@@ -86,6 +88,8 @@ SWGDeviceReport::init() {
     m_device_hw_type_isSet = false;
     direction = 0;
     m_direction_isSet = false;
+    telemetry = new SWGDSPTelemetry();
+    m_telemetry_isSet = false;
     airspy_report = new SWGAirspyReport();
     m_airspy_report_isSet = false;
     airspy_hf_report = new SWGAirspyHFReport();
@@ -199,6 +203,9 @@ SWGDeviceReport::cleanup() {
     if(xtrx_output_report != nullptr) { 
         delete xtrx_output_report;
     }
+    if(telemetry != nullptr) { 
+        delete telemetry;
+    }
 }
 
 SWGDeviceReport*
@@ -216,6 +223,8 @@ SWGDeviceReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&direction, pJson["direction"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&telemetry, pJson["telemetry"], "SWGDSPTelemetry", "SWGDSPTelemetry");
+    
     ::SWGSDRangel::setValue(&airspy_report, pJson["airspyReport"], "SWGAirspyReport", "SWGAirspyReport");
     
     ::SWGSDRangel::setValue(&airspy_hf_report, pJson["airspyHFReport"], "SWGAirspyHFReport", "SWGAirspyHFReport");
@@ -280,6 +289,9 @@ SWGDeviceReport::asJsonObject() {
     if(m_direction_isSet){
         obj->insert("direction", QJsonValue(direction));
     }
+    if((telemetry != nullptr) && (telemetry->isSet())){
+        toJsonValue(QString("telemetry"), telemetry, obj, QString("SWGDSPTelemetry"));
+    }
     if((airspy_report != nullptr) && (airspy_report->isSet())){
         toJsonValue(QString("airspyReport"), airspy_report, obj, QString("SWGAirspyReport"));
     }
@@ -367,6 +379,16 @@ SWGDeviceReport::setDirection(qint32 direction) {
     this->m_direction_isSet = true;
 }
 
+SWGDSPTelemetry*
+SWGDeviceReport::getTelemetry() {
+    return telemetry;
+}
+void
+SWGDeviceReport::setTelemetry(SWGDSPTelemetry* telemetry) {
+    this->telemetry = telemetry;
+    this->m_telemetry_isSet = true;
+}
+
 SWGAirspyReport*
 SWGDeviceReport::getAirspyReport() {
     return airspy_report;
@@ -588,6 +610,9 @@ SWGDeviceReport::isSet(){
         if(m_direction_isSet){
             isObjectUpdated = true; break;
         }
+        if(telemetry && telemetry->isSet()){
+            isObjectUpdated = true; break;
+        }
         if(airspy_report && airspy_report->isSet()){
             isObjectUpdated = true; break;
         }
@@ -26,6 +26,7 @@
 #include "SWGAirspyReport.h"
 #include "SWGBladeRF2InputReport.h"
 #include "SWGBladeRF2OutputReport.h"
+#include "SWGDSPTelemetry.h"
 #include "SWGFileInputReport.h"
 #include "SWGKiwiSDRReport.h"
 #include "SWGLimeSdrInputReport.h"
@@ -68,6 +69,9 @@ public:
     qint32 getDirection();
     void setDirection(qint32 direction);
 
+    SWGDSPTelemetry* getTelemetry();
+    void setTelemetry(SWGDSPTelemetry* telemetry);
+
     SWGAirspyReport* getAirspyReport();
     void setAirspyReport(SWGAirspyReport* airspy_report);
 
@@ -141,6 +145,9 @@ private:
     qint32 direction;
     bool m_direction_isSet;
 
+    SWGDSPTelemetry* telemetry;
+    bool m_telemetry_isSet;
+
     SWGAirspyReport* airspy_report;
     bool m_airspy_report_isSet;
 
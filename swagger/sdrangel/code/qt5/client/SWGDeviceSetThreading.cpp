@@ -0,0 +1,140 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.14.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGDeviceSetThreading.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGDeviceSetThreading::SWGDeviceSetThreading(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGDeviceSetThreading::SWGDeviceSetThreading() {
+    policy = nullptr;
+    m_policy_isSet = false;
+    channels = nullptr;
+    m_channels_isSet = false;
+}
+
+SWGDeviceSetThreading::~SWGDeviceSetThreading() {
+    this->cleanup();
+}
+
+void
+SWGDeviceSetThreading::init() {
+    policy = new SWGThreadPolicy();
+    m_policy_isSet = false;
+    channels = new QList<SWGChannelThreadPolicy*>();
+    m_channels_isSet = false;
+}
+
+void
+SWGDeviceSetThreading::cleanup() {
+
+    if(policy != nullptr) { 
+        delete policy;
+    }
+    if(channels != nullptr) { 
+        auto arr = channels;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete channels;
+    }
+}
+
+SWGDeviceSetThreading*
+SWGDeviceSetThreading::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGDeviceSetThreading::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&policy, pJson["policy"], "SWGThreadPolicy", "SWGThreadPolicy");
+    
+    
+    ::SWGSDRangel::setValue(&channels, pJson["channels"], "QList", "SWGChannelThreadPolicy");
+}
+
+QString
+SWGDeviceSetThreading::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGDeviceSetThreading::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if((policy != nullptr) && (policy->isSet())){
+        toJsonValue(QString("policy"), policy, obj, QString("SWGThreadPolicy"));
+    }
+    if(channels && channels->size() > 0){
+        toJsonArray((QList<void*>*)channels, obj, "channels", "SWGChannelThreadPolicy");
+    }
+
+    return obj;
+}
+
+SWGThreadPolicy*
+SWGDeviceSetThreading::getPolicy() {
+    return policy;
+}
+void
+SWGDeviceSetThreading::setPolicy(SWGThreadPolicy* policy) {
+    this->policy = policy;
+    this->m_policy_isSet = true;
+}
+
+QList<SWGChannelThreadPolicy*>*
+SWGDeviceSetThreading::getChannels() {
+    return channels;
+}
+void
+SWGDeviceSetThreading::setChannels(QList<SWGChannelThreadPolicy*>* channels) {
+    this->channels = channels;
+    this->m_channels_isSet = true;
+}
+
+
+bool
+SWGDeviceSetThreading::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(policy && policy->isSet()){
+            isObjectUpdated = true; break;
+        }
+        if(channels && (channels->size() > 0)){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,223 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.14.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGFifoCounters.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGFifoCounters::SWGFifoCounters(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGFifoCounters::SWGFifoCounters() {
+    overflow_events = 0L;
+    m_overflow_events_isSet = false;
+    overflow_samples = 0L;
+    m_overflow_samples_isSet = false;
+    last_overflow_time = 0L;
+    m_last_overflow_time_isSet = false;
+    underrun_events = 0L;
+    m_underrun_events_isSet = false;
+    underrun_samples = 0L;
+    m_underrun_samples_isSet = false;
+    last_underrun_time = 0L;
+    m_last_underrun_time_isSet = false;
+}
+
+SWGFifoCounters::~SWGFifoCounters() {
+    this->cleanup();
+}
+
+void
+SWGFifoCounters::init() {
+    overflow_events = 0L;
+    m_overflow_events_isSet = false;
+    overflow_samples = 0L;
+    m_overflow_samples_isSet = false;
+    last_overflow_time = 0L;
+    m_last_overflow_time_isSet = false;
+    underrun_events = 0L;
+    m_underrun_events_isSet = false;
+    underrun_samples = 0L;
+    m_underrun_samples_isSet = false;
+    last_underrun_time = 0L;
+    m_last_underrun_time_isSet = false;
+}
+
+void
+SWGFifoCounters::cleanup() {
+
+
+
+
+
+
+}
+
+SWGFifoCounters*
+SWGFifoCounters::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGFifoCounters::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&overflow_events, pJson["overflowEvents"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&overflow_samples, pJson["overflowSamples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&last_overflow_time, pJson["lastOverflowTime"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&underrun_events, pJson["underrunEvents"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&underrun_samples, pJson["underrunSamples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&last_underrun_time, pJson["lastUnderrunTime"], "qint64", "");
+    
+}
+
+QString
+SWGFifoCounters::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGFifoCounters::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_overflow_events_isSet){
+        obj->insert("overflowEvents", QJsonValue(overflow_events));
+    }
+    if(m_overflow_samples_isSet){
+        obj->insert("overflowSamples", QJsonValue(overflow_samples));
+    }
+    if(m_last_overflow_time_isSet){
+        obj->insert("lastOverflowTime", QJsonValue(last_overflow_time));
+    }
+    if(m_underrun_events_isSet){
+        obj->insert("underrunEvents", QJsonValue(underrun_events));
+    }
+    if(m_underrun_samples_isSet){
+        obj->insert("underrunSamples", QJsonValue(underrun_samples));
+    }
+    if(m_last_underrun_time_isSet){
+        obj->insert("lastUnderrunTime", QJsonValue(last_underrun_time));
+    }
+
+    return obj;
+}
+
+qint64
+SWGFifoCounters::getOverflowEvents() {
+    return overflow_events;
+}
+void
+SWGFifoCounters::setOverflowEvents(qint64 overflow_events) {
+    this->overflow_events = overflow_events;
+    this->m_overflow_events_isSet = true;
+}
+
+qint64
+SWGFifoCounters::getOverflowSamples() {
+    return overflow_samples;
+}
+void
+SWGFifoCounters::setOverflowSamples(qint64 overflow_samples) {
+    this->overflow_samples = overflow_samples;
+    this->m_overflow_samples_isSet = true;
+}
+
+qint64
+SWGFifoCounters::getLastOverflowTime() {
+    return last_overflow_time;
+}
+void
+SWGFifoCounters::setLastOverflowTime(qint64 last_overflow_time) {
+    this->last_overflow_time = last_overflow_time;
+    this->m_last_overflow_time_isSet = true;
+}
+
+qint64
+SWGFifoCounters::getUnderrunEvents() {
+    return underrun_events;
+}
+void
+SWGFifoCounters::setUnderrunEvents(qint64 underrun_events) {
+    this->underrun_events = underrun_events;
+    this->m_underrun_events_isSet = true;
+}
+
+qint64
+SWGFifoCounters::getUnderrunSamples() {
+    return underrun_samples;
+}
+void
+SWGFifoCounters::setUnderrunSamples(qint64 underrun_samples) {
+    this->underrun_samples = underrun_samples;
+    this->m_underrun_samples_isSet = true;
+}
+
+qint64
+SWGFifoCounters::getLastUnderrunTime() {
+    return last_underrun_time;
+}
+void
+SWGFifoCounters::setLastUnderrunTime(qint64 last_underrun_time) {
+    this->last_underrun_time = last_underrun_time;
+    this->m_last_underrun_time_isSet = true;
+}
+
+
+bool
+SWGFifoCounters::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_overflow_events_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_overflow_samples_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_last_overflow_time_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_underrun_events_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_underrun_samples_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_last_underrun_time_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,88 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.14.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGFifoCounters.h
+ *
+ * Overflow and underrun counters of a FIFO
+ */
+
+#ifndef SWGFifoCounters_H_
+#define SWGFifoCounters_H_
+
+#include <QJsonObject>
+
+
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGFifoCounters: public SWGObject {
+public:
+    SWGFifoCounters();
+    SWGFifoCounters(QString* json);
+    virtual ~SWGFifoCounters();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGFifoCounters* fromJson(QString &jsonString) override;
+
+    qint64 getOverflowEvents();
+    void setOverflowEvents(qint64 overflow_events);
+
+    qint64 getOverflowSamples();
+    void setOverflowSamples(qint64 overflow_samples);
+
+    qint64 getLastOverflowTime();
+    void setLastOverflowTime(qint64 last_overflow_time);
+
+    qint64 getUnderrunEvents();
+    void setUnderrunEvents(qint64 underrun_events);
+
+    qint64 getUnderrunSamples();
+    void setUnderrunSamples(qint64 underrun_samples);
+
+    qint64 getLastUnderrunTime();
+    void setLastUnderrunTime(qint64 last_underrun_time);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint64 overflow_events;
+    bool m_overflow_events_isSet;
+
+    qint64 overflow_samples;
+    bool m_overflow_samples_isSet;
+
+    qint64 last_overflow_time;
+    bool m_last_overflow_time_isSet;
+
+    qint64 underrun_events;
+    bool m_underrun_events_isSet;
+
+    qint64 underrun_samples;
+    bool m_underrun_samples_isSet;
+
+    qint64 last_underrun_time;
+    bool m_last_underrun_time_isSet;
+
+};
+
+}
+
+#endif /* SWGFifoCounters_H_ */
@@ -0,0 +1,133 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.14.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGFileInputActions.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGFileInputActions::SWGFileInputActions(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGFileInputActions::SWGFileInputActions() {
+    seek_millis = 0;
+    m_seek_millis_isSet = false;
+    seek_time = nullptr;
+    m_seek_time_isSet = false;
+}
+
+SWGFileInputActions::~SWGFileInputActions() {
+    this->cleanup();
+}
+
+void
+SWGFileInputActions::init() {
+    seek_millis = 0;
+    m_seek_millis_isSet = false;
+    seek_time = new QString("");
+    m_seek_time_isSet = false;
+}
+
+void
+SWGFileInputActions::cleanup() {
+
+    if(seek_time != nullptr) { 
+        delete seek_time;
+    }
+}
+
+SWGFileInputActions*
+SWGFileInputActions::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGFileInputActions::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&seek_millis, pJson["seekMillis"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&seek_time, pJson["seekTime"], "QString", "QString");
+    
+}
+
+QString
+SWGFileInputActions::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGFileInputActions::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_seek_millis_isSet){
+        obj->insert("seekMillis", QJsonValue(seek_millis));
+    }
+    if(seek_time != nullptr && *seek_time != QString("")){
+        toJsonValue(QString("seekTime"), seek_time, obj, QString("QString"));
+    }
+
+    return obj;
+}
+
+qint32
+SWGFileInputActions::getSeekMillis() {
+    return seek_millis;
+}
+void
+SWGFileInputActions::setSeekMillis(qint32 seek_millis) {
+    this->seek_millis = seek_millis;
+    this->m_seek_millis_isSet = true;
+}
+
+QString*
+SWGFileInputActions::getSeekTime() {
+    return seek_time;
+}
+void
+SWGFileInputActions::setSeekTime(QString* seek_time) {
+    this->seek_time = seek_time;
+    this->m_seek_time_isSet = true;
+}
+
+
+bool
+SWGFileInputActions::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_seek_millis_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(seek_time && *seek_time != QString("")){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
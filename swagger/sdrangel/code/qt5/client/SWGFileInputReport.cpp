@@ -40,6 +40,8 @@ SWGFileInputReport::SWGFileInputReport() {
     m_elapsed_time_isSet = false;
     duration_time = nullptr;
     m_duration_time_isSet = false;
+    end_of_file = 0;
+    m_end_of_file_isSet = false;
 }
 
 SWGFileInputReport::~SWGFileInputReport() {
@@ -60,6 +62,8 @@ SWGFileInputReport::init() {
     m_elapsed_time_isSet = false;
     duration_time = new QString("");
     m_duration_time_isSet = false;
+    end_of_file = 0;
+    m_end_of_file_isSet = false;
 }
 
 void
@@ -78,6 +82,7 @@ SWGFileInputReport::cleanup() {
     if(duration_time != nullptr) { 
         delete duration_time;
     }
+
 }
 
 SWGFileInputReport*
@@ -103,6 +108,8 @@ SWGFileInputReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&duration_time, pJson["durationTime"], "QString", "QString");
     
+    ::SWGSDRangel::setValue(&end_of_file, pJson["endOfFile"], "qint32", "");
+    
 }
 
 QString
@@ -137,6 +144,9 @@ SWGFileInputReport::asJsonObject() {
     if(duration_time != nullptr && *duration_time != QString("")){
         toJsonValue(QString("durationTime"), duration_time, obj, QString("QString"));
     }
+    if(m_end_of_file_isSet){
+        obj->insert("endOfFile", QJsonValue(end_of_file));
+    }
 
     return obj;
 }
@@ -201,6 +211,16 @@ SWGFileInputReport::setDurationTime(QString* duration_time) {
     this->m_duration_time_isSet = true;
 }
 
+qint32
+SWGFileInputReport::getEndOfFile() {
+    return end_of_file;
+}
+void
+SWGFileInputReport::setEndOfFile(qint32 end_of_file) {
+    this->end_of_file = end_of_file;
+    this->m_end_of_file_isSet = true;
+}
+
 
 bool
 SWGFileInputReport::isSet(){
@@ -224,6 +244,9 @@ SWGFileInputReport::isSet(){
         if(duration_time && *duration_time != QString("")){
             isObjectUpdated = true; break;
         }
+        if(m_end_of_file_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -60,6 +60,9 @@ public:
     QString* getDurationTime();
     void setDurationTime(QString* duration_time);
 
+    qint32 getEndOfFile();
+    void setEndOfFile(qint32 end_of_file);
+
 
     virtual bool isSet() override;
 
@@ -82,6 +85,9 @@ private:
     QString* duration_time;
     bool m_duration_time_isSet;
 
+    qint32 end_of_file;
+    bool m_end_of_file_isSet;
+
 };
 
 }
@@ -44,6 +44,10 @@ SWGInstanceSummaryResponse::SWGInstanceSummaryResponse() {
     m_architecture_isSet = false;
     os = nullptr;
     m_os_isSet = false;
+    simd_path = nullptr;
+    m_simd_path_isSet = false;
+    cpu_features = nullptr;
+    m_cpu_features_isSet = false;
     logging = nullptr;
     m_logging_isSet = false;
     devicesetlist = nullptr;
@@ -72,6 +76,10 @@ SWGInstanceSummaryResponse::init() {
     m_architecture_isSet = false;
     os = new QString("");
     m_os_isSet = false;
+    simd_path = new QString("");
+    m_simd_path_isSet = false;
+    cpu_features = new QString("");
+    m_cpu_features_isSet = false;
     logging = new SWGLoggingInfo();
     m_logging_isSet = false;
     devicesetlist = new SWGDeviceSetList();
@@ -98,6 +106,12 @@ SWGInstanceSummaryResponse::cleanup() {
     if(os != nullptr) { 
         delete os;
     }
+    if(simd_path != nullptr) { 
+        delete simd_path;
+    }
+    if(cpu_features != nullptr) { 
+        delete cpu_features;
+    }
     if(logging != nullptr) { 
         delete logging;
     }
@@ -133,6 +147,10 @@ SWGInstanceSummaryResponse::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&os, pJson["os"], "QString", "QString");
     
+    ::SWGSDRangel::setValue(&simd_path, pJson["simdPath"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&cpu_features, pJson["cpuFeatures"], "QString", "QString");
+    
     ::SWGSDRangel::setValue(&logging, pJson["logging"], "SWGLoggingInfo", "SWGLoggingInfo");
     
     ::SWGSDRangel::setValue(&devicesetlist, pJson["devicesetlist"], "SWGDeviceSetList", "SWGDeviceSetList");
@@ -177,6 +195,12 @@ SWGInstanceSummaryResponse::asJsonObject() {
     if(os != nullptr && *os != QString("")){
         toJsonValue(QString("os"), os, obj, QString("QString"));
     }
+    if(simd_path != nullptr && *simd_path != QString("")){
+        toJsonValue(QString("simdPath"), simd_path, obj, QString("QString"));
+    }
+    if(cpu_features != nullptr && *cpu_features != QString("")){
+        toJsonValue(QString("cpuFeatures"), cpu_features, obj, QString("QString"));
+    }
     if((logging != nullptr) && (logging->isSet())){
         toJsonValue(QString("logging"), logging, obj, QString("SWGLoggingInfo"));
     }
@@ -267,6 +291,26 @@ SWGInstanceSummaryResponse::setOs(QString* os) {
     this->m_os_isSet = true;
 }
 
+QString*
+SWGInstanceSummaryResponse::getSimdPath() {
+    return simd_path;
+}
+void
+SWGInstanceSummaryResponse::setSimdPath(QString* simd_path) {
+    this->simd_path = simd_path;
+    this->m_simd_path_isSet = true;
+}
+
+QString*
+SWGInstanceSummaryResponse::getCpuFeatures() {
+    return cpu_features;
+}
+void
+SWGInstanceSummaryResponse::setCpuFeatures(QString* cpu_features) {
+    this->cpu_features = cpu_features;
+    this->m_cpu_features_isSet = true;
+}
+
 SWGLoggingInfo*
 SWGInstanceSummaryResponse::getLogging() {
     return logging;
@@ -316,6 +360,12 @@ SWGInstanceSummaryResponse::isSet(){
         if(os && *os != QString("")){
             isObjectUpdated = true; break;
         }
+        if(simd_path && *simd_path != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(cpu_features && *cpu_features != QString("")){
+            isObjectUpdated = true; break;
+        }
         if(logging && logging->isSet()){
             isObjectUpdated = true; break;
         }
@@ -68,6 +68,12 @@ public:
     QString* getOs();
     void setOs(QString* os);
 
+    QString* getSimdPath();
+    void setSimdPath(QString* simd_path);
+
+    QString* getCpuFeatures();
+    void setCpuFeatures(QString* cpu_features);
+
     SWGLoggingInfo* getLogging();
     void setLogging(SWGLoggingInfo* logging);
 
@@ -102,6 +108,12 @@ private:
     QString* os;
     bool m_os_isSet;
 
+    QString* simd_path;
+    bool m_simd_path_isSet;
+
+    QString* cpu_features;
+    bool m_cpu_features_isSet;
+
     SWGLoggingInfo* logging;
     bool m_logging_isSet;
 
@@ -52,14 +52,17 @@
 #include "SWGChannelAnalyzerSettings.h"
 #include "SWGChannelConfig.h"
 #include "SWGChannelListItem.h"
+#include "SWGChannelRecord.h"
 #include "SWGChannelReport.h"
 #include "SWGChannelSettings.h"
+#include "SWGChannelThreadPolicy.h"
 #include "SWGChannelsDetail.h"
 #include "SWGCommand.h"
 #include "SWGComplex.h"
 #include "SWGDATVDemodSettings.h"
 #include "SWGDSDDemodReport.h"
 #include "SWGDSDDemodSettings.h"
+#include "SWGDSPTelemetry.h"
 #include "SWGDVSerialDevice.h"
 #include "SWGDVSerialDevices.h"
 #include "SWGDeviceActions.h"
@@ -68,6 +71,7 @@
 #include "SWGDeviceReport.h"
 #include "SWGDeviceSet.h"
 #include "SWGDeviceSetList.h"
+#include "SWGDeviceSetThreading.h"
 #include "SWGDeviceSettings.h"
 #include "SWGDeviceState.h"
 #include "SWGErrorResponse.h"
@@ -75,6 +79,8 @@
 #include "SWGFCDProPlusActions.h"
 #include "SWGFCDProPlusSettings.h"
 #include "SWGFCDProSettings.h"
+#include "SWGFifoCounters.h"
+#include "SWGFileInputActions.h"
 #include "SWGFileInputReport.h"
 #include "SWGFileInputSettings.h"
 #include "SWGFileSourceActions.h"
@@ -172,9 +178,12 @@
 #include "SWGSoapySDRInputSettings.h"
 #include "SWGSoapySDROutputSettings.h"
 #include "SWGSoapySDRReport.h"
+#include "SWGSpectrumStream.h"
+#include "SWGSpectrumZoom.h"
 #include "SWGSuccessResponse.h"
 #include "SWGTestSourceActions.h"
 #include "SWGTestSourceSettings.h"
+#include "SWGThreadPolicy.h"
 #include "SWGTraceData.h"
 #include "SWGTriggerData.h"
 #include "SWGUDPSinkReport.h"
@@ -308,12 +317,18 @@ namespace SWGSDRangel {
     if(QString("SWGChannelListItem").compare(type) == 0) {
       return new SWGChannelListItem();
     }
+    if(QString("SWGChannelRecord").compare(type) == 0) {
+      return new SWGChannelRecord();
+    }
     if(QString("SWGChannelReport").compare(type) == 0) {
       return new SWGChannelReport();
     }
     if(QString("SWGChannelSettings").compare(type) == 0) {
       return new SWGChannelSettings();
     }
+    if(QString("SWGChannelThreadPolicy").compare(type) == 0) {
+      return new SWGChannelThreadPolicy();
+    }
     if(QString("SWGChannelsDetail").compare(type) == 0) {
       return new SWGChannelsDetail();
     }
@@ -332,6 +347,9 @@ namespace SWGSDRangel {
     if(QString("SWGDSDDemodSettings").compare(type) == 0) {
       return new SWGDSDDemodSettings();
     }
+    if(QString("SWGDSPTelemetry").compare(type) == 0) {
+      return new SWGDSPTelemetry();
+    }
     if(QString("SWGDVSerialDevice").compare(type) == 0) {
       return new SWGDVSerialDevice();
     }
@@ -356,6 +374,9 @@ namespace SWGSDRangel {
     if(QString("SWGDeviceSetList").compare(type) == 0) {
       return new SWGDeviceSetList();
     }
+    if(QString("SWGDeviceSetThreading").compare(type) == 0) {
+      return new SWGDeviceSetThreading();
+    }
     if(QString("SWGDeviceSettings").compare(type) == 0) {
       return new SWGDeviceSettings();
     }
@@ -377,6 +398,12 @@ namespace SWGSDRangel {
     if(QString("SWGFCDProSettings").compare(type) == 0) {
       return new SWGFCDProSettings();
     }
+    if(QString("SWGFifoCounters").compare(type) == 0) {
+      return new SWGFifoCounters();
+    }
+    if(QString("SWGFileInputActions").compare(type) == 0) {
+      return new SWGFileInputActions();
+    }
     if(QString("SWGFileInputReport").compare(type) == 0) {
       return new SWGFileInputReport();
     }
@@ -668,6 +695,12 @@ namespace SWGSDRangel {
     if(QString("SWGSoapySDRReport").compare(type) == 0) {
       return new SWGSoapySDRReport();
     }
+    if(QString("SWGSpectrumStream").compare(type) == 0) {
+      return new SWGSpectrumStream();
+    }
+    if(QString("SWGSpectrumZoom").compare(type) == 0) {
+      return new SWGSpectrumZoom();
+    }
     if(QString("SWGSuccessResponse").compare(type) == 0) {
       return new SWGSuccessResponse();
     }
@@ -677,6 +710,9 @@ namespace SWGSDRangel {
     if(QString("SWGTestSourceSettings").compare(type) == 0) {
       return new SWGTestSourceSettings();
     }
+    if(QString("SWGThreadPolicy").compare(type) == 0) {
+      return new SWGThreadPolicy();
+    }
     if(QString("SWGTraceData").compare(type) == 0) {
       return new SWGTraceData();
     }
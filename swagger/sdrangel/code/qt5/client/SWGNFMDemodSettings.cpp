@@ -60,6 +60,8 @@ SWGNFMDemodSettings::SWGNFMDemodSettings() {
     m_audio_device_name_isSet = false;
     stream_index = 0;
     m_stream_index_isSet = false;
+    shared_channelizer = 0;
+    m_shared_channelizer_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = nullptr;
@@ -110,6 +112,8 @@ SWGNFMDemodSettings::init() {
     m_audio_device_name_isSet = false;
     stream_index = 0;
     m_stream_index_isSet = false;
+    shared_channelizer = 0;
+    m_shared_channelizer_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = new QString("");
@@ -151,6 +155,7 @@ SWGNFMDemodSettings::cleanup() {
 
 
 
+
 }
 
 SWGNFMDemodSettings*
@@ -196,6 +201,8 @@ SWGNFMDemodSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&stream_index, pJson["streamIndex"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&shared_channelizer, pJson["sharedChannelizer"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&use_reverse_api, pJson["useReverseAPI"], "qint32", "");
     
     ::SWGSDRangel::setValue(&reverse_api_address, pJson["reverseAPIAddress"], "QString", "QString");
@@ -270,6 +277,9 @@ SWGNFMDemodSettings::asJsonObject() {
     if(m_stream_index_isSet){
         obj->insert("streamIndex", QJsonValue(stream_index));
     }
+    if(m_shared_channelizer_isSet){
+        obj->insert("sharedChannelizer", QJsonValue(shared_channelizer));
+    }
     if(m_use_reverse_api_isSet){
         obj->insert("useReverseAPI", QJsonValue(use_reverse_api));
     }
@@ -449,6 +459,16 @@ SWGNFMDemodSettings::setStreamIndex(qint32 stream_index) {
     this->m_stream_index_isSet = true;
 }
 
+qint32
+SWGNFMDemodSettings::getSharedChannelizer() {
+    return shared_channelizer;
+}
+void
+SWGNFMDemodSettings::setSharedChannelizer(qint32 shared_channelizer) {
+    this->shared_channelizer = shared_channelizer;
+    this->m_shared_channelizer_isSet = true;
+}
+
 qint32
 SWGNFMDemodSettings::getUseReverseApi() {
     return use_reverse_api;
@@ -552,6 +572,9 @@ SWGNFMDemodSettings::isSet(){
         if(m_stream_index_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_shared_channelizer_isSet){
+            isObjectUpdated = true; break;
+        }
         if(m_use_reverse_api_isSet){
             isObjectUpdated = true; break;
         }
@@ -90,6 +90,9 @@ public:
     qint32 getStreamIndex();
     void setStreamIndex(qint32 stream_index);
 
+    qint32 getSharedChannelizer();
+    void setSharedChannelizer(qint32 shared_channelizer);
+
     qint32 getUseReverseApi();
     void setUseReverseApi(qint32 use_reverse_api);
 
@@ -157,6 +160,9 @@ private:
     qint32 stream_index;
     bool m_stream_index_isSet;
 
+    qint32 shared_channelizer;
+    bool m_shared_channelizer_isSet;
+
     qint32 use_reverse_api;
     bool m_use_reverse_api_isSet;
 
@@ -0,0 +1,526 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.14.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGSpectrumStream.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGSpectrumStream::SWGSpectrumStream(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGSpectrumStream::SWGSpectrumStream() {
+    ws_enable = 0;
+    m_ws_enable_isSet = false;
+    ws_address = nullptr;
+    m_ws_address_isSet = false;
+    ws_port = 0;
+    m_ws_port_isSet = false;
+    ws_clients = 0;
+    m_ws_clients_isSet = false;
+    udp_enable = 0;
+    m_udp_enable_isSet = false;
+    udp_address = nullptr;
+    m_udp_address_isSet = false;
+    udp_port = 0;
+    m_udp_port_isSet = false;
+    max_frame_rate = 0.0f;
+    m_max_frame_rate_isSet = false;
+    max_bins = 0;
+    m_max_bins_isSet = false;
+    ref_level = 0.0f;
+    m_ref_level_isSet = false;
+    power_range = 0.0f;
+    m_power_range_isSet = false;
+    fft_size = 0;
+    m_fft_size_isSet = false;
+    fft_overlap = 0;
+    m_fft_overlap_isSet = false;
+    fft_window = 0;
+    m_fft_window_isSet = false;
+    averaging_mode = 0;
+    m_averaging_mode_isSet = false;
+    averaging_nb = 0;
+    m_averaging_nb_isSet = false;
+    linear = 0;
+    m_linear_isSet = false;
+    frame_rate = 0;
+    m_frame_rate_isSet = false;
+    frame_aggregation = 0;
+    m_frame_aggregation_isSet = false;
+}
+
+SWGSpectrumStream::~SWGSpectrumStream() {
+    this->cleanup();
+}
+
+void
+SWGSpectrumStream::init() {
+    ws_enable = 0;
+    m_ws_enable_isSet = false;
+    ws_address = new QString("");
+    m_ws_address_isSet = false;
+    ws_port = 0;
+    m_ws_port_isSet = false;
+    ws_clients = 0;
+    m_ws_clients_isSet = false;
+    udp_enable = 0;
+    m_udp_enable_isSet = false;
+    udp_address = new QString("");
+    m_udp_address_isSet = false;
+    udp_port = 0;
+    m_udp_port_isSet = false;
+    max_frame_rate = 0.0f;
+    m_max_frame_rate_isSet = false;
+    max_bins = 0;
+    m_max_bins_isSet = false;
+    ref_level = 0.0f;
+    m_ref_level_isSet = false;
+    power_range = 0.0f;
+    m_power_range_isSet = false;
+    fft_size = 0;
+    m_fft_size_isSet = false;
+    fft_overlap = 0;
+    m_fft_overlap_isSet = false;
+    fft_window = 0;
+    m_fft_window_isSet = false;
+    averaging_mode = 0;
+    m_averaging_mode_isSet = false;
+    averaging_nb = 0;
+    m_averaging_nb_isSet = false;
+    linear = 0;
+    m_linear_isSet = false;
+    frame_rate = 0;
+    m_frame_rate_isSet = false;
+    frame_aggregation = 0;
+    m_frame_aggregation_isSet = false;
+}
+
+void
+SWGSpectrumStream::cleanup() {
+
+    if(ws_address != nullptr) { 
+        delete ws_address;
+    }
+
+
+
+    if(udp_address != nullptr) { 
+        delete udp_address;
+    }
+
+
+
+
+
+
+
+
+
+
+
+
+
+}
+
+SWGSpectrumStream*
+SWGSpectrumStream::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGSpectrumStream::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&ws_enable, pJson["wsEnable"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&ws_address, pJson["wsAddress"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&ws_port, pJson["wsPort"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&ws_clients, pJson["wsClients"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&udp_enable, pJson["udpEnable"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&udp_address, pJson["udpAddress"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&udp_port, pJson["udpPort"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&max_frame_rate, pJson["maxFrameRate"], "float", "");
+    
+    ::SWGSDRangel::setValue(&max_bins, pJson["maxBins"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&ref_level, pJson["refLevel"], "float", "");
+    
+    ::SWGSDRangel::setValue(&power_range, pJson["powerRange"], "float", "");
+    
+    ::SWGSDRangel::setValue(&fft_size, pJson["fftSize"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fft_overlap, pJson["fftOverlap"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fft_window, pJson["fftWindow"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&averaging_mode, pJson["averagingMode"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&averaging_nb, pJson["averagingNb"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&linear, pJson["linear"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&frame_rate, pJson["frameRate"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&frame_aggregation, pJson["frameAggregation"], "qint32", "");
+    
+}
+
+QString
+SWGSpectrumStream::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGSpectrumStream::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_ws_enable_isSet){
+        obj->insert("wsEnable", QJsonValue(ws_enable));
+    }
+    if(ws_address != nullptr && *ws_address != QString("")){
+        toJsonValue(QString("wsAddress"), ws_address, obj, QString("QString"));
+    }
+    if(m_ws_port_isSet){
+        obj->insert("wsPort", QJsonValue(ws_port));
+    }
+    if(m_ws_clients_isSet){
+        obj->insert("wsClients", QJsonValue(ws_clients));
+    }
+    if(m_udp_enable_isSet){
+        obj->insert("udpEnable", QJsonValue(udp_enable));
+    }
+    if(udp_address != nullptr && *udp_address != QString("")){
+        toJsonValue(QString("udpAddress"), udp_address, obj, QString("QString"));
+    }
+    if(m_udp_port_isSet){
+        obj->insert("udpPort", QJsonValue(udp_port));
+    }
+    if(m_max_frame_rate_isSet){
+        obj->insert("maxFrameRate", QJsonValue(max_frame_rate));
+    }
+    if(m_max_bins_isSet){
+        obj->insert("maxBins", QJsonValue(max_bins));
+    }
+    if(m_ref_level_isSet){
+        obj->insert("refLevel", QJsonValue(ref_level));
+    }
+    if(m_power_range_isSet){
+        obj->insert("powerRange", QJsonValue(power_range));
+    }
+    if(m_fft_size_isSet){
+        obj->insert("fftSize", QJsonValue(fft_size));
+    }
+    if(m_fft_overlap_isSet){
+        obj->insert("fftOverlap", QJsonValue(fft_overlap));
+    }
+    if(m_fft_window_isSet){
+        obj->insert("fftWindow", QJsonValue(fft_window));
+    }
+    if(m_averaging_mode_isSet){
+        obj->insert("averagingMode", QJsonValue(averaging_mode));
+    }
+    if(m_averaging_nb_isSet){
+        obj->insert("averagingNb", QJsonValue(averaging_nb));
+    }
+    if(m_linear_isSet){
+        obj->insert("linear", QJsonValue(linear));
+    }
+    if(m_frame_rate_isSet){
+        obj->insert("frameRate", QJsonValue(frame_rate));
+    }
+    if(m_frame_aggregation_isSet){
+        obj->insert("frameAggregation", QJsonValue(frame_aggregation));
+    }
+
+    return obj;
+}
+
+qint32
+SWGSpectrumStream::getWsEnable() {
+    return ws_enable;
+}
+void
+SWGSpectrumStream::setWsEnable(qint32 ws_enable) {
+    this->ws_enable = ws_enable;
+    this->m_ws_enable_isSet = true;
+}
+
+QString*
+SWGSpectrumStream::getWsAddress() {
+    return ws_address;
+}
+void
+SWGSpectrumStream::setWsAddress(QString* ws_address) {
+    this->ws_address = ws_address;
+    this->m_ws_address_isSet = true;
+}
+
+qint32
+SWGSpectrumStream::getWsPort() {
+    return ws_port;
+}
+void
+SWGSpectrumStream::setWsPort(qint32 ws_port) {
+    this->ws_port = ws_port;
+    this->m_ws_port_isSet = true;
+}
+
+qint32
+SWGSpectrumStream::getWsClients() {
+    return ws_clients;
+}
+void
+SWGSpectrumStream::setWsClients(qint32 ws_clients) {
+    this->ws_clients = ws_clients;
+    this->m_ws_clients_isSet = true;
+}
+
+qint32
+SWGSpectrumStream::getUdpEnable() {
+    return udp_enable;
+}
+void
+SWGSpectrumStream::setUdpEnable(qint32 udp_enable) {
+    this->udp_enable = udp_enable;
+    this->m_udp_enable_isSet = true;
+}
+
+QString*
+SWGSpectrumStream::getUdpAddress() {
+    return udp_address;
+}
+void
+SWGSpectrumStream::setUdpAddress(QString* udp_address) {
+    this->udp_address = udp_address;
+    this->m_udp_address_isSet = true;
+}
+
+qint32
+SWGSpectrumStream::getUdpPort() {
+    return udp_port;
+}
+void
+SWGSpectrumStream::setUdpPort(qint32 udp_port) {
+    this->udp_port = udp_port;
+    this->m_udp_port_isSet = true;
+}
+
+float
+SWGSpectrumStream::getMaxFrameRate() {
+    return max_frame_rate;
+}
+void
+SWGSpectrumStream::setMaxFrameRate(float max_frame_rate) {
+    this->max_frame_rate = max_frame_rate;
+    this->m_max_frame_rate_isSet = true;
+}
+
+qint32
+SWGSpectrumStream::getMaxBins() {
+    return max_bins;
+}
+void
+SWGSpectrumStream::setMaxBins(qint32 max_bins) {
+    this->max_bins = max_bins;
+    this->m_max_bins_isSet = true;
+}
+
+float
+SWGSpectrumStream::getRefLevel() {
+    return ref_level;
+}
+void
+SWGSpectrumStream::setRefLevel(float ref_level) {
+    this->ref_level = ref_level;
+    this->m_ref_level_isSet = true;
+}
+
+float
+SWGSpectrumStream::getPowerRange() {
+    return power_range;
+}
+void
+SWGSpectrumStream::setPowerRange(float power_range) {
+    this->power_range = power_range;
+    this->m_power_range_isSet = true;
+}
+
+qint32
+SWGSpectrumStream::getFftSize() {
+    return fft_size;
+}
+void
+SWGSpectrumStream::setFftSize(qint32 fft_size) {
+    this->fft_size = fft_size;
+    this->m_fft_size_isSet = true;
+}
+
+qint32
+SWGSpectrumStream::getFftOverlap() {
+    return fft_overlap;
+}
+void
+SWGSpectrumStream::setFftOverlap(qint32 fft_overlap) {
+    this->fft_overlap = fft_overlap;
+    this->m_fft_overlap_isSet = true;
+}
+
+qint32
+SWGSpectrumStream::getFftWindow() {
+    return fft_window;
+}
+void
+SWGSpectrumStream::setFftWindow(qint32 fft_window) {
+    this->fft_window = fft_window;
+    this->m_fft_window_isSet = true;
+}
+
+qint32
+SWGSpectrumStream::getAveragingMode() {
+    return averaging_mode;
+}
+void
+SWGSpectrumStream::setAveragingMode(qint32 averaging_mode) {
+    this->averaging_mode = averaging_mode;
+    this->m_averaging_mode_isSet = true;
+}
+
+qint32
+SWGSpectrumStream::getAveragingNb() {
+    return averaging_nb;
+}
+void
+SWGSpectrumStream::setAveragingNb(qint32 averaging_nb) {
+    this->averaging_nb = averaging_nb;
+    this->m_averaging_nb_isSet = true;
+}
+
+qint32
+SWGSpectrumStream::getLinear() {
+    return linear;
+}
+void
+SWGSpectrumStream::setLinear(qint32 linear) {
+    this->linear = linear;
+    this->m_linear_isSet = true;
+}
+
+qint32
+SWGSpectrumStream::getFrameRate() {
+    return frame_rate;
+}
+void
+SWGSpectrumStream::setFrameRate(qint32 frame_rate) {
+    this->frame_rate = frame_rate;
+    this->m_frame_rate_isSet = true;
+}
+
+qint32
+SWGSpectrumStream::getFrameAggregation() {
+    return frame_aggregation;
+}
+void
+SWGSpectrumStream::setFrameAggregation(qint32 frame_aggregation) {
+    this->frame_aggregation = frame_aggregation;
+    this->m_frame_aggregation_isSet = true;
+}
+
+
+bool
+SWGSpectrumStream::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_ws_enable_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(ws_address && *ws_address != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_ws_port_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_ws_clients_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_udp_enable_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(udp_address && *udp_address != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_udp_port_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_max_frame_rate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_max_bins_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_ref_level_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_power_range_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fft_size_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fft_overlap_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fft_window_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_averaging_mode_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_averaging_nb_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_linear_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_frame_rate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_frame_aggregation_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,167 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.14.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGSpectrumStream.h
+ *
+ * Streaming of the device set spectrum to remote clients
+ */
+
+#ifndef SWGSpectrumStream_H_
+#define SWGSpectrumStream_H_
+
+#include <QJsonObject>
+
+
+#include <QString>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGSpectrumStream: public SWGObject {
+public:
+    SWGSpectrumStream();
+    SWGSpectrumStream(QString* json);
+    virtual ~SWGSpectrumStream();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGSpectrumStream* fromJson(QString &jsonString) override;
+
+    qint32 getWsEnable();
+    void setWsEnable(qint32 ws_enable);
+
+    QString* getWsAddress();
+    void setWsAddress(QString* ws_address);
+
+    qint32 getWsPort();
+    void setWsPort(qint32 ws_port);
+
+    qint32 getWsClients();
+    void setWsClients(qint32 ws_clients);
+
+    qint32 getUdpEnable();
+    void setUdpEnable(qint32 udp_enable);
+
+    QString* getUdpAddress();
+    void setUdpAddress(QString* udp_address);
+
+    qint32 getUdpPort();
+    void setUdpPort(qint32 udp_port);
+
+    float getMaxFrameRate();
+    void setMaxFrameRate(float max_frame_rate);
+
+    qint32 getMaxBins();
+    void setMaxBins(qint32 max_bins);
+
+    float getRefLevel();
+    void setRefLevel(float ref_level);
+
+    float getPowerRange();
+    void setPowerRange(float power_range);
+
+    qint32 getFftSize();
+    void setFftSize(qint32 fft_size);
+
+    qint32 getFftOverlap();
+    void setFftOverlap(qint32 fft_overlap);
+
+    qint32 getFftWindow();
+    void setFftWindow(qint32 fft_window);
+
+    qint32 getAveragingMode();
+    void setAveragingMode(qint32 averaging_mode);
+
+    qint32 getAveragingNb();
+    void setAveragingNb(qint32 averaging_nb);
+
+    qint32 getLinear();
+    void setLinear(qint32 linear);
+
+    qint32 getFrameRate();
+    void setFrameRate(qint32 frame_rate);
+
+    qint32 getFrameAggregation();
+    void setFrameAggregation(qint32 frame_aggregation);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 ws_enable;
+    bool m_ws_enable_isSet;
+
+    QString* ws_address;
+    bool m_ws_address_isSet;
+
+    qint32 ws_port;
+    bool m_ws_port_isSet;
+
+    qint32 ws_clients;
+    bool m_ws_clients_isSet;
+
+    qint32 udp_enable;
+    bool m_udp_enable_isSet;
+
+    QString* udp_address;
+    bool m_udp_address_isSet;
+
+    qint32 udp_port;
+    bool m_udp_port_isSet;
+
+    float max_frame_rate;
+    bool m_max_frame_rate_isSet;
+
+    qint32 max_bins;
+    bool m_max_bins_isSet;
+
+    float ref_level;
+    bool m_ref_level_isSet;
+
+    float power_range;
+    bool m_power_range_isSet;
+
+    qint32 fft_size;
+    bool m_fft_size_isSet;
+
+    qint32 fft_overlap;
+    bool m_fft_overlap_isSet;
+
+    qint32 fft_window;
+    bool m_fft_window_isSet;
+
+    qint32 averaging_mode;
+    bool m_averaging_mode_isSet;
+
+    qint32 averaging_nb;
+    bool m_averaging_nb_isSet;
+
+    qint32 linear;
+    bool m_linear_isSet;
+
+    qint32 frame_rate;
+    bool m_frame_rate_isSet;
+
+    qint32 frame_aggregation;
+    bool m_frame_aggregation_isSet;
+
+};
+
+}
+
+#endif /* SWGSpectrumStream_H_ */
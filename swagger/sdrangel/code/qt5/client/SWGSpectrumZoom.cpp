@@ -0,0 +1,226 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.14.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+
+#include "SWGSpectrumZoom.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGSpectrumZoom::SWGSpectrumZoom(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGSpectrumZoom::SWGSpectrumZoom() {
+    enable = 0;
+    m_enable_isSet = false;
+    center_frequency_offset = 0L;
+    m_center_frequency_offset_isSet = false;
+    span = 0;
+    m_span_isSet = false;
+    zoom_center_frequency_offset = 0L;
+    m_zoom_center_frequency_offset_isSet = false;
+    zoom_span = 0;
+    m_zoom_span_isSet = false;
+    stream = nullptr;
+    m_stream_isSet = false;
+}
+
+SWGSpectrumZoom::~SWGSpectrumZoom() {
+    this->cleanup();
+}
+
+void
+SWGSpectrumZoom::init() {
+    enable = 0;
+    m_enable_isSet = false;
+    center_frequency_offset = 0L;
+    m_center_frequency_offset_isSet = false;
+    span = 0;
+    m_span_isSet = false;
+    zoom_center_frequency_offset = 0L;
+    m_zoom_center_frequency_offset_isSet = false;
+    zoom_span = 0;
+    m_zoom_span_isSet = false;
+    stream = new SWGSpectrumStream();
+    m_stream_isSet = false;
+}
+
+void
+SWGSpectrumZoom::cleanup() {
+
+
+
+
+
+    if(stream != nullptr) { 
+        delete stream;
+    }
+}
+
+SWGSpectrumZoom*
+SWGSpectrumZoom::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGSpectrumZoom::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&enable, pJson["enable"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&center_frequency_offset, pJson["centerFrequencyOffset"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&span, pJson["span"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&zoom_center_frequency_offset, pJson["zoomCenterFrequencyOffset"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&zoom_span, pJson["zoomSpan"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&stream, pJson["stream"], "SWGSpectrumStream", "SWGSpectrumStream");
+    
+}
+
+QString
+SWGSpectrumZoom::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGSpectrumZoom::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_enable_isSet){
+        obj->insert("enable", QJsonValue(enable));
+    }
+    if(m_center_frequency_offset_isSet){
+        obj->insert("centerFrequencyOffset", QJsonValue(center_frequency_offset));
+    }
+    if(m_span_isSet){
+        obj->insert("span", QJsonValue(span));
+    }
+    if(m_zoom_center_frequency_offset_isSet){
+        obj->insert("zoomCenterFrequencyOffset", QJsonValue(zoom_center_frequency_offset));
+    }
+    if(m_zoom_span_isSet){
+        obj->insert("zoomSpan", QJsonValue(zoom_span));
+    }
+    if((stream != nullptr) && (stream->isSet())){
+        toJsonValue(QString("stream"), stream, obj, QString("SWGSpectrumStream"));
+    }
+
+    return obj;
+}
+
+qint32
+SWGSpectrumZoom::getEnable() {
+    return enable;
+}
+void
+SWGSpectrumZoom::setEnable(qint32 enable) {
+    this->enable = enable;
+    this->m_enable_isSet = true;
+}
+
+qint64
+SWGSpectrumZoom::getCenterFrequencyOffset() {
+    return center_frequency_offset;
+}
+void
+SWGSpectrumZoom::setCenterFrequencyOffset(qint64 center_frequency_offset) {
+    this->center_frequency_offset = center_frequency_offset;
+    this->m_center_frequency_offset_isSet = true;
+}
+
+qint32
+SWGSpectrumZoom::getSpan() {
+    return span;
+}
+void
+SWGSpectrumZoom::setSpan(qint32 span) {
+    this->span = span;
+    this->m_span_isSet = true;
+}
+
+qint64
+SWGSpectrumZoom::getZoomCenterFrequencyOffset() {
+    return zoom_center_frequency_offset;
+}
+void
+SWGSpectrumZoom::setZoomCenterFrequencyOffset(qint64 zoom_center_frequency_offset) {
+    this->zoom_center_frequency_offset = zoom_center_frequency_offset;
+    this->m_zoom_center_frequency_offset_isSet = true;
+}
+
+qint32
+SWGSpectrumZoom::getZoomSpan() {
+    return zoom_span;
+}
+void
+SWGSpectrumZoom::setZoomSpan(qint32 zoom_span) {
+    this->zoom_span = zoom_span;
+    this->m_zoom_span_isSet = true;
+}
+
+SWGSpectrumStream*
+SWGSpectrumZoom::getStream() {
+    return stream;
+}
+void
+SWGSpectrumZoom::setStream(SWGSpectrumStream* stream) {
+    this->stream = stream;
+    this->m_stream_isSet = true;
+}
+
+
+bool
+SWGSpectrumZoom::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_enable_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_center_frequency_offset_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_span_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_zoom_center_frequency_offset_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_zoom_span_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(stream && stream->isSet()){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,90 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.14.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+/*
+ * SWGSpectrumZoom.h
+ *
+ * Spectrum of a narrow span of the Rx device set baseband with its own FFT and streaming
+ */
+
+#ifndef SWGSpectrumZoom_H_
+#define SWGSpectrumZoom_H_
+
+#include <QJsonObject>
+
+
+#include "SWGSpectrumStream.h"
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGSpectrumZoom: public SWGObject {
+public:
+    SWGSpectrumZoom();
+    SWGSpectrumZoom(QString* json);
+    virtual ~SWGSpectrumZoom();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGSpectrumZoom* fromJson(QString &jsonString) override;
+
+    qint32 getEnable();
+    void setEnable(qint32 enable);
+
+    qint64 getCenterFrequencyOffset();
+    void setCenterFrequencyOffset(qint64 center_frequency_offset);
+
+    qint32 getSpan();
+    void setSpan(qint32 span);
+
+    qint64 getZoomCenterFrequencyOffset();
+    void setZoomCenterFrequencyOffset(qint64 zoom_center_frequency_offset);
+
+    qint32 getZoomSpan();
+    void setZoomSpan(qint32 zoom_span);
+
+    SWGSpectrumStream* getStream();
+    void setStream(SWGSpectrumStream* stream);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 enable;
+    bool m_enable_isSet;
+
+    qint64 center_frequency_offset;
+    bool m_center_frequency_offset_isSet;
+
+    qint32 span;
+    bool m_span_isSet;
+
+    qint64 zoom_center_frequency_offset;
+    bool m_zoom_center_frequency_offset_isSet;
+
+    qint32 zoom_span;
+    bool m_zoom_span_isSet;
+
+    SWGSpectrumStream* stream;
+    bool m_stream_isSet;
+
+};
+
+}
+
+#endif /* SWGSpectrumZoom_H_ */
@@ -0,0 +1,179 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.14.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGThreadPolicy.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGThreadPolicy::SWGThreadPolicy(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGThreadPolicy::SWGThreadPolicy() {
+    scheduling = 0;
+    m_scheduling_isSet = false;
+    priority = 0;
+    m_priority_isSet = false;
+    nice = 0;
+    m_nice_isSet = false;
+    cpus = nullptr;
+    m_cpus_isSet = false;
+}
+
+SWGThreadPolicy::~SWGThreadPolicy() {
+    this->cleanup();
+}
+
+void
+SWGThreadPolicy::init() {
+    scheduling = 0;
+    m_scheduling_isSet = false;
+    priority = 0;
+    m_priority_isSet = false;
+    nice = 0;
+    m_nice_isSet = false;
+    cpus = new QString("");
+    m_cpus_isSet = false;
+}
+
+void
+SWGThreadPolicy::cleanup() {
+
+
+
+    if(cpus != nullptr) { 
+        delete cpus;
+    }
+}
+
+SWGThreadPolicy*
+SWGThreadPolicy::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGThreadPolicy::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&scheduling, pJson["scheduling"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&priority, pJson["priority"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&nice, pJson["nice"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&cpus, pJson["cpus"], "QString", "QString");
+    
+}
+
+QString
+SWGThreadPolicy::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGThreadPolicy::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_scheduling_isSet){
+        obj->insert("scheduling", QJsonValue(scheduling));
+    }
+    if(m_priority_isSet){
+        obj->insert("priority", QJsonValue(priority));
+    }
+    if(m_nice_isSet){
+        obj->insert("nice", QJsonValue(nice));
+    }
+    if(cpus != nullptr && *cpus != QString("")){
+        toJsonValue(QString("cpus"), cpus, obj, QString("QString"));
+    }
+
+    return obj;
+}
+
+qint32
+SWGThreadPolicy::getScheduling() {
+    return scheduling;
+}
+void
+SWGThreadPolicy::setScheduling(qint32 scheduling) {
+    this->scheduling = scheduling;
+    this->m_scheduling_isSet = true;
+}
+
+qint32
+SWGThreadPolicy::getPriority() {
+    return priority;
+}
+void
+SWGThreadPolicy::setPriority(qint32 priority) {
+    this->priority = priority;
+    this->m_priority_isSet = true;
+}
+
+qint32
+SWGThreadPolicy::getNice() {
+    return nice;
+}
+void
+SWGThreadPolicy::setNice(qint32 nice) {
+    this->nice = nice;
+    this->m_nice_isSet = true;
+}
+
+QString*
+SWGThreadPolicy::getCpus() {
+    return cpus;
+}
+void
+SWGThreadPolicy::setCpus(QString* cpus) {
+    this->cpus = cpus;
+    this->m_cpus_isSet = true;
+}
+
+
+bool
+SWGThreadPolicy::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_scheduling_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_priority_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_nice_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(cpus && *cpus != QString("")){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+